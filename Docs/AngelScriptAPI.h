@@ -11065,7 +11065,6 @@ bool GetInterceptNetworkUpdate(const String&) const;
 TileMapObject2D GetObject(uint) const;
 Node GetObjectNode(uint) const;
 Tile2D GetTile(int, int) const;
-Node GetTileNode(int, int) const;
 bool HasProperty(const String&) const;
 bool Load(File, bool = false);
 bool Load(VectorBuffer&, bool = false);
@@ -11083,6 +11082,7 @@ void SetAttributeAnimation(const String&, ValueAnimation, WrapMode = WM_LOOP, fl
 void SetAttributeAnimationSpeed(const String&, float);
 void SetAttributeAnimationWrapMode(const String&, WrapMode);
 void SetInterceptNetworkUpdate(const String&, bool);
+void SetTile(int, int, Tile2D);
 const String& GetProperty(const String&) const;
 
 // Properties:
@@ -133,8 +133,13 @@ void AnimatingScene::CreateInstructions()
     
     // Construct new Text object, set string to display and font to use
     Text* instructionText = ui->GetRoot()->CreateChild<Text>();
-    instructionText->SetText("Use WASD keys and mouse/touch to move");
+    instructionText->SetText(
+        "Use WASD keys and mouse/touch to move\n"
+        "P to toggle parallel update of the rotators"
+    );
     instructionText->SetFont(cache->GetResource<Font>("Fonts/Anonymous Pro.ttf"), 15);
+    // The text has multiple rows. Center them in relation to each other
+    instructionText->SetTextAlignment(HA_CENTER);
     
     // Position the text relative to the screen center
     instructionText->SetHorizontalAlignment(HA_CENTER);
@@ -188,6 +193,16 @@ void AnimatingScene::MoveCamera(float timeStep)
         cameraNode_->Translate(Vector3::LEFT * MOVE_SPEED * timeStep);
     if (input->GetKeyDown('D'))
         cameraNode_->Translate(Vector3::RIGHT * MOVE_SPEED * timeStep);
+
+    // Toggle parallel update of the rotators with P. The time taken by the serial and parallel logic updates can be compared
+    // in the profiler of the debug HUD (F2)
+    if (input->GetKeyPress('P'))
+    {
+        PODVector<Rotator*> rotators;
+        scene_->GetComponents<Rotator>(rotators, true);
+        for (unsigned i = 0; i < rotators.Size(); ++i)
+            rotators[i]->SetParallelUpdate(!rotators[i]->GetParallelUpdate());
+    }
 }
 
 void AnimatingScene::HandleUpdate(StringHash eventType, VariantMap& eventData)
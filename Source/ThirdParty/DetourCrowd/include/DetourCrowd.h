@@ -198,6 +198,39 @@ struct dtCrowdAgentDebugInfo
 	dtObstacleAvoidanceDebugData* vod;
 };
 
+class dtCrowd;
+struct dtCrowdThreadData;
+struct dtCrowdAgentSortItem;
+
+/// Urho3D: The per-agent phases of #dtCrowd::update that can be processed in parallel.
+/// @ingroup crowd
+enum dtCrowdUpdatePhase
+{
+	DT_CROWD_PHASE_NEIGHBOURS = 0,			///< Update the collision boundary and neighbours.
+	DT_CROWD_PHASE_CORNERS,					///< Find the corners to steer to.
+	DT_CROWD_PHASE_STEERING,				///< Calculate the desired velocity.
+	DT_CROWD_PHASE_VELOCITY_PLANNING,		///< Sample the new safe velocity (local avoidance).
+	DT_CROWD_PHASE_INTEGRATE,				///< Integrate the velocity.
+	DT_CROWD_PHASE_COLLISION_DISPLACEMENT,	///< Calculate the collision displacement.
+	DT_CROWD_PHASE_COLLISION_APPLY,			///< Apply the collision displacement.
+	DT_CROWD_PHASE_MOVE,					///< Move the agents along the navigation mesh.
+};
+
+/// Urho3D: Distributes the per-agent phases of #dtCrowd::update to multiple threads.
+/// @ingroup crowd
+class dtCrowdParallelDispatcher
+{
+public:
+	virtual ~dtCrowdParallelDispatcher() {}
+
+	/// Processes the phase for all active agents by calling #dtCrowd::updateAgentRange for disjoint ranges
+	/// covering [0, @p nagents). Must not return before all ranges have been processed.
+	///  @param[in]		crowd		The crowd being updated.
+	///  @param[in]		phase		The update phase. (See: #dtCrowdUpdatePhase)
+	///  @param[in]		nagents		The number of active agents.
+	virtual void dispatch(dtCrowd* crowd, const int phase, const int nagents) = 0;
+};
+
 /// Provides local steering behaviors for a group of agents. 
 /// @ingroup crowd
 class dtCrowd
@@ -227,6 +260,15 @@ class dtCrowd
 
 	dtNavMeshQuery* m_navquery;
 
+	// Urho3D: state for processing the per-agent update phases in parallel.
+	dtCrowdParallelDispatcher* m_dispatcher;
+	int m_maxThreads;
+	dtCrowdThreadData* m_threadData;
+	dtCrowdAgentSortItem* m_sortItems;
+	int m_updateAgentCount;
+	float m_updateDt;
+	dtCrowdAgentDebugInfo* m_updateDebug;
+
 	void updateTopologyOptimization(dtCrowdAgent** agents, const int nagents, const float dt);
 	void updateMoveRequest(const float dt);
 	void checkPathValidity(dtCrowdAgent** agents, const int nagents, const float dt);
@@ -236,6 +278,11 @@ class dtCrowd
 	bool requestMoveTargetReplan(const int idx, dtPolyRef ref, const float* pos);
 
 	void purge();
+
+	// Urho3D: helpers for the parallel update.
+	void freeThreadData();
+	void sortAgentsSpatially(dtCrowdAgent** agents, const int nagents);
+	void runAgentPhase(const int phase, const int nagents);
 	
 public:
 	dtCrowd();
@@ -316,6 +363,21 @@ public:
 	///  @param[in]		dt		The time, in seconds, to update the simulation. [Limit: > 0]
 	///  @param[out]	debug	A debug object to load with debug information. [Opt]
 	void update(const float dt, dtCrowdAgentDebugInfo* debug);
+
+	/// Urho3D: Sets the dispatcher used to process the per-agent update phases in parallel. Allocates
+	/// query objects for each thread. Must be called again after #init.
+	///  @param[in]		dispatcher	The dispatcher, or null to update serially.
+	///  @param[in]		maxThreads	The number of threads the dispatcher may use, including the calling thread.
+	/// @return True if the per-thread data could be allocated.
+	bool setParallelDispatcher(dtCrowdParallelDispatcher* dispatcher, const int maxThreads);
+
+	/// Urho3D: Processes a range of the active agents for one update phase. Called by the dispatcher
+	/// during #update, possibly from multiple threads at once.
+	///  @param[in]		phase		The update phase. (See: #dtCrowdUpdatePhase)
+	///  @param[in]		begin		The first active agent to process.
+	///  @param[in]		end			One past the last active agent to process.
+	///  @param[in]		threadIndex	The index of the calling thread. [Limits: 0 <= value < maxThreads]
+	void updateAgentRange(const int phase, const int begin, const int end, const int threadIndex);
 	
 	/// Gets the filter used by the crowd.
 	/// @return The filter used by the crowd.
@@ -342,7 +342,14 @@ dtCrowd::dtCrowd() :
 	m_maxPathResult(0),
 	m_maxAgentRadius(0),
 	m_velocitySampleCount(0),
-	m_navquery(0)
+	m_navquery(0),
+	m_dispatcher(0),
+	m_maxThreads(1),
+	m_threadData(0),
+	m_sortItems(0),
+	m_updateAgentCount(0),
+	m_updateDt(0),
+	m_updateDebug(0)
 {
 }
 
@@ -353,6 +360,9 @@ dtCrowd::~dtCrowd()
 
 void dtCrowd::purge()
 {
+	// Urho3D: free the per-thread query objects before the crowd's own
+	freeThreadData();
+
 	for (int i = 0; i < m_maxAgents; ++i)
 		m_agents[i].~dtCrowdAgent();
 	dtFree(m_agents);
@@ -1047,377 +1057,585 @@ void dtCrowd::checkPathValidity(dtCrowdAgent** agents, const int nagents, const
 	}
 }
 	
-void dtCrowd::update(const float dt, dtCrowdAgentDebugInfo* debug)
+// Urho3D: per-thread query objects used while the per-agent update phases run in parallel.
+struct dtCrowdThreadData
 {
-	m_velocitySampleCount = 0;
-	
-	const int debugIdx = debug ? debug->idx : -1;
-	
-	dtCrowdAgent** agents = m_activeAgents;
-	int nagents = getActiveAgents(agents, m_maxAgents);
+	dtNavMeshQuery* navquery;
+	dtObstacleAvoidanceQuery* obstacleQuery;
+	int velocitySampleCount;
+};
 
-	// Check that all agents still have valid paths.
-	checkPathValidity(agents, nagents, dt);
-	
-	// Update async move request and path finder.
-	updateMoveRequest(dt);
+// Urho3D: active agent sorted by its proximity grid cell.
+struct dtCrowdAgentSortItem
+{
+	unsigned int key;
+	dtCrowdAgent* agent;
+};
 
-	// Optimize path topology.
-	updateTopologyOptimization(agents, nagents, dt);
-	
-	// Register agents to proximity grid.
-	m_grid->clear();
-	for (int i = 0; i < nagents; ++i)
+static unsigned int spreadBits(unsigned int v)
+{
+	v &= 0xffff;
+	v = (v | (v << 8)) & 0x00ff00ff;
+	v = (v | (v << 4)) & 0x0f0f0f0f;
+	v = (v | (v << 2)) & 0x33333333;
+	v = (v | (v << 1)) & 0x55555555;
+	return v;
+}
+
+static int compareAgentSortItems(const void* va, const void* vb)
+{
+	const dtCrowdAgentSortItem* a = (const dtCrowdAgentSortItem*)va;
+	const dtCrowdAgentSortItem* b = (const dtCrowdAgentSortItem*)vb;
+	if (a->key < b->key) return -1;
+	if (a->key > b->key) return 1;
+	// Keep the order stable between frames for agents in the same cell.
+	if (a->agent < b->agent) return -1;
+	if (a->agent > b->agent) return 1;
+	return 0;
+}
+
+bool dtCrowd::setParallelDispatcher(dtCrowdParallelDispatcher* dispatcher, const int maxThreads)
+{
+	freeThreadData();
+
+	if (!dispatcher || maxThreads < 2 || !m_navquery)
+		return true;
+
+	m_threadData = (dtCrowdThreadData*)dtAlloc(sizeof(dtCrowdThreadData)*maxThreads, DT_ALLOC_PERM);
+	if (!m_threadData)
+		return false;
+	memset(m_threadData, 0, sizeof(dtCrowdThreadData)*maxThreads);
+	m_maxThreads = maxThreads;
+
+	// Thread 0 is the calling thread, which uses the crowd's own query objects.
+	m_threadData[0].navquery = m_navquery;
+	m_threadData[0].obstacleQuery = m_obstacleQuery;
+	for (int i = 1; i < maxThreads; ++i)
 	{
-		dtCrowdAgent* ag = agents[i];
-		const float* p = ag->npos;
-		const float r = ag->params.radius;
-		m_grid->addItem((unsigned short)i, p[0]-r, p[2]-r, p[0]+r, p[2]+r);
+		dtCrowdThreadData& data = m_threadData[i];
+		data.navquery = dtAllocNavMeshQuery();
+		if (!data.navquery || dtStatusFailed(data.navquery->init(m_navquery->getAttachedNavMesh(), MAX_COMMON_NODES)))
+		{
+			freeThreadData();
+			return false;
+		}
+		data.obstacleQuery = dtAllocObstacleAvoidanceQuery();
+		if (!data.obstacleQuery || !data.obstacleQuery->init(6, 8))
+		{
+			freeThreadData();
+			return false;
+		}
 	}
-	
-	// Get nearby navmesh segments and agents to collide with.
-	for (int i = 0; i < nagents; ++i)
+
+	m_sortItems = (dtCrowdAgentSortItem*)dtAlloc(sizeof(dtCrowdAgentSortItem)*m_maxAgents, DT_ALLOC_PERM);
+	if (!m_sortItems)
 	{
-		dtCrowdAgent* ag = agents[i];
-		if (ag->state != DT_CROWDAGENT_STATE_WALKING)
-			continue;
+		freeThreadData();
+		return false;
+	}
+
+	m_dispatcher = dispatcher;
+	return true;
+}
 
-		// Update the collision boundary after certain distance has been passed or
-		// if it has become invalid.
-		const float updateThr = ag->params.collisionQueryRange*0.25f;
-		if (dtVdist2DSqr(ag->npos, ag->boundary.getCenter()) > dtSqr(updateThr) ||
-			!ag->boundary.isValid(m_navquery, &m_filters[ag->params.queryFilterType]))
+void dtCrowd::freeThreadData()
+{
+	if (m_threadData)
+	{
+		for (int i = 1; i < m_maxThreads; ++i)
 		{
-			ag->boundary.update(ag->corridor.getFirstPoly(), ag->npos, ag->params.collisionQueryRange,
-								m_navquery, &m_filters[ag->params.queryFilterType]);
+			dtFreeNavMeshQuery(m_threadData[i].navquery);
+			dtFreeObstacleAvoidanceQuery(m_threadData[i].obstacleQuery);
 		}
-		// Query neighbour agents
-		ag->nneis = getNeighbours(ag->npos, ag->params.height, ag->params.collisionQueryRange,
-								  ag, ag->neis, DT_CROWDAGENT_MAX_NEIGHBOURS,
-								  agents, nagents, m_grid);
-		for (int j = 0; j < ag->nneis; j++)
-			ag->neis[j].idx = getAgentIndex(agents[ag->neis[j].idx]);
+		dtFree(m_threadData);
+		m_threadData = 0;
 	}
-	
-	// Find next corner to steer to.
+	dtFree(m_sortItems);
+	m_sortItems = 0;
+	m_maxThreads = 1;
+	m_dispatcher = 0;
+}
+
+void dtCrowd::sortAgentsSpatially(dtCrowdAgent** agents, const int nagents)
+{
+	// Order the agents along a Z-order curve of the proximity grid cells, so that the ranges handed out to
+	// the threads are spatially coherent and neighbour lookups touch mostly the same agents.
+	const float invCellSize = 1.0f / m_grid->getCellSize();
 	for (int i = 0; i < nagents; ++i)
 	{
-		dtCrowdAgent* ag = agents[i];
-		
-		if (ag->state != DT_CROWDAGENT_STATE_WALKING)
-			continue;
-		if (ag->targetState == DT_CROWDAGENT_TARGET_NONE || ag->targetState == DT_CROWDAGENT_TARGET_VELOCITY)
-			continue;
-		
-		// Find corners for steering
-		ag->ncorners = ag->corridor.findCorners(ag->cornerVerts, ag->cornerFlags, ag->cornerPolys,
-												DT_CROWDAGENT_MAX_CORNERS, m_navquery, &m_filters[ag->params.queryFilterType]);
-		
-		// Check to see if the corner after the next corner is directly visible,
-		// and short cut to there.
-		if ((ag->params.updateFlags & DT_CROWD_OPTIMIZE_VIS) && ag->ncorners > 0)
-		{
-			const float* target = &ag->cornerVerts[dtMin(1,ag->ncorners-1)*3];
-			ag->corridor.optimizePathVisibility(target, ag->params.pathOptimizationRange, m_navquery, &m_filters[ag->params.queryFilterType]);
-			
-			// Copy data for debug purposes.
-			if (debugIdx == i)
-			{
-				dtVcopy(debug->optStart, ag->corridor.getPos());
-				dtVcopy(debug->optEnd, target);
-			}
-		}
-		else
-		{
-			// Copy data for debug purposes.
-			if (debugIdx == i)
-			{
-				dtVset(debug->optStart, 0,0,0);
-				dtVset(debug->optEnd, 0,0,0);
-			}
-		}
+		const float* p = agents[i]->npos;
+		const unsigned int x = (unsigned int)(int)dtMathFloorf(p[0] * invCellSize);
+		const unsigned int z = (unsigned int)(int)dtMathFloorf(p[2] * invCellSize);
+		m_sortItems[i].key = spreadBits(x) | (spreadBits(z) << 1);
+		m_sortItems[i].agent = agents[i];
 	}
-	
-	// Trigger off-mesh connections (depends on corners).
+
+	qsort(m_sortItems, nagents, sizeof(dtCrowdAgentSortItem), compareAgentSortItems);
+
 	for (int i = 0; i < nagents; ++i)
+		agents[i] = m_sortItems[i].agent;
+}
+
+void dtCrowd::runAgentPhase(const int phase, const int nagents)
+{
+	if (m_dispatcher)
+		m_dispatcher->dispatch(this, phase, nagents);
+	else
+		updateAgentRange(phase, 0, nagents, 0);
+}
+
+void dtCrowd::updateAgentRange(const int phase, const int begin, const int end, const int threadIndex)
+{
+	dtAssert(threadIndex >= 0 && threadIndex < m_maxThreads);
+
+	dtCrowdAgent** agents = m_activeAgents;
+	const int nagents = m_updateAgentCount;
+	const float dt = m_updateDt;
+	dtCrowdAgentDebugInfo* debug = m_updateDebug;
+	const int debugIdx = debug ? debug->idx : -1;
+	dtNavMeshQuery* navquery = threadIndex > 0 ? m_threadData[threadIndex].navquery : m_navquery;
+	dtObstacleAvoidanceQuery* obstacleQuery = threadIndex > 0 ? m_threadData[threadIndex].obstacleQuery : m_obstacleQuery;
+
+	switch (phase)
 	{
-		dtCrowdAgent* ag = agents[i];
-		
-		if (ag->state != DT_CROWDAGENT_STATE_WALKING)
-			continue;
-		if (ag->targetState == DT_CROWDAGENT_TARGET_NONE || ag->targetState == DT_CROWDAGENT_TARGET_VELOCITY)
-			continue;
-		
-		// Check 
-		const float triggerRadius = ag->params.radius*2.25f;
-		if (overOffmeshConnection(ag, triggerRadius))
+	case DT_CROWD_PHASE_NEIGHBOURS:
+		// Get nearby navmesh segments and agents to collide with.
+		for (int i = begin; i < end; ++i)
 		{
-			// Prepare to off-mesh connection.
-			const int idx = (int)(ag - m_agents);
-			dtCrowdAgentAnimation* anim = &m_agentAnims[idx];
-			
-			// Adjust the path over the off-mesh connection.
-			dtPolyRef refs[2];
-			if (ag->corridor.moveOverOffmeshConnection(ag->cornerPolys[ag->ncorners-1], refs,
-													   anim->startPos, anim->endPos, m_navquery))
-			{
-				dtVcopy(anim->initPos, ag->npos);
-				anim->polyRef = refs[1];
-				anim->active = true;
-				anim->t = 0.0f;
-				anim->tmax = (dtVdist2D(anim->startPos, anim->endPos) / ag->params.maxSpeed) * 0.5f;
-				
-				ag->state = DT_CROWDAGENT_STATE_OFFMESH;
-				ag->ncorners = 0;
-				ag->nneis = 0;
+			dtCrowdAgent* ag = agents[i];
+			if (ag->state != DT_CROWDAGENT_STATE_WALKING)
 				continue;
-			}
-			else
+
+			// Update the collision boundary after certain distance has been passed or
+			// if it has become invalid.
+			const float updateThr = ag->params.collisionQueryRange*0.25f;
+			if (dtVdist2DSqr(ag->npos, ag->boundary.getCenter()) > dtSqr(updateThr) ||
+				!ag->boundary.isValid(navquery, &m_filters[ag->params.queryFilterType]))
 			{
-				// Path validity check will ensure that bad/blocked connections will be replanned.
+				ag->boundary.update(ag->corridor.getFirstPoly(), ag->npos, ag->params.collisionQueryRange,
+									navquery, &m_filters[ag->params.queryFilterType]);
 			}
+			// Query neighbour agents
+			ag->nneis = getNeighbours(ag->npos, ag->params.height, ag->params.collisionQueryRange,
+									  ag, ag->neis, DT_CROWDAGENT_MAX_NEIGHBOURS,
+									  agents, nagents, m_grid);
+			for (int j = 0; j < ag->nneis; j++)
+				ag->neis[j].idx = getAgentIndex(agents[ag->neis[j].idx]);
 		}
-	}
-		
-	// Calculate steering.
-	for (int i = 0; i < nagents; ++i)
-	{
-		dtCrowdAgent* ag = agents[i];
+		break;
 
-		if (ag->state != DT_CROWDAGENT_STATE_WALKING)
-			continue;
-		if (ag->targetState == DT_CROWDAGENT_TARGET_NONE)
-			continue;
-		
-		float dvel[3] = {0,0,0};
-
-		if (ag->targetState == DT_CROWDAGENT_TARGET_VELOCITY)
-		{
-			dtVcopy(dvel, ag->targetPos);
-			ag->desiredSpeed = dtVlen(ag->targetPos);
-		}
-		else
+	case DT_CROWD_PHASE_CORNERS:
+		// Find next corner to steer to.
+		for (int i = begin; i < end; ++i)
 		{
-			// Calculate steering direction.
-			if (ag->params.updateFlags & DT_CROWD_ANTICIPATE_TURNS)
-				calcSmoothSteerDirection(ag, dvel);
-			else
-				calcStraightSteerDirection(ag, dvel);
-			
-			// Calculate speed scale, which tells the agent to slowdown at the end of the path.
-			const float slowDownRadius = ag->params.radius*2;	// TODO: make less hacky.
-			const float speedScale = getDistanceToGoal(ag, slowDownRadius) / slowDownRadius;
-				
-			ag->desiredSpeed = ag->params.maxSpeed;
-			dtVscale(dvel, dvel, ag->desiredSpeed * speedScale);
-		}
+			dtCrowdAgent* ag = agents[i];
 
-		// Separation
-		if (ag->params.updateFlags & DT_CROWD_SEPARATION)
-		{
-			const float separationDist = ag->params.collisionQueryRange; 
-			const float invSeparationDist = 1.0f / separationDist; 
-			const float separationWeight = ag->params.separationWeight;
-			
-			float w = 0;
-			float disp[3] = {0,0,0};
-			
-			for (int j = 0; j < ag->nneis; ++j)
+			if (ag->state != DT_CROWDAGENT_STATE_WALKING)
+				continue;
+			if (ag->targetState == DT_CROWDAGENT_TARGET_NONE || ag->targetState == DT_CROWDAGENT_TARGET_VELOCITY)
+				continue;
+
+			// Find corners for steering
+			ag->ncorners = ag->corridor.findCorners(ag->cornerVerts, ag->cornerFlags, ag->cornerPolys,
+													DT_CROWDAGENT_MAX_CORNERS, navquery, &m_filters[ag->params.queryFilterType]);
+
+			// Check to see if the corner after the next corner is directly visible,
+			// and short cut to there.
+			if ((ag->params.updateFlags & DT_CROWD_OPTIMIZE_VIS) && ag->ncorners > 0)
 			{
-				const dtCrowdAgent* nei = &m_agents[ag->neis[j].idx];
-				
-				float diff[3];
-				dtVsub(diff, ag->npos, nei->npos);
-				diff[1] = 0;
-				
-				const float distSqr = dtVlenSqr(diff);
-				if (distSqr < 0.00001f)
-					continue;
-				if (distSqr > dtSqr(separationDist))
-					continue;
-				const float dist = dtMathSqrtf(distSqr);
-				const float weight = separationWeight * (1.0f - dtSqr(dist*invSeparationDist));
-				
-				dtVmad(disp, disp, diff, weight/dist);
-				w += 1.0f;
+				const float* target = &ag->cornerVerts[dtMin(1,ag->ncorners-1)*3];
+				ag->corridor.optimizePathVisibility(target, ag->params.pathOptimizationRange, navquery, &m_filters[ag->params.queryFilterType]);
+
+				// Copy data for debug purposes.
+				if (debugIdx == getAgentIndex(ag))
+				{
+					dtVcopy(debug->optStart, ag->corridor.getPos());
+					dtVcopy(debug->optEnd, target);
+				}
 			}
-			
-			if (w > 0.0001f)
+			else
 			{
-				// Adjust desired velocity.
-				dtVmad(dvel, dvel, disp, 1.0f/w);
-				// Clamp desired velocity to desired speed.
-				const float speedSqr = dtVlenSqr(dvel);
-				const float desiredSqr = dtSqr(ag->desiredSpeed);
-				if (speedSqr > desiredSqr)
-					dtVscale(dvel, dvel, desiredSqr/speedSqr);
+				// Copy data for debug purposes.
+				if (debugIdx == getAgentIndex(ag))
+				{
+					dtVset(debug->optStart, 0,0,0);
+					dtVset(debug->optEnd, 0,0,0);
+				}
 			}
 		}
-		
-		// Set the desired velocity.
-		dtVcopy(ag->dvel, dvel);
-	}
-	
-	// Velocity planning.	
-	for (int i = 0; i < nagents; ++i)
-	{
-		dtCrowdAgent* ag = agents[i];
-		
-		if (ag->state != DT_CROWDAGENT_STATE_WALKING)
-			continue;
-		
-		if (ag->params.updateFlags & DT_CROWD_OBSTACLE_AVOIDANCE)
+		break;
+
+	case DT_CROWD_PHASE_STEERING:
+		// Calculate steering.
+		for (int i = begin; i < end; ++i)
 		{
-			m_obstacleQuery->reset();
-			
-			// Add neighbours as obstacles.
-			for (int j = 0; j < ag->nneis; ++j)
-			{
-				const dtCrowdAgent* nei = &m_agents[ag->neis[j].idx];
-				m_obstacleQuery->addCircle(nei->npos, nei->params.radius, nei->vel, nei->dvel);
-			}
+			dtCrowdAgent* ag = agents[i];
 
-			// Append neighbour segments as obstacles.
-			for (int j = 0; j < ag->boundary.getSegmentCount(); ++j)
-			{
-				const float* s = ag->boundary.getSegment(j);
-				if (dtTriArea2D(ag->npos, s, s+3) < 0.0f)
-					continue;
-				m_obstacleQuery->addSegment(s, s+3);
-			}
+			if (ag->state != DT_CROWDAGENT_STATE_WALKING)
+				continue;
+			if (ag->targetState == DT_CROWDAGENT_TARGET_NONE)
+				continue;
 
-			dtObstacleAvoidanceDebugData* vod = 0;
-			if (debugIdx == i) 
-				vod = debug->vod;
-			
-			// Sample new safe velocity.
-			bool adaptive = true;
-			int ns = 0;
+			float dvel[3] = {0,0,0};
 
-			const dtObstacleAvoidanceParams* params = &m_obstacleQueryParams[ag->params.obstacleAvoidanceType];
-				
-			if (adaptive)
+			if (ag->targetState == DT_CROWDAGENT_TARGET_VELOCITY)
 			{
-				ns = m_obstacleQuery->sampleVelocityAdaptive(ag->npos, ag->params.radius, ag->desiredSpeed,
-															 ag->vel, ag->dvel, ag->nvel, params, vod);
+				dtVcopy(dvel, ag->targetPos);
+				ag->desiredSpeed = dtVlen(ag->targetPos);
 			}
 			else
 			{
-				ns = m_obstacleQuery->sampleVelocityGrid(ag->npos, ag->params.radius, ag->desiredSpeed,
-														 ag->vel, ag->dvel, ag->nvel, params, vod);
+				// Calculate steering direction.
+				if (ag->params.updateFlags & DT_CROWD_ANTICIPATE_TURNS)
+					calcSmoothSteerDirection(ag, dvel);
+				else
+					calcStraightSteerDirection(ag, dvel);
+
+				// Calculate speed scale, which tells the agent to slowdown at the end of the path.
+				const float slowDownRadius = ag->params.radius*2;	// TODO: make less hacky.
+				const float speedScale = getDistanceToGoal(ag, slowDownRadius) / slowDownRadius;
+
+				ag->desiredSpeed = ag->params.maxSpeed;
+				dtVscale(dvel, dvel, ag->desiredSpeed * speedScale);
 			}
-			m_velocitySampleCount += ns;
+
+			// Separation
+			if (ag->params.updateFlags & DT_CROWD_SEPARATION)
+			{
+				const float separationDist = ag->params.collisionQueryRange;
+				const float invSeparationDist = 1.0f / separationDist;
+				const float separationWeight = ag->params.separationWeight;
+
+				float w = 0;
+				float disp[3] = {0,0,0};
+
+				for (int j = 0; j < ag->nneis; ++j)
+				{
+					const dtCrowdAgent* nei = &m_agents[ag->neis[j].idx];
+
+					float diff[3];
+					dtVsub(diff, ag->npos, nei->npos);
+					diff[1] = 0;
+
+					const float distSqr = dtVlenSqr(diff);
+					if (distSqr < 0.00001f)
+						continue;
+					if (distSqr > dtSqr(separationDist))
+						continue;
+					const float dist = dtMathSqrtf(distSqr);
+					const float weight = separationWeight * (1.0f - dtSqr(dist*invSeparationDist));
+
+					dtVmad(disp, disp, diff, weight/dist);
+					w += 1.0f;
+				}
+
+				if (w > 0.0001f)
+				{
+					// Adjust desired velocity.
+					dtVmad(dvel, dvel, disp, 1.0f/w);
+					// Clamp desired velocity to desired speed.
+					const float speedSqr = dtVlenSqr(dvel);
+					const float desiredSqr = dtSqr(ag->desiredSpeed);
+					if (speedSqr > desiredSqr)
+						dtVscale(dvel, dvel, desiredSqr/speedSqr);
+				}
+			}
+
+			// Set the desired velocity.
+			dtVcopy(ag->dvel, dvel);
 		}
-		else
+		break;
+
+	case DT_CROWD_PHASE_VELOCITY_PLANNING:
 		{
-			// If not using velocity planning, new velocity is directly the desired velocity.
-			dtVcopy(ag->nvel, ag->dvel);
+			int velocitySampleCount = 0;
+
+			// Velocity planning.
+			for (int i = begin; i < end; ++i)
+			{
+				dtCrowdAgent* ag = agents[i];
+
+				if (ag->state != DT_CROWDAGENT_STATE_WALKING)
+					continue;
+
+				if (ag->params.updateFlags & DT_CROWD_OBSTACLE_AVOIDANCE)
+				{
+					obstacleQuery->reset();
+
+					// Add neighbours as obstacles.
+					for (int j = 0; j < ag->nneis; ++j)
+					{
+						const dtCrowdAgent* nei = &m_agents[ag->neis[j].idx];
+						obstacleQuery->addCircle(nei->npos, nei->params.radius, nei->vel, nei->dvel);
+					}
+
+					// Append neighbour segments as obstacles.
+					for (int j = 0; j < ag->boundary.getSegmentCount(); ++j)
+					{
+						const float* s = ag->boundary.getSegment(j);
+						if (dtTriArea2D(ag->npos, s, s+3) < 0.0f)
+							continue;
+						obstacleQuery->addSegment(s, s+3);
+					}
+
+					dtObstacleAvoidanceDebugData* vod = 0;
+					if (debugIdx == getAgentIndex(ag))
+						vod = debug->vod;
+
+					// Sample new safe velocity.
+					bool adaptive = true;
+					int ns = 0;
+
+					const dtObstacleAvoidanceParams* params = &m_obstacleQueryParams[ag->params.obstacleAvoidanceType];
+
+					if (adaptive)
+					{
+						ns = obstacleQuery->sampleVelocityAdaptive(ag->npos, ag->params.radius, ag->desiredSpeed,
+																   ag->vel, ag->dvel, ag->nvel, params, vod);
+					}
+					else
+					{
+						ns = obstacleQuery->sampleVelocityGrid(ag->npos, ag->params.radius, ag->desiredSpeed,
+															   ag->vel, ag->dvel, ag->nvel, params, vod);
+					}
+					velocitySampleCount += ns;
+				}
+				else
+				{
+					// If not using velocity planning, new velocity is directly the desired velocity.
+					dtVcopy(ag->nvel, ag->dvel);
+				}
+			}
+
+			// Each thread accumulates to its own counter, they are summed up after the phase.
+			if (threadIndex > 0)
+				m_threadData[threadIndex].velocitySampleCount += velocitySampleCount;
+			else
+				m_velocitySampleCount += velocitySampleCount;
 		}
-	}
+		break;
 
-	// Integrate.
-	for (int i = 0; i < nagents; ++i)
-	{
-		dtCrowdAgent* ag = agents[i];
-		if (ag->state != DT_CROWDAGENT_STATE_WALKING)
-			continue;
-		integrate(ag, dt);
-	}
-	
-	// Handle collisions.
-	static const float COLLISION_RESOLVE_FACTOR = 0.7f;
-	
-	for (int iter = 0; iter < 4; ++iter)
-	{
-		for (int i = 0; i < nagents; ++i)
+	case DT_CROWD_PHASE_INTEGRATE:
+		// Integrate.
+		for (int i = begin; i < end; ++i)
 		{
 			dtCrowdAgent* ag = agents[i];
-			const int idx0 = getAgentIndex(ag);
-			
 			if (ag->state != DT_CROWDAGENT_STATE_WALKING)
 				continue;
+			integrate(ag, dt);
+		}
+		break;
 
-			dtVset(ag->disp, 0,0,0);
-			
-			float w = 0;
+	case DT_CROWD_PHASE_COLLISION_DISPLACEMENT:
+		{
+			static const float COLLISION_RESOLVE_FACTOR = 0.7f;
 
-			for (int j = 0; j < ag->nneis; ++j)
+			for (int i = begin; i < end; ++i)
 			{
-				const dtCrowdAgent* nei = &m_agents[ag->neis[j].idx];
-				const int idx1 = getAgentIndex(nei);
+				dtCrowdAgent* ag = agents[i];
+				const int idx0 = getAgentIndex(ag);
 
-				float diff[3];
-				dtVsub(diff, ag->npos, nei->npos);
-				diff[1] = 0;
-				
-				float dist = dtVlenSqr(diff);
-				if (dist > dtSqr(ag->params.radius + nei->params.radius))
+				if (ag->state != DT_CROWDAGENT_STATE_WALKING)
 					continue;
-				dist = dtMathSqrtf(dist);
-				float pen = (ag->params.radius + nei->params.radius) - dist;
-				if (dist < 0.0001f)
+
+				dtVset(ag->disp, 0,0,0);
+
+				float w = 0;
+
+				for (int j = 0; j < ag->nneis; ++j)
 				{
-					// Agents on top of each other, try to choose diverging separation directions.
-					if (idx0 > idx1)
-						dtVset(diff, -ag->dvel[2],0,ag->dvel[0]);
+					const dtCrowdAgent* nei = &m_agents[ag->neis[j].idx];
+					const int idx1 = getAgentIndex(nei);
+
+					float diff[3];
+					dtVsub(diff, ag->npos, nei->npos);
+					diff[1] = 0;
+
+					float dist = dtVlenSqr(diff);
+					if (dist > dtSqr(ag->params.radius + nei->params.radius))
+						continue;
+					dist = dtMathSqrtf(dist);
+					float pen = (ag->params.radius + nei->params.radius) - dist;
+					if (dist < 0.0001f)
+					{
+						// Agents on top of each other, try to choose diverging separation directions.
+						if (idx0 > idx1)
+							dtVset(diff, -ag->dvel[2],0,ag->dvel[0]);
+						else
+							dtVset(diff, ag->dvel[2],0,-ag->dvel[0]);
+						pen = 0.01f;
+					}
 					else
-						dtVset(diff, ag->dvel[2],0,-ag->dvel[0]);
-					pen = 0.01f;
+					{
+						pen = (1.0f/dist) * (pen*0.5f) * COLLISION_RESOLVE_FACTOR;
+					}
+
+					dtVmad(ag->disp, ag->disp, diff, pen);
+
+					w += 1.0f;
 				}
-				else
+
+				if (w > 0.0001f)
 				{
-					pen = (1.0f/dist) * (pen*0.5f) * COLLISION_RESOLVE_FACTOR;
+					const float iw = 1.0f / w;
+					dtVscale(ag->disp, ag->disp, iw);
 				}
-				
-				dtVmad(ag->disp, ag->disp, diff, pen);			
-				
-				w += 1.0f;
-			}
-			
-			if (w > 0.0001f)
-			{
-				const float iw = 1.0f / w;
-				dtVscale(ag->disp, ag->disp, iw);
 			}
 		}
-		
-		for (int i = 0; i < nagents; ++i)
+		break;
+
+	case DT_CROWD_PHASE_COLLISION_APPLY:
+		for (int i = begin; i < end; ++i)
 		{
 			dtCrowdAgent* ag = agents[i];
 			if (ag->state != DT_CROWDAGENT_STATE_WALKING)
 				continue;
-			
+
 			dtVadd(ag->npos, ag->npos, ag->disp);
 		}
+		break;
+
+	case DT_CROWD_PHASE_MOVE:
+		for (int i = begin; i < end; ++i)
+		{
+			dtCrowdAgent* ag = agents[i];
+			if (ag->state != DT_CROWDAGENT_STATE_WALKING)
+				continue;
+
+			// Move along navmesh.
+			ag->corridor.movePosition(ag->npos, navquery, &m_filters[ag->params.queryFilterType]);
+			// Get valid constrained position back.
+			dtVcopy(ag->npos, ag->corridor.getPos());
+
+			// If not using path, truncate the corridor to just one poly.
+			if (ag->targetState == DT_CROWDAGENT_TARGET_NONE || ag->targetState == DT_CROWDAGENT_TARGET_VELOCITY)
+			{
+				ag->corridor.reset(ag->corridor.getFirstPoly(), ag->npos);
+				ag->partial = false;
+			}
+		}
+		break;
 	}
-	
+}
+
+void dtCrowd::update(const float dt, dtCrowdAgentDebugInfo* debug)
+{
+	m_velocitySampleCount = 0;
+
+	dtCrowdAgent** agents = m_activeAgents;
+	int nagents = getActiveAgents(agents, m_maxAgents);
+
+	// Check that all agents still have valid paths.
+	checkPathValidity(agents, nagents, dt);
+
+	// Update async move request and path finder.
+	updateMoveRequest(dt);
+
+	// Optimize path topology.
+	updateTopologyOptimization(agents, nagents, dt);
+
+	// Urho3D: when the per-agent phases are processed in parallel, sort the agents so that each thread gets
+	// a spatially coherent range.
+	if (m_dispatcher)
+	{
+		sortAgentsSpatially(agents, nagents);
+		for (int i = 1; i < m_maxThreads; ++i)
+			m_threadData[i].velocitySampleCount = 0;
+	}
+
+	m_updateAgentCount = nagents;
+	m_updateDt = dt;
+	m_updateDebug = debug;
+
+	// Register agents to proximity grid.
+	m_grid->clear();
 	for (int i = 0; i < nagents; ++i)
 	{
 		dtCrowdAgent* ag = agents[i];
+		const float* p = ag->npos;
+		const float r = ag->params.radius;
+		m_grid->addItem((unsigned short)i, p[0]-r, p[2]-r, p[0]+r, p[2]+r);
+	}
+
+	// Get nearby navmesh segments and agents to collide with.
+	runAgentPhase(DT_CROWD_PHASE_NEIGHBOURS, nagents);
+
+	// Find next corner to steer to.
+	runAgentPhase(DT_CROWD_PHASE_CORNERS, nagents);
+
+	// Trigger off-mesh connections (depends on corners).
+	for (int i = 0; i < nagents; ++i)
+	{
+		dtCrowdAgent* ag = agents[i];
+
 		if (ag->state != DT_CROWDAGENT_STATE_WALKING)
 			continue;
-		
-		// Move along navmesh.
-		ag->corridor.movePosition(ag->npos, m_navquery, &m_filters[ag->params.queryFilterType]);
-		// Get valid constrained position back.
-		dtVcopy(ag->npos, ag->corridor.getPos());
-
-		// If not using path, truncate the corridor to just one poly.
 		if (ag->targetState == DT_CROWDAGENT_TARGET_NONE || ag->targetState == DT_CROWDAGENT_TARGET_VELOCITY)
+			continue;
+
+		// Check
+		const float triggerRadius = ag->params.radius*2.25f;
+		if (overOffmeshConnection(ag, triggerRadius))
 		{
-			ag->corridor.reset(ag->corridor.getFirstPoly(), ag->npos);
-			ag->partial = false;
+			// Prepare to off-mesh connection.
+			const int idx = (int)(ag - m_agents);
+			dtCrowdAgentAnimation* anim = &m_agentAnims[idx];
+
+			// Adjust the path over the off-mesh connection.
+			dtPolyRef refs[2];
+			if (ag->corridor.moveOverOffmeshConnection(ag->cornerPolys[ag->ncorners-1], refs,
+													   anim->startPos, anim->endPos, m_navquery))
+			{
+				dtVcopy(anim->initPos, ag->npos);
+				anim->polyRef = refs[1];
+				anim->active = true;
+				anim->t = 0.0f;
+				anim->tmax = (dtVdist2D(anim->startPos, anim->endPos) / ag->params.maxSpeed) * 0.5f;
+
+				ag->state = DT_CROWDAGENT_STATE_OFFMESH;
+				ag->ncorners = 0;
+				ag->nneis = 0;
+				continue;
+			}
+			else
+			{
+				// Path validity check will ensure that bad/blocked connections will be replanned.
+			}
 		}
+	}
+
+	// Calculate steering.
+	runAgentPhase(DT_CROWD_PHASE_STEERING, nagents);
 
+	// Velocity planning.
+	runAgentPhase(DT_CROWD_PHASE_VELOCITY_PLANNING, nagents);
+	if (m_dispatcher)
+	{
+		for (int i = 1; i < m_maxThreads; ++i)
+			m_velocitySampleCount += m_threadData[i].velocitySampleCount;
 	}
-	
+
+	// Integrate.
+	runAgentPhase(DT_CROWD_PHASE_INTEGRATE, nagents);
+
+	// Handle collisions.
+	for (int iter = 0; iter < 4; ++iter)
+	{
+		runAgentPhase(DT_CROWD_PHASE_COLLISION_DISPLACEMENT, nagents);
+		runAgentPhase(DT_CROWD_PHASE_COLLISION_APPLY, nagents);
+	}
+
+	// Move along navmesh.
+	runAgentPhase(DT_CROWD_PHASE_MOVE, nagents);
+
 	// Update agents using off-mesh connection.
 	for (int i = 0; i < m_maxAgents; ++i)
 	{
 		dtCrowdAgentAnimation* anim = &m_agentAnims[i];
 		if (!anim->active)
 			continue;
-		dtCrowdAgent* ag = agents[i];
+		// Urho3D: the animations are indexed by agent index, not by the active agent list index
+		dtCrowdAgent* ag = &m_agents[i];
 
 		anim->t += dt;
 		if (anim->t > anim->tmax)
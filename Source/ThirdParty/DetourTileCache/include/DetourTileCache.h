@@ -126,6 +126,24 @@ public:
     // Urho3D: added function to know when we have too many obstacle requests without update
     bool isObstacleQueueFull() const { return m_nreqs >= MAX_REQUESTS; }
 
+    // Urho3D: added functions for rebuilding the tiles touched by obstacles outside update(), e.g. in worker threads.
+    /// Process the queued obstacle requests if no tile rebuilds are pending. Return number of tiles pending rebuild.
+    int processObstacleRequests();
+    /// Return number of tiles pending rebuild.
+    int getPendingTileCount() const { return m_nupdate; }
+    /// Return a tile pending rebuild.
+    dtCompressedTileRef getPendingTile(const int i) const { return m_update[i]; }
+    /// Copy the obstacles affecting a tile. Return number of obstacles copied.
+    int getTileObstacles(const dtCompressedTileRef ref, dtTileCacheObstacle* obstacles, const int maxObstacles) const;
+    /// Build the nav mesh data of a tile with the given obstacles and allocator without modifying the tile cache. The data is null if the tile is empty.
+    /// Can be called from multiple threads at once if each uses its own allocator and the mesh process is thread-safe.
+    dtStatus buildNavMeshTileData(const dtCompressedTileRef ref, const dtTileCacheObstacle* obstacles, const int nobstacles,
+                                  struct dtTileCacheAlloc* talloc, unsigned char** navData, int* navDataSize) const;
+    /// Replace the nav mesh tile with built data, which the nav mesh takes ownership of.
+    dtStatus replaceNavMeshTile(const dtCompressedTileRef ref, unsigned char* navData, const int navDataSize, class dtNavMesh* navmesh);
+    /// Remove a rebuilt tile from the pending list and advance the state of the obstacles waiting for it.
+    void markTileUpdated(const dtCompressedTileRef ref);
+
 	/// Encodes a tile id.
 	inline dtCompressedTileRef encodeTileId(unsigned int salt, unsigned int it) const
 	{
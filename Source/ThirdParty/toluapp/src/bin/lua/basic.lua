@@ -416,3 +416,29 @@ end
 function get_is_function(t)
 	return _is_functions[t] or search_base(t, _base_is_functions) or "tolua_isusertype"
 end
+
+-- Urho3D: plain value types which are returned to Lua stored inside the userdata, instead of as a garbage collected heap copy
+_value_types = {
+ ["Vector2"] = true,
+ ["IntVector2"] = true,
+ ["Vector3"] = true,
+ ["Vector4"] = true,
+ ["Quaternion"] = true,
+ ["Color"] = true,
+ ["Rect"] = true,
+ ["IntRect"] = true,
+ ["Matrix3"] = true,
+ ["Matrix3x4"] = true,
+ ["Matrix4"] = true,
+ ["BoundingBox"] = true,
+ ["Plane"] = true,
+ ["Ray"] = true,
+ ["Sphere"] = true,
+ ["StringHash"] = true,
+}
+
+function is_value_type(t)
+	t = gsub(t, "^%s*const%s+", "")
+	t = gsub(t, "^Urho3D::", "")
+	return _value_types[t] and get_push_function(t) == "tolua_pushusertype"
+end
@@ -180,13 +180,19 @@ function classFunction:supcode (local_constructor)
   end
  else
   output('  {')
-  if self.type ~= '' and self.type ~= 'void' then
+  -- Urho3D: construct local value types on the stack, they are copied into the userdata when pushed
+  local value_new = class and self.name=='new' and local_constructor and is_value_type(self.type)
+  if value_new then
+   output('  ',self.type,' tolua_ret = ')
+  elseif self.type ~= '' and self.type ~= 'void' then
    output('  ',self.mod,self.type,self.ptr,'tolua_ret = ')
    output('(',self.mod,self.type,self.ptr,') ')
   else
    output('  ')
   end
-  if class and self.name=='new' then
+  if value_new then
+   output(self.type,'(')
+  elseif class and self.name=='new' then
    output('Mtolua_new((',self.type,')(')
   elseif class and static then
 	if out then
@@ -228,7 +234,9 @@ function classFunction:supcode (local_constructor)
   if class and self.name == 'operator[]' and flags['1'] then
 	output('-1);')
   else
-	if class and self.name=='new' then
+	if value_new then
+		output(');')
+	elseif class and self.name=='new' then
 		output('));') -- close Mtolua_new(
 	else
 		output(');')
@@ -253,7 +261,9 @@ function classFunction:supcode (local_constructor)
 		owned = true
 	end
     local push_func = get_push_function(t)
-    if self.ptr == '' then
+    if value_new or (self.ptr == '' and is_value_type(t)) then
+     output('   tolua_pushusertype_value(tolua_S,(void*)&tolua_ret,sizeof(',new_t,'),"',t,'");')
+    elseif self.ptr == '' then
      output('   {')
      output('#ifdef __cplusplus\n')
      output('    void* tolua_obj = Mtolua_new((',new_t,')(tolua_ret));')
@@ -105,7 +105,10 @@ function classOperator:supcode_tmp()
 		t = self.type
 		local push_func = get_push_function(t)
 		new_t = string.gsub(t, "const%s+", "")
-		if self.ptr == '' then
+		-- Urho3D: store plain value types inside the userdata
+		if self.ptr == '' and is_value_type(t) then
+			output('   tolua_pushusertype_value(tolua_S,(void*)&tolua_ret,sizeof(',new_t,'),"',t,'");')
+		elseif self.ptr == '' then
 			output('   {')
 			output('#ifdef __cplusplus\n')
 			output('    void* tolua_obj = Mtolua_new((',new_t,')(tolua_ret));')
@@ -168,6 +168,10 @@ function classVariable:supcode ()
 		elseif self.ptr == '' then
 			if prop_type == nil then
 				output('  ',push_func,'(tolua_S,(void*)&'..self:getvalue(class,static,prop_get)..',"',t,'");')
+			-- Urho3D: store plain value types returned by property getters inside the userdata
+			elseif is_value_type(self.type) then
+				output('  '..self.type..' tolua_ret = ('..self.type..')'..self:getvalue(class,static,prop_get)..';\n')
+				output('  tolua_pushusertype_value(tolua_S,(void*)&tolua_ret,sizeof(tolua_ret),"'..self.type..'");\n')
 			else
 				output('  '..self.type..' tolua_ret = ('..self.type..')'..self:getvalue(class,static,prop_get)..';\n')
 				output('  #ifdef __cplusplus\n')
@@ -683,7 +683,40 @@ TOLUA_API int tolua_tolua_open (lua_State* tolua_S)
    95, 98, 97,115,101, 95,105,115, 95,102,117,110, 99,116,105,
   111,110,115, 41, 32,111,114, 32, 34,116,111,108,117, 97, 95,
   105,115,117,115,101,114,116,121,112,101, 34, 10,101,110,100,
-   45, 45, 45,32
+   10, 95,118, 97,108,117,101, 95,116,121,112,101,115, 32, 61,
+   32,123, 10, 91, 34, 86,101, 99,116,111,114, 50, 34, 93, 32,
+   61, 32,116,114,117,101, 44, 10, 91, 34, 73,110,116, 86,101,
+   99,116,111,114, 50, 34, 93, 32, 61, 32,116,114,117,101, 44,
+   10, 91, 34, 86,101, 99,116,111,114, 51, 34, 93, 32, 61, 32,
+  116,114,117,101, 44, 10, 91, 34, 86,101, 99,116,111,114, 52,
+   34, 93, 32, 61, 32,116,114,117,101, 44, 10, 91, 34, 81,117,
+   97,116,101,114,110,105,111,110, 34, 93, 32, 61, 32,116,114,
+  117,101, 44, 10, 91, 34, 67,111,108,111,114, 34, 93, 32, 61,
+   32,116,114,117,101, 44, 10, 91, 34, 82,101, 99,116, 34, 93,
+   32, 61, 32,116,114,117,101, 44, 10, 91, 34, 73,110,116, 82,
+  101, 99,116, 34, 93, 32, 61, 32,116,114,117,101, 44, 10, 91,
+   34, 77, 97,116,114,105,120, 51, 34, 93, 32, 61, 32,116,114,
+  117,101, 44, 10, 91, 34, 77, 97,116,114,105,120, 51,120, 52,
+   34, 93, 32, 61, 32,116,114,117,101, 44, 10, 91, 34, 77, 97,
+  116,114,105,120, 52, 34, 93, 32, 61, 32,116,114,117,101, 44,
+   10, 91, 34, 66,111,117,110,100,105,110,103, 66,111,120, 34,
+   93, 32, 61, 32,116,114,117,101, 44, 10, 91, 34, 80,108, 97,
+  110,101, 34, 93, 32, 61, 32,116,114,117,101, 44, 10, 91, 34,
+   82, 97,121, 34, 93, 32, 61, 32,116,114,117,101, 44, 10, 91,
+   34, 83,112,104,101,114,101, 34, 93, 32, 61, 32,116,114,117,
+  101, 44, 10, 91, 34, 83,116,114,105,110,103, 72, 97,115,104,
+   34, 93, 32, 61, 32,116,114,117,101, 44, 10,125, 10,102,117,
+  110, 99,116,105,111,110, 32,105,115, 95,118, 97,108,117,101,
+   95,116,121,112,101, 40,116, 41, 10,116, 32, 61, 32,103,115,
+  117, 98, 40,116, 44, 32, 34, 94, 37,115, 42, 99,111,110,115,
+  116, 37,115, 43, 34, 44, 32, 34, 34, 41, 10,116, 32, 61, 32,
+  103,115,117, 98, 40,116, 44, 32, 34, 94, 85,114,104,111, 51,
+   68, 58, 58, 34, 44, 32, 34, 34, 41, 10,114,101,116,117,114,
+  110, 32, 95,118, 97,108,117,101, 95,116,121,112,101,115, 91,
+  116, 93, 32, 97,110,100, 32,103,101,116, 95,112,117,115,104,
+   95,102,117,110, 99,116,105,111,110, 40,116, 41, 32, 61, 61,
+   32, 34,116,111,108,117, 97, 95,112,117,115,104,117,115,101,
+  114,116,121,112,101, 34, 10,101,110,100, 45, 45, 45,32
   };
   tolua_dobuffer(tolua_S,(char*)B,sizeof(B),"tolua embedded: lua/basic.lua");
   lua_settop(tolua_S, top);
@@ -3749,258 +3782,274 @@ TOLUA_API int tolua_tolua_open (lua_State* tolua_S)
    39, 46, 46,115,101,108,102, 58,103,101,116,118, 97,108,117,
   101, 40, 99,108, 97,115,115, 44,115,116, 97,116,105, 99, 44,
   112,114,111,112, 95,103,101,116, 41, 46, 46, 39, 44, 34, 39,
-   44,116, 44, 39, 34, 41, 59, 39, 41, 10,101,108,115,101, 10,
-  111,117,116,112,117,116, 40, 39, 32, 39, 46, 46,115,101,108,
-  102, 46,116,121,112,101, 46, 46, 39, 32,116,111,108,117, 97,
-   95,114,101,116, 32, 61, 32, 40, 39, 46, 46,115,101,108,102,
-   46,116,121,112,101, 46, 46, 39, 41, 39, 46, 46,115,101,108,
-  102, 58,103,101,116,118, 97,108,117,101, 40, 99,108, 97,115,
-  115, 44,115,116, 97,116,105, 99, 44,112,114,111,112, 95,103,
-  101,116, 41, 46, 46, 39, 59, 92,110, 39, 41, 10,111,117,116,
-  112,117,116, 40, 39, 32, 35,105,102,100,101,102, 32, 95, 95,
-   99,112,108,117,115,112,108,117,115, 92,110, 39, 41, 10,111,
-  117,116,112,117,116, 40, 39, 32,118,111,105,100, 42, 32,116,
-  111,108,117, 97, 95,111, 98,106, 32, 61, 32, 40,118,111,105,
-  100, 42, 41, 77,116,111,108,117, 97, 95,110,101,119, 40, 40,
-   39, 46, 46,115,101,108,102, 46,116,121,112,101, 46, 46, 39,
-   41, 40,116,111,108,117, 97, 95,114,101,116, 41, 41, 59, 92,
-  110, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32,116,111,
-  108,117, 97, 95,112,117,115,104,117,115,101,114,116,121,112,
-  101, 40,116,111,108,117, 97, 95, 83, 44,116,111,108,117, 97,
-   95,111, 98,106, 44, 34, 39, 46, 46,115,101,108,102, 46,116,
-  121,112,101, 46, 46, 39, 34, 41, 59, 92,110, 39, 41, 10,111,
-  117,116,112,117,116, 40, 39, 32,116,111,108,117, 97, 95,114,
-  101,103,105,115,116,101,114, 95,103, 99, 40,116,111,108,117,
-   97, 95, 83, 44,108,117, 97, 95,103,101,116,116,111,112, 40,
-  116,111,108,117, 97, 95, 83, 41, 41, 59, 92,110, 39, 41, 10,
-  111,117,116,112,117,116, 40, 39, 32, 35,101,108,115,101, 92,
-  110, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32,118,111,
-  105,100, 42, 32,116,111,108,117, 97, 95,111, 98,106, 32, 61,
-   32,116,111,108,117, 97, 95, 99,111,112,121, 40,116,111,108,
-  117, 97, 95, 83, 44, 40,118,111,105,100, 42, 41, 38,116,111,
-  108,117, 97, 95,114,101,116, 44,115,105,122,101,111,102, 40,
-   39, 46, 46,115,101,108,102, 46,116,121,112,101, 46, 46, 39,
-   41, 41, 59, 92,110, 39, 41, 10,111,117,116,112,117,116, 40,
-   39, 32,116,111,108,117, 97, 95,112,117,115,104,117,115,101,
-  114,116,121,112,101, 40,116,111,108,117, 97, 95, 83, 44,116,
-  111,108,117, 97, 95,111, 98,106, 44, 34, 39, 46, 46,115,101,
-  108,102, 46,116,121,112,101, 46, 46, 39, 34, 41, 59, 92,110,
-   39, 41, 10,111,117,116,112,117,116, 40, 39, 32,116,111,108,
-  117, 97, 95,114,101,103,105,115,116,101,114, 95,103, 99, 40,
-  116,111,108,117, 97, 95, 83, 44,108,117, 97, 95,103,101,116,
-  116,111,112, 40,116,111,108,117, 97, 95, 83, 41, 41, 59, 92,
-  110, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32, 35,101,
-  110,100,105,102, 92,110, 39, 41, 10,101,110,100, 10,101,108,
-  115,101, 10,111,117,116,112,117,116, 40, 39, 32, 39, 44,112,
-  117,115,104, 95,102,117,110, 99, 44, 39, 40,116,111,108,117,
-   97, 95, 83, 44, 40,118,111,105,100, 42, 41, 39, 46, 46,115,
+   44,116, 44, 39, 34, 41, 59, 39, 41, 10,101,108,115,101,105,
+  102, 32,105,115, 95,118, 97,108,117,101, 95,116,121,112,101,
+   40,115,101,108,102, 46,116,121,112,101, 41, 32,116,104,101,
+  110, 10,111,117,116,112,117,116, 40, 39, 32, 39, 46, 46,115,
+  101,108,102, 46,116,121,112,101, 46, 46, 39, 32,116,111,108,
+  117, 97, 95,114,101,116, 32, 61, 32, 40, 39, 46, 46,115,101,
+  108,102, 46,116,121,112,101, 46, 46, 39, 41, 39, 46, 46,115,
   101,108,102, 58,103,101,116,118, 97,108,117,101, 40, 99,108,
    97,115,115, 44,115,116, 97,116,105, 99, 44,112,114,111,112,
-   95,103,101,116, 41, 46, 46, 39, 44, 34, 39, 44,116, 44, 39,
-   34, 41, 59, 39, 41, 10,101,110,100, 10,101,110,100, 10,101,
-  110,100, 10,111,117,116,112,117,116, 40, 39, 32,114,101,116,
-  117,114,110, 32, 49, 59, 39, 41, 10,111,117,116,112,117,116,
-   40, 39,125, 39, 41, 10,111,117,116,112,117,116, 40, 39, 35,
-  101,110,100,105,102, 32, 47, 47, 35,105,102,110,100,101,102,
-   32, 84, 79, 76, 85, 65, 95, 68, 73, 83, 65, 66, 76, 69, 92,
-  110, 39, 41, 10,111,117,116,112,117,116, 40, 39, 92,110, 39,
-   41, 10,105,102, 32,110,111,116, 32, 40,115,116,114,102,105,
-  110,100, 40,115,101,108,102, 46,116,121,112,101, 44, 39, 99,
-  111,110,115,116, 37,115, 43, 39, 41, 32,111,114, 32,115,116,
-  114,105,110,103, 46,102,105,110,100, 40,115,101,108,102, 46,
-  109,111,100, 44, 32, 39,116,111,108,117, 97, 95,114,101, 97,
-  100,111,110,108,121, 39, 41, 32,111,114, 32,115,116,114,105,
-  110,103, 46,102,105,110,100, 40,115,101,108,102, 46,109,111,
-  100, 44, 32, 39,116,111,108,117, 97, 95,105,110,104,101,114,
-  105,116,115, 39, 41, 41, 32,116,104,101,110, 10,105,102, 32,
-   99,108, 97,115,115, 32,116,104,101,110, 10,111,117,116,112,
-  117,116, 40, 34, 47, 42, 32,115,101,116, 32,102,117,110, 99,
-  116,105,111,110, 58, 34, 44,115,101,108,102, 46,110, 97,109,
-  101, 44, 34, 32,111,102, 32, 99,108, 97,115,115, 32, 34, 44,
-   99,108, 97,115,115, 44, 34, 32, 42, 47, 34, 41, 10,101,108,
-  115,101, 10,111,117,116,112,117,116, 40, 34, 47, 42, 32,115,
-  101,116, 32,102,117,110, 99,116,105,111,110, 58, 34, 44,115,
-  101,108,102, 46,110, 97,109,101, 44, 34, 32, 42, 47, 34, 41,
-   10,101,110,100, 10,115,101,108,102, 46, 99,115,101,116,110,
-   97,109,101, 32, 61, 32,115,101,108,102, 58, 99,102,117,110,
-   99,110, 97,109,101, 40, 34,116,111,108,117, 97, 95,115,101,
-  116, 34, 41, 10,111,117,116,112,117,116, 40, 34, 35,105,102,
-  110,100,101,102, 32, 84, 79, 76, 85, 65, 95, 68, 73, 83, 65,
-   66, 76, 69, 95, 34, 46, 46,115,101,108,102, 46, 99,115,101,
-  116,110, 97,109,101, 41, 10,111,117,116,112,117,116, 40, 34,
-   92,110,115,116, 97,116,105, 99, 32,105,110,116, 34, 44,115,
-  101,108,102, 46, 99,115,101,116,110, 97,109,101, 44, 34, 40,
-  108,117, 97, 95, 83,116, 97,116,101, 42, 32,116,111,108,117,
-   97, 95, 83, 41, 34, 41, 10,111,117,116,112,117,116, 40, 34,
-  123, 34, 41, 10,105,102, 32, 99,108, 97,115,115, 32, 97,110,
-  100, 32,115,116, 97,116,105, 99, 61, 61,110,105,108, 32,116,
-  104,101,110, 10,111,117,116,112,117,116, 40, 39, 32, 39, 44,
-  115,101,108,102, 46,112, 97,114,101,110,116, 46,116,121,112,
-  101, 44, 39, 42, 39, 44, 39,115,101,108,102, 32, 61, 32, 39,
-   41, 10,111,117,116,112,117,116, 40, 39, 40, 39, 44,115,101,
-  108,102, 46,112, 97,114,101,110,116, 46,116,121,112,101, 44,
-   39, 42, 41, 32, 39, 41, 10,108,111, 99, 97,108, 32,116,111,
-   95,102,117,110, 99, 32, 61, 32,103,101,116, 95,116,111, 95,
-  102,117,110, 99,116,105,111,110, 40,115,101,108,102, 46,112,
-   97,114,101,110,116, 46,116,121,112,101, 41, 10,111,117,116,
-  112,117,116, 40,116,111, 95,102,117,110, 99, 44, 39, 40,116,
-  111,108,117, 97, 95, 83, 44, 49, 44, 48, 41, 59, 39, 41, 10,
-  101,110,100, 10,111,117,116,112,117,116, 40, 39, 35,105,102,
-  110,100,101,102, 32, 84, 79, 76, 85, 65, 95, 82, 69, 76, 69,
-   65, 83, 69, 92,110, 39, 41, 10,111,117,116,112,117,116, 40,
-   39, 32,116,111,108,117, 97, 95, 69,114,114,111,114, 32,116,
-  111,108,117, 97, 95,101,114,114, 59, 39, 41, 10,105,102, 32,
+   95,103,101,116, 41, 46, 46, 39, 59, 92,110, 39, 41, 10,111,
+  117,116,112,117,116, 40, 39, 32,116,111,108,117, 97, 95,112,
+  117,115,104,117,115,101,114,116,121,112,101, 95,118, 97,108,
+  117,101, 40,116,111,108,117, 97, 95, 83, 44, 40,118,111,105,
+  100, 42, 41, 38,116,111,108,117, 97, 95,114,101,116, 44,115,
+  105,122,101,111,102, 40,116,111,108,117, 97, 95,114,101,116,
+   41, 44, 34, 39, 46, 46,115,101,108,102, 46,116,121,112,101,
+   46, 46, 39, 34, 41, 59, 92,110, 39, 41, 10,101,108,115,101,
+   10,111,117,116,112,117,116, 40, 39, 32, 39, 46, 46,115,101,
+  108,102, 46,116,121,112,101, 46, 46, 39, 32,116,111,108,117,
+   97, 95,114,101,116, 32, 61, 32, 40, 39, 46, 46,115,101,108,
+  102, 46,116,121,112,101, 46, 46, 39, 41, 39, 46, 46,115,101,
+  108,102, 58,103,101,116,118, 97,108,117,101, 40, 99,108, 97,
+  115,115, 44,115,116, 97,116,105, 99, 44,112,114,111,112, 95,
+  103,101,116, 41, 46, 46, 39, 59, 92,110, 39, 41, 10,111,117,
+  116,112,117,116, 40, 39, 32, 35,105,102,100,101,102, 32, 95,
+   95, 99,112,108,117,115,112,108,117,115, 92,110, 39, 41, 10,
+  111,117,116,112,117,116, 40, 39, 32,118,111,105,100, 42, 32,
+  116,111,108,117, 97, 95,111, 98,106, 32, 61, 32, 40,118,111,
+  105,100, 42, 41, 77,116,111,108,117, 97, 95,110,101,119, 40,
+   40, 39, 46, 46,115,101,108,102, 46,116,121,112,101, 46, 46,
+   39, 41, 40,116,111,108,117, 97, 95,114,101,116, 41, 41, 59,
+   92,110, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32,116,
+  111,108,117, 97, 95,112,117,115,104,117,115,101,114,116,121,
+  112,101, 40,116,111,108,117, 97, 95, 83, 44,116,111,108,117,
+   97, 95,111, 98,106, 44, 34, 39, 46, 46,115,101,108,102, 46,
+  116,121,112,101, 46, 46, 39, 34, 41, 59, 92,110, 39, 41, 10,
+  111,117,116,112,117,116, 40, 39, 32,116,111,108,117, 97, 95,
+  114,101,103,105,115,116,101,114, 95,103, 99, 40,116,111,108,
+  117, 97, 95, 83, 44,108,117, 97, 95,103,101,116,116,111,112,
+   40,116,111,108,117, 97, 95, 83, 41, 41, 59, 92,110, 39, 41,
+   10,111,117,116,112,117,116, 40, 39, 32, 35,101,108,115,101,
+   92,110, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32,118,
+  111,105,100, 42, 32,116,111,108,117, 97, 95,111, 98,106, 32,
+   61, 32,116,111,108,117, 97, 95, 99,111,112,121, 40,116,111,
+  108,117, 97, 95, 83, 44, 40,118,111,105,100, 42, 41, 38,116,
+  111,108,117, 97, 95,114,101,116, 44,115,105,122,101,111,102,
+   40, 39, 46, 46,115,101,108,102, 46,116,121,112,101, 46, 46,
+   39, 41, 41, 59, 92,110, 39, 41, 10,111,117,116,112,117,116,
+   40, 39, 32,116,111,108,117, 97, 95,112,117,115,104,117,115,
+  101,114,116,121,112,101, 40,116,111,108,117, 97, 95, 83, 44,
+  116,111,108,117, 97, 95,111, 98,106, 44, 34, 39, 46, 46,115,
+  101,108,102, 46,116,121,112,101, 46, 46, 39, 34, 41, 59, 92,
+  110, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32,116,111,
+  108,117, 97, 95,114,101,103,105,115,116,101,114, 95,103, 99,
+   40,116,111,108,117, 97, 95, 83, 44,108,117, 97, 95,103,101,
+  116,116,111,112, 40,116,111,108,117, 97, 95, 83, 41, 41, 59,
+   92,110, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32, 35,
+  101,110,100,105,102, 92,110, 39, 41, 10,101,110,100, 10,101,
+  108,115,101, 10,111,117,116,112,117,116, 40, 39, 32, 39, 44,
+  112,117,115,104, 95,102,117,110, 99, 44, 39, 40,116,111,108,
+  117, 97, 95, 83, 44, 40,118,111,105,100, 42, 41, 39, 46, 46,
+  115,101,108,102, 58,103,101,116,118, 97,108,117,101, 40, 99,
+  108, 97,115,115, 44,115,116, 97,116,105, 99, 44,112,114,111,
+  112, 95,103,101,116, 41, 46, 46, 39, 44, 34, 39, 44,116, 44,
+   39, 34, 41, 59, 39, 41, 10,101,110,100, 10,101,110,100, 10,
+  101,110,100, 10,111,117,116,112,117,116, 40, 39, 32,114,101,
+  116,117,114,110, 32, 49, 59, 39, 41, 10,111,117,116,112,117,
+  116, 40, 39,125, 39, 41, 10,111,117,116,112,117,116, 40, 39,
+   35,101,110,100,105,102, 32, 47, 47, 35,105,102,110,100,101,
+  102, 32, 84, 79, 76, 85, 65, 95, 68, 73, 83, 65, 66, 76, 69,
+   92,110, 39, 41, 10,111,117,116,112,117,116, 40, 39, 92,110,
+   39, 41, 10,105,102, 32,110,111,116, 32, 40,115,116,114,102,
+  105,110,100, 40,115,101,108,102, 46,116,121,112,101, 44, 39,
+   99,111,110,115,116, 37,115, 43, 39, 41, 32,111,114, 32,115,
+  116,114,105,110,103, 46,102,105,110,100, 40,115,101,108,102,
+   46,109,111,100, 44, 32, 39,116,111,108,117, 97, 95,114,101,
+   97,100,111,110,108,121, 39, 41, 32,111,114, 32,115,116,114,
+  105,110,103, 46,102,105,110,100, 40,115,101,108,102, 46,109,
+  111,100, 44, 32, 39,116,111,108,117, 97, 95,105,110,104,101,
+  114,105,116,115, 39, 41, 41, 32,116,104,101,110, 10,105,102,
+   32, 99,108, 97,115,115, 32,116,104,101,110, 10,111,117,116,
+  112,117,116, 40, 34, 47, 42, 32,115,101,116, 32,102,117,110,
+   99,116,105,111,110, 58, 34, 44,115,101,108,102, 46,110, 97,
+  109,101, 44, 34, 32,111,102, 32, 99,108, 97,115,115, 32, 34,
+   44, 99,108, 97,115,115, 44, 34, 32, 42, 47, 34, 41, 10,101,
+  108,115,101, 10,111,117,116,112,117,116, 40, 34, 47, 42, 32,
+  115,101,116, 32,102,117,110, 99,116,105,111,110, 58, 34, 44,
+  115,101,108,102, 46,110, 97,109,101, 44, 34, 32, 42, 47, 34,
+   41, 10,101,110,100, 10,115,101,108,102, 46, 99,115,101,116,
+  110, 97,109,101, 32, 61, 32,115,101,108,102, 58, 99,102,117,
+  110, 99,110, 97,109,101, 40, 34,116,111,108,117, 97, 95,115,
+  101,116, 34, 41, 10,111,117,116,112,117,116, 40, 34, 35,105,
+  102,110,100,101,102, 32, 84, 79, 76, 85, 65, 95, 68, 73, 83,
+   65, 66, 76, 69, 95, 34, 46, 46,115,101,108,102, 46, 99,115,
+  101,116,110, 97,109,101, 41, 10,111,117,116,112,117,116, 40,
+   34, 92,110,115,116, 97,116,105, 99, 32,105,110,116, 34, 44,
+  115,101,108,102, 46, 99,115,101,116,110, 97,109,101, 44, 34,
+   40,108,117, 97, 95, 83,116, 97,116,101, 42, 32,116,111,108,
+  117, 97, 95, 83, 41, 34, 41, 10,111,117,116,112,117,116, 40,
+   34,123, 34, 41, 10,105,102, 32, 99,108, 97,115,115, 32, 97,
+  110,100, 32,115,116, 97,116,105, 99, 61, 61,110,105,108, 32,
+  116,104,101,110, 10,111,117,116,112,117,116, 40, 39, 32, 39,
+   44,115,101,108,102, 46,112, 97,114,101,110,116, 46,116,121,
+  112,101, 44, 39, 42, 39, 44, 39,115,101,108,102, 32, 61, 32,
+   39, 41, 10,111,117,116,112,117,116, 40, 39, 40, 39, 44,115,
+  101,108,102, 46,112, 97,114,101,110,116, 46,116,121,112,101,
+   44, 39, 42, 41, 32, 39, 41, 10,108,111, 99, 97,108, 32,116,
+  111, 95,102,117,110, 99, 32, 61, 32,103,101,116, 95,116,111,
+   95,102,117,110, 99,116,105,111,110, 40,115,101,108,102, 46,
+  112, 97,114,101,110,116, 46,116,121,112,101, 41, 10,111,117,
+  116,112,117,116, 40,116,111, 95,102,117,110, 99, 44, 39, 40,
+  116,111,108,117, 97, 95, 83, 44, 49, 44, 48, 41, 59, 39, 41,
+   10,101,110,100, 10,111,117,116,112,117,116, 40, 39, 35,105,
+  102,110,100,101,102, 32, 84, 79, 76, 85, 65, 95, 82, 69, 76,
+   69, 65, 83, 69, 92,110, 39, 41, 10,111,117,116,112,117,116,
+   40, 39, 32,116,111,108,117, 97, 95, 69,114,114,111,114, 32,
+  116,111,108,117, 97, 95,101,114,114, 59, 39, 41, 10,105,102,
+   32, 99,108, 97,115,115, 32, 97,110,100, 32,115,116, 97,116,
+  105, 99, 61, 61,110,105,108, 32,116,104,101,110, 10,111,117,
+  116,112,117,116, 40, 39, 32,105,102, 32, 40, 33,115,101,108,
+  102, 41, 32,116,111,108,117, 97, 95,101,114,114,111,114, 40,
+  116,111,108,117, 97, 95, 83, 44, 34, 39, 46, 46,111,117,116,
+  112,117,116, 95,101,114,114,111,114, 95,104,111,111,107, 40,
+   34,105,110,118, 97,108,105,100, 32, 92, 39,115,101,108,102,
+   92, 39, 32,105,110, 32, 97, 99, 99,101,115,115,105,110,103,
+   32,118, 97,114,105, 97, 98,108,101, 32, 92, 39, 37,115, 92,
+   39, 34, 44, 32,115,101,108,102, 46,110, 97,109,101, 41, 46,
+   46, 39, 34, 44, 78, 85, 76, 76, 41, 59, 39, 41, 59, 10,101,
+  108,115,101,105,102, 32,115,116, 97,116,105, 99, 32,116,104,
+  101,110, 10, 95, 44, 95, 44,115,101,108,102, 46,109,111,100,
+   32, 61, 32,115,116,114,102,105,110,100, 40,115,101,108,102,
+   46,109,111,100, 44, 39, 94, 37,115, 42,115,116, 97,116,105,
+   99, 37,115, 37,115, 42, 40, 46, 42, 41, 39, 41, 10,101,110,
+  100, 10,111,117,116,112,117,116, 40, 39, 32,105,102, 32, 40,
+   39, 46, 46,115,101,108,102, 58,111,117,116, 99,104,101, 99,
+  107,116,121,112,101, 40, 50, 41, 46, 46, 39, 41, 39, 41, 10,
+  111,117,116,112,117,116, 40, 39, 32,116,111,108,117, 97, 95,
+  101,114,114,111,114, 40,116,111,108,117, 97, 95, 83, 44, 34,
+   35,118,105,110,118, 97,108,105,100, 32,116,121,112,101, 32,
+  105,110, 32,118, 97,114,105, 97, 98,108,101, 32, 97,115,115,
+  105,103,110,109,101,110,116, 46, 34, 44, 38,116,111,108,117,
+   97, 95,101,114,114, 41, 59, 39, 41, 10,111,117,116,112,117,
+  116, 40, 39, 35,101,110,100,105,102, 92,110, 39, 41, 10,108,
+  111, 99, 97,108, 32,100,101,102, 32, 61, 32, 48, 10,105,102,
+   32,115,101,108,102, 46,100,101,102, 32,126, 61, 32, 39, 39,
+   32,116,104,101,110, 32,100,101,102, 32, 61, 32,115,101,108,
+  102, 46,100,101,102, 32,101,110,100, 10,105,102, 32,115,101,
+  108,102, 46,116,121,112,101, 32, 61, 61, 32, 39, 99,104, 97,
+  114, 42, 39, 32, 97,110,100, 32,115,101,108,102, 46,100,105,
+  109, 32,126, 61, 32, 39, 39, 32,116,104,101,110, 10,111,117,
+  116,112,117,116, 40, 39, 32,115,116,114,110, 99,112,121, 40,
+   40, 99,104, 97,114, 42, 41, 39, 41, 10,105,102, 32, 99,108,
+   97,115,115, 32, 97,110,100, 32,115,116, 97,116,105, 99, 32,
+  116,104,101,110, 10,111,117,116,112,117,116, 40,115,101,108,
+  102, 46,112, 97,114,101,110,116, 46,116,121,112,101, 46, 46,
+   39, 58, 58, 39, 46, 46,115,101,108,102, 46,110, 97,109,101,
+   41, 10,101,108,115,101,105,102, 32, 99,108, 97,115,115, 32,
+  116,104,101,110, 10,111,117,116,112,117,116, 40, 39,115,101,
+  108,102, 45, 62, 39, 46, 46,115,101,108,102, 46,110, 97,109,
+  101, 41, 10,101,108,115,101, 10,111,117,116,112,117,116, 40,
+  115,101,108,102, 46,110, 97,109,101, 41, 10,101,110,100, 10,
+  111,117,116,112,117,116, 40, 39, 44, 40, 99,111,110,115,116,
+   32, 99,104, 97,114, 42, 41,116,111,108,117, 97, 95,116,111,
+  115,116,114,105,110,103, 40,116,111,108,117, 97, 95, 83, 44,
+   50, 44, 39, 44,100,101,102, 44, 39, 41, 44, 39, 44,115,101,
+  108,102, 46,100,105,109, 44, 39, 45, 49, 41, 59, 39, 41, 10,
+  101,108,115,101, 10,108,111, 99, 97,108, 32,112,116,114, 32,
+   61, 32, 39, 39, 10,105,102, 32,115,101,108,102, 46,112,116,
+  114,126, 61, 39, 39, 32,116,104,101,110, 32,112,116,114, 32,
+   61, 32, 39, 42, 39, 32,101,110,100, 10,111,117,116,112,117,
+  116, 40, 39, 32, 39, 41, 10,108,111, 99, 97,108, 32,110, 97,
+  109,101, 32, 61, 32,112,114,111,112, 95,115,101,116, 32,111,
+  114, 32,115,101,108,102, 46,110, 97,109,101, 10,105,102, 32,
    99,108, 97,115,115, 32, 97,110,100, 32,115,116, 97,116,105,
-   99, 61, 61,110,105,108, 32,116,104,101,110, 10,111,117,116,
-  112,117,116, 40, 39, 32,105,102, 32, 40, 33,115,101,108,102,
-   41, 32,116,111,108,117, 97, 95,101,114,114,111,114, 40,116,
-  111,108,117, 97, 95, 83, 44, 34, 39, 46, 46,111,117,116,112,
-  117,116, 95,101,114,114,111,114, 95,104,111,111,107, 40, 34,
-  105,110,118, 97,108,105,100, 32, 92, 39,115,101,108,102, 92,
-   39, 32,105,110, 32, 97, 99, 99,101,115,115,105,110,103, 32,
-  118, 97,114,105, 97, 98,108,101, 32, 92, 39, 37,115, 92, 39,
-   34, 44, 32,115,101,108,102, 46,110, 97,109,101, 41, 46, 46,
-   39, 34, 44, 78, 85, 76, 76, 41, 59, 39, 41, 59, 10,101,108,
-  115,101,105,102, 32,115,116, 97,116,105, 99, 32,116,104,101,
-  110, 10, 95, 44, 95, 44,115,101,108,102, 46,109,111,100, 32,
-   61, 32,115,116,114,102,105,110,100, 40,115,101,108,102, 46,
-  109,111,100, 44, 39, 94, 37,115, 42,115,116, 97,116,105, 99,
-   37,115, 37,115, 42, 40, 46, 42, 41, 39, 41, 10,101,110,100,
-   10,111,117,116,112,117,116, 40, 39, 32,105,102, 32, 40, 39,
-   46, 46,115,101,108,102, 58,111,117,116, 99,104,101, 99,107,
-  116,121,112,101, 40, 50, 41, 46, 46, 39, 41, 39, 41, 10,111,
-  117,116,112,117,116, 40, 39, 32,116,111,108,117, 97, 95,101,
-  114,114,111,114, 40,116,111,108,117, 97, 95, 83, 44, 34, 35,
-  118,105,110,118, 97,108,105,100, 32,116,121,112,101, 32,105,
-  110, 32,118, 97,114,105, 97, 98,108,101, 32, 97,115,115,105,
-  103,110,109,101,110,116, 46, 34, 44, 38,116,111,108,117, 97,
-   95,101,114,114, 41, 59, 39, 41, 10,111,117,116,112,117,116,
-   40, 39, 35,101,110,100,105,102, 92,110, 39, 41, 10,108,111,
-   99, 97,108, 32,100,101,102, 32, 61, 32, 48, 10,105,102, 32,
-  115,101,108,102, 46,100,101,102, 32,126, 61, 32, 39, 39, 32,
-  116,104,101,110, 32,100,101,102, 32, 61, 32,115,101,108,102,
-   46,100,101,102, 32,101,110,100, 10,105,102, 32,115,101,108,
-  102, 46,116,121,112,101, 32, 61, 61, 32, 39, 99,104, 97,114,
-   42, 39, 32, 97,110,100, 32,115,101,108,102, 46,100,105,109,
-   32,126, 61, 32, 39, 39, 32,116,104,101,110, 10,111,117,116,
-  112,117,116, 40, 39, 32,115,116,114,110, 99,112,121, 40, 40,
-   99,104, 97,114, 42, 41, 39, 41, 10,105,102, 32, 99,108, 97,
-  115,115, 32, 97,110,100, 32,115,116, 97,116,105, 99, 32,116,
-  104,101,110, 10,111,117,116,112,117,116, 40,115,101,108,102,
-   46,112, 97,114,101,110,116, 46,116,121,112,101, 46, 46, 39,
-   58, 58, 39, 46, 46,115,101,108,102, 46,110, 97,109,101, 41,
-   10,101,108,115,101,105,102, 32, 99,108, 97,115,115, 32,116,
-  104,101,110, 10,111,117,116,112,117,116, 40, 39,115,101,108,
-  102, 45, 62, 39, 46, 46,115,101,108,102, 46,110, 97,109,101,
-   41, 10,101,108,115,101, 10,111,117,116,112,117,116, 40,115,
-  101,108,102, 46,110, 97,109,101, 41, 10,101,110,100, 10,111,
-  117,116,112,117,116, 40, 39, 44, 40, 99,111,110,115,116, 32,
-   99,104, 97,114, 42, 41,116,111,108,117, 97, 95,116,111,115,
-  116,114,105,110,103, 40,116,111,108,117, 97, 95, 83, 44, 50,
-   44, 39, 44,100,101,102, 44, 39, 41, 44, 39, 44,115,101,108,
-  102, 46,100,105,109, 44, 39, 45, 49, 41, 59, 39, 41, 10,101,
-  108,115,101, 10,108,111, 99, 97,108, 32,112,116,114, 32, 61,
-   32, 39, 39, 10,105,102, 32,115,101,108,102, 46,112,116,114,
-  126, 61, 39, 39, 32,116,104,101,110, 32,112,116,114, 32, 61,
-   32, 39, 42, 39, 32,101,110,100, 10,111,117,116,112,117,116,
-   40, 39, 32, 39, 41, 10,108,111, 99, 97,108, 32,110, 97,109,
-  101, 32, 61, 32,112,114,111,112, 95,115,101,116, 32,111,114,
-   32,115,101,108,102, 46,110, 97,109,101, 10,105,102, 32, 99,
-  108, 97,115,115, 32, 97,110,100, 32,115,116, 97,116,105, 99,
-   32,116,104,101,110, 10,111,117,116,112,117,116, 40,115,101,
-  108,102, 46,112, 97,114,101,110,116, 46,116,121,112,101, 46,
-   46, 39, 58, 58, 39, 46, 46,110, 97,109,101, 41, 10,101,108,
-  115,101,105,102, 32, 99,108, 97,115,115, 32,116,104,101,110,
-   10,111,117,116,112,117,116, 40, 39,115,101,108,102, 45, 62,
-   39, 46, 46,110, 97,109,101, 41, 10,101,108,115,101, 10,111,
-  117,116,112,117,116, 40,110, 97,109,101, 41, 10,101,110,100,
-   10,108,111, 99, 97,108, 32,116, 32, 61, 32,105,115, 98, 97,
-  115,105, 99, 40,115,101,108,102, 46,116,121,112,101, 41, 10,
-  105,102, 32,112,114,111,112, 95,115,101,116, 32,116,104,101,
-  110, 10,111,117,116,112,117,116, 40, 39, 40, 39, 41, 10,101,
-  108,115,101, 10,111,117,116,112,117,116, 40, 39, 32, 61, 32,
-   39, 41, 10,101,110,100, 10,105,102, 32,110,111,116, 32,116,
-   32, 97,110,100, 32,112,116,114, 61, 61, 39, 39, 32,116,104,
-  101,110, 32,111,117,116,112,117,116, 40, 39, 42, 39, 41, 32,
-  101,110,100, 10,105,102, 32,115,101,108,102, 46,112,116,114,
-   32,126, 61, 32, 39, 38, 39, 32,116,104,101,110, 10,111,117,
-  116,112,117,116, 40, 39, 40, 40, 39, 44,115,101,108,102, 46,
-  109,111,100, 44,115,101,108,102, 46,116,121,112,101, 41, 10,
-  101,108,115,101, 10,111,117,116,112,117,116, 40, 39, 40, 42,
-   40, 39, 44,115,101,108,102, 46,109,111,100, 44,115,101,108,
-  102, 46,116,121,112,101, 41, 10,101,110,100, 10,105,102, 32,
-  110,111,116, 32,116, 32,116,104,101,110, 10,111,117,116,112,
-  117,116, 40, 39, 42, 39, 41, 10,101,110,100, 10,111,117,116,
-  112,117,116, 40, 39, 41, 32, 39, 41, 10,105,102, 32,116, 32,
-  116,104,101,110, 10,105,102, 32,105,115,101,110,117,109, 40,
-  115,101,108,102, 46,116,121,112,101, 41, 32,116,104,101,110,
-   10,111,117,116,112,117,116, 40, 39, 40,105,110,116, 41, 32,
-   39, 41, 10,101,110,100, 10,111,117,116,112,117,116, 40, 39,
-  116,111,108,117, 97, 95,116,111, 39, 46, 46,116, 44, 39, 40,
-  116,111,108,117, 97, 95, 83, 44, 50, 44, 39, 44,100,101,102,
-   44, 39, 41, 41, 39, 41, 10,101,108,115,101, 10,108,111, 99,
-   97,108, 32,116,111, 95,102,117,110, 99, 32, 61, 32,103,101,
-  116, 95,116,111, 95,102,117,110, 99,116,105,111,110, 40,115,
-  101,108,102, 46,116,121,112,101, 41, 10,111,117,116,112,117,
-  116, 40,116,111, 95,102,117,110, 99, 44, 39, 40,116,111,108,
-  117, 97, 95, 83, 44, 50, 44, 39, 44,100,101,102, 44, 39, 41,
-   41, 39, 41, 10,101,110,100, 10,105,102, 32,112,114,111,112,
-   95,115,101,116, 32,116,104,101,110, 10,111,117,116,112,117,
-  116, 40, 34, 41, 34, 41, 10,101,110,100, 10,111,117,116,112,
-  117,116, 40, 34, 59, 34, 41, 10,101,110,100, 10,111,117,116,
-  112,117,116, 40, 39, 32,114,101,116,117,114,110, 32, 48, 59,
-   39, 41, 10,111,117,116,112,117,116, 40, 39,125, 39, 41, 10,
-  111,117,116,112,117,116, 40, 39, 35,101,110,100,105,102, 32,
-   47, 47, 35,105,102,110,100,101,102, 32, 84, 79, 76, 85, 65,
-   95, 68, 73, 83, 65, 66, 76, 69, 92,110, 39, 41, 10,111,117,
-  116,112,117,116, 40, 39, 92,110, 39, 41, 10,101,110,100, 10,
-  101,110,100, 10,102,117,110, 99,116,105,111,110, 32, 99,108,
-   97,115,115, 86, 97,114,105, 97, 98,108,101, 58,114,101,103,
-  105,115,116,101,114, 32, 40,112,114,101, 41, 10,105,102, 32,
-  110,111,116, 32,115,101,108,102, 58, 99,104,101, 99,107, 95,
-  112,117, 98,108,105, 99, 95, 97, 99, 99,101,115,115, 40, 41,
-   32,116,104,101,110, 10,114,101,116,117,114,110, 10,101,110,
-  100, 10,112,114,101, 32, 61, 32,112,114,101, 32,111,114, 32,
-   39, 39, 10,108,111, 99, 97,108, 32,112, 97,114,101,110,116,
-   32, 61, 32,115,101,108,102, 58,105,110,109,111,100,117,108,
-  101, 40, 41, 32,111,114, 32,115,101,108,102, 58,105,110,110,
-   97,109,101,115,112, 97, 99,101, 40, 41, 32,111,114, 32,115,
-  101,108,102, 58,105,110, 99,108, 97,115,115, 40, 41, 10,105,
-  102, 32,110,111,116, 32,112, 97,114,101,110,116, 32,116,104,
-  101,110, 10,105,102, 32, 99,108, 97,115,115, 86, 97,114,105,
-   97, 98,108,101, 46, 95,119, 97,114,110,105,110,103, 61, 61,
-  110,105,108, 32,116,104,101,110, 10,119, 97,114,110,105,110,
-  103, 40, 34, 77, 97,112,112,105,110,103, 32,118, 97,114,105,
-   97, 98,108,101, 32,116,111, 32,103,108,111, 98, 97,108, 32,
-  109, 97,121, 32,100,101,103,114, 97,100,101, 32,112,101,114,
-  102,111,114,109, 97,110, 99,101, 34, 41, 10, 99,108, 97,115,
-  115, 86, 97,114,105, 97, 98,108,101, 46, 95,119, 97,114,110,
-  105,110,103, 32, 61, 32, 49, 10,101,110,100, 10,101,110,100,
-   10,105,102, 32,115,101,108,102, 46, 99,115,101,116,110, 97,
-  109,101, 32,116,104,101,110, 10,111,117,116,112,117,116, 40,
+   99, 32,116,104,101,110, 10,111,117,116,112,117,116, 40,115,
+  101,108,102, 46,112, 97,114,101,110,116, 46,116,121,112,101,
+   46, 46, 39, 58, 58, 39, 46, 46,110, 97,109,101, 41, 10,101,
+  108,115,101,105,102, 32, 99,108, 97,115,115, 32,116,104,101,
+  110, 10,111,117,116,112,117,116, 40, 39,115,101,108,102, 45,
+   62, 39, 46, 46,110, 97,109,101, 41, 10,101,108,115,101, 10,
+  111,117,116,112,117,116, 40,110, 97,109,101, 41, 10,101,110,
+  100, 10,108,111, 99, 97,108, 32,116, 32, 61, 32,105,115, 98,
+   97,115,105, 99, 40,115,101,108,102, 46,116,121,112,101, 41,
+   10,105,102, 32,112,114,111,112, 95,115,101,116, 32,116,104,
+  101,110, 10,111,117,116,112,117,116, 40, 39, 40, 39, 41, 10,
+  101,108,115,101, 10,111,117,116,112,117,116, 40, 39, 32, 61,
+   32, 39, 41, 10,101,110,100, 10,105,102, 32,110,111,116, 32,
+  116, 32, 97,110,100, 32,112,116,114, 61, 61, 39, 39, 32,116,
+  104,101,110, 32,111,117,116,112,117,116, 40, 39, 42, 39, 41,
+   32,101,110,100, 10,105,102, 32,115,101,108,102, 46,112,116,
+  114, 32,126, 61, 32, 39, 38, 39, 32,116,104,101,110, 10,111,
+  117,116,112,117,116, 40, 39, 40, 40, 39, 44,115,101,108,102,
+   46,109,111,100, 44,115,101,108,102, 46,116,121,112,101, 41,
+   10,101,108,115,101, 10,111,117,116,112,117,116, 40, 39, 40,
+   42, 40, 39, 44,115,101,108,102, 46,109,111,100, 44,115,101,
+  108,102, 46,116,121,112,101, 41, 10,101,110,100, 10,105,102,
+   32,110,111,116, 32,116, 32,116,104,101,110, 10,111,117,116,
+  112,117,116, 40, 39, 42, 39, 41, 10,101,110,100, 10,111,117,
+  116,112,117,116, 40, 39, 41, 32, 39, 41, 10,105,102, 32,116,
+   32,116,104,101,110, 10,105,102, 32,105,115,101,110,117,109,
+   40,115,101,108,102, 46,116,121,112,101, 41, 32,116,104,101,
+  110, 10,111,117,116,112,117,116, 40, 39, 40,105,110,116, 41,
+   32, 39, 41, 10,101,110,100, 10,111,117,116,112,117,116, 40,
+   39,116,111,108,117, 97, 95,116,111, 39, 46, 46,116, 44, 39,
+   40,116,111,108,117, 97, 95, 83, 44, 50, 44, 39, 44,100,101,
+  102, 44, 39, 41, 41, 39, 41, 10,101,108,115,101, 10,108,111,
+   99, 97,108, 32,116,111, 95,102,117,110, 99, 32, 61, 32,103,
+  101,116, 95,116,111, 95,102,117,110, 99,116,105,111,110, 40,
+  115,101,108,102, 46,116,121,112,101, 41, 10,111,117,116,112,
+  117,116, 40,116,111, 95,102,117,110, 99, 44, 39, 40,116,111,
+  108,117, 97, 95, 83, 44, 50, 44, 39, 44,100,101,102, 44, 39,
+   41, 41, 39, 41, 10,101,110,100, 10,105,102, 32,112,114,111,
+  112, 95,115,101,116, 32,116,104,101,110, 10,111,117,116,112,
+  117,116, 40, 34, 41, 34, 41, 10,101,110,100, 10,111,117,116,
+  112,117,116, 40, 34, 59, 34, 41, 10,101,110,100, 10,111,117,
+  116,112,117,116, 40, 39, 32,114,101,116,117,114,110, 32, 48,
+   59, 39, 41, 10,111,117,116,112,117,116, 40, 39,125, 39, 41,
+   10,111,117,116,112,117,116, 40, 39, 35,101,110,100,105,102,
+   32, 47, 47, 35,105,102,110,100,101,102, 32, 84, 79, 76, 85,
+   65, 95, 68, 73, 83, 65, 66, 76, 69, 92,110, 39, 41, 10,111,
+  117,116,112,117,116, 40, 39, 92,110, 39, 41, 10,101,110,100,
+   10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32, 99,
+  108, 97,115,115, 86, 97,114,105, 97, 98,108,101, 58,114,101,
+  103,105,115,116,101,114, 32, 40,112,114,101, 41, 10,105,102,
+   32,110,111,116, 32,115,101,108,102, 58, 99,104,101, 99,107,
+   95,112,117, 98,108,105, 99, 95, 97, 99, 99,101,115,115, 40,
+   41, 32,116,104,101,110, 10,114,101,116,117,114,110, 10,101,
+  110,100, 10,112,114,101, 32, 61, 32,112,114,101, 32,111,114,
+   32, 39, 39, 10,108,111, 99, 97,108, 32,112, 97,114,101,110,
+  116, 32, 61, 32,115,101,108,102, 58,105,110,109,111,100,117,
+  108,101, 40, 41, 32,111,114, 32,115,101,108,102, 58,105,110,
+  110, 97,109,101,115,112, 97, 99,101, 40, 41, 32,111,114, 32,
+  115,101,108,102, 58,105,110, 99,108, 97,115,115, 40, 41, 10,
+  105,102, 32,110,111,116, 32,112, 97,114,101,110,116, 32,116,
+  104,101,110, 10,105,102, 32, 99,108, 97,115,115, 86, 97,114,
+  105, 97, 98,108,101, 46, 95,119, 97,114,110,105,110,103, 61,
+   61,110,105,108, 32,116,104,101,110, 10,119, 97,114,110,105,
+  110,103, 40, 34, 77, 97,112,112,105,110,103, 32,118, 97,114,
+  105, 97, 98,108,101, 32,116,111, 32,103,108,111, 98, 97,108,
+   32,109, 97,121, 32,100,101,103,114, 97,100,101, 32,112,101,
+  114,102,111,114,109, 97,110, 99,101, 34, 41, 10, 99,108, 97,
+  115,115, 86, 97,114,105, 97, 98,108,101, 46, 95,119, 97,114,
+  110,105,110,103, 32, 61, 32, 49, 10,101,110,100, 10,101,110,
+  100, 10,105,102, 32,115,101,108,102, 46, 99,115,101,116,110,
+   97,109,101, 32,116,104,101,110, 10,111,117,116,112,117,116,
+   40,112,114,101, 46, 46, 39,116,111,108,117, 97, 95,118, 97,
+  114,105, 97, 98,108,101, 40,116,111,108,117, 97, 95, 83, 44,
+   34, 39, 46, 46,115,101,108,102, 46,108,110, 97,109,101, 46,
+   46, 39, 34, 44, 39, 46, 46,115,101,108,102, 46, 99,103,101,
+  116,110, 97,109,101, 46, 46, 39, 44, 39, 46, 46,115,101,108,
+  102, 46, 99,115,101,116,110, 97,109,101, 46, 46, 39, 41, 59,
+   39, 41, 10,101,108,115,101, 10,111,117,116,112,117,116, 40,
   112,114,101, 46, 46, 39,116,111,108,117, 97, 95,118, 97,114,
   105, 97, 98,108,101, 40,116,111,108,117, 97, 95, 83, 44, 34,
    39, 46, 46,115,101,108,102, 46,108,110, 97,109,101, 46, 46,
    39, 34, 44, 39, 46, 46,115,101,108,102, 46, 99,103,101,116,
-  110, 97,109,101, 46, 46, 39, 44, 39, 46, 46,115,101,108,102,
-   46, 99,115,101,116,110, 97,109,101, 46, 46, 39, 41, 59, 39,
-   41, 10,101,108,115,101, 10,111,117,116,112,117,116, 40,112,
-  114,101, 46, 46, 39,116,111,108,117, 97, 95,118, 97,114,105,
-   97, 98,108,101, 40,116,111,108,117, 97, 95, 83, 44, 34, 39,
-   46, 46,115,101,108,102, 46,108,110, 97,109,101, 46, 46, 39,
-   34, 44, 39, 46, 46,115,101,108,102, 46, 99,103,101,116,110,
-   97,109,101, 46, 46, 39, 44, 78, 85, 76, 76, 41, 59, 39, 41,
-   10,101,110,100, 10,101,110,100, 10,102,117,110, 99,116,105,
-  111,110, 32, 95, 86, 97,114,105, 97, 98,108,101, 32, 40,116,
-   41, 10,115,101,116,109,101,116, 97,116, 97, 98,108,101, 40,
-  116, 44, 99,108, 97,115,115, 86, 97,114,105, 97, 98,108,101,
-   41, 10, 97,112,112,101,110,100, 40,116, 41, 10,114,101,116,
-  117,114,110, 32,116, 10,101,110,100, 10,102,117,110, 99,116,
-  105,111,110, 32, 86, 97,114,105, 97, 98,108,101, 32, 40,115,
-   41, 10,114,101,116,117,114,110, 32, 95, 86, 97,114,105, 97,
-   98,108,101, 32, 40, 68,101, 99,108, 97,114, 97,116,105,111,
-  110, 40,115, 44, 39,118, 97,114, 39, 41, 41, 10,101,110,100,
-   45, 45, 45, 45, 45, 45, 45, 45, 45, 45,32
+  110, 97,109,101, 46, 46, 39, 44, 78, 85, 76, 76, 41, 59, 39,
+   41, 10,101,110,100, 10,101,110,100, 10,102,117,110, 99,116,
+  105,111,110, 32, 95, 86, 97,114,105, 97, 98,108,101, 32, 40,
+  116, 41, 10,115,101,116,109,101,116, 97,116, 97, 98,108,101,
+   40,116, 44, 99,108, 97,115,115, 86, 97,114,105, 97, 98,108,
+  101, 41, 10, 97,112,112,101,110,100, 40,116, 41, 10,114,101,
+  116,117,114,110, 32,116, 10,101,110,100, 10,102,117,110, 99,
+  116,105,111,110, 32, 86, 97,114,105, 97, 98,108,101, 32, 40,
+  115, 41, 10,114,101,116,117,114,110, 32, 95, 86, 97,114,105,
+   97, 98,108,101, 32, 40, 68,101, 99,108, 97,114, 97,116,105,
+  111,110, 40,115, 44, 39,118, 97,114, 39, 41, 41, 10,101,110,
+  100, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,32
   };
   tolua_dobuffer(tolua_S,(char*)B,sizeof(B),"tolua embedded: lua/variable.lua");
   lua_settop(tolua_S, top);
@@ -4590,110 +4639,150 @@ TOLUA_API int tolua_tolua_open (lua_State* tolua_S)
    39, 41, 32, 61, 32, 39, 44,115,101,108,102, 46, 97,114,103,
   115, 91, 50, 93, 46,110, 97,109,101, 44, 39, 59, 39, 41, 10,
   101,110,100, 10,101,108,115,101, 10,111,117,116,112,117,116,
-   40, 39, 32,123, 39, 41, 10,105,102, 32,115,101,108,102, 46,
-  116,121,112,101, 32,126, 61, 32, 39, 39, 32, 97,110,100, 32,
-  115,101,108,102, 46,116,121,112,101, 32,126, 61, 32, 39,118,
-  111,105,100, 39, 32,116,104,101,110, 10,111,117,116,112,117,
-  116, 40, 39, 32, 39, 44,115,101,108,102, 46,109,111,100, 44,
-  115,101,108,102, 46,116,121,112,101, 44,115,101,108,102, 46,
-  112,116,114, 44, 39,116,111,108,117, 97, 95,114,101,116, 32,
-   61, 32, 39, 41, 10,111,117,116,112,117,116, 40, 39, 40, 39,
-   44,115,101,108,102, 46,109,111,100, 44,115,101,108,102, 46,
-  116,121,112,101, 44,115,101,108,102, 46,112,116,114, 44, 39,
-   41, 32, 39, 41, 10,101,108,115,101, 10,111,117,116,112,117,
-  116, 40, 39, 32, 39, 41, 10,101,110,100, 10,105,102, 32, 99,
-  108, 97,115,115, 32, 97,110,100, 32,115,101,108,102, 46,110,
-   97,109,101, 61, 61, 39,110,101,119, 39, 32,116,104,101,110,
-   10,111,117,116,112,117,116, 40, 39, 77,116,111,108,117, 97,
-   95,110,101,119, 40, 40, 39, 44,115,101,108,102, 46,116,121,
-  112,101, 44, 39, 41, 40, 39, 41, 10,101,108,115,101,105,102,
-   32, 99,108, 97,115,115, 32, 97,110,100, 32,115,116, 97,116,
-  105, 99, 32,116,104,101,110, 10,105,102, 32,111,117,116, 32,
+   40, 39, 32,123, 39, 41, 10,108,111, 99, 97,108, 32,118, 97,
+  108,117,101, 95,110,101,119, 32, 61, 32, 99,108, 97,115,115,
+   32, 97,110,100, 32,115,101,108,102, 46,110, 97,109,101, 61,
+   61, 39,110,101,119, 39, 32, 97,110,100, 32,108,111, 99, 97,
+  108, 95, 99,111,110,115,116,114,117, 99,116,111,114, 32, 97,
+  110,100, 32,105,115, 95,118, 97,108,117,101, 95,116,121,112,
+  101, 40,115,101,108,102, 46,116,121,112,101, 41, 10,105,102,
+   32,118, 97,108,117,101, 95,110,101,119, 32,116,104,101,110,
+   10,111,117,116,112,117,116, 40, 39, 32, 39, 44,115,101,108,
+  102, 46,116,121,112,101, 44, 39, 32,116,111,108,117, 97, 95,
+  114,101,116, 32, 61, 32, 39, 41, 10,101,108,115,101,105,102,
+   32,115,101,108,102, 46,116,121,112,101, 32,126, 61, 32, 39,
+   39, 32, 97,110,100, 32,115,101,108,102, 46,116,121,112,101,
+   32,126, 61, 32, 39,118,111,105,100, 39, 32,116,104,101,110,
+   10,111,117,116,112,117,116, 40, 39, 32, 39, 44,115,101,108,
+  102, 46,109,111,100, 44,115,101,108,102, 46,116,121,112,101,
+   44,115,101,108,102, 46,112,116,114, 44, 39,116,111,108,117,
+   97, 95,114,101,116, 32, 61, 32, 39, 41, 10,111,117,116,112,
+  117,116, 40, 39, 40, 39, 44,115,101,108,102, 46,109,111,100,
+   44,115,101,108,102, 46,116,121,112,101, 44,115,101,108,102,
+   46,112,116,114, 44, 39, 41, 32, 39, 41, 10,101,108,115,101,
+   10,111,117,116,112,117,116, 40, 39, 32, 39, 41, 10,101,110,
+  100, 10,105,102, 32,118, 97,108,117,101, 95,110,101,119, 32,
   116,104,101,110, 10,111,117,116,112,117,116, 40,115,101,108,
-  102, 46,110, 97,109,101, 44, 39, 40, 39, 41, 10,101,108,115,
-  101, 10,111,117,116,112,117,116, 40, 99,108, 97,115,115, 46,
-   46, 39, 58, 58, 39, 46, 46,115,101,108,102, 46,110, 97,109,
-  101, 44, 39, 40, 39, 41, 10,101,110,100, 10,101,108,115,101,
-  105,102, 32, 99,108, 97,115,115, 32,116,104,101,110, 10,105,
-  102, 32,111,117,116, 32,116,104,101,110, 10,111,117,116,112,
-  117,116, 40,115,101,108,102, 46,110, 97,109,101, 44, 39, 40,
-   39, 41, 10,101,108,115,101, 10,105,102, 32,115,101,108,102,
-   46, 99, 97,115,116, 95,111,112,101,114, 97,116,111,114, 32,
-  116,104,101,110, 10,111,117,116,112,117,116, 40, 39,115,101,
-  108,102, 45, 62,111,112,101,114, 97,116,111,114, 32, 39, 44,
-  115,101,108,102, 46,109,111,100, 44,115,101,108,102, 46,116,
-  121,112,101, 44, 39, 40, 39, 41, 10,101,108,115,101, 10,111,
-  117,116,112,117,116, 40, 39,115,101,108,102, 45, 62, 39, 46,
-   46,115,101,108,102, 46,110, 97,109,101, 44, 39, 40, 39, 41,
-   10,101,110,100, 10,101,110,100, 10,101,108,115,101, 10,111,
-  117,116,112,117,116, 40,115,101,108,102, 46,110, 97,109,101,
-   44, 39, 40, 39, 41, 10,101,110,100, 10,105,102, 32,111,117,
-  116, 32, 97,110,100, 32,110,111,116, 32,115,116, 97,116,105,
-   99, 32,116,104,101,110, 10,111,117,116,112,117,116, 40, 39,
-  115,101,108,102, 39, 41, 10,105,102, 32,115,101,108,102, 46,
-   97,114,103,115, 91, 49, 93, 32, 97,110,100, 32,115,101,108,
-  102, 46, 97,114,103,115, 91, 49, 93, 46,110, 97,109,101, 32,
-  126, 61, 32, 39, 39, 32,116,104,101,110, 10,111,117,116,112,
-  117,116, 40, 39, 44, 39, 41, 10,101,110,100, 10,101,110,100,
-   10,108,111, 99, 97,108, 32,105, 61, 49, 10,119,104,105,108,
-  101, 32,115,101,108,102, 46, 97,114,103,115, 91,105, 93, 32,
-  100,111, 10,115,101,108,102, 46, 97,114,103,115, 91,105, 93,
-   58,112, 97,115,115,112, 97,114, 40, 41, 10,105, 32, 61, 32,
-  105, 43, 49, 10,105,102, 32,115,101,108,102, 46, 97,114,103,
-  115, 91,105, 93, 32,116,104,101,110, 10,111,117,116,112,117,
-  116, 40, 39, 44, 39, 41, 10,101,110,100, 10,101,110,100, 10,
-  105,102, 32, 99,108, 97,115,115, 32, 97,110,100, 32,115,101,
-  108,102, 46,110, 97,109,101, 32, 61, 61, 32, 39,111,112,101,
-  114, 97,116,111,114, 91, 93, 39, 32, 97,110,100, 32,102,108,
-   97,103,115, 91, 39, 49, 39, 93, 32,116,104,101,110, 10,111,
-  117,116,112,117,116, 40, 39, 45, 49, 41, 59, 39, 41, 10,101,
-  108,115,101, 10,105,102, 32, 99,108, 97,115,115, 32, 97,110,
-  100, 32,115,101,108,102, 46,110, 97,109,101, 61, 61, 39,110,
-  101,119, 39, 32,116,104,101,110, 10,111,117,116,112,117,116,
-   40, 39, 41, 41, 59, 39, 41, 10,101,108,115,101, 10,111,117,
-  116,112,117,116, 40, 39, 41, 59, 39, 41, 10,101,110,100, 10,
-  101,110,100, 10,105,102, 32,115,101,108,102, 46,116,121,112,
-  101, 32,126, 61, 32, 39, 39, 32, 97,110,100, 32,115,101,108,
-  102, 46,116,121,112,101, 32,126, 61, 32, 39,118,111,105,100,
-   39, 32,116,104,101,110, 10,110,114,101,116, 32, 61, 32,110,
-  114,101,116, 32, 43, 32, 49, 10,108,111, 99, 97,108, 32,116,
-   44, 99,116, 32, 61, 32,105,115, 98, 97,115,105, 99, 40,115,
-  101,108,102, 46,116,121,112,101, 41, 10,105,102, 32,116, 32,
-   97,110,100, 32,115,101,108,102, 46,110, 97,109,101, 32,126,
-   61, 32, 34,110,101,119, 34, 32,116,104,101,110, 10,105,102,
+  102, 46,116,121,112,101, 44, 39, 40, 39, 41, 10,101,108,115,
+  101,105,102, 32, 99,108, 97,115,115, 32, 97,110,100, 32,115,
+  101,108,102, 46,110, 97,109,101, 61, 61, 39,110,101,119, 39,
+   32,116,104,101,110, 10,111,117,116,112,117,116, 40, 39, 77,
+  116,111,108,117, 97, 95,110,101,119, 40, 40, 39, 44,115,101,
+  108,102, 46,116,121,112,101, 44, 39, 41, 40, 39, 41, 10,101,
+  108,115,101,105,102, 32, 99,108, 97,115,115, 32, 97,110,100,
+   32,115,116, 97,116,105, 99, 32,116,104,101,110, 10,105,102,
+   32,111,117,116, 32,116,104,101,110, 10,111,117,116,112,117,
+  116, 40,115,101,108,102, 46,110, 97,109,101, 44, 39, 40, 39,
+   41, 10,101,108,115,101, 10,111,117,116,112,117,116, 40, 99,
+  108, 97,115,115, 46, 46, 39, 58, 58, 39, 46, 46,115,101,108,
+  102, 46,110, 97,109,101, 44, 39, 40, 39, 41, 10,101,110,100,
+   10,101,108,115,101,105,102, 32, 99,108, 97,115,115, 32,116,
+  104,101,110, 10,105,102, 32,111,117,116, 32,116,104,101,110,
+   10,111,117,116,112,117,116, 40,115,101,108,102, 46,110, 97,
+  109,101, 44, 39, 40, 39, 41, 10,101,108,115,101, 10,105,102,
    32,115,101,108,102, 46, 99, 97,115,116, 95,111,112,101,114,
-   97,116,111,114, 32, 97,110,100, 32, 95, 98, 97,115,105, 99,
-   95,114, 97,119, 95,112,117,115,104, 91,116, 93, 32,116,104,
-  101,110, 10,111,117,116,112,117,116, 40, 39, 32, 39, 44, 95,
-   98, 97,115,105, 99, 95,114, 97,119, 95,112,117,115,104, 91,
-  116, 93, 44, 39, 40,116,111,108,117, 97, 95, 83, 44, 40, 39,
-   44, 99,116, 44, 39, 41,116,111,108,117, 97, 95,114,101,116,
-   41, 59, 39, 41, 10,101,108,115,101, 10,111,117,116,112,117,
-  116, 40, 39, 32,116,111,108,117, 97, 95,112,117,115,104, 39,
-   46, 46,116, 46, 46, 39, 40,116,111,108,117, 97, 95, 83, 44,
-   40, 39, 44, 99,116, 44, 39, 41,116,111,108,117, 97, 95,114,
-  101,116, 41, 59, 39, 41, 10,101,110,100, 10,101,108,115,101,
-   10,116, 32, 61, 32,115,101,108,102, 46,116,121,112,101, 10,
-  110,101,119, 95,116, 32, 61, 32,115,116,114,105,110,103, 46,
-  103,115,117, 98, 40,116, 44, 32, 34, 99,111,110,115,116, 37,
-  115, 43, 34, 44, 32, 34, 34, 41, 10,108,111, 99, 97,108, 32,
-  111,119,110,101,100, 32, 61, 32,102, 97,108,115,101, 10,105,
-  102, 32,115,116,114,105,110,103, 46,102,105,110,100, 40,115,
-  101,108,102, 46,109,111,100, 44, 32, 34,116,111,108,117, 97,
-   95,111,119,110,101,100, 34, 41, 32,116,104,101,110, 10,111,
-  119,110,101,100, 32, 61, 32,116,114,117,101, 10,101,110,100,
-   10,108,111, 99, 97,108, 32,112,117,115,104, 95,102,117,110,
-   99, 32, 61, 32,103,101,116, 95,112,117,115,104, 95,102,117,
-  110, 99,116,105,111,110, 40,116, 41, 10,105,102, 32,115,101,
-  108,102, 46,112,116,114, 32, 61, 61, 32, 39, 39, 32,116,104,
-  101,110, 10,111,117,116,112,117,116, 40, 39, 32,123, 39, 41,
-   10,111,117,116,112,117,116, 40, 39, 35,105,102,100,101,102,
-   32, 95, 95, 99,112,108,117,115,112,108,117,115, 92,110, 39,
-   41, 10,111,117,116,112,117,116, 40, 39, 32,118,111,105,100,
-   42, 32,116,111,108,117, 97, 95,111, 98,106, 32, 61, 32, 77,
-  116,111,108,117, 97, 95,110,101,119, 40, 40, 39, 44,110,101,
-  119, 95,116, 44, 39, 41, 40,116,111,108,117, 97, 95,114,101,
-  116, 41, 41, 59, 39, 41, 10,111,117,116,112,117,116, 40, 39,
+   97,116,111,114, 32,116,104,101,110, 10,111,117,116,112,117,
+  116, 40, 39,115,101,108,102, 45, 62,111,112,101,114, 97,116,
+  111,114, 32, 39, 44,115,101,108,102, 46,109,111,100, 44,115,
+  101,108,102, 46,116,121,112,101, 44, 39, 40, 39, 41, 10,101,
+  108,115,101, 10,111,117,116,112,117,116, 40, 39,115,101,108,
+  102, 45, 62, 39, 46, 46,115,101,108,102, 46,110, 97,109,101,
+   44, 39, 40, 39, 41, 10,101,110,100, 10,101,110,100, 10,101,
+  108,115,101, 10,111,117,116,112,117,116, 40,115,101,108,102,
+   46,110, 97,109,101, 44, 39, 40, 39, 41, 10,101,110,100, 10,
+  105,102, 32,111,117,116, 32, 97,110,100, 32,110,111,116, 32,
+  115,116, 97,116,105, 99, 32,116,104,101,110, 10,111,117,116,
+  112,117,116, 40, 39,115,101,108,102, 39, 41, 10,105,102, 32,
+  115,101,108,102, 46, 97,114,103,115, 91, 49, 93, 32, 97,110,
+  100, 32,115,101,108,102, 46, 97,114,103,115, 91, 49, 93, 46,
+  110, 97,109,101, 32,126, 61, 32, 39, 39, 32,116,104,101,110,
+   10,111,117,116,112,117,116, 40, 39, 44, 39, 41, 10,101,110,
+  100, 10,101,110,100, 10,108,111, 99, 97,108, 32,105, 61, 49,
+   10,119,104,105,108,101, 32,115,101,108,102, 46, 97,114,103,
+  115, 91,105, 93, 32,100,111, 10,115,101,108,102, 46, 97,114,
+  103,115, 91,105, 93, 58,112, 97,115,115,112, 97,114, 40, 41,
+   10,105, 32, 61, 32,105, 43, 49, 10,105,102, 32,115,101,108,
+  102, 46, 97,114,103,115, 91,105, 93, 32,116,104,101,110, 10,
+  111,117,116,112,117,116, 40, 39, 44, 39, 41, 10,101,110,100,
+   10,101,110,100, 10,105,102, 32, 99,108, 97,115,115, 32, 97,
+  110,100, 32,115,101,108,102, 46,110, 97,109,101, 32, 61, 61,
+   32, 39,111,112,101,114, 97,116,111,114, 91, 93, 39, 32, 97,
+  110,100, 32,102,108, 97,103,115, 91, 39, 49, 39, 93, 32,116,
+  104,101,110, 10,111,117,116,112,117,116, 40, 39, 45, 49, 41,
+   59, 39, 41, 10,101,108,115,101, 10,105,102, 32,118, 97,108,
+  117,101, 95,110,101,119, 32,116,104,101,110, 10,111,117,116,
+  112,117,116, 40, 39, 41, 59, 39, 41, 10,101,108,115,101,105,
+  102, 32, 99,108, 97,115,115, 32, 97,110,100, 32,115,101,108,
+  102, 46,110, 97,109,101, 61, 61, 39,110,101,119, 39, 32,116,
+  104,101,110, 10,111,117,116,112,117,116, 40, 39, 41, 41, 59,
+   39, 41, 10,101,108,115,101, 10,111,117,116,112,117,116, 40,
+   39, 41, 59, 39, 41, 10,101,110,100, 10,101,110,100, 10,105,
+  102, 32,115,101,108,102, 46,116,121,112,101, 32,126, 61, 32,
+   39, 39, 32, 97,110,100, 32,115,101,108,102, 46,116,121,112,
+  101, 32,126, 61, 32, 39,118,111,105,100, 39, 32,116,104,101,
+  110, 10,110,114,101,116, 32, 61, 32,110,114,101,116, 32, 43,
+   32, 49, 10,108,111, 99, 97,108, 32,116, 44, 99,116, 32, 61,
+   32,105,115, 98, 97,115,105, 99, 40,115,101,108,102, 46,116,
+  121,112,101, 41, 10,105,102, 32,116, 32, 97,110,100, 32,115,
+  101,108,102, 46,110, 97,109,101, 32,126, 61, 32, 34,110,101,
+  119, 34, 32,116,104,101,110, 10,105,102, 32,115,101,108,102,
+   46, 99, 97,115,116, 95,111,112,101,114, 97,116,111,114, 32,
+   97,110,100, 32, 95, 98, 97,115,105, 99, 95,114, 97,119, 95,
+  112,117,115,104, 91,116, 93, 32,116,104,101,110, 10,111,117,
+  116,112,117,116, 40, 39, 32, 39, 44, 95, 98, 97,115,105, 99,
+   95,114, 97,119, 95,112,117,115,104, 91,116, 93, 44, 39, 40,
+  116,111,108,117, 97, 95, 83, 44, 40, 39, 44, 99,116, 44, 39,
+   41,116,111,108,117, 97, 95,114,101,116, 41, 59, 39, 41, 10,
+  101,108,115,101, 10,111,117,116,112,117,116, 40, 39, 32,116,
+  111,108,117, 97, 95,112,117,115,104, 39, 46, 46,116, 46, 46,
+   39, 40,116,111,108,117, 97, 95, 83, 44, 40, 39, 44, 99,116,
+   44, 39, 41,116,111,108,117, 97, 95,114,101,116, 41, 59, 39,
+   41, 10,101,110,100, 10,101,108,115,101, 10,116, 32, 61, 32,
+  115,101,108,102, 46,116,121,112,101, 10,110,101,119, 95,116,
+   32, 61, 32,115,116,114,105,110,103, 46,103,115,117, 98, 40,
+  116, 44, 32, 34, 99,111,110,115,116, 37,115, 43, 34, 44, 32,
+   34, 34, 41, 10,108,111, 99, 97,108, 32,111,119,110,101,100,
+   32, 61, 32,102, 97,108,115,101, 10,105,102, 32,115,116,114,
+  105,110,103, 46,102,105,110,100, 40,115,101,108,102, 46,109,
+  111,100, 44, 32, 34,116,111,108,117, 97, 95,111,119,110,101,
+  100, 34, 41, 32,116,104,101,110, 10,111,119,110,101,100, 32,
+   61, 32,116,114,117,101, 10,101,110,100, 10,108,111, 99, 97,
+  108, 32,112,117,115,104, 95,102,117,110, 99, 32, 61, 32,103,
+  101,116, 95,112,117,115,104, 95,102,117,110, 99,116,105,111,
+  110, 40,116, 41, 10,105,102, 32,118, 97,108,117,101, 95,110,
+  101,119, 32,111,114, 32, 40,115,101,108,102, 46,112,116,114,
+   32, 61, 61, 32, 39, 39, 32, 97,110,100, 32,105,115, 95,118,
+   97,108,117,101, 95,116,121,112,101, 40,116, 41, 41, 32,116,
+  104,101,110, 10,111,117,116,112,117,116, 40, 39, 32,116,111,
+  108,117, 97, 95,112,117,115,104,117,115,101,114,116,121,112,
+  101, 95,118, 97,108,117,101, 40,116,111,108,117, 97, 95, 83,
+   44, 40,118,111,105,100, 42, 41, 38,116,111,108,117, 97, 95,
+  114,101,116, 44,115,105,122,101,111,102, 40, 39, 44,110,101,
+  119, 95,116, 44, 39, 41, 44, 34, 39, 44,116, 44, 39, 34, 41,
+   59, 39, 41, 10,101,108,115,101,105,102, 32,115,101,108,102,
+   46,112,116,114, 32, 61, 61, 32, 39, 39, 32,116,104,101,110,
+   10,111,117,116,112,117,116, 40, 39, 32,123, 39, 41, 10,111,
+  117,116,112,117,116, 40, 39, 35,105,102,100,101,102, 32, 95,
+   95, 99,112,108,117,115,112,108,117,115, 92,110, 39, 41, 10,
+  111,117,116,112,117,116, 40, 39, 32,118,111,105,100, 42, 32,
+  116,111,108,117, 97, 95,111, 98,106, 32, 61, 32, 77,116,111,
+  108,117, 97, 95,110,101,119, 40, 40, 39, 44,110,101,119, 95,
+  116, 44, 39, 41, 40,116,111,108,117, 97, 95,114,101,116, 41,
+   41, 59, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32, 39,
+   44,112,117,115,104, 95,102,117,110, 99, 44, 39, 40,116,111,
+  108,117, 97, 95, 83, 44,116,111,108,117, 97, 95,111, 98,106,
+   44, 34, 39, 44,116, 44, 39, 34, 41, 59, 39, 41, 10,111,117,
+  116,112,117,116, 40, 39, 32,116,111,108,117, 97, 95,114,101,
+  103,105,115,116,101,114, 95,103, 99, 40,116,111,108,117, 97,
+   95, 83, 44,108,117, 97, 95,103,101,116,116,111,112, 40,116,
+  111,108,117, 97, 95, 83, 41, 41, 59, 39, 41, 10,111,117,116,
+  112,117,116, 40, 39, 35,101,108,115,101, 92,110, 39, 41, 10,
+  111,117,116,112,117,116, 40, 39, 32,118,111,105,100, 42, 32,
+  116,111,108,117, 97, 95,111, 98,106, 32, 61, 32,116,111,108,
+  117, 97, 95, 99,111,112,121, 40,116,111,108,117, 97, 95, 83,
+   44, 40,118,111,105,100, 42, 41, 38,116,111,108,117, 97, 95,
+  114,101,116, 44,115,105,122,101,111,102, 40, 39, 44,116, 44,
+   39, 41, 41, 59, 39, 41, 10,111,117,116,112,117,116, 40, 39,
    32, 39, 44,112,117,115,104, 95,102,117,110, 99, 44, 39, 40,
   116,111,108,117, 97, 95, 83, 44,116,111,108,117, 97, 95,111,
    98,106, 44, 34, 39, 44,116, 44, 39, 34, 41, 59, 39, 41, 10,
@@ -4701,373 +4790,359 @@ TOLUA_API int tolua_tolua_open (lua_State* tolua_S)
   114,101,103,105,115,116,101,114, 95,103, 99, 40,116,111,108,
   117, 97, 95, 83, 44,108,117, 97, 95,103,101,116,116,111,112,
    40,116,111,108,117, 97, 95, 83, 41, 41, 59, 39, 41, 10,111,
-  117,116,112,117,116, 40, 39, 35,101,108,115,101, 92,110, 39,
-   41, 10,111,117,116,112,117,116, 40, 39, 32,118,111,105,100,
-   42, 32,116,111,108,117, 97, 95,111, 98,106, 32, 61, 32,116,
-  111,108,117, 97, 95, 99,111,112,121, 40,116,111,108,117, 97,
-   95, 83, 44, 40,118,111,105,100, 42, 41, 38,116,111,108,117,
-   97, 95,114,101,116, 44,115,105,122,101,111,102, 40, 39, 44,
-  116, 44, 39, 41, 41, 59, 39, 41, 10,111,117,116,112,117,116,
-   40, 39, 32, 39, 44,112,117,115,104, 95,102,117,110, 99, 44,
-   39, 40,116,111,108,117, 97, 95, 83, 44,116,111,108,117, 97,
-   95,111, 98,106, 44, 34, 39, 44,116, 44, 39, 34, 41, 59, 39,
-   41, 10,111,117,116,112,117,116, 40, 39, 32,116,111,108,117,
-   97, 95,114,101,103,105,115,116,101,114, 95,103, 99, 40,116,
-  111,108,117, 97, 95, 83, 44,108,117, 97, 95,103,101,116,116,
-  111,112, 40,116,111,108,117, 97, 95, 83, 41, 41, 59, 39, 41,
-   10,111,117,116,112,117,116, 40, 39, 35,101,110,100,105,102,
-   92,110, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32,125,
-   39, 41, 10,101,108,115,101,105,102, 32,115,101,108,102, 46,
-  112,116,114, 32, 61, 61, 32, 39, 38, 39, 32,116,104,101,110,
-   10,111,117,116,112,117,116, 40, 39, 32, 39, 44,112,117,115,
-  104, 95,102,117,110, 99, 44, 39, 40,116,111,108,117, 97, 95,
-   83, 44, 40,118,111,105,100, 42, 41, 38,116,111,108,117, 97,
-   95,114,101,116, 44, 34, 39, 44,116, 44, 39, 34, 41, 59, 39,
-   41, 10,101,108,115,101, 10,111,117,116,112,117,116, 40, 39,
-   32, 39, 44,112,117,115,104, 95,102,117,110, 99, 44, 39, 40,
-  116,111,108,117, 97, 95, 83, 44, 40,118,111,105,100, 42, 41,
-  116,111,108,117, 97, 95,114,101,116, 44, 34, 39, 44,116, 44,
-   39, 34, 41, 59, 39, 41, 10,105,102, 32,111,119,110,101,100,
-   32,111,114, 32,108,111, 99, 97,108, 95, 99,111,110,115,116,
-  114,117, 99,116,111,114, 32,116,104,101,110, 10,111,117,116,
-  112,117,116, 40, 39, 32,116,111,108,117, 97, 95,114,101,103,
-  105,115,116,101,114, 95,103, 99, 40,116,111,108,117, 97, 95,
-   83, 44,108,117, 97, 95,103,101,116,116,111,112, 40,116,111,
-  108,117, 97, 95, 83, 41, 41, 59, 39, 41, 10,101,110,100, 10,
-  101,110,100, 10,101,110,100, 10,101,110,100, 10,108,111, 99,
-   97,108, 32,105, 61, 49, 10,119,104,105,108,101, 32,115,101,
-  108,102, 46, 97,114,103,115, 91,105, 93, 32,100,111, 10,110,
-  114,101,116, 32, 61, 32,110,114,101,116, 32, 43, 32,115,101,
-  108,102, 46, 97,114,103,115, 91,105, 93, 58,114,101,116,118,
-   97,108,117,101, 40, 41, 10,105, 32, 61, 32,105, 43, 49, 10,
-  101,110,100, 10,111,117,116,112,117,116, 40, 39, 32,125, 39,
-   41, 10,105,102, 32, 99,108, 97,115,115, 32,116,104,101,110,
-   32,110, 97,114,103, 61, 50, 32,101,108,115,101, 32,110, 97,
-  114,103, 61, 49, 32,101,110,100, 10,105,102, 32,115,101,108,
-  102, 46, 97,114,103,115, 91, 49, 93, 46,116,121,112,101, 32,
-  126, 61, 32, 39,118,111,105,100, 39, 32,116,104,101,110, 10,
-  108,111, 99, 97,108, 32,105, 61, 49, 10,119,104,105,108,101,
-   32,115,101,108,102, 46, 97,114,103,115, 91,105, 93, 32,100,
-  111, 10,115,101,108,102, 46, 97,114,103,115, 91,105, 93, 58,
-  115,101,116, 97,114,114, 97,121, 40,110, 97,114,103, 41, 10,
-  110, 97,114,103, 32, 61, 32,110, 97,114,103, 43, 49, 10,105,
-   32, 61, 32,105, 43, 49, 10,101,110,100, 10,101,110,100, 10,
-  105,102, 32,115,101,108,102, 46, 97,114,103,115, 91, 49, 93,
-   46,116,121,112,101, 32,126, 61, 32, 39,118,111,105,100, 39,
-   32,116,104,101,110, 10,108,111, 99, 97,108, 32,105, 61, 49,
-   10,119,104,105,108,101, 32,115,101,108,102, 46, 97,114,103,
-  115, 91,105, 93, 32,100,111, 10,115,101,108,102, 46, 97,114,
-  103,115, 91,105, 93, 58,102,114,101,101, 97,114,114, 97,121,
-   40, 41, 10,105, 32, 61, 32,105, 43, 49, 10,101,110,100, 10,
-  101,110,100, 10,101,110,100, 10,112,111,115,116, 95, 99, 97,
-  108,108, 95,104,111,111,107, 40,115,101,108,102, 41, 10,111,
-  117,116,112,117,116, 40, 39, 32,125, 39, 41, 10,111,117,116,
-  112,117,116, 40, 39, 32,114,101,116,117,114,110, 32, 39, 46,
-   46,110,114,101,116, 46, 46, 39, 59, 39, 41, 10,105,102, 32,
-  111,118,101,114,108,111, 97,100, 32, 60, 32, 48, 32,116,104,
-  101,110, 10,111,117,116,112,117,116, 40, 39, 35,105,102,110,
-  100,101,102, 32, 84, 79, 76, 85, 65, 95, 82, 69, 76, 69, 65,
-   83, 69, 92,110, 39, 41, 10,111,117,116,112,117,116, 40, 39,
-  116,111,108,117, 97, 95,108,101,114,114,111,114, 58, 92,110,
-   39, 41, 10,111,117,116,112,117,116, 40, 39, 32,116,111,108,
-  117, 97, 95,101,114,114,111,114, 40,116,111,108,117, 97, 95,
-   83, 44, 34, 39, 46, 46,111,117,116,112,117,116, 95,101,114,
-  114,111,114, 95,104,111,111,107, 40, 34, 35,102,101,114,114,
-  111,114, 32,105,110, 32,102,117,110, 99,116,105,111,110, 32,
-   92, 39, 37,115, 92, 39, 46, 34, 44, 32,115,101,108,102, 46,
-  108,110, 97,109,101, 41, 46, 46, 39, 34, 44, 38,116,111,108,
-  117, 97, 95,101,114,114, 41, 59, 39, 41, 10,111,117,116,112,
-  117,116, 40, 39, 32,114,101,116,117,114,110, 32, 48, 59, 39,
-   41, 10,111,117,116,112,117,116, 40, 39, 35,101,110,100,105,
-  102, 92,110, 39, 41, 10,101,108,115,101, 10,108,111, 99, 97,
-  108, 32, 95,108,111, 99, 97,108, 32, 61, 32, 34, 34, 10,105,
-  102, 32,108,111, 99, 97,108, 95, 99,111,110,115,116,114,117,
-   99,116,111,114, 32,116,104,101,110, 10, 95,108,111, 99, 97,
-  108, 32, 61, 32, 34, 95,108,111, 99, 97,108, 34, 10,101,110,
-  100, 10,111,117,116,112,117,116, 40, 39,116,111,108,117, 97,
-   95,108,101,114,114,111,114, 58, 92,110, 39, 41, 10,111,117,
-  116,112,117,116, 40, 39, 32,114,101,116,117,114,110, 32, 39,
-   46, 46,115,116,114,115,117, 98, 40,115,101,108,102, 46, 99,
-  110, 97,109,101, 44, 49, 44, 45, 51, 41, 46, 46,102,111,114,
-  109, 97,116, 40, 34, 37, 48, 50,100, 34, 44,111,118,101,114,
-  108,111, 97,100, 41, 46, 46, 95,108,111, 99, 97,108, 46, 46,
-   39, 40,116,111,108,117, 97, 95, 83, 41, 59, 39, 41, 10,101,
-  110,100, 10,111,117,116,112,117,116, 40, 39,125, 39, 41, 10,
-  111,117,116,112,117,116, 40, 39, 35,101,110,100,105,102, 32,
-   47, 47, 35,105,102,110,100,101,102, 32, 84, 79, 76, 85, 65,
-   95, 68, 73, 83, 65, 66, 76, 69, 92,110, 39, 41, 10,111,117,
-  116,112,117,116, 40, 39, 92,110, 39, 41, 10,105,102, 32, 99,
-  108, 97,115,115, 32, 97,110,100, 32,115,101,108,102, 46,110,
-   97,109,101, 61, 61, 39,110,101,119, 39, 32, 97,110,100, 32,
-  110,111,116, 32,108,111, 99, 97,108, 95, 99,111,110,115,116,
-  114,117, 99,116,111,114, 32,116,104,101,110, 10,115,101,108,
-  102, 58,115,117,112, 99,111,100,101, 40, 49, 41, 10,101,110,
-  100, 10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32,
-   99,108, 97,115,115, 70,117,110, 99,116,105,111,110, 58,114,
-  101,103,105,115,116,101,114, 32, 40,112,114,101, 41, 10,105,
-  102, 32,110,111,116, 32,115,101,108,102, 58, 99,104,101, 99,
-  107, 95,112,117, 98,108,105, 99, 95, 97, 99, 99,101,115,115,
-   40, 41, 32,116,104,101,110, 10,114,101,116,117,114,110, 10,
-  101,110,100, 10,105,102, 32,115,101,108,102, 46,110, 97,109,
-  101, 32, 61, 61, 32, 39,110,101,119, 39, 32, 97,110,100, 32,
-  115,101,108,102, 46,112, 97,114,101,110,116, 46,102,108, 97,
-  103,115, 46,112,117,114,101, 95,118,105,114,116,117, 97,108,
+  117,116,112,117,116, 40, 39, 35,101,110,100,105,102, 92,110,
+   39, 41, 10,111,117,116,112,117,116, 40, 39, 32,125, 39, 41,
+   10,101,108,115,101,105,102, 32,115,101,108,102, 46,112,116,
+  114, 32, 61, 61, 32, 39, 38, 39, 32,116,104,101,110, 10,111,
+  117,116,112,117,116, 40, 39, 32, 39, 44,112,117,115,104, 95,
+  102,117,110, 99, 44, 39, 40,116,111,108,117, 97, 95, 83, 44,
+   40,118,111,105,100, 42, 41, 38,116,111,108,117, 97, 95,114,
+  101,116, 44, 34, 39, 44,116, 44, 39, 34, 41, 59, 39, 41, 10,
+  101,108,115,101, 10,111,117,116,112,117,116, 40, 39, 32, 39,
+   44,112,117,115,104, 95,102,117,110, 99, 44, 39, 40,116,111,
+  108,117, 97, 95, 83, 44, 40,118,111,105,100, 42, 41,116,111,
+  108,117, 97, 95,114,101,116, 44, 34, 39, 44,116, 44, 39, 34,
+   41, 59, 39, 41, 10,105,102, 32,111,119,110,101,100, 32,111,
+  114, 32,108,111, 99, 97,108, 95, 99,111,110,115,116,114,117,
+   99,116,111,114, 32,116,104,101,110, 10,111,117,116,112,117,
+  116, 40, 39, 32,116,111,108,117, 97, 95,114,101,103,105,115,
+  116,101,114, 95,103, 99, 40,116,111,108,117, 97, 95, 83, 44,
+  108,117, 97, 95,103,101,116,116,111,112, 40,116,111,108,117,
+   97, 95, 83, 41, 41, 59, 39, 41, 10,101,110,100, 10,101,110,
+  100, 10,101,110,100, 10,101,110,100, 10,108,111, 99, 97,108,
+   32,105, 61, 49, 10,119,104,105,108,101, 32,115,101,108,102,
+   46, 97,114,103,115, 91,105, 93, 32,100,111, 10,110,114,101,
+  116, 32, 61, 32,110,114,101,116, 32, 43, 32,115,101,108,102,
+   46, 97,114,103,115, 91,105, 93, 58,114,101,116,118, 97,108,
+  117,101, 40, 41, 10,105, 32, 61, 32,105, 43, 49, 10,101,110,
+  100, 10,111,117,116,112,117,116, 40, 39, 32,125, 39, 41, 10,
+  105,102, 32, 99,108, 97,115,115, 32,116,104,101,110, 32,110,
+   97,114,103, 61, 50, 32,101,108,115,101, 32,110, 97,114,103,
+   61, 49, 32,101,110,100, 10,105,102, 32,115,101,108,102, 46,
+   97,114,103,115, 91, 49, 93, 46,116,121,112,101, 32,126, 61,
+   32, 39,118,111,105,100, 39, 32,116,104,101,110, 10,108,111,
+   99, 97,108, 32,105, 61, 49, 10,119,104,105,108,101, 32,115,
+  101,108,102, 46, 97,114,103,115, 91,105, 93, 32,100,111, 10,
+  115,101,108,102, 46, 97,114,103,115, 91,105, 93, 58,115,101,
+  116, 97,114,114, 97,121, 40,110, 97,114,103, 41, 10,110, 97,
+  114,103, 32, 61, 32,110, 97,114,103, 43, 49, 10,105, 32, 61,
+   32,105, 43, 49, 10,101,110,100, 10,101,110,100, 10,105,102,
+   32,115,101,108,102, 46, 97,114,103,115, 91, 49, 93, 46,116,
+  121,112,101, 32,126, 61, 32, 39,118,111,105,100, 39, 32,116,
+  104,101,110, 10,108,111, 99, 97,108, 32,105, 61, 49, 10,119,
+  104,105,108,101, 32,115,101,108,102, 46, 97,114,103,115, 91,
+  105, 93, 32,100,111, 10,115,101,108,102, 46, 97,114,103,115,
+   91,105, 93, 58,102,114,101,101, 97,114,114, 97,121, 40, 41,
+   10,105, 32, 61, 32,105, 43, 49, 10,101,110,100, 10,101,110,
+  100, 10,101,110,100, 10,112,111,115,116, 95, 99, 97,108,108,
+   95,104,111,111,107, 40,115,101,108,102, 41, 10,111,117,116,
+  112,117,116, 40, 39, 32,125, 39, 41, 10,111,117,116,112,117,
+  116, 40, 39, 32,114,101,116,117,114,110, 32, 39, 46, 46,110,
+  114,101,116, 46, 46, 39, 59, 39, 41, 10,105,102, 32,111,118,
+  101,114,108,111, 97,100, 32, 60, 32, 48, 32,116,104,101,110,
+   10,111,117,116,112,117,116, 40, 39, 35,105,102,110,100,101,
+  102, 32, 84, 79, 76, 85, 65, 95, 82, 69, 76, 69, 65, 83, 69,
+   92,110, 39, 41, 10,111,117,116,112,117,116, 40, 39,116,111,
+  108,117, 97, 95,108,101,114,114,111,114, 58, 92,110, 39, 41,
+   10,111,117,116,112,117,116, 40, 39, 32,116,111,108,117, 97,
+   95,101,114,114,111,114, 40,116,111,108,117, 97, 95, 83, 44,
+   34, 39, 46, 46,111,117,116,112,117,116, 95,101,114,114,111,
+  114, 95,104,111,111,107, 40, 34, 35,102,101,114,114,111,114,
+   32,105,110, 32,102,117,110, 99,116,105,111,110, 32, 92, 39,
+   37,115, 92, 39, 46, 34, 44, 32,115,101,108,102, 46,108,110,
+   97,109,101, 41, 46, 46, 39, 34, 44, 38,116,111,108,117, 97,
+   95,101,114,114, 41, 59, 39, 41, 10,111,117,116,112,117,116,
+   40, 39, 32,114,101,116,117,114,110, 32, 48, 59, 39, 41, 10,
+  111,117,116,112,117,116, 40, 39, 35,101,110,100,105,102, 92,
+  110, 39, 41, 10,101,108,115,101, 10,108,111, 99, 97,108, 32,
+   95,108,111, 99, 97,108, 32, 61, 32, 34, 34, 10,105,102, 32,
+  108,111, 99, 97,108, 95, 99,111,110,115,116,114,117, 99,116,
+  111,114, 32,116,104,101,110, 10, 95,108,111, 99, 97,108, 32,
+   61, 32, 34, 95,108,111, 99, 97,108, 34, 10,101,110,100, 10,
+  111,117,116,112,117,116, 40, 39,116,111,108,117, 97, 95,108,
+  101,114,114,111,114, 58, 92,110, 39, 41, 10,111,117,116,112,
+  117,116, 40, 39, 32,114,101,116,117,114,110, 32, 39, 46, 46,
+  115,116,114,115,117, 98, 40,115,101,108,102, 46, 99,110, 97,
+  109,101, 44, 49, 44, 45, 51, 41, 46, 46,102,111,114,109, 97,
+  116, 40, 34, 37, 48, 50,100, 34, 44,111,118,101,114,108,111,
+   97,100, 41, 46, 46, 95,108,111, 99, 97,108, 46, 46, 39, 40,
+  116,111,108,117, 97, 95, 83, 41, 59, 39, 41, 10,101,110,100,
+   10,111,117,116,112,117,116, 40, 39,125, 39, 41, 10,111,117,
+  116,112,117,116, 40, 39, 35,101,110,100,105,102, 32, 47, 47,
+   35,105,102,110,100,101,102, 32, 84, 79, 76, 85, 65, 95, 68,
+   73, 83, 65, 66, 76, 69, 92,110, 39, 41, 10,111,117,116,112,
+  117,116, 40, 39, 92,110, 39, 41, 10,105,102, 32, 99,108, 97,
+  115,115, 32, 97,110,100, 32,115,101,108,102, 46,110, 97,109,
+  101, 61, 61, 39,110,101,119, 39, 32, 97,110,100, 32,110,111,
+  116, 32,108,111, 99, 97,108, 95, 99,111,110,115,116,114,117,
+   99,116,111,114, 32,116,104,101,110, 10,115,101,108,102, 58,
+  115,117,112, 99,111,100,101, 40, 49, 41, 10,101,110,100, 10,
+  101,110,100, 10,102,117,110, 99,116,105,111,110, 32, 99,108,
+   97,115,115, 70,117,110, 99,116,105,111,110, 58,114,101,103,
+  105,115,116,101,114, 32, 40,112,114,101, 41, 10,105,102, 32,
+  110,111,116, 32,115,101,108,102, 58, 99,104,101, 99,107, 95,
+  112,117, 98,108,105, 99, 95, 97, 99, 99,101,115,115, 40, 41,
    32,116,104,101,110, 10,114,101,116,117,114,110, 10,101,110,
-  100, 10,111,117,116,112,117,116, 40,112,114,101, 46, 46, 39,
-  116,111,108,117, 97, 95,102,117,110, 99,116,105,111,110, 40,
-  116,111,108,117, 97, 95, 83, 44, 34, 39, 46, 46,115,101,108,
-  102, 46,108,110, 97,109,101, 46, 46, 39, 34, 44, 39, 46, 46,
-  115,101,108,102, 46, 99,110, 97,109,101, 46, 46, 39, 41, 59,
-   39, 41, 10,105,102, 32,115,101,108,102, 46,110, 97,109,101,
-   32, 61, 61, 32, 39,110,101,119, 39, 32,116,104,101,110, 10,
+  100, 10,105,102, 32,115,101,108,102, 46,110, 97,109,101, 32,
+   61, 61, 32, 39,110,101,119, 39, 32, 97,110,100, 32,115,101,
+  108,102, 46,112, 97,114,101,110,116, 46,102,108, 97,103,115,
+   46,112,117,114,101, 95,118,105,114,116,117, 97,108, 32,116,
+  104,101,110, 10,114,101,116,117,114,110, 10,101,110,100, 10,
   111,117,116,112,117,116, 40,112,114,101, 46, 46, 39,116,111,
   108,117, 97, 95,102,117,110, 99,116,105,111,110, 40,116,111,
-  108,117, 97, 95, 83, 44, 34,110,101,119, 95,108,111, 99, 97,
-  108, 34, 44, 39, 46, 46,115,101,108,102, 46, 99,110, 97,109,
-  101, 46, 46, 39, 95,108,111, 99, 97,108, 41, 59, 39, 41, 10,
-  111,117,116,112,117,116, 40,112,114,101, 46, 46, 39,116,111,
-  108,117, 97, 95,102,117,110, 99,116,105,111,110, 40,116,111,
-  108,117, 97, 95, 83, 44, 34, 46, 99, 97,108,108, 34, 44, 39,
-   46, 46,115,101,108,102, 46, 99,110, 97,109,101, 46, 46, 39,
-   95,108,111, 99, 97,108, 41, 59, 39, 41, 10,101,110,100, 10,
-  101,110,100, 10,102,117,110, 99,116,105,111,110, 32, 99,108,
-   97,115,115, 70,117,110, 99,116,105,111,110, 58,112,114,105,
-  110,116, 32, 40,105,100,101,110,116, 44, 99,108,111,115,101,
-   41, 10,112,114,105,110,116, 40,105,100,101,110,116, 46, 46,
-   34, 70,117,110, 99,116,105,111,110,123, 34, 41, 10,112,114,
-  105,110,116, 40,105,100,101,110,116, 46, 46, 34, 32,109,111,
-  100, 32, 61, 32, 39, 34, 46, 46,115,101,108,102, 46,109,111,
-  100, 46, 46, 34, 39, 44, 34, 41, 10,112,114,105,110,116, 40,
-  105,100,101,110,116, 46, 46, 34, 32,116,121,112,101, 32, 61,
-   32, 39, 34, 46, 46,115,101,108,102, 46,116,121,112,101, 46,
+  108,117, 97, 95, 83, 44, 34, 39, 46, 46,115,101,108,102, 46,
+  108,110, 97,109,101, 46, 46, 39, 34, 44, 39, 46, 46,115,101,
+  108,102, 46, 99,110, 97,109,101, 46, 46, 39, 41, 59, 39, 41,
+   10,105,102, 32,115,101,108,102, 46,110, 97,109,101, 32, 61,
+   61, 32, 39,110,101,119, 39, 32,116,104,101,110, 10,111,117,
+  116,112,117,116, 40,112,114,101, 46, 46, 39,116,111,108,117,
+   97, 95,102,117,110, 99,116,105,111,110, 40,116,111,108,117,
+   97, 95, 83, 44, 34,110,101,119, 95,108,111, 99, 97,108, 34,
+   44, 39, 46, 46,115,101,108,102, 46, 99,110, 97,109,101, 46,
+   46, 39, 95,108,111, 99, 97,108, 41, 59, 39, 41, 10,111,117,
+  116,112,117,116, 40,112,114,101, 46, 46, 39,116,111,108,117,
+   97, 95,102,117,110, 99,116,105,111,110, 40,116,111,108,117,
+   97, 95, 83, 44, 34, 46, 99, 97,108,108, 34, 44, 39, 46, 46,
+  115,101,108,102, 46, 99,110, 97,109,101, 46, 46, 39, 95,108,
+  111, 99, 97,108, 41, 59, 39, 41, 10,101,110,100, 10,101,110,
+  100, 10,102,117,110, 99,116,105,111,110, 32, 99,108, 97,115,
+  115, 70,117,110, 99,116,105,111,110, 58,112,114,105,110,116,
+   32, 40,105,100,101,110,116, 44, 99,108,111,115,101, 41, 10,
+  112,114,105,110,116, 40,105,100,101,110,116, 46, 46, 34, 70,
+  117,110, 99,116,105,111,110,123, 34, 41, 10,112,114,105,110,
+  116, 40,105,100,101,110,116, 46, 46, 34, 32,109,111,100, 32,
+   61, 32, 39, 34, 46, 46,115,101,108,102, 46,109,111,100, 46,
    46, 34, 39, 44, 34, 41, 10,112,114,105,110,116, 40,105,100,
-  101,110,116, 46, 46, 34, 32,112,116,114, 32, 61, 32, 39, 34,
-   46, 46,115,101,108,102, 46,112,116,114, 46, 46, 34, 39, 44,
-   34, 41, 10,112,114,105,110,116, 40,105,100,101,110,116, 46,
-   46, 34, 32,110, 97,109,101, 32, 61, 32, 39, 34, 46, 46,115,
-  101,108,102, 46,110, 97,109,101, 46, 46, 34, 39, 44, 34, 41,
-   10,112,114,105,110,116, 40,105,100,101,110,116, 46, 46, 34,
-   32,108,110, 97,109,101, 32, 61, 32, 39, 34, 46, 46,115,101,
-  108,102, 46,108,110, 97,109,101, 46, 46, 34, 39, 44, 34, 41,
-   10,112,114,105,110,116, 40,105,100,101,110,116, 46, 46, 34,
-   32, 99,111,110,115,116, 32, 61, 32, 39, 34, 46, 46,115,101,
-  108,102, 46, 99,111,110,115,116, 46, 46, 34, 39, 44, 34, 41,
-   10,112,114,105,110,116, 40,105,100,101,110,116, 46, 46, 34,
-   32, 99,110, 97,109,101, 32, 61, 32, 39, 34, 46, 46,115,101,
-  108,102, 46, 99,110, 97,109,101, 46, 46, 34, 39, 44, 34, 41,
-   10,112,114,105,110,116, 40,105,100,101,110,116, 46, 46, 34,
-   32,108,110, 97,109,101, 32, 61, 32, 39, 34, 46, 46,115,101,
-  108,102, 46,108,110, 97,109,101, 46, 46, 34, 39, 44, 34, 41,
-   10,112,114,105,110,116, 40,105,100,101,110,116, 46, 46, 34,
-   32, 97,114,103,115, 32, 61, 32,123, 34, 41, 10,108,111, 99,
-   97,108, 32,105, 61, 49, 10,119,104,105,108,101, 32,115,101,
-  108,102, 46, 97,114,103,115, 91,105, 93, 32,100,111, 10,115,
-  101,108,102, 46, 97,114,103,115, 91,105, 93, 58,112,114,105,
-  110,116, 40,105,100,101,110,116, 46, 46, 34, 32, 34, 44, 34,
-   44, 34, 41, 10,105, 32, 61, 32,105, 43, 49, 10,101,110,100,
+  101,110,116, 46, 46, 34, 32,116,121,112,101, 32, 61, 32, 39,
+   34, 46, 46,115,101,108,102, 46,116,121,112,101, 46, 46, 34,
+   39, 44, 34, 41, 10,112,114,105,110,116, 40,105,100,101,110,
+  116, 46, 46, 34, 32,112,116,114, 32, 61, 32, 39, 34, 46, 46,
+  115,101,108,102, 46,112,116,114, 46, 46, 34, 39, 44, 34, 41,
    10,112,114,105,110,116, 40,105,100,101,110,116, 46, 46, 34,
-   32,125, 34, 41, 10,112,114,105,110,116, 40,105,100,101,110,
-  116, 46, 46, 34,125, 34, 46, 46, 99,108,111,115,101, 41, 10,
-  101,110,100, 10,102,117,110, 99,116,105,111,110, 32, 99,108,
-   97,115,115, 70,117,110, 99,116,105,111,110, 58,114,101,113,
-  117,105,114,101, 99,111,108,108,101, 99,116,105,111,110, 32,
-   40,116, 41, 10,108,111, 99, 97,108, 32,114, 32, 61, 32,102,
-   97,108,115,101, 10,105,102, 32,115,101,108,102, 46,116,121,
-  112,101, 32,126, 61, 32, 39, 39, 32, 97,110,100, 32,110,111,
-  116, 32,105,115, 98, 97,115,105, 99, 40,115,101,108,102, 46,
-  116,121,112,101, 41, 32, 97,110,100, 32,115,101,108,102, 46,
-  112,116,114, 61, 61, 39, 39, 32,116,104,101,110, 10,108,111,
-   99, 97,108, 32,116,121,112,101, 32, 61, 32,103,115,117, 98,
-   40,115,101,108,102, 46,116,121,112,101, 44, 34, 37,115, 42,
-   99,111,110,115,116, 37,115, 43, 34, 44, 34, 34, 41, 10,116,
-   91,116,121,112,101, 93, 32, 61, 32, 34,116,111,108,117, 97,
-   95, 99,111,108,108,101, 99,116, 95, 34, 32, 46, 46, 32, 99,
-  108,101, 97,110, 95,116,101,109,112,108, 97,116,101, 40,116,
-  121,112,101, 41, 10,114, 32, 61, 32,116,114,117,101, 10,101,
-  110,100, 10,108,111, 99, 97,108, 32,105, 61, 49, 10,119,104,
-  105,108,101, 32,115,101,108,102, 46, 97,114,103,115, 91,105,
-   93, 32,100,111, 10,114, 32, 61, 32,115,101,108,102, 46, 97,
-  114,103,115, 91,105, 93, 58,114,101,113,117,105,114,101, 99,
-  111,108,108,101, 99,116,105,111,110, 40,116, 41, 32,111,114,
-   32,114, 10,105, 32, 61, 32,105, 43, 49, 10,101,110,100, 10,
-  114,101,116,117,114,110, 32,114, 10,101,110,100, 10,102,117,
-  110, 99,116,105,111,110, 32, 99,108, 97,115,115, 70,117,110,
-   99,116,105,111,110, 58,111,118,101,114,108,111, 97,100, 32,
-   40, 41, 10,114,101,116,117,114,110, 32,115,101,108,102, 46,
-  112, 97,114,101,110,116, 58,111,118,101,114,108,111, 97,100,
-   40,115,101,108,102, 46,108,110, 97,109,101, 41, 10,101,110,
-  100, 10,102,117,110, 99,116,105,111,110, 32,112, 97,114, 97,
-  109, 95,111, 98,106,101, 99,116, 40,112, 97,114, 41, 10,105,
-  102, 32,110,111,116, 32,115,116,114,105,110,103, 46,102,105,
-  110,100, 40,112, 97,114, 44, 32, 39, 61, 39, 41, 32,116,104,
-  101,110, 32,114,101,116,117,114,110, 32,102, 97,108,115,101,
-   32,101,110,100, 10,108,111, 99, 97,108, 32, 95, 44, 95, 44,
-  100,101,102, 32, 61, 32,115,116,114,105,110,103, 46,102,105,
-  110,100, 40,112, 97,114, 44, 32, 34, 61, 40, 46, 42, 41, 36,
-   34, 41, 10,105,102, 32,115,116,114,105,110,103, 46,102,105,
-  110,100, 40,112, 97,114, 44, 32, 34,124, 34, 41, 32,116,104,
-  101,110, 10,114,101,116,117,114,110, 32,116,114,117,101, 10,
-  101,110,100, 10,105,102, 32,115,116,114,105,110,103, 46,102,
-  105,110,100, 40,112, 97,114, 44, 32, 34, 37, 42, 34, 41, 32,
-  116,104,101,110, 10,105,102, 32,115,116,114,105,110,103, 46,
-  102,105,110,100, 40,112, 97,114, 44, 32, 39, 61, 37,115, 42,
-  110,101,119, 39, 41, 32,111,114, 32,115,116,114,105,110,103,
-   46,102,105,110,100, 40,112, 97,114, 44, 32, 34, 37, 40, 34,
-   41, 32,116,104,101,110, 10,114,101,116,117,114,110, 32,116,
-  114,117,101, 10,101,110,100, 10,114,101,116,117,114,110, 32,
-  102, 97,108,115,101, 10,101,110,100, 10,105,102, 32,115,116,
-  114,105,110,103, 46,102,105,110,100, 40,112, 97,114, 44, 32,
-   34, 91, 37, 40, 38, 93, 34, 41, 32,116,104,101,110, 10,114,
-  101,116,117,114,110, 32,116,114,117,101, 10,101,110,100, 10,
-  114,101,116,117,114,110, 32,102, 97,108,115,101, 10,101,110,
-  100, 10,102,117,110, 99,116,105,111,110, 32,115,116,114,105,
-  112, 95,108, 97,115,116, 95, 97,114,103, 40, 97,108,108, 95,
-   97,114,103,115, 44, 32,108, 97,115,116, 95, 97,114,103, 41,
-   10,108,111, 99, 97,108, 32, 95, 44, 95, 44,115, 95, 97,114,
-  103, 32, 61, 32,115,116,114,105,110,103, 46,102,105,110,100,
-   40,108, 97,115,116, 95, 97,114,103, 44, 32, 34, 94, 40, 91,
-   94, 61, 93, 43, 41, 34, 41, 10,108, 97,115,116, 95, 97,114,
-  103, 32, 61, 32,115,116,114,105,110,103, 46,103,115,117, 98,
-   40,108, 97,115,116, 95, 97,114,103, 44, 32, 34, 40, 91, 37,
-   37, 37, 40, 37, 41, 93, 41, 34, 44, 32, 34, 37, 37, 37, 49,
-   34, 41, 59, 10, 97,108,108, 95, 97,114,103,115, 32, 61, 32,
-  115,116,114,105,110,103, 46,103,115,117, 98, 40, 97,108,108,
-   95, 97,114,103,115, 44, 32, 34, 37,115, 42, 44, 37,115, 42,
-   34, 46, 46,108, 97,115,116, 95, 97,114,103, 46, 46, 34, 37,
-  115, 42, 37, 41, 37,115, 42, 36, 34, 44, 32, 34, 41, 34, 41,
-   10,114,101,116,117,114,110, 32, 97,108,108, 95, 97,114,103,
-  115, 44, 32,115, 95, 97,114,103, 10,101,110,100, 10,102,117,
-  110, 99,116,105,111,110, 32, 95, 70,117,110, 99,116,105,111,
-  110, 32, 40,116, 41, 10,115,101,116,109,101,116, 97,116, 97,
-   98,108,101, 40,116, 44, 99,108, 97,115,115, 70,117,110, 99,
-  116,105,111,110, 41, 10,105,102, 32,116, 46, 99,111,110,115,
-  116, 32,126, 61, 32, 39, 99,111,110,115,116, 39, 32, 97,110,
-  100, 32,116, 46, 99,111,110,115,116, 32,126, 61, 32, 39, 39,
-   32,116,104,101,110, 10,101,114,114,111,114, 40, 34, 35,105,
-  110,118, 97,108,105,100, 32, 39, 99,111,110,115,116, 39, 32,
-  115,112,101, 99,105,102,105, 99, 97,116,105,111,110, 34, 41,
-   10,101,110,100, 10, 97,112,112,101,110,100, 40,116, 41, 10,
-  105,102, 32,116, 58,105,110, 99,108, 97,115,115, 40, 41, 32,
-  116,104,101,110, 10,105,102, 32,115,116,114,105,110,103, 46,
-  103,115,117, 98, 40,116, 46,110, 97,109,101, 44, 32, 34, 37,
-   98, 60, 62, 34, 44, 32, 34, 34, 41, 32, 61, 61, 32,115,116,
-  114,105,110,103, 46,103,115,117, 98, 40,116, 46,112, 97,114,
-  101,110,116, 46,111,114,105,103,105,110, 97,108, 95,110, 97,
-  109,101, 32,111,114, 32,116, 46,112, 97,114,101,110,116, 46,
-  110, 97,109,101, 44, 32, 34, 37, 98, 60, 62, 34, 44, 32, 34,
-   34, 41, 32,116,104,101,110, 10,116, 46,110, 97,109,101, 32,
-   61, 32, 39,110,101,119, 39, 10,116, 46,108,110, 97,109,101,
-   32, 61, 32, 39,110,101,119, 39, 10,116, 46,112, 97,114,101,
-  110,116, 46, 95,110,101,119, 32, 61, 32,116,114,117,101, 10,
-  116, 46,116,121,112,101, 32, 61, 32,116, 46,112, 97,114,101,
-  110,116, 46,110, 97,109,101, 10,116, 46,112,116,114, 32, 61,
-   32, 39, 42, 39, 10,101,108,115,101,105,102, 32,115,116,114,
-  105,110,103, 46,103,115,117, 98, 40,116, 46,110, 97,109,101,
-   44, 32, 34, 37, 98, 60, 62, 34, 44, 32, 34, 34, 41, 32, 61,
-   61, 32, 39,126, 39, 46, 46,115,116,114,105,110,103, 46,103,
-  115,117, 98, 40,116, 46,112, 97,114,101,110,116, 46,111,114,
-  105,103,105,110, 97,108, 95,110, 97,109,101, 32,111,114, 32,
-  116, 46,112, 97,114,101,110,116, 46,110, 97,109,101, 44, 32,
-   34, 37, 98, 60, 62, 34, 44, 32, 34, 34, 41, 32,116,104,101,
-  110, 10,116, 46,110, 97,109,101, 32, 61, 32, 39,100,101,108,
-  101,116,101, 39, 10,116, 46,108,110, 97,109,101, 32, 61, 32,
-   39,100,101,108,101,116,101, 39, 10,116, 46,112, 97,114,101,
-  110,116, 46, 95,100,101,108,101,116,101, 32, 61, 32,116,114,
-  117,101, 10,101,110,100, 10,101,110,100, 10,116, 46, 99,110,
-   97,109,101, 32, 61, 32,116, 58, 99,102,117,110, 99,110, 97,
-  109,101, 40, 34,116,111,108,117, 97, 34, 41, 46, 46,116, 58,
-  111,118,101,114,108,111, 97,100, 40,116, 41, 10,114,101,116,
-  117,114,110, 32,116, 10,101,110,100, 10,102,117,110, 99,116,
-  105,111,110, 32, 70,117,110, 99,116,105,111,110, 32, 40,100,
-   44, 97, 44, 99, 41, 10,105,102, 32,110,111,116, 32,102,108,
-   97,103,115, 91, 39, 87, 39, 93, 32, 97,110,100, 32,115,116,
-  114,105,110,103, 46,102,105,110,100, 40, 97, 44, 32, 34, 37,
-   46, 37, 46, 37, 46, 37,115, 42, 37, 41, 34, 41, 32,116,104,
-  101,110, 10,119, 97,114,110,105,110,103, 40, 34, 70,117,110,
-   99,116,105,111,110,115, 32,119,105,116,104, 32,118, 97,114,
-  105, 97, 98,108,101, 32, 97,114,103,117,109,101,110,116,115,
-   32, 40, 96, 46, 46, 46, 39, 41, 32, 97,114,101, 32,110,111,
-  116, 32,115,117,112,112,111,114,116,101,100, 46, 32, 73,103,
-  110,111,114,105,110,103, 32, 34, 46, 46,100, 46, 46, 97, 46,
-   46, 99, 41, 10,114,101,116,117,114,110, 32,110,105,108, 10,
-  101,110,100, 10,108,111, 99, 97,108, 32,105, 61, 49, 10,108,
-  111, 99, 97,108, 32,108, 32, 61, 32,123,110, 61, 48,125, 10,
-   97, 32, 61, 32,115,116,114,105,110,103, 46,103,115,117, 98,
-   40, 97, 44, 32, 34, 37,115, 42, 40, 91, 37, 40, 37, 41, 93,
-   41, 37,115, 42, 34, 44, 32, 34, 37, 49, 34, 41, 10,108,111,
-   99, 97,108, 32,116, 44,115,116,114,105,112, 44,108, 97,115,
-  116, 32, 61, 32,115,116,114,105,112, 95,112, 97,114,115, 40,
-  115,116,114,115,117, 98, 40, 97, 44, 50, 44, 45, 50, 41, 41,
-   59, 10,105,102, 32,115,116,114,105,112, 32,116,104,101,110,
-   10,108,111, 99, 97,108, 32,110,115, 32, 61, 32,106,111,105,
-  110, 40,116, 44, 32, 34, 44, 34, 44, 32, 49, 44, 32,108, 97,
-  115,116, 45, 49, 41, 10,110,115, 32, 61, 32, 34, 40, 34, 46,
-   46,115,116,114,105,110,103, 46,103,115,117, 98, 40,110,115,
-   44, 32, 34, 37,115, 42, 44, 37,115, 42, 36, 34, 44, 32, 34,
-   34, 41, 46, 46, 39, 41, 39, 10,108,111, 99, 97,108, 32,102,
-   32, 61, 32, 70,117,110, 99,116,105,111,110, 40,100, 44, 32,
-  110,115, 44, 32, 99, 41, 10,102,111,114, 32,105, 61, 49, 44,
-  108, 97,115,116, 32,100,111, 10,116, 91,105, 93, 32, 61, 32,
-  115,116,114,105,110,103, 46,103,115,117, 98, 40,116, 91,105,
-   93, 44, 32, 34, 61, 46, 42, 36, 34, 44, 32, 34, 34, 41, 10,
-  101,110,100, 10,101,110,100, 10,119,104,105,108,101, 32,116,
-   91,105, 93, 32,100,111, 10,108, 46,110, 32, 61, 32,108, 46,
-  110, 43, 49, 10,108, 91,108, 46,110, 93, 32, 61, 32, 68,101,
-   99,108, 97,114, 97,116,105,111,110, 40,116, 91,105, 93, 44,
-   39,118, 97,114, 39, 44,116,114,117,101, 41, 10,105, 32, 61,
-   32,105, 43, 49, 10,101,110,100, 10,108,111, 99, 97,108, 32,
-  102, 32, 61, 32, 68,101, 99,108, 97,114, 97,116,105,111,110,
-   40,100, 44, 39,102,117,110, 99, 39, 41, 10,102, 46, 97,114,
-  103,115, 32, 61, 32,108, 10,102, 46, 99,111,110,115,116, 32,
-   61, 32, 99, 10,114,101,116,117,114,110, 32, 95, 70,117,110,
-   99,116,105,111,110, 40,102, 41, 10,101,110,100, 10,102,117,
-  110, 99,116,105,111,110, 32,106,111,105,110, 40,116, 44, 32,
-  115,101,112, 44, 32,102,105,114,115,116, 44, 32,108, 97,115,
-  116, 41, 10,102,105,114,115,116, 32, 61, 32,102,105,114,115,
-  116, 32,111,114, 32, 49, 10,108, 97,115,116, 32, 61, 32,108,
-   97,115,116, 32,111,114, 32,116, 97, 98,108,101, 46,103,101,
-  116,110, 40,116, 41, 10,108,111, 99, 97,108, 32,108,115,101,
-  112, 32, 61, 32, 34, 34, 10,108,111, 99, 97,108, 32,114,101,
-  116, 32, 61, 32, 34, 34, 10,108,111, 99, 97,108, 32,108,111,
-  111,112, 32, 61, 32,102, 97,108,115,101, 10,102,111,114, 32,
-  105, 32, 61, 32,102,105,114,115,116, 44,108, 97,115,116, 32,
-  100,111, 10,114,101,116, 32, 61, 32,114,101,116, 46, 46,108,
-  115,101,112, 46, 46,116, 91,105, 93, 10,108,115,101,112, 32,
-   61, 32,115,101,112, 10,108,111,111,112, 32, 61, 32,116,114,
-  117,101, 10,101,110,100, 10,105,102, 32,110,111,116, 32,108,
-  111,111,112, 32,116,104,101,110, 10,114,101,116,117,114,110,
-   32, 34, 34, 10,101,110,100, 10,114,101,116,117,114,110, 32,
-  114,101,116, 10,101,110,100, 10,102,117,110, 99,116,105,111,
-  110, 32,115,116,114,105,112, 95,112, 97,114,115, 40,115, 41,
-   10,108,111, 99, 97,108, 32,116, 32, 61, 32,115,112,108,105,
-  116, 95, 99, 95,116,111,107,101,110,115, 40,115, 44, 32, 39,
-   44, 39, 41, 10,108,111, 99, 97,108, 32,115,116,114,105,112,
-   32, 61, 32,102, 97,108,115,101, 10,108,111, 99, 97,108, 32,
-  108, 97,115,116, 10,102,111,114, 32,105, 61,116, 46,110, 44,
-   49, 44, 45, 49, 32,100,111, 10,105,102, 32,110,111,116, 32,
-  115,116,114,105,112, 32, 97,110,100, 32,112, 97,114, 97,109,
-   95,111, 98,106,101, 99,116, 40,116, 91,105, 93, 41, 32,116,
-  104,101,110, 10,108, 97,115,116, 32, 61, 32,105, 10,115,116,
-  114,105,112, 32, 61, 32,116,114,117,101, 10,101,110,100, 10,
-  101,110,100, 10,114,101,116,117,114,110, 32,116, 44,115,116,
-  114,105,112, 44,108, 97,115,116, 10,101,110,100, 10,102,117,
-  110, 99,116,105,111,110, 32,115,116,114,105,112, 95,100,101,
-  102, 97,117,108,116,115, 40,115, 41, 10,115, 32, 61, 32,115,
-  116,114,105,110,103, 46,103,115,117, 98, 40,115, 44, 32, 34,
-   94, 37, 40, 34, 44, 32, 34, 34, 41, 10,115, 32, 61, 32,115,
-  116,114,105,110,103, 46,103,115,117, 98, 40,115, 44, 32, 34,
-   37, 41, 36, 34, 44, 32, 34, 34, 41, 10,108,111, 99, 97,108,
-   32,116, 32, 61, 32,115,112,108,105,116, 95, 99, 95,116,111,
-  107,101,110,115, 40,115, 44, 32, 34, 44, 34, 41, 10,108,111,
-   99, 97,108, 32,115,101,112, 44, 32,114,101,116, 32, 61, 32,
-   34, 34, 44, 34, 34, 10,102,111,114, 32,105, 61, 49, 44,116,
-   46,110, 32,100,111, 10,116, 91,105, 93, 32, 61, 32,115,116,
+   32,110, 97,109,101, 32, 61, 32, 39, 34, 46, 46,115,101,108,
+  102, 46,110, 97,109,101, 46, 46, 34, 39, 44, 34, 41, 10,112,
+  114,105,110,116, 40,105,100,101,110,116, 46, 46, 34, 32,108,
+  110, 97,109,101, 32, 61, 32, 39, 34, 46, 46,115,101,108,102,
+   46,108,110, 97,109,101, 46, 46, 34, 39, 44, 34, 41, 10,112,
+  114,105,110,116, 40,105,100,101,110,116, 46, 46, 34, 32, 99,
+  111,110,115,116, 32, 61, 32, 39, 34, 46, 46,115,101,108,102,
+   46, 99,111,110,115,116, 46, 46, 34, 39, 44, 34, 41, 10,112,
+  114,105,110,116, 40,105,100,101,110,116, 46, 46, 34, 32, 99,
+  110, 97,109,101, 32, 61, 32, 39, 34, 46, 46,115,101,108,102,
+   46, 99,110, 97,109,101, 46, 46, 34, 39, 44, 34, 41, 10,112,
+  114,105,110,116, 40,105,100,101,110,116, 46, 46, 34, 32,108,
+  110, 97,109,101, 32, 61, 32, 39, 34, 46, 46,115,101,108,102,
+   46,108,110, 97,109,101, 46, 46, 34, 39, 44, 34, 41, 10,112,
+  114,105,110,116, 40,105,100,101,110,116, 46, 46, 34, 32, 97,
+  114,103,115, 32, 61, 32,123, 34, 41, 10,108,111, 99, 97,108,
+   32,105, 61, 49, 10,119,104,105,108,101, 32,115,101,108,102,
+   46, 97,114,103,115, 91,105, 93, 32,100,111, 10,115,101,108,
+  102, 46, 97,114,103,115, 91,105, 93, 58,112,114,105,110,116,
+   40,105,100,101,110,116, 46, 46, 34, 32, 34, 44, 34, 44, 34,
+   41, 10,105, 32, 61, 32,105, 43, 49, 10,101,110,100, 10,112,
+  114,105,110,116, 40,105,100,101,110,116, 46, 46, 34, 32,125,
+   34, 41, 10,112,114,105,110,116, 40,105,100,101,110,116, 46,
+   46, 34,125, 34, 46, 46, 99,108,111,115,101, 41, 10,101,110,
+  100, 10,102,117,110, 99,116,105,111,110, 32, 99,108, 97,115,
+  115, 70,117,110, 99,116,105,111,110, 58,114,101,113,117,105,
+  114,101, 99,111,108,108,101, 99,116,105,111,110, 32, 40,116,
+   41, 10,108,111, 99, 97,108, 32,114, 32, 61, 32,102, 97,108,
+  115,101, 10,105,102, 32,115,101,108,102, 46,116,121,112,101,
+   32,126, 61, 32, 39, 39, 32, 97,110,100, 32,110,111,116, 32,
+  105,115, 98, 97,115,105, 99, 40,115,101,108,102, 46,116,121,
+  112,101, 41, 32, 97,110,100, 32,115,101,108,102, 46,112,116,
+  114, 61, 61, 39, 39, 32,116,104,101,110, 10,108,111, 99, 97,
+  108, 32,116,121,112,101, 32, 61, 32,103,115,117, 98, 40,115,
+  101,108,102, 46,116,121,112,101, 44, 34, 37,115, 42, 99,111,
+  110,115,116, 37,115, 43, 34, 44, 34, 34, 41, 10,116, 91,116,
+  121,112,101, 93, 32, 61, 32, 34,116,111,108,117, 97, 95, 99,
+  111,108,108,101, 99,116, 95, 34, 32, 46, 46, 32, 99,108,101,
+   97,110, 95,116,101,109,112,108, 97,116,101, 40,116,121,112,
+  101, 41, 10,114, 32, 61, 32,116,114,117,101, 10,101,110,100,
+   10,108,111, 99, 97,108, 32,105, 61, 49, 10,119,104,105,108,
+  101, 32,115,101,108,102, 46, 97,114,103,115, 91,105, 93, 32,
+  100,111, 10,114, 32, 61, 32,115,101,108,102, 46, 97,114,103,
+  115, 91,105, 93, 58,114,101,113,117,105,114,101, 99,111,108,
+  108,101, 99,116,105,111,110, 40,116, 41, 32,111,114, 32,114,
+   10,105, 32, 61, 32,105, 43, 49, 10,101,110,100, 10,114,101,
+  116,117,114,110, 32,114, 10,101,110,100, 10,102,117,110, 99,
+  116,105,111,110, 32, 99,108, 97,115,115, 70,117,110, 99,116,
+  105,111,110, 58,111,118,101,114,108,111, 97,100, 32, 40, 41,
+   10,114,101,116,117,114,110, 32,115,101,108,102, 46,112, 97,
+  114,101,110,116, 58,111,118,101,114,108,111, 97,100, 40,115,
+  101,108,102, 46,108,110, 97,109,101, 41, 10,101,110,100, 10,
+  102,117,110, 99,116,105,111,110, 32,112, 97,114, 97,109, 95,
+  111, 98,106,101, 99,116, 40,112, 97,114, 41, 10,105,102, 32,
+  110,111,116, 32,115,116,114,105,110,103, 46,102,105,110,100,
+   40,112, 97,114, 44, 32, 39, 61, 39, 41, 32,116,104,101,110,
+   32,114,101,116,117,114,110, 32,102, 97,108,115,101, 32,101,
+  110,100, 10,108,111, 99, 97,108, 32, 95, 44, 95, 44,100,101,
+  102, 32, 61, 32,115,116,114,105,110,103, 46,102,105,110,100,
+   40,112, 97,114, 44, 32, 34, 61, 40, 46, 42, 41, 36, 34, 41,
+   10,105,102, 32,115,116,114,105,110,103, 46,102,105,110,100,
+   40,112, 97,114, 44, 32, 34,124, 34, 41, 32,116,104,101,110,
+   10,114,101,116,117,114,110, 32,116,114,117,101, 10,101,110,
+  100, 10,105,102, 32,115,116,114,105,110,103, 46,102,105,110,
+  100, 40,112, 97,114, 44, 32, 34, 37, 42, 34, 41, 32,116,104,
+  101,110, 10,105,102, 32,115,116,114,105,110,103, 46,102,105,
+  110,100, 40,112, 97,114, 44, 32, 39, 61, 37,115, 42,110,101,
+  119, 39, 41, 32,111,114, 32,115,116,114,105,110,103, 46,102,
+  105,110,100, 40,112, 97,114, 44, 32, 34, 37, 40, 34, 41, 32,
+  116,104,101,110, 10,114,101,116,117,114,110, 32,116,114,117,
+  101, 10,101,110,100, 10,114,101,116,117,114,110, 32,102, 97,
+  108,115,101, 10,101,110,100, 10,105,102, 32,115,116,114,105,
+  110,103, 46,102,105,110,100, 40,112, 97,114, 44, 32, 34, 91,
+   37, 40, 38, 93, 34, 41, 32,116,104,101,110, 10,114,101,116,
+  117,114,110, 32,116,114,117,101, 10,101,110,100, 10,114,101,
+  116,117,114,110, 32,102, 97,108,115,101, 10,101,110,100, 10,
+  102,117,110, 99,116,105,111,110, 32,115,116,114,105,112, 95,
+  108, 97,115,116, 95, 97,114,103, 40, 97,108,108, 95, 97,114,
+  103,115, 44, 32,108, 97,115,116, 95, 97,114,103, 41, 10,108,
+  111, 99, 97,108, 32, 95, 44, 95, 44,115, 95, 97,114,103, 32,
+   61, 32,115,116,114,105,110,103, 46,102,105,110,100, 40,108,
+   97,115,116, 95, 97,114,103, 44, 32, 34, 94, 40, 91, 94, 61,
+   93, 43, 41, 34, 41, 10,108, 97,115,116, 95, 97,114,103, 32,
+   61, 32,115,116,114,105,110,103, 46,103,115,117, 98, 40,108,
+   97,115,116, 95, 97,114,103, 44, 32, 34, 40, 91, 37, 37, 37,
+   40, 37, 41, 93, 41, 34, 44, 32, 34, 37, 37, 37, 49, 34, 41,
+   59, 10, 97,108,108, 95, 97,114,103,115, 32, 61, 32,115,116,
+  114,105,110,103, 46,103,115,117, 98, 40, 97,108,108, 95, 97,
+  114,103,115, 44, 32, 34, 37,115, 42, 44, 37,115, 42, 34, 46,
+   46,108, 97,115,116, 95, 97,114,103, 46, 46, 34, 37,115, 42,
+   37, 41, 37,115, 42, 36, 34, 44, 32, 34, 41, 34, 41, 10,114,
+  101,116,117,114,110, 32, 97,108,108, 95, 97,114,103,115, 44,
+   32,115, 95, 97,114,103, 10,101,110,100, 10,102,117,110, 99,
+  116,105,111,110, 32, 95, 70,117,110, 99,116,105,111,110, 32,
+   40,116, 41, 10,115,101,116,109,101,116, 97,116, 97, 98,108,
+  101, 40,116, 44, 99,108, 97,115,115, 70,117,110, 99,116,105,
+  111,110, 41, 10,105,102, 32,116, 46, 99,111,110,115,116, 32,
+  126, 61, 32, 39, 99,111,110,115,116, 39, 32, 97,110,100, 32,
+  116, 46, 99,111,110,115,116, 32,126, 61, 32, 39, 39, 32,116,
+  104,101,110, 10,101,114,114,111,114, 40, 34, 35,105,110,118,
+   97,108,105,100, 32, 39, 99,111,110,115,116, 39, 32,115,112,
+  101, 99,105,102,105, 99, 97,116,105,111,110, 34, 41, 10,101,
+  110,100, 10, 97,112,112,101,110,100, 40,116, 41, 10,105,102,
+   32,116, 58,105,110, 99,108, 97,115,115, 40, 41, 32,116,104,
+  101,110, 10,105,102, 32,115,116,114,105,110,103, 46,103,115,
+  117, 98, 40,116, 46,110, 97,109,101, 44, 32, 34, 37, 98, 60,
+   62, 34, 44, 32, 34, 34, 41, 32, 61, 61, 32,115,116,114,105,
+  110,103, 46,103,115,117, 98, 40,116, 46,112, 97,114,101,110,
+  116, 46,111,114,105,103,105,110, 97,108, 95,110, 97,109,101,
+   32,111,114, 32,116, 46,112, 97,114,101,110,116, 46,110, 97,
+  109,101, 44, 32, 34, 37, 98, 60, 62, 34, 44, 32, 34, 34, 41,
+   32,116,104,101,110, 10,116, 46,110, 97,109,101, 32, 61, 32,
+   39,110,101,119, 39, 10,116, 46,108,110, 97,109,101, 32, 61,
+   32, 39,110,101,119, 39, 10,116, 46,112, 97,114,101,110,116,
+   46, 95,110,101,119, 32, 61, 32,116,114,117,101, 10,116, 46,
+  116,121,112,101, 32, 61, 32,116, 46,112, 97,114,101,110,116,
+   46,110, 97,109,101, 10,116, 46,112,116,114, 32, 61, 32, 39,
+   42, 39, 10,101,108,115,101,105,102, 32,115,116,114,105,110,
+  103, 46,103,115,117, 98, 40,116, 46,110, 97,109,101, 44, 32,
+   34, 37, 98, 60, 62, 34, 44, 32, 34, 34, 41, 32, 61, 61, 32,
+   39,126, 39, 46, 46,115,116,114,105,110,103, 46,103,115,117,
+   98, 40,116, 46,112, 97,114,101,110,116, 46,111,114,105,103,
+  105,110, 97,108, 95,110, 97,109,101, 32,111,114, 32,116, 46,
+  112, 97,114,101,110,116, 46,110, 97,109,101, 44, 32, 34, 37,
+   98, 60, 62, 34, 44, 32, 34, 34, 41, 32,116,104,101,110, 10,
+  116, 46,110, 97,109,101, 32, 61, 32, 39,100,101,108,101,116,
+  101, 39, 10,116, 46,108,110, 97,109,101, 32, 61, 32, 39,100,
+  101,108,101,116,101, 39, 10,116, 46,112, 97,114,101,110,116,
+   46, 95,100,101,108,101,116,101, 32, 61, 32,116,114,117,101,
+   10,101,110,100, 10,101,110,100, 10,116, 46, 99,110, 97,109,
+  101, 32, 61, 32,116, 58, 99,102,117,110, 99,110, 97,109,101,
+   40, 34,116,111,108,117, 97, 34, 41, 46, 46,116, 58,111,118,
+  101,114,108,111, 97,100, 40,116, 41, 10,114,101,116,117,114,
+  110, 32,116, 10,101,110,100, 10,102,117,110, 99,116,105,111,
+  110, 32, 70,117,110, 99,116,105,111,110, 32, 40,100, 44, 97,
+   44, 99, 41, 10,105,102, 32,110,111,116, 32,102,108, 97,103,
+  115, 91, 39, 87, 39, 93, 32, 97,110,100, 32,115,116,114,105,
+  110,103, 46,102,105,110,100, 40, 97, 44, 32, 34, 37, 46, 37,
+   46, 37, 46, 37,115, 42, 37, 41, 34, 41, 32,116,104,101,110,
+   10,119, 97,114,110,105,110,103, 40, 34, 70,117,110, 99,116,
+  105,111,110,115, 32,119,105,116,104, 32,118, 97,114,105, 97,
+   98,108,101, 32, 97,114,103,117,109,101,110,116,115, 32, 40,
+   96, 46, 46, 46, 39, 41, 32, 97,114,101, 32,110,111,116, 32,
+  115,117,112,112,111,114,116,101,100, 46, 32, 73,103,110,111,
+  114,105,110,103, 32, 34, 46, 46,100, 46, 46, 97, 46, 46, 99,
+   41, 10,114,101,116,117,114,110, 32,110,105,108, 10,101,110,
+  100, 10,108,111, 99, 97,108, 32,105, 61, 49, 10,108,111, 99,
+   97,108, 32,108, 32, 61, 32,123,110, 61, 48,125, 10, 97, 32,
+   61, 32,115,116,114,105,110,103, 46,103,115,117, 98, 40, 97,
+   44, 32, 34, 37,115, 42, 40, 91, 37, 40, 37, 41, 93, 41, 37,
+  115, 42, 34, 44, 32, 34, 37, 49, 34, 41, 10,108,111, 99, 97,
+  108, 32,116, 44,115,116,114,105,112, 44,108, 97,115,116, 32,
+   61, 32,115,116,114,105,112, 95,112, 97,114,115, 40,115,116,
+  114,115,117, 98, 40, 97, 44, 50, 44, 45, 50, 41, 41, 59, 10,
+  105,102, 32,115,116,114,105,112, 32,116,104,101,110, 10,108,
+  111, 99, 97,108, 32,110,115, 32, 61, 32,106,111,105,110, 40,
+  116, 44, 32, 34, 44, 34, 44, 32, 49, 44, 32,108, 97,115,116,
+   45, 49, 41, 10,110,115, 32, 61, 32, 34, 40, 34, 46, 46,115,
+  116,114,105,110,103, 46,103,115,117, 98, 40,110,115, 44, 32,
+   34, 37,115, 42, 44, 37,115, 42, 36, 34, 44, 32, 34, 34, 41,
+   46, 46, 39, 41, 39, 10,108,111, 99, 97,108, 32,102, 32, 61,
+   32, 70,117,110, 99,116,105,111,110, 40,100, 44, 32,110,115,
+   44, 32, 99, 41, 10,102,111,114, 32,105, 61, 49, 44,108, 97,
+  115,116, 32,100,111, 10,116, 91,105, 93, 32, 61, 32,115,116,
   114,105,110,103, 46,103,115,117, 98, 40,116, 91,105, 93, 44,
-   32, 34, 61, 46, 42, 36, 34, 44, 32, 34, 34, 41, 10,114,101,
-  116, 32, 61, 32,114,101,116, 46, 46,115,101,112, 46, 46,116,
-   91,105, 93, 10,115,101,112, 32, 61, 32, 34, 44, 34, 10,101,
-  110,100, 10,114,101,116,117,114,110, 32, 34, 40, 34, 46, 46,
-  114,101,116, 46, 46, 34, 41, 34, 10,101,110,100, 45, 45,32
+   32, 34, 61, 46, 42, 36, 34, 44, 32, 34, 34, 41, 10,101,110,
+  100, 10,101,110,100, 10,119,104,105,108,101, 32,116, 91,105,
+   93, 32,100,111, 10,108, 46,110, 32, 61, 32,108, 46,110, 43,
+   49, 10,108, 91,108, 46,110, 93, 32, 61, 32, 68,101, 99,108,
+   97,114, 97,116,105,111,110, 40,116, 91,105, 93, 44, 39,118,
+   97,114, 39, 44,116,114,117,101, 41, 10,105, 32, 61, 32,105,
+   43, 49, 10,101,110,100, 10,108,111, 99, 97,108, 32,102, 32,
+   61, 32, 68,101, 99,108, 97,114, 97,116,105,111,110, 40,100,
+   44, 39,102,117,110, 99, 39, 41, 10,102, 46, 97,114,103,115,
+   32, 61, 32,108, 10,102, 46, 99,111,110,115,116, 32, 61, 32,
+   99, 10,114,101,116,117,114,110, 32, 95, 70,117,110, 99,116,
+  105,111,110, 40,102, 41, 10,101,110,100, 10,102,117,110, 99,
+  116,105,111,110, 32,106,111,105,110, 40,116, 44, 32,115,101,
+  112, 44, 32,102,105,114,115,116, 44, 32,108, 97,115,116, 41,
+   10,102,105,114,115,116, 32, 61, 32,102,105,114,115,116, 32,
+  111,114, 32, 49, 10,108, 97,115,116, 32, 61, 32,108, 97,115,
+  116, 32,111,114, 32,116, 97, 98,108,101, 46,103,101,116,110,
+   40,116, 41, 10,108,111, 99, 97,108, 32,108,115,101,112, 32,
+   61, 32, 34, 34, 10,108,111, 99, 97,108, 32,114,101,116, 32,
+   61, 32, 34, 34, 10,108,111, 99, 97,108, 32,108,111,111,112,
+   32, 61, 32,102, 97,108,115,101, 10,102,111,114, 32,105, 32,
+   61, 32,102,105,114,115,116, 44,108, 97,115,116, 32,100,111,
+   10,114,101,116, 32, 61, 32,114,101,116, 46, 46,108,115,101,
+  112, 46, 46,116, 91,105, 93, 10,108,115,101,112, 32, 61, 32,
+  115,101,112, 10,108,111,111,112, 32, 61, 32,116,114,117,101,
+   10,101,110,100, 10,105,102, 32,110,111,116, 32,108,111,111,
+  112, 32,116,104,101,110, 10,114,101,116,117,114,110, 32, 34,
+   34, 10,101,110,100, 10,114,101,116,117,114,110, 32,114,101,
+  116, 10,101,110,100, 10,102,117,110, 99,116,105,111,110, 32,
+  115,116,114,105,112, 95,112, 97,114,115, 40,115, 41, 10,108,
+  111, 99, 97,108, 32,116, 32, 61, 32,115,112,108,105,116, 95,
+   99, 95,116,111,107,101,110,115, 40,115, 44, 32, 39, 44, 39,
+   41, 10,108,111, 99, 97,108, 32,115,116,114,105,112, 32, 61,
+   32,102, 97,108,115,101, 10,108,111, 99, 97,108, 32,108, 97,
+  115,116, 10,102,111,114, 32,105, 61,116, 46,110, 44, 49, 44,
+   45, 49, 32,100,111, 10,105,102, 32,110,111,116, 32,115,116,
+  114,105,112, 32, 97,110,100, 32,112, 97,114, 97,109, 95,111,
+   98,106,101, 99,116, 40,116, 91,105, 93, 41, 32,116,104,101,
+  110, 10,108, 97,115,116, 32, 61, 32,105, 10,115,116,114,105,
+  112, 32, 61, 32,116,114,117,101, 10,101,110,100, 10,101,110,
+  100, 10,114,101,116,117,114,110, 32,116, 44,115,116,114,105,
+  112, 44,108, 97,115,116, 10,101,110,100, 10,102,117,110, 99,
+  116,105,111,110, 32,115,116,114,105,112, 95,100,101,102, 97,
+  117,108,116,115, 40,115, 41, 10,115, 32, 61, 32,115,116,114,
+  105,110,103, 46,103,115,117, 98, 40,115, 44, 32, 34, 94, 37,
+   40, 34, 44, 32, 34, 34, 41, 10,115, 32, 61, 32,115,116,114,
+  105,110,103, 46,103,115,117, 98, 40,115, 44, 32, 34, 37, 41,
+   36, 34, 44, 32, 34, 34, 41, 10,108,111, 99, 97,108, 32,116,
+   32, 61, 32,115,112,108,105,116, 95, 99, 95,116,111,107,101,
+  110,115, 40,115, 44, 32, 34, 44, 34, 41, 10,108,111, 99, 97,
+  108, 32,115,101,112, 44, 32,114,101,116, 32, 61, 32, 34, 34,
+   44, 34, 34, 10,102,111,114, 32,105, 61, 49, 44,116, 46,110,
+   32,100,111, 10,116, 91,105, 93, 32, 61, 32,115,116,114,105,
+  110,103, 46,103,115,117, 98, 40,116, 91,105, 93, 44, 32, 34,
+   61, 46, 42, 36, 34, 44, 32, 34, 34, 41, 10,114,101,116, 32,
+   61, 32,114,101,116, 46, 46,115,101,112, 46, 46,116, 91,105,
+   93, 10,115,101,112, 32, 61, 32, 34, 44, 34, 10,101,110,100,
+   10,114,101,116,117,114,110, 32, 34, 40, 34, 46, 46,114,101,
+  116, 46, 46, 34, 41, 34, 10,101,110,100, 45, 45,32
   };
   tolua_dobuffer(tolua_S,(char*)B,sizeof(B),"tolua embedded: lua/function.lua");
   lua_settop(tolua_S, top);
@@ -5220,174 +5295,183 @@ TOLUA_API int tolua_tolua_open (lua_State* tolua_S)
    32,115,116,114,105,110,103, 46,103,115,117, 98, 40,116, 44,
    32, 34, 99,111,110,115,116, 37,115, 43, 34, 44, 32, 34, 34,
    41, 10,105,102, 32,115,101,108,102, 46,112,116,114, 32, 61,
-   61, 32, 39, 39, 32,116,104,101,110, 10,111,117,116,112,117,
-  116, 40, 39, 32,123, 39, 41, 10,111,117,116,112,117,116, 40,
-   39, 35,105,102,100,101,102, 32, 95, 95, 99,112,108,117,115,
-  112,108,117,115, 92,110, 39, 41, 10,111,117,116,112,117,116,
-   40, 39, 32,118,111,105,100, 42, 32,116,111,108,117, 97, 95,
-  111, 98,106, 32, 61, 32, 77,116,111,108,117, 97, 95,110,101,
-  119, 40, 40, 39, 44,110,101,119, 95,116, 44, 39, 41, 40,116,
-  111,108,117, 97, 95,114,101,116, 41, 41, 59, 39, 41, 10,111,
-  117,116,112,117,116, 40, 39, 32, 39, 44,112,117,115,104, 95,
-  102,117,110, 99, 44, 39, 40,116,111,108,117, 97, 95, 83, 44,
-  116,111,108,117, 97, 95,111, 98,106, 44, 34, 39, 44,116, 44,
-   39, 34, 41, 59, 39, 41, 10,111,117,116,112,117,116, 40, 39,
-   32,116,111,108,117, 97, 95,114,101,103,105,115,116,101,114,
-   95,103, 99, 40,116,111,108,117, 97, 95, 83, 44,108,117, 97,
-   95,103,101,116,116,111,112, 40,116,111,108,117, 97, 95, 83,
-   41, 41, 59, 39, 41, 10,111,117,116,112,117,116, 40, 39, 35,
-  101,108,115,101, 92,110, 39, 41, 10,111,117,116,112,117,116,
-   40, 39, 32,118,111,105,100, 42, 32,116,111,108,117, 97, 95,
-  111, 98,106, 32, 61, 32,116,111,108,117, 97, 95, 99,111,112,
-  121, 40,116,111,108,117, 97, 95, 83, 44, 40,118,111,105,100,
-   42, 41, 38,116,111,108,117, 97, 95,114,101,116, 44,115,105,
-  122,101,111,102, 40, 39, 44,116, 44, 39, 41, 41, 59, 39, 41,
-   10,111,117,116,112,117,116, 40, 39, 32, 39, 44,112,117,115,
-  104, 95,102,117,110, 99, 44, 39, 40,116,111,108,117, 97, 95,
-   83, 44,116,111,108,117, 97, 95,111, 98,106, 44, 34, 39, 44,
-  116, 44, 39, 34, 41, 59, 39, 41, 10,111,117,116,112,117,116,
-   40, 39, 32,116,111,108,117, 97, 95,114,101,103,105,115,116,
-  101,114, 95,103, 99, 40,116,111,108,117, 97, 95, 83, 44,108,
-  117, 97, 95,103,101,116,116,111,112, 40,116,111,108,117, 97,
-   95, 83, 41, 41, 59, 39, 41, 10,111,117,116,112,117,116, 40,
-   39, 35,101,110,100,105,102, 92,110, 39, 41, 10,111,117,116,
-  112,117,116, 40, 39, 32,125, 39, 41, 10,101,108,115,101,105,
-  102, 32,115,101,108,102, 46,112,116,114, 32, 61, 61, 32, 39,
-   38, 39, 32,116,104,101,110, 10,111,117,116,112,117,116, 40,
-   39, 32, 39, 44,112,117,115,104, 95,102,117,110, 99, 44, 39,
-   40,116,111,108,117, 97, 95, 83, 44, 40,118,111,105,100, 42,
-   41, 38,116,111,108,117, 97, 95,114,101,116, 44, 34, 39, 44,
-  116, 44, 39, 34, 41, 59, 39, 41, 10,101,108,115,101, 10,105,
-  102, 32,108,111, 99, 97,108, 95, 99,111,110,115,116,114,117,
-   99,116,111,114, 32,116,104,101,110, 10,111,117,116,112,117,
-  116, 40, 39, 32, 39, 44,112,117,115,104, 95,102,117,110, 99,
-   44, 39, 40,116,111,108,117, 97, 95, 83, 44, 40,118,111,105,
-  100, 32, 42, 41,116,111,108,117, 97, 95,114,101,116, 44, 34,
-   39, 44,116, 44, 39, 34, 41, 59, 39, 41, 10,111,117,116,112,
-  117,116, 40, 39, 32,116,111,108,117, 97, 95,114,101,103,105,
-  115,116,101,114, 95,103, 99, 40,116,111,108,117, 97, 95, 83,
-   44,108,117, 97, 95,103,101,116,116,111,112, 40,116,111,108,
-  117, 97, 95, 83, 41, 41, 59, 39, 41, 10,101,108,115,101, 10,
-  111,117,116,112,117,116, 40, 39, 32, 39, 44,112,117,115,104,
-   95,102,117,110, 99, 44, 39, 40,116,111,108,117, 97, 95, 83,
-   44, 40,118,111,105,100, 42, 41,116,111,108,117, 97, 95,114,
-  101,116, 44, 34, 39, 44,116, 44, 39, 34, 41, 59, 39, 41, 10,
-  101,110,100, 10,101,110,100, 10,101,110,100, 10,111,117,116,
-  112,117,116, 40, 39, 32,125, 39, 41, 10,111,117,116,112,117,
-  116, 40, 39, 32,114,101,116,117,114,110, 32, 49, 59, 39, 41,
-   10,111,117,116,112,117,116, 40, 39, 35,105,102,110,100,101,
-  102, 32, 84, 79, 76, 85, 65, 95, 82, 69, 76, 69, 65, 83, 69,
-   92,110, 39, 41, 10,111,117,116,112,117,116, 40, 39,116,111,
-  108,117, 97, 95,108,101,114,114,111,114, 58, 92,110, 39, 41,
+   61, 32, 39, 39, 32, 97,110,100, 32,105,115, 95,118, 97,108,
+  117,101, 95,116,121,112,101, 40,116, 41, 32,116,104,101,110,
    10,111,117,116,112,117,116, 40, 39, 32,116,111,108,117, 97,
-   95,101,114,114,111,114, 40,116,111,108,117, 97, 95, 83, 44,
-   34, 39, 46, 46,111,117,116,112,117,116, 95,101,114,114,111,
-  114, 95,104,111,111,107, 40, 34, 35,102,101,114,114,111,114,
-   32,105,110, 32,102,117,110, 99,116,105,111,110, 32, 92, 39,
-   37,115, 92, 39, 46, 34, 44, 32,115,101,108,102, 46,108,110,
-   97,109,101, 41, 46, 46, 39, 34, 44, 38,116,111,108,117, 97,
-   95,101,114,114, 41, 59, 39, 41, 10,111,117,116,112,117,116,
-   40, 39, 32,114,101,116,117,114,110, 32, 48, 59, 39, 41, 10,
-  111,117,116,112,117,116, 40, 39, 35,101,110,100,105,102, 92,
-  110, 39, 41, 10,111,117,116,112,117,116, 40, 39,125, 39, 41,
-   10,111,117,116,112,117,116, 40, 39, 35,101,110,100,105,102,
-   32, 47, 47, 35,105,102,110,100,101,102, 32, 84, 79, 76, 85,
-   65, 95, 68, 73, 83, 65, 66, 76, 69, 92,110, 39, 41, 10,111,
-  117,116,112,117,116, 40, 39, 92,110, 39, 41, 10,101,110,100,
-   10,102,117,110, 99,116,105,111,110, 32, 95, 79,112,101,114,
-   97,116,111,114, 32, 40,116, 41, 10,115,101,116,109,101,116,
-   97,116, 97, 98,108,101, 40,116, 44, 99,108, 97,115,115, 79,
-  112,101,114, 97,116,111,114, 41, 10,105,102, 32,116, 46, 99,
-  111,110,115,116, 32,126, 61, 32, 39, 99,111,110,115,116, 39,
-   32, 97,110,100, 32,116, 46, 99,111,110,115,116, 32,126, 61,
-   32, 39, 39, 32,116,104,101,110, 10,101,114,114,111,114, 40,
-   34, 35,105,110,118, 97,108,105,100, 32, 39, 99,111,110,115,
-  116, 39, 32,115,112,101, 99,105,102,105, 99, 97,116,105,111,
-  110, 34, 41, 10,101,110,100, 10, 97,112,112,101,110,100, 40,
-  116, 41, 10,105,102, 32,110,111,116, 32,116, 58,105,110, 99,
-  108, 97,115,115, 40, 41, 32,116,104,101,110, 10,101,114,114,
-  111,114, 40, 34, 35,111,112,101,114, 97,116,111,114, 32, 99,
-   97,110, 32,111,110,108,121, 32, 98,101, 32,100,101,102,105,
-  110,101,100, 32, 97,115, 32, 99,108, 97,115,115, 32,109,101,
-  109, 98,101,114, 34, 41, 10,101,110,100, 10,116, 46, 99,110,
-   97,109,101, 32, 61, 32,116, 58, 99,102,117,110, 99,110, 97,
-  109,101, 40, 34,116,111,108,117, 97, 34, 41, 46, 46,116, 58,
-  111,118,101,114,108,111, 97,100, 40,116, 41, 10,116, 46,110,
-   97,109,101, 32, 61, 32, 34,111,112,101,114, 97,116,111,114,
-   34, 32, 46, 46, 32,116, 46,107,105,110,100, 10,114,101,116,
-  117,114,110, 32,116, 10,101,110,100, 10,102,117,110, 99,116,
-  105,111,110, 32, 79,112,101,114, 97,116,111,114, 32, 40,100,
-   44,107, 44, 97, 44, 99, 41, 10,108,111, 99, 97,108, 32,111,
-  112, 95,107, 32, 61, 32,115,116,114,105,110,103, 46,103,115,
-  117, 98, 40,107, 44, 32, 34, 94, 37,115, 42, 34, 44, 32, 34,
-   34, 41, 10,111,112, 95,107, 32, 61, 32,115,116,114,105,110,
-  103, 46,103,115,117, 98, 40,107, 44, 32, 34, 37,115, 42, 36,
-   34, 44, 32, 34, 34, 41, 10,105,102, 32,100, 32, 61, 61, 32,
-   34,111,112,101,114, 97,116,111,114, 34, 32, 97,110,100, 32,
-  107, 32,126, 61, 32, 39, 39, 32,116,104,101,110, 10,100, 32,
-   61, 32,107, 46, 46, 34, 32,111,112,101,114, 97,116,111,114,
-   34, 10,101,108,115,101,105,102, 32,110,111,116, 32, 95, 84,
-   77, 91,111,112, 95,107, 93, 32,116,104,101,110, 10,105,102,
-   32,102,108, 97,103,115, 91, 39, 87, 39, 93, 32,116,104,101,
-  110, 10,101,114,114,111,114, 40, 34,116,111,108,117, 97, 58,
-   32,110,111, 32,115,117,112,112,111,114,116, 32,102,111,114,
-   32,111,112,101,114, 97,116,111,114, 34, 32, 46, 46, 32,102,
-   46,107,105,110,100, 41, 10,101,108,115,101, 10,119, 97,114,
-  110,105,110,103, 40, 34, 78,111, 32,115,117,112,112,111,114,
-  116, 32,102,111,114, 32,111,112,101,114, 97,116,111,114, 32,
-   34, 46, 46,111,112, 95,107, 46, 46, 34, 44, 32,105,103,110,
-  111,114,105,110,103, 34, 41, 10,114,101,116,117,114,110, 32,
-  110,105,108, 10,101,110,100, 10,101,110,100, 10,108,111, 99,
-   97,108, 32,114,101,102, 32, 61, 32, 39, 39, 10,108,111, 99,
-   97,108, 32,116, 32, 61, 32,115,112,108,105,116, 95, 99, 95,
-  116,111,107,101,110,115, 40,115,116,114,115,117, 98, 40, 97,
-   44, 50, 44,115,116,114,108,101,110, 40, 97, 41, 45, 49, 41,
-   44, 39, 44, 39, 41, 10,108,111, 99, 97,108, 32,105, 61, 49,
-   10,108,111, 99, 97,108, 32,108, 32, 61, 32,123,110, 61, 48,
-  125, 10,119,104,105,108,101, 32,116, 91,105, 93, 32,100,111,
-   10,108, 46,110, 32, 61, 32,108, 46,110, 43, 49, 10,108, 91,
-  108, 46,110, 93, 32, 61, 32, 68,101, 99,108, 97,114, 97,116,
-  105,111,110, 40,116, 91,105, 93, 44, 39,118, 97,114, 39, 41,
-   10,105, 32, 61, 32,105, 43, 49, 10,101,110,100, 10,105,102,
-   32,107, 32, 61, 61, 32, 39, 91, 93, 39, 32,116,104,101,110,
-   10,108,111, 99, 97,108, 32, 95, 10, 95, 44, 32, 95, 44, 32,
-  114,101,102, 32, 61, 32,115,116,114,102,105,110,100, 40,100,
-   44, 39, 40, 38, 41, 39, 41, 10,100, 32, 61, 32,103,115,117,
-   98, 40,100, 44, 39, 38, 39, 44, 39, 39, 41, 10,101,108,115,
-  101,105,102, 32,107, 61, 61, 39, 38, 91, 93, 39, 32,116,104,
-  101,110, 10,108, 46,110, 32, 61, 32,108, 46,110, 43, 49, 10,
-  108, 91,108, 46,110, 93, 32, 61, 32, 68,101, 99,108, 97,114,
-   97,116,105,111,110, 40,100, 44, 39,118, 97,114, 39, 41, 10,
-  108, 91,108, 46,110, 93, 46,110, 97,109,101, 32, 61, 32, 39,
-  116,111,108,117, 97, 95,118, 97,108,117,101, 39, 10,101,110,
-  100, 10,108,111, 99, 97,108, 32,102, 32, 61, 32, 68,101, 99,
-  108, 97,114, 97,116,105,111,110, 40,100, 44, 39,102,117,110,
-   99, 39, 41, 10,105,102, 32,107, 32, 61, 61, 32, 39, 91, 93,
-   39, 32, 97,110,100, 32, 40,108, 91, 49, 93, 61, 61,110,105,
-  108, 32,111,114, 32,105,115, 98, 97,115,105, 99, 40,108, 91,
-   49, 93, 46,116,121,112,101, 41,126, 61, 39,110,117,109, 98,
-  101,114, 39, 41, 32,116,104,101,110, 10,101,114,114,111,114,
-   40, 39,111,112,101,114, 97,116,111,114, 91, 93, 32, 99, 97,
-  110, 32,111,110,108,121, 32, 98,101, 32,100,101,102,105,110,
-  101,100, 32,102,111,114, 32,110,117,109,101,114,105, 99, 32,
-  105,110,100,101,120, 46, 39, 41, 10,101,110,100, 10,102, 46,
-   97,114,103,115, 32, 61, 32,108, 10,102, 46, 99,111,110,115,
-  116, 32, 61, 32, 99, 10,102, 46,107,105,110,100, 32, 61, 32,
-  111,112, 95,107, 10,102, 46,108,110, 97,109,101, 32, 61, 32,
-   34, 46, 34, 46, 46, 40, 95, 84, 77, 91,102, 46,107,105,110,
-  100, 93, 32,111,114, 32,102, 46,107,105,110,100, 41, 10,105,
-  102, 32,110,111,116, 32, 95, 84, 77, 91,102, 46,107,105,110,
-  100, 93, 32,116,104,101,110, 10,102, 46, 99, 97,115,116, 95,
-  111,112,101,114, 97,116,111,114, 32, 61, 32,116,114,117,101,
-   10,101,110,100, 10,105,102, 32,102, 46,107,105,110,100, 32,
-   61, 61, 32, 39, 91, 93, 39, 32, 97,110,100, 32,114,101,102,
-   61, 61, 39, 38, 39, 32, 97,110,100, 32,102, 46, 99,111,110,
-  115,116,126, 61, 39, 99,111,110,115,116, 39, 32,116,104,101,
-  110, 10, 79,112,101,114, 97,116,111,114, 40,100, 44, 39, 38,
-   39, 46, 46,107, 44, 97, 44, 99, 41, 10,101,110,100, 10,114,
-  101,116,117,114,110, 32, 95, 79,112,101,114, 97,116,111,114,
-   40,102, 41, 10,101,110,100, 45, 45, 45, 45, 45, 45, 45, 45,
-   45, 45, 45, 45, 45, 45,32
+   95,112,117,115,104,117,115,101,114,116,121,112,101, 95,118,
+   97,108,117,101, 40,116,111,108,117, 97, 95, 83, 44, 40,118,
+  111,105,100, 42, 41, 38,116,111,108,117, 97, 95,114,101,116,
+   44,115,105,122,101,111,102, 40, 39, 44,110,101,119, 95,116,
+   44, 39, 41, 44, 34, 39, 44,116, 44, 39, 34, 41, 59, 39, 41,
+   10,101,108,115,101,105,102, 32,115,101,108,102, 46,112,116,
+  114, 32, 61, 61, 32, 39, 39, 32,116,104,101,110, 10,111,117,
+  116,112,117,116, 40, 39, 32,123, 39, 41, 10,111,117,116,112,
+  117,116, 40, 39, 35,105,102,100,101,102, 32, 95, 95, 99,112,
+  108,117,115,112,108,117,115, 92,110, 39, 41, 10,111,117,116,
+  112,117,116, 40, 39, 32,118,111,105,100, 42, 32,116,111,108,
+  117, 97, 95,111, 98,106, 32, 61, 32, 77,116,111,108,117, 97,
+   95,110,101,119, 40, 40, 39, 44,110,101,119, 95,116, 44, 39,
+   41, 40,116,111,108,117, 97, 95,114,101,116, 41, 41, 59, 39,
+   41, 10,111,117,116,112,117,116, 40, 39, 32, 39, 44,112,117,
+  115,104, 95,102,117,110, 99, 44, 39, 40,116,111,108,117, 97,
+   95, 83, 44,116,111,108,117, 97, 95,111, 98,106, 44, 34, 39,
+   44,116, 44, 39, 34, 41, 59, 39, 41, 10,111,117,116,112,117,
+  116, 40, 39, 32,116,111,108,117, 97, 95,114,101,103,105,115,
+  116,101,114, 95,103, 99, 40,116,111,108,117, 97, 95, 83, 44,
+  108,117, 97, 95,103,101,116,116,111,112, 40,116,111,108,117,
+   97, 95, 83, 41, 41, 59, 39, 41, 10,111,117,116,112,117,116,
+   40, 39, 35,101,108,115,101, 92,110, 39, 41, 10,111,117,116,
+  112,117,116, 40, 39, 32,118,111,105,100, 42, 32,116,111,108,
+  117, 97, 95,111, 98,106, 32, 61, 32,116,111,108,117, 97, 95,
+   99,111,112,121, 40,116,111,108,117, 97, 95, 83, 44, 40,118,
+  111,105,100, 42, 41, 38,116,111,108,117, 97, 95,114,101,116,
+   44,115,105,122,101,111,102, 40, 39, 44,116, 44, 39, 41, 41,
+   59, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32, 39, 44,
+  112,117,115,104, 95,102,117,110, 99, 44, 39, 40,116,111,108,
+  117, 97, 95, 83, 44,116,111,108,117, 97, 95,111, 98,106, 44,
+   34, 39, 44,116, 44, 39, 34, 41, 59, 39, 41, 10,111,117,116,
+  112,117,116, 40, 39, 32,116,111,108,117, 97, 95,114,101,103,
+  105,115,116,101,114, 95,103, 99, 40,116,111,108,117, 97, 95,
+   83, 44,108,117, 97, 95,103,101,116,116,111,112, 40,116,111,
+  108,117, 97, 95, 83, 41, 41, 59, 39, 41, 10,111,117,116,112,
+  117,116, 40, 39, 35,101,110,100,105,102, 92,110, 39, 41, 10,
+  111,117,116,112,117,116, 40, 39, 32,125, 39, 41, 10,101,108,
+  115,101,105,102, 32,115,101,108,102, 46,112,116,114, 32, 61,
+   61, 32, 39, 38, 39, 32,116,104,101,110, 10,111,117,116,112,
+  117,116, 40, 39, 32, 39, 44,112,117,115,104, 95,102,117,110,
+   99, 44, 39, 40,116,111,108,117, 97, 95, 83, 44, 40,118,111,
+  105,100, 42, 41, 38,116,111,108,117, 97, 95,114,101,116, 44,
+   34, 39, 44,116, 44, 39, 34, 41, 59, 39, 41, 10,101,108,115,
+  101, 10,105,102, 32,108,111, 99, 97,108, 95, 99,111,110,115,
+  116,114,117, 99,116,111,114, 32,116,104,101,110, 10,111,117,
+  116,112,117,116, 40, 39, 32, 39, 44,112,117,115,104, 95,102,
+  117,110, 99, 44, 39, 40,116,111,108,117, 97, 95, 83, 44, 40,
+  118,111,105,100, 32, 42, 41,116,111,108,117, 97, 95,114,101,
+  116, 44, 34, 39, 44,116, 44, 39, 34, 41, 59, 39, 41, 10,111,
+  117,116,112,117,116, 40, 39, 32,116,111,108,117, 97, 95,114,
+  101,103,105,115,116,101,114, 95,103, 99, 40,116,111,108,117,
+   97, 95, 83, 44,108,117, 97, 95,103,101,116,116,111,112, 40,
+  116,111,108,117, 97, 95, 83, 41, 41, 59, 39, 41, 10,101,108,
+  115,101, 10,111,117,116,112,117,116, 40, 39, 32, 39, 44,112,
+  117,115,104, 95,102,117,110, 99, 44, 39, 40,116,111,108,117,
+   97, 95, 83, 44, 40,118,111,105,100, 42, 41,116,111,108,117,
+   97, 95,114,101,116, 44, 34, 39, 44,116, 44, 39, 34, 41, 59,
+   39, 41, 10,101,110,100, 10,101,110,100, 10,101,110,100, 10,
+  111,117,116,112,117,116, 40, 39, 32,125, 39, 41, 10,111,117,
+  116,112,117,116, 40, 39, 32,114,101,116,117,114,110, 32, 49,
+   59, 39, 41, 10,111,117,116,112,117,116, 40, 39, 35,105,102,
+  110,100,101,102, 32, 84, 79, 76, 85, 65, 95, 82, 69, 76, 69,
+   65, 83, 69, 92,110, 39, 41, 10,111,117,116,112,117,116, 40,
+   39,116,111,108,117, 97, 95,108,101,114,114,111,114, 58, 92,
+  110, 39, 41, 10,111,117,116,112,117,116, 40, 39, 32,116,111,
+  108,117, 97, 95,101,114,114,111,114, 40,116,111,108,117, 97,
+   95, 83, 44, 34, 39, 46, 46,111,117,116,112,117,116, 95,101,
+  114,114,111,114, 95,104,111,111,107, 40, 34, 35,102,101,114,
+  114,111,114, 32,105,110, 32,102,117,110, 99,116,105,111,110,
+   32, 92, 39, 37,115, 92, 39, 46, 34, 44, 32,115,101,108,102,
+   46,108,110, 97,109,101, 41, 46, 46, 39, 34, 44, 38,116,111,
+  108,117, 97, 95,101,114,114, 41, 59, 39, 41, 10,111,117,116,
+  112,117,116, 40, 39, 32,114,101,116,117,114,110, 32, 48, 59,
+   39, 41, 10,111,117,116,112,117,116, 40, 39, 35,101,110,100,
+  105,102, 92,110, 39, 41, 10,111,117,116,112,117,116, 40, 39,
+  125, 39, 41, 10,111,117,116,112,117,116, 40, 39, 35,101,110,
+  100,105,102, 32, 47, 47, 35,105,102,110,100,101,102, 32, 84,
+   79, 76, 85, 65, 95, 68, 73, 83, 65, 66, 76, 69, 92,110, 39,
+   41, 10,111,117,116,112,117,116, 40, 39, 92,110, 39, 41, 10,
+  101,110,100, 10,102,117,110, 99,116,105,111,110, 32, 95, 79,
+  112,101,114, 97,116,111,114, 32, 40,116, 41, 10,115,101,116,
+  109,101,116, 97,116, 97, 98,108,101, 40,116, 44, 99,108, 97,
+  115,115, 79,112,101,114, 97,116,111,114, 41, 10,105,102, 32,
+  116, 46, 99,111,110,115,116, 32,126, 61, 32, 39, 99,111,110,
+  115,116, 39, 32, 97,110,100, 32,116, 46, 99,111,110,115,116,
+   32,126, 61, 32, 39, 39, 32,116,104,101,110, 10,101,114,114,
+  111,114, 40, 34, 35,105,110,118, 97,108,105,100, 32, 39, 99,
+  111,110,115,116, 39, 32,115,112,101, 99,105,102,105, 99, 97,
+  116,105,111,110, 34, 41, 10,101,110,100, 10, 97,112,112,101,
+  110,100, 40,116, 41, 10,105,102, 32,110,111,116, 32,116, 58,
+  105,110, 99,108, 97,115,115, 40, 41, 32,116,104,101,110, 10,
+  101,114,114,111,114, 40, 34, 35,111,112,101,114, 97,116,111,
+  114, 32, 99, 97,110, 32,111,110,108,121, 32, 98,101, 32,100,
+  101,102,105,110,101,100, 32, 97,115, 32, 99,108, 97,115,115,
+   32,109,101,109, 98,101,114, 34, 41, 10,101,110,100, 10,116,
+   46, 99,110, 97,109,101, 32, 61, 32,116, 58, 99,102,117,110,
+   99,110, 97,109,101, 40, 34,116,111,108,117, 97, 34, 41, 46,
+   46,116, 58,111,118,101,114,108,111, 97,100, 40,116, 41, 10,
+  116, 46,110, 97,109,101, 32, 61, 32, 34,111,112,101,114, 97,
+  116,111,114, 34, 32, 46, 46, 32,116, 46,107,105,110,100, 10,
+  114,101,116,117,114,110, 32,116, 10,101,110,100, 10,102,117,
+  110, 99,116,105,111,110, 32, 79,112,101,114, 97,116,111,114,
+   32, 40,100, 44,107, 44, 97, 44, 99, 41, 10,108,111, 99, 97,
+  108, 32,111,112, 95,107, 32, 61, 32,115,116,114,105,110,103,
+   46,103,115,117, 98, 40,107, 44, 32, 34, 94, 37,115, 42, 34,
+   44, 32, 34, 34, 41, 10,111,112, 95,107, 32, 61, 32,115,116,
+  114,105,110,103, 46,103,115,117, 98, 40,107, 44, 32, 34, 37,
+  115, 42, 36, 34, 44, 32, 34, 34, 41, 10,105,102, 32,100, 32,
+   61, 61, 32, 34,111,112,101,114, 97,116,111,114, 34, 32, 97,
+  110,100, 32,107, 32,126, 61, 32, 39, 39, 32,116,104,101,110,
+   10,100, 32, 61, 32,107, 46, 46, 34, 32,111,112,101,114, 97,
+  116,111,114, 34, 10,101,108,115,101,105,102, 32,110,111,116,
+   32, 95, 84, 77, 91,111,112, 95,107, 93, 32,116,104,101,110,
+   10,105,102, 32,102,108, 97,103,115, 91, 39, 87, 39, 93, 32,
+  116,104,101,110, 10,101,114,114,111,114, 40, 34,116,111,108,
+  117, 97, 58, 32,110,111, 32,115,117,112,112,111,114,116, 32,
+  102,111,114, 32,111,112,101,114, 97,116,111,114, 34, 32, 46,
+   46, 32,102, 46,107,105,110,100, 41, 10,101,108,115,101, 10,
+  119, 97,114,110,105,110,103, 40, 34, 78,111, 32,115,117,112,
+  112,111,114,116, 32,102,111,114, 32,111,112,101,114, 97,116,
+  111,114, 32, 34, 46, 46,111,112, 95,107, 46, 46, 34, 44, 32,
+  105,103,110,111,114,105,110,103, 34, 41, 10,114,101,116,117,
+  114,110, 32,110,105,108, 10,101,110,100, 10,101,110,100, 10,
+  108,111, 99, 97,108, 32,114,101,102, 32, 61, 32, 39, 39, 10,
+  108,111, 99, 97,108, 32,116, 32, 61, 32,115,112,108,105,116,
+   95, 99, 95,116,111,107,101,110,115, 40,115,116,114,115,117,
+   98, 40, 97, 44, 50, 44,115,116,114,108,101,110, 40, 97, 41,
+   45, 49, 41, 44, 39, 44, 39, 41, 10,108,111, 99, 97,108, 32,
+  105, 61, 49, 10,108,111, 99, 97,108, 32,108, 32, 61, 32,123,
+  110, 61, 48,125, 10,119,104,105,108,101, 32,116, 91,105, 93,
+   32,100,111, 10,108, 46,110, 32, 61, 32,108, 46,110, 43, 49,
+   10,108, 91,108, 46,110, 93, 32, 61, 32, 68,101, 99,108, 97,
+  114, 97,116,105,111,110, 40,116, 91,105, 93, 44, 39,118, 97,
+  114, 39, 41, 10,105, 32, 61, 32,105, 43, 49, 10,101,110,100,
+   10,105,102, 32,107, 32, 61, 61, 32, 39, 91, 93, 39, 32,116,
+  104,101,110, 10,108,111, 99, 97,108, 32, 95, 10, 95, 44, 32,
+   95, 44, 32,114,101,102, 32, 61, 32,115,116,114,102,105,110,
+  100, 40,100, 44, 39, 40, 38, 41, 39, 41, 10,100, 32, 61, 32,
+  103,115,117, 98, 40,100, 44, 39, 38, 39, 44, 39, 39, 41, 10,
+  101,108,115,101,105,102, 32,107, 61, 61, 39, 38, 91, 93, 39,
+   32,116,104,101,110, 10,108, 46,110, 32, 61, 32,108, 46,110,
+   43, 49, 10,108, 91,108, 46,110, 93, 32, 61, 32, 68,101, 99,
+  108, 97,114, 97,116,105,111,110, 40,100, 44, 39,118, 97,114,
+   39, 41, 10,108, 91,108, 46,110, 93, 46,110, 97,109,101, 32,
+   61, 32, 39,116,111,108,117, 97, 95,118, 97,108,117,101, 39,
+   10,101,110,100, 10,108,111, 99, 97,108, 32,102, 32, 61, 32,
+   68,101, 99,108, 97,114, 97,116,105,111,110, 40,100, 44, 39,
+  102,117,110, 99, 39, 41, 10,105,102, 32,107, 32, 61, 61, 32,
+   39, 91, 93, 39, 32, 97,110,100, 32, 40,108, 91, 49, 93, 61,
+   61,110,105,108, 32,111,114, 32,105,115, 98, 97,115,105, 99,
+   40,108, 91, 49, 93, 46,116,121,112,101, 41,126, 61, 39,110,
+  117,109, 98,101,114, 39, 41, 32,116,104,101,110, 10,101,114,
+  114,111,114, 40, 39,111,112,101,114, 97,116,111,114, 91, 93,
+   32, 99, 97,110, 32,111,110,108,121, 32, 98,101, 32,100,101,
+  102,105,110,101,100, 32,102,111,114, 32,110,117,109,101,114,
+  105, 99, 32,105,110,100,101,120, 46, 39, 41, 10,101,110,100,
+   10,102, 46, 97,114,103,115, 32, 61, 32,108, 10,102, 46, 99,
+  111,110,115,116, 32, 61, 32, 99, 10,102, 46,107,105,110,100,
+   32, 61, 32,111,112, 95,107, 10,102, 46,108,110, 97,109,101,
+   32, 61, 32, 34, 46, 34, 46, 46, 40, 95, 84, 77, 91,102, 46,
+  107,105,110,100, 93, 32,111,114, 32,102, 46,107,105,110,100,
+   41, 10,105,102, 32,110,111,116, 32, 95, 84, 77, 91,102, 46,
+  107,105,110,100, 93, 32,116,104,101,110, 10,102, 46, 99, 97,
+  115,116, 95,111,112,101,114, 97,116,111,114, 32, 61, 32,116,
+  114,117,101, 10,101,110,100, 10,105,102, 32,102, 46,107,105,
+  110,100, 32, 61, 61, 32, 39, 91, 93, 39, 32, 97,110,100, 32,
+  114,101,102, 61, 61, 39, 38, 39, 32, 97,110,100, 32,102, 46,
+   99,111,110,115,116,126, 61, 39, 99,111,110,115,116, 39, 32,
+  116,104,101,110, 10, 79,112,101,114, 97,116,111,114, 40,100,
+   44, 39, 38, 39, 46, 46,107, 44, 97, 44, 99, 41, 10,101,110,
+  100, 10,114,101,116,117,114,110, 32, 95, 79,112,101,114, 97,
+  116,111,114, 40,102, 41, 10,101,110,100, 45, 45, 45, 45, 45,
+   45, 45, 45, 45, 45, 45, 45, 45, 45,32
   };
   tolua_dobuffer(tolua_S,(char*)B,sizeof(B),"tolua embedded: lua/operator.lua");
   lua_settop(tolua_S, top);
@@ -177,7 +177,9 @@ static int lua_isusertype (lua_State* L, int lo, const char* type)
 		{
 		 lua_rawget(L,LUA_REGISTRYINDEX);  /* get registry[mt] */
 		 tn = lua_tostring(L,-1);
-		 r = tn && (strcmp(tn,type) == 0);
+		 // Modified by Urho3D. A type is also its const type, so accept that without the specialized class lookup, which is
+		 // the common case for const reference parameters such as 'const Vector3&'
+		 r = tn && (strcmp(tn,type) == 0 || (strncmp(type,"const ",6) == 0 && strcmp(tn,type+6) == 0));
 		 lua_pop(L, 1);
 			if (r)
 			 return 1;
@@ -16,6 +16,7 @@
 #include "lauxlib.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 TOLUA_API void tolua_pushvalue (lua_State* L, int lo)
 {
@@ -118,6 +119,23 @@ TOLUA_API void tolua_pushusertype_and_takeownership (lua_State* L, void* value,
 	tolua_register_gc(L,lua_gettop(L));
 }
 
+// Added by Urho3D. The value is stored after the object pointer in the same userdata, so it is freed along with the userdata
+// and must not be registered for garbage collection. The userdata is not added to the ubox, as no other pointer refers to it.
+// Only suitable for types that can be copied with memcpy and have a trivial destructor.
+TOLUA_API void tolua_pushusertype_value (lua_State* L, const void* value, unsigned int size, const char* type)
+{
+ void** u = (void**)lua_newuserdata(L,sizeof(void*) + size);  /* stack: newud */
+ *u = (void*)(u + 1);
+ memcpy(u + 1,value,size);
+ luaL_getmetatable(L,type);                                     /* stack: newud mt */
+ lua_setmetatable(L,-2);                                        /* stack: newud */
+
+ #ifdef LUA_VERSION_NUM
+ lua_pushvalue(L, TOLUA_NOPEER);
+ lua_setfenv(L, -2);
+ #endif
+}
+
 TOLUA_API void tolua_pushfieldvalue (lua_State* L, int lo, int index, int v)
 {
  lua_pushnumber(L,index);
@@ -29,6 +29,7 @@
 #include <Urho3D/IO/File.h>
 #include <Urho3D/IO/FileSystem.h>
 #include <Urho3D/Graphics/Geometry.h>
+#include <Urho3D/Graphics/GeometryOptimizer.h>
 #include <Urho3D/Graphics/Graphics.h>
 #include <Urho3D/Graphics/IndexBuffer.h>
 #include <Urho3D/Graphics/Light.h>
@@ -51,6 +52,8 @@
 
 #include <Urho3D/Container/Sort.h>
 
+#include "MeshSimplifier.h"
+
 #ifdef WIN32
 #include <windows.h>
 #endif
@@ -122,7 +125,10 @@ bool noOverwriteMaterial_ = false;
 bool noOverwriteTexture_ = false;
 bool noOverwriteNewerTexture_ = false;
 bool checkUniqueModel_ = true;
+bool optimizeGeometries_ = false;
 unsigned maxBones_ = 64;
+PODVector<float> lodRatios_;
+PODVector<float> lodDistances_;
 Vector<String> nonSkinningBoneIncludes_;
 Vector<String> nonSkinningBoneExcludes_;
 
@@ -155,6 +161,8 @@ void BuildAndSaveMaterial(aiMaterial* material, HashSet<String>& usedTextures);
 void CopyTextures(const HashSet<String>& usedTextures, const String& sourcePath);
 
 void CombineLods(const PODVector<float>& lodDistances, const Vector<String>& modelNames, const String& outName);
+void GenerateLods(Model* model);
+void OptimizeGeometries(Model* model);
 
 void GetMeshesUnderNode(Vector<Pair<aiNode*, aiMesh*> >& meshes, aiNode* node);
 unsigned GetMeshIndex(aiMesh* mesh);
@@ -248,6 +256,9 @@ void Run(const Vector<String>& arguments)
             "-ct         Check and do not overwrite if texture exists\n"
             "-ctn        Check and do not overwrite if texture has newer timestamp\n"
             "-am         Export all meshes even if identical (scene mode only)\n"
+            "-lod <list> Generate LOD levels by mesh simplification. Semicolon separated list\n"
+            "            of triangle ratio and distance pairs, for example -lod \"0.5,20;0.25,50\"\n"
+            "-oc         Optimize triangle and vertex order for the vertex cache and overdraw\n"
         );
     }
     
@@ -389,6 +400,27 @@ void Run(const Vector<String>& arguments)
                 noOverwriteNewerTexture_ = true;
             else if (argument == "am")
                 checkUniqueModel_ = false;
+            else if (argument == "oc")
+                optimizeGeometries_ = true;
+            else if (argument == "lod" && !value.Empty())
+            {
+                Vector<String> levels = value.Split(';');
+                for (unsigned j = 0; j < levels.Size(); ++j)
+                {
+                    Vector<String> params = levels[j].Split(',');
+                    if (params.Size() != 2)
+                        ErrorExit("LOD levels must be defined as ratio and distance pairs");
+                    float ratio = ToFloat(params[0]);
+                    float distance = ToFloat(params[1]);
+                    if (ratio <= 0.0f || ratio >= 1.0f)
+                        ErrorExit("LOD triangle ratio must be between 0 and 1");
+                    if (distance <= (lodDistances_.Size() ? lodDistances_.Back() : 0.0f))
+                        ErrorExit("LOD distances must be increasing and greater than 0");
+                    lodRatios_.Push(ratio);
+                    lodDistances_.Push(distance);
+                }
+                ++i;
+            }
         }
     }
     
@@ -928,6 +960,11 @@ void BuildAndSaveModel(OutModel& model)
     outModel->SetIndexBuffers(ibVector);
     outModel->SetBoundingBox(box);
     
+    if (lodRatios_.Size())
+        GenerateLods(outModel);
+    if (optimizeGeometries_)
+        OptimizeGeometries(outModel);
+    
     // Build skeleton if necessary
     if (model.bones_.Size() && model.rootBone_)
     {
@@ -1846,6 +1883,139 @@ void CombineLods(const PODVector<float>& lodDistances, const Vector<String>& mod
     outModel->Save(outFile);
 }
 
+void GenerateLods(Model* model)
+{
+    Vector<SharedPtr<IndexBuffer> > ibVector = model->GetIndexBuffers();
+    float modelSize = model->GetBoundingBox().Size().Length();
+    unsigned numGeometries = model->GetNumGeometries();
+    
+    for (unsigned i = 0; i < lodRatios_.Size(); ++i)
+    {
+        // The simplified geometries share the original vertex buffers. Collect their indices into one new index buffer
+        // per original index buffer
+        HashMap<IndexBuffer*, PODVector<unsigned> > lodIndices;
+        PODVector<unsigned> lodIndexStarts(numGeometries);
+        PODVector<unsigned> lodIndexCounts(numGeometries);
+        
+        for (unsigned j = 0; j < numGeometries; ++j)
+        {
+            Geometry* geom = model->GetGeometry(j, 0);
+            IndexBuffer* ib = geom->GetIndexBuffer();
+            VertexBuffer* vb = geom->GetVertexBuffer(0);
+            lodIndexCounts[j] = 0;
+            if (geom->GetPrimitiveType() != TRIANGLE_LIST || !ib || !vb || !ib->GetShadowData() || !vb->GetShadowData())
+                continue;
+            
+            PODVector<unsigned> indices(geom->GetIndexCount());
+            const unsigned char* indexData = ib->GetShadowData() + geom->GetIndexStart() * ib->GetIndexSize();
+            for (unsigned k = 0; k < indices.Size(); ++k)
+            {
+                if (ib->GetIndexSize() == sizeof(unsigned))
+                    indices[k] = ((const unsigned*)indexData)[k];
+                else
+                    indices[k] = ((const unsigned short*)indexData)[k];
+            }
+            
+            unsigned numTriangles = indices.Size() / 3;
+            float error = SimplifyMesh(indices, vb->GetShadowData(), vb->GetVertexSize(), (unsigned)(numTriangles *
+                lodRatios_[i]));
+            PrintLine("Geometry " + String(j) + " LOD level " + String(i + 1) + ": " + String(indices.Size() / 3) + " of " +
+                String(numTriangles) + " triangles, error " + String(error) + " (" + String(modelSize > 0.0f ? 100.0f *
+                error / modelSize : 0.0f) + "% of model size)");
+            if (indices.Empty())
+                continue;
+            
+            PODVector<unsigned>& dest = lodIndices[ib];
+            lodIndexStarts[j] = dest.Size();
+            lodIndexCounts[j] = indices.Size();
+            dest.Push(indices);
+        }
+        
+        // Skip the level if simplification removed every triangle, as an empty index buffer can not be created
+        if (lodIndices.Empty())
+        {
+            PrintLine("LOD level " + String(i + 1) + " has no triangles left, skipping");
+            continue;
+        }
+        
+        HashMap<IndexBuffer*, SharedPtr<IndexBuffer> > lodBuffers;
+        for (HashMap<IndexBuffer*, PODVector<unsigned> >::Iterator j = lodIndices.Begin(); j != lodIndices.End(); ++j)
+        {
+            const PODVector<unsigned>& indices = j->second_;
+            bool largeIndices = j->first_->GetIndexSize() == sizeof(unsigned);
+            SharedPtr<IndexBuffer> ib(new IndexBuffer(context_));
+            ib->SetSize(indices.Size(), largeIndices);
+            if (largeIndices)
+                ib->SetData(&indices[0]);
+            else
+            {
+                PODVector<unsigned short> shortIndices(indices.Size());
+                for (unsigned k = 0; k < indices.Size(); ++k)
+                    shortIndices[k] = (unsigned short)indices[k];
+                ib->SetData(&shortIndices[0]);
+            }
+            
+            lodBuffers[j->first_] = ib;
+            ibVector.Push(ib);
+        }
+        
+        for (unsigned j = 0; j < numGeometries; ++j)
+        {
+            if (!lodIndexCounts[j])
+                continue;
+            
+            Geometry* geom = model->GetGeometry(j, 0);
+            SharedPtr<Geometry> lodGeom(new Geometry(context_));
+            lodGeom->SetNumVertexBuffers(geom->GetNumVertexBuffers());
+            for (unsigned k = 0; k < geom->GetNumVertexBuffers(); ++k)
+                lodGeom->SetVertexBuffer(k, geom->GetVertexBuffer(k), geom->GetVertexElementMask(k));
+            lodGeom->SetIndexBuffer(lodBuffers[geom->GetIndexBuffer()]);
+            lodGeom->SetDrawRange(TRIANGLE_LIST, lodIndexStarts[j], lodIndexCounts[j]);
+            lodGeom->SetLodDistance(lodDistances_[i]);
+            
+            unsigned numLevels = model->GetNumGeometryLodLevels(j);
+            model->SetNumGeometryLodLevels(j, numLevels + 1);
+            model->SetGeometry(j, numLevels, lodGeom);
+        }
+    }
+    
+    model->SetIndexBuffers(ibVector);
+}
+
+void OptimizeGeometries(Model* model)
+{
+    // Record the cache efficiency of each geometry and LOD level before optimizing to report the improvement
+    Vector<PODVector<VertexCacheStatistics> > before(model->GetNumGeometries());
+    for (unsigned i = 0; i < model->GetNumGeometries(); ++i)
+    {
+        for (unsigned j = 0; j < model->GetNumGeometryLodLevels(i); ++j)
+        {
+            Geometry* geom = model->GetGeometry(i, j);
+            IndexBuffer* ib = geom->GetIndexBuffer();
+            before[i].Push(ib && ib->GetShadowData() ? AnalyzeVertexCache(ib->GetShadowData(), ib->GetIndexSize(),
+                geom->GetIndexStart(), geom->GetIndexCount()) : VertexCacheStatistics());
+        }
+    }
+    
+    model->OptimizeGeometries();
+    
+    for (unsigned i = 0; i < model->GetNumGeometries(); ++i)
+    {
+        for (unsigned j = 0; j < model->GetNumGeometryLodLevels(i); ++j)
+        {
+            Geometry* geom = model->GetGeometry(i, j);
+            IndexBuffer* ib = geom->GetIndexBuffer();
+            if (geom->GetPrimitiveType() != TRIANGLE_LIST || !ib || !ib->GetShadowData())
+                continue;
+            
+            VertexCacheStatistics after = AnalyzeVertexCache(ib->GetShadowData(), ib->GetIndexSize(), geom->GetIndexStart(),
+                geom->GetIndexCount());
+            PrintLine("Geometry " + String(i) + " LOD level " + String(j) + ": ACMR " + String(before[i][j].acmr_) + " -> " +
+                String(after.acmr_) + ", ATVR " + String(before[i][j].atvr_) + " -> " + String(after.atvr_));
+        }
+    }
+}
+
 void GetMeshesUnderNode(Vector<Pair<aiNode*, aiMesh*> >& dest, aiNode* node)
 {
     for (unsigned i = 0; i < node->mNumMeshes; ++i)
@@ -0,0 +1,401 @@
+//
+// Copyright (c) 2008-2015 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "MeshSimplifier.h"
+
+#include <Urho3D/Container/HashMap.h>
+#include <Urho3D/Container/HashSet.h>
+#include <Urho3D/Container/Sort.h>
+#include <Urho3D/Math/Vector3.h>
+
+#include <cstring>
+
+#include <Urho3D/DebugNew.h>
+
+/// Weight of the planes that keep open borders in place, relative to the triangle area weighted surface planes.
+static const float BORDER_WEIGHT = 10.0f;
+/// Minimum cosine of the angle between a triangle's normal before and after a collapse.
+static const float MIN_NORMAL_DOT = 0.25f;
+
+/// Vertex classification for collapse rules.
+enum VertexKind
+{
+    /// Single attribute set and closed surface around. Can collapse onto any neighbor.
+    VK_MANIFOLD = 0,
+    /// Single attribute set on an open border. Can collapse along the border.
+    VK_BORDER,
+    /// On an attribute seam or otherwise complex. Can not collapse, but other vertices can collapse onto it.
+    VK_LOCKED
+};
+
+/// Symmetric 4x4 error quadric with the accumulated weight.
+struct Quadric
+{
+    /// Construct zero.
+    Quadric() :
+        a00_(0.0f), a11_(0.0f), a22_(0.0f), a10_(0.0f), a20_(0.0f), a21_(0.0f),
+        b0_(0.0f), b1_(0.0f), b2_(0.0f), c_(0.0f), weight_(0.0f)
+    {
+    }
+
+    /// Add the squared distance to a plane.
+    void AddPlane(const Vector3& normal, float d, float weight)
+    {
+        a00_ += weight * normal.x_ * normal.x_;
+        a11_ += weight * normal.y_ * normal.y_;
+        a22_ += weight * normal.z_ * normal.z_;
+        a10_ += weight * normal.y_ * normal.x_;
+        a20_ += weight * normal.z_ * normal.x_;
+        a21_ += weight * normal.z_ * normal.y_;
+        b0_ += weight * normal.x_ * d;
+        b1_ += weight * normal.y_ * d;
+        b2_ += weight * normal.z_ * d;
+        c_ += weight * d * d;
+        weight_ += weight;
+    }
+
+    /// Add another quadric.
+    void Add(const Quadric& rhs)
+    {
+        a00_ += rhs.a00_;
+        a11_ += rhs.a11_;
+        a22_ += rhs.a22_;
+        a10_ += rhs.a10_;
+        a20_ += rhs.a20_;
+        a21_ += rhs.a21_;
+        b0_ += rhs.b0_;
+        b1_ += rhs.b1_;
+        b2_ += rhs.b2_;
+        c_ += rhs.c_;
+        weight_ += rhs.weight_;
+    }
+
+    /// Return the weighted mean squared distance of a position to the planes.
+    float Evaluate(const Vector3& p) const
+    {
+        float rx = a00_ * p.x_ + a10_ * p.y_ + a20_ * p.z_ + 2.0f * b0_;
+        float ry = a10_ * p.x_ + a11_ * p.y_ + a21_ * p.z_ + 2.0f * b1_;
+        float rz = a20_ * p.x_ + a21_ * p.y_ + a22_ * p.z_ + 2.0f * b2_;
+        float error = rx * p.x_ + ry * p.y_ + rz * p.z_ + c_;
+        return weight_ > M_EPSILON ? Max(error / weight_, 0.0f) : 0.0f;
+    }
+
+    float a00_, a11_, a22_, a10_, a20_, a21_;
+    float b0_, b1_, b2_;
+    float c_;
+    float weight_;
+};
+
+/// Vertex position with its local index, for finding the vertices that share a position.
+struct SortedPosition
+{
+    Vector3 position_;
+    unsigned index_;
+};
+
+/// Edge collapse candidate.
+struct Collapse
+{
+    /// Vertex to remove.
+    unsigned from_;
+    /// Vertex to keep.
+    unsigned to_;
+    /// Squared error.
+    float error_;
+};
+
+static bool ComparePositions(const SortedPosition& lhs, const SortedPosition& rhs)
+{
+    if (lhs.position_.x_ != rhs.position_.x_)
+        return lhs.position_.x_ < rhs.position_.x_;
+    if (lhs.position_.y_ != rhs.position_.y_)
+        return lhs.position_.y_ < rhs.position_.y_;
+    return lhs.position_.z_ < rhs.position_.z_;
+}
+
+static bool CompareCollapses(const Collapse& lhs, const Collapse& rhs)
+{
+    return lhs.error_ < rhs.error_;
+}
+
+static inline unsigned long long EdgeKey(unsigned from, unsigned to)
+{
+    return ((unsigned long long)from << 32) | to;
+}
+
+float SimplifyMesh(PODVector<unsigned>& indices, const unsigned char* vertexData, unsigned vertexSize, unsigned targetTriangles)
+{
+    if (indices.Size() < 3 || indices.Size() / 3 <= targetTriangles)
+        return 0.0f;
+    if (!targetTriangles)
+        targetTriangles = 1;
+
+    // Remap the used vertices to a compact local range
+    HashMap<unsigned, unsigned> localIndices;
+    PODVector<unsigned> vertexIndices;
+    PODVector<Vector3> positions;
+    for (unsigned i = 0; i < indices.Size(); ++i)
+    {
+        HashMap<unsigned, unsigned>::Iterator j = localIndices.Find(indices[i]);
+        if (j == localIndices.End())
+        {
+            unsigned local = vertexIndices.Size();
+            localIndices[indices[i]] = local;
+            vertexIndices.Push(indices[i]);
+            positions.Push(*reinterpret_cast<const Vector3*>(vertexData + indices[i] * vertexSize));
+            indices[i] = local;
+        }
+        else
+            indices[i] = j->second_;
+    }
+
+    // Group the vertices sharing a position. A vertex whose position is shared has an attribute seam
+    unsigned numVertices = vertexIndices.Size();
+    PODVector<SortedPosition> sorted(numVertices);
+    for (unsigned i = 0; i < numVertices; ++i)
+    {
+        sorted[i].position_ = positions[i];
+        sorted[i].index_ = i;
+    }
+    Sort(sorted.Begin(), sorted.End(), ComparePositions);
+
+    PODVector<unsigned> groups(numVertices);
+    PODVector<bool> seams(numVertices);
+    for (unsigned i = 0; i < numVertices;)
+    {
+        unsigned j = i + 1;
+        while (j < numVertices && sorted[j].position_ == sorted[i].position_)
+            ++j;
+        for (unsigned k = i; k < j; ++k)
+        {
+            groups[sorted[k].index_] = sorted[i].index_;
+            seams[sorted[k].index_] = j - i > 1;
+        }
+        i = j;
+    }
+
+    // Accumulate the quadrics of the triangle planes, weighted by area, into the position groups
+    Vector<Quadric> quadrics(numVertices);
+    for (unsigned i = 0; i < indices.Size(); i += 3)
+    {
+        const Vector3& p0 = positions[indices[i]];
+        Vector3 normal = (positions[indices[i + 1]] - p0).CrossProduct(positions[indices[i + 2]] - p0);
+        float area = normal.Length();
+        if (area < M_EPSILON)
+            continue;
+        normal /= area;
+        for (unsigned j = 0; j < 3; ++j)
+            quadrics[groups[indices[i + j]]].AddPlane(normal, -normal.DotProduct(p0), area * 0.5f);
+    }
+
+    float maxError = 0.0f;
+    PODVector<unsigned char> kinds(numVertices);
+    PODVector<unsigned> collapseTargets(numVertices);
+    PODVector<bool> locked(numVertices);
+    PODVector<unsigned> triangleOffsets(numVertices + 1);
+    PODVector<unsigned> vertexTriangles;
+    PODVector<Collapse> collapses;
+    HashSet<unsigned long long> edges;
+    bool firstPass = true;
+
+    for (;;)
+    {
+        unsigned numTriangles = indices.Size() / 3;
+        if (numTriangles <= targetTriangles)
+            break;
+
+        // Find the open border edges as directed edges between position groups without an opposing edge
+        edges.Clear();
+        for (unsigned i = 0; i < indices.Size(); i += 3)
+        {
+            for (unsigned j = 0; j < 3; ++j)
+                edges.Insert(EdgeKey(groups[indices[i + j]], groups[indices[i + (j + 1) % 3]]));
+        }
+
+        PODVector<unsigned char> borderCounts(numVertices);
+        memset(&borderCounts[0], 0, numVertices);
+        for (unsigned i = 0; i < indices.Size(); i += 3)
+        {
+            for (unsigned j = 0; j < 3; ++j)
+            {
+                unsigned v0 = indices[i + j];
+                unsigned v1 = indices[i + (j + 1) % 3];
+                if (edges.Contains(EdgeKey(groups[v1], groups[v0])))
+                    continue;
+
+                if (borderCounts[groups[v0]] < 255)
+                    ++borderCounts[groups[v0]];
+                if (borderCounts[groups[v1]] < 255)
+                    ++borderCounts[groups[v1]];
+
+                // Keep the border in place by a plane through the edge, perpendicular to the triangle
+                if (firstPass)
+                {
+                    const Vector3& p0 = positions[v0];
+                    const Vector3& p1 = positions[v1];
+                    const Vector3& p2 = positions[indices[i + (j + 2) % 3]];
+                    Vector3 edge = p1 - p0;
+                    Vector3 normal = edge.CrossProduct(edge.CrossProduct(p2 - p0)).Normalized();
+                    float weight = edge.LengthSquared() * BORDER_WEIGHT;
+                    quadrics[groups[v0]].AddPlane(normal, -normal.DotProduct(p0), weight);
+                    quadrics[groups[v1]].AddPlane(normal, -normal.DotProduct(p0), weight);
+                }
+            }
+        }
+        firstPass = false;
+
+        for (unsigned i = 0; i < numVertices; ++i)
+        {
+            unsigned borderCount = borderCounts[groups[i]];
+            if (seams[i] || (borderCount != 0 && borderCount != 2))
+                kinds[i] = VK_LOCKED;
+            else
+                kinds[i] = (unsigned char)(borderCount ? VK_BORDER : VK_MANIFOLD);
+        }
+
+        // Build the vertex to triangle adjacency
+        memset(&triangleOffsets[0], 0, (numVertices + 1) * sizeof(unsigned));
+        for (unsigned i = 0; i < indices.Size(); ++i)
+            ++triangleOffsets[indices[i] + 1];
+        for (unsigned i = 0; i < numVertices; ++i)
+            triangleOffsets[i + 1] += triangleOffsets[i];
+        vertexTriangles.Resize(indices.Size());
+        PODVector<unsigned> fill(triangleOffsets);
+        for (unsigned i = 0; i < indices.Size(); ++i)
+            vertexTriangles[fill[indices[i]]++] = i / 3;
+
+        // Collect the allowed collapses and sort them by error
+        collapses.Clear();
+        for (unsigned i = 0; i < indices.Size(); i += 3)
+        {
+            for (unsigned j = 0; j < 3; ++j)
+            {
+                unsigned v0 = indices[i + j];
+                unsigned v1 = indices[i + (j + 1) % 3];
+                bool borderEdge = !edges.Contains(EdgeKey(groups[v1], groups[v0]));
+
+                for (unsigned k = 0; k < 2; ++k)
+                {
+                    unsigned from = k ? v1 : v0;
+                    unsigned to = k ? v0 : v1;
+                    if (kinds[from] == VK_LOCKED || (kinds[from] == VK_BORDER && (!borderEdge || kinds[to] == VK_MANIFOLD)))
+                        continue;
+
+                    Quadric quadric = quadrics[groups[from]];
+                    quadric.Add(quadrics[groups[to]]);
+
+                    Collapse collapse;
+                    collapse.from_ = from;
+                    collapse.to_ = to;
+                    collapse.error_ = quadric.Evaluate(positions[to]);
+                    collapses.Push(collapse);
+                }
+            }
+        }
+        if (collapses.Empty())
+            break;
+        Sort(collapses.Begin(), collapses.End(), CompareCollapses);
+
+        // Perform the cheapest collapses whose surroundings have not changed in this pass
+        for (unsigned i = 0; i < numVertices; ++i)
+        {
+            collapseTargets[i] = i;
+            locked[i] = false;
+        }
+
+        unsigned numCollapses = 0;
+        for (unsigned i = 0; i < collapses.Size() && numTriangles > targetTriangles; ++i)
+        {
+            const Collapse& collapse = collapses[i];
+            unsigned from = collapse.from_;
+            unsigned to = collapse.to_;
+            if (locked[from] || locked[to])
+                continue;
+
+            // Reject collapses that would flip or strongly bend triangles, and count the triangles that would disappear
+            unsigned removed = 0;
+            bool allowed = true;
+            for (unsigned j = triangleOffsets[from]; j < triangleOffsets[from + 1] && allowed; ++j)
+            {
+                const unsigned* triangle = &indices[vertexTriangles[j] * 3];
+                if (triangle[0] == to || triangle[1] == to || triangle[2] == to)
+                {
+                    ++removed;
+                    continue;
+                }
+
+                Vector3 p[3];
+                Vector3 q[3];
+                for (unsigned k = 0; k < 3; ++k)
+                {
+                    p[k] = positions[triangle[k]];
+                    q[k] = triangle[k] == from ? positions[to] : p[k];
+                }
+                Vector3 oldNormal = (p[1] - p[0]).CrossProduct(p[2] - p[0]);
+                Vector3 newNormal = (q[1] - q[0]).CrossProduct(q[2] - q[0]);
+                float oldLength = oldNormal.Length();
+                if (oldLength > M_EPSILON && oldNormal.DotProduct(newNormal) <= MIN_NORMAL_DOT * oldLength * newNormal.Length())
+                    allowed = false;
+            }
+            if (!allowed || removed >= numTriangles)
+                continue;
+
+            collapseTargets[from] = to;
+            quadrics[groups[to]].Add(quadrics[groups[from]]);
+            maxError = Max(maxError, collapse.error_);
+            numTriangles -= removed;
+            ++numCollapses;
+
+            for (unsigned j = triangleOffsets[from]; j < triangleOffsets[from + 1]; ++j)
+            {
+                const unsigned* triangle = &indices[vertexTriangles[j] * 3];
+                locked[triangle[0]] = true;
+                locked[triangle[1]] = true;
+                locked[triangle[2]] = true;
+            }
+        }
+
+        if (!numCollapses)
+            break;
+
+        // Apply the collapses and remove the triangles that became degenerate
+        unsigned writeIndex = 0;
+        for (unsigned i = 0; i < indices.Size(); i += 3)
+        {
+            unsigned v0 = collapseTargets[indices[i]];
+            unsigned v1 = collapseTargets[indices[i + 1]];
+            unsigned v2 = collapseTargets[indices[i + 2]];
+            if (v0 == v1 || v1 == v2 || v2 == v0)
+                continue;
+            indices[writeIndex++] = v0;
+            indices[writeIndex++] = v1;
+            indices[writeIndex++] = v2;
+        }
+        indices.Resize(writeIndex);
+    }
+
+    // Return to the original vertex indices
+    for (unsigned i = 0; i < indices.Size(); ++i)
+        indices[i] = vertexIndices[indices[i]];
+
+    return sqrtf(maxError);
+}
@@ -0,0 +1,633 @@
+//
+// Copyright (c) 2008-2015 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include <Urho3D/Urho3D.h>
+
+#include <Urho3D/Container/ArrayPtr.h>
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Core/ProcessUtils.h>
+#include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/Core/Timer.h>
+#include <Urho3D/Core/WorkQueue.h>
+#include <Urho3D/IO/File.h>
+#include <Urho3D/IO/FileSystem.h>
+#include <Urho3D/IO/Log.h>
+#include <Urho3D/Math/MathDefs.h>
+#include <Urho3D/Resource/Image.h>
+
+#ifdef WIN32
+#include <windows.h>
+#endif
+
+#include <Urho3D/DebugNew.h>
+
+using namespace Urho3D;
+
+static const unsigned DDSD_CAPS = 0x00000001;
+static const unsigned DDSD_HEIGHT = 0x00000002;
+static const unsigned DDSD_WIDTH = 0x00000004;
+static const unsigned DDSD_PIXELFORMAT = 0x00001000;
+static const unsigned DDSD_MIPMAPCOUNT = 0x00020000;
+static const unsigned DDSD_LINEARSIZE = 0x00080000;
+static const unsigned DDPF_FOURCC = 0x00000004;
+static const unsigned DDSCAPS_COMPLEX = 0x00000008;
+static const unsigned DDSCAPS_TEXTURE = 0x00001000;
+static const unsigned DDSCAPS_MIPMAP = 0x00400000;
+static const unsigned DDS_DIMENSION_TEXTURE2D = 3;
+static const unsigned DDS_DXGI_FORMAT_BC1_UNORM_SRGB = 72;
+static const unsigned DDS_DXGI_FORMAT_BC3_UNORM_SRGB = 78;
+static const unsigned FOURCC_DXT1 = ('D') | ('X' << 8) | ('T' << 16) | ('1' << 24);
+static const unsigned FOURCC_DXT5 = ('D') | ('X' << 8) | ('T' << 16) | ('5' << 24);
+static const unsigned FOURCC_DX10 = ('D') | ('X' << 8) | ('1' << 16) | ('0' << 24);
+
+static const int COLOR_REFINE_ITERATIONS = 2;
+
+/// Block compression parameters of one mip level, shared by the work items encoding it.
+struct EncodeLevel
+{
+    /// RGBA source pixels.
+    const unsigned char* source_;
+    /// Destination block data.
+    unsigned char* dest_;
+    /// Width in pixels.
+    int width_;
+    /// Height in pixels.
+    int height_;
+    /// Block size in bytes.
+    unsigned blockSize_;
+    /// Encode DXT5 alpha.
+    bool alpha_;
+};
+
+int main(int argc, char** argv);
+void Run(const Vector<String>& arguments);
+
+int main(int argc, char** argv)
+{
+    Vector<String> arguments;
+
+#ifdef WIN32
+    arguments = ParseArguments(GetCommandLineW());
+#else
+    arguments = ParseArguments(argc, argv);
+#endif
+
+    Run(arguments);
+    return 0;
+}
+
+void Help()
+{
+    ErrorExit("Usage: TextureTool -options <input image file> <output dds file>\n"
+        "\n"
+        "Options:\n"
+        "-h Shows this help message.\n"
+        "-f Compression format: dxt1 or dxt5. Default is dxt5 if the image has non-opaque alpha, otherwise dxt1.\n"
+        "-nomips Writes only the full size level.\n"
+        "-srgb Treats the image as sRGB: mip levels are averaged in linear space and the output is marked sRGB.\n"
+        "-t Number of encoding threads. Default is the number of CPU cores.\n"
+        "-v Verifies the output by decoding it, and compares load time and memory use to the source image.\n");
+}
+
+/// Expand a 565 color to 8 bits per channel the same way as the decompressor.
+static void Unpack565(unsigned short packed, int* color)
+{
+    int red = (packed >> 11) & 0x1f;
+    int green = (packed >> 5) & 0x3f;
+    int blue = packed & 0x1f;
+    color[0] = (red << 3) | (red >> 2);
+    color[1] = (green << 2) | (green >> 4);
+    color[2] = (blue << 3) | (blue >> 2);
+}
+
+/// Quantize a color to 565.
+static unsigned short Pack565(const float* color)
+{
+    int red = Clamp((int)(color[0] * 31.0f / 255.0f + 0.5f), 0, 31);
+    int green = Clamp((int)(color[1] * 63.0f / 255.0f + 0.5f), 0, 63);
+    int blue = Clamp((int)(color[2] * 31.0f / 255.0f + 0.5f), 0, 31);
+    return (unsigned short)((red << 11) | (green << 5) | blue);
+}
+
+/// Choose the nearest palette entry for each pixel of a block. Return the summed squared error.
+static int FitColorIndices(const unsigned char* block, unsigned short color0, unsigned short color1, unsigned char* indices)
+{
+    int palette[4][3];
+    Unpack565(color0, palette[0]);
+    Unpack565(color1, palette[1]);
+    for (unsigned c = 0; c < 3; ++c)
+    {
+        palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+        palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+    }
+
+    int totalError = 0;
+    for (unsigned i = 0; i < 16; ++i)
+    {
+        const unsigned char* pixel = block + i * 4;
+        int bestError = M_MAX_INT;
+        for (unsigned j = 0; j < 4; ++j)
+        {
+            int dr = pixel[0] - palette[j][0];
+            int dg = pixel[1] - palette[j][1];
+            int db = pixel[2] - palette[j][2];
+            int error = dr * dr + dg * dg + db * db;
+            if (error < bestError)
+            {
+                bestError = error;
+                indices[i] = (unsigned char)j;
+            }
+        }
+        totalError += bestError;
+    }
+
+    return totalError;
+}
+
+/// Encode the colors of a 4x4 RGBA block as 8 bytes of DXT1 color data.
+static void EncodeColorBlock(const unsigned char* block, unsigned char* dest)
+{
+    // Find the principal axis of the colors by power iteration on their covariance
+    float mean[3] = { 0.0f, 0.0f, 0.0f };
+    for (unsigned i = 0; i < 16; ++i)
+    {
+        for (unsigned c = 0; c < 3; ++c)
+            mean[c] += block[i * 4 + c];
+    }
+    for (unsigned c = 0; c < 3; ++c)
+        mean[c] /= 16.0f;
+
+    float cov[6] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    for (unsigned i = 0; i < 16; ++i)
+    {
+        float r = block[i * 4] - mean[0];
+        float g = block[i * 4 + 1] - mean[1];
+        float b = block[i * 4 + 2] - mean[2];
+        cov[0] += r * r;
+        cov[1] += r * g;
+        cov[2] += r * b;
+        cov[3] += g * g;
+        cov[4] += g * b;
+        cov[5] += b * b;
+    }
+
+    float axis[3] = { 1.0f, 1.0f, 1.0f };
+    for (unsigned iteration = 0; iteration < 4; ++iteration)
+    {
+        float x = axis[0] * cov[0] + axis[1] * cov[1] + axis[2] * cov[2];
+        float y = axis[0] * cov[1] + axis[1] * cov[3] + axis[2] * cov[4];
+        float z = axis[0] * cov[2] + axis[1] * cov[4] + axis[2] * cov[5];
+        float length = Max(Max(Abs(x), Abs(y)), Abs(z));
+        if (length < M_EPSILON)
+            break;
+        axis[0] = x / length;
+        axis[1] = y / length;
+        axis[2] = z / length;
+    }
+
+    // Use the colors at the extremes of the axis as the initial endpoints
+    float minProjection = M_INFINITY;
+    float maxProjection = -M_INFINITY;
+    float endpoints[2][3];
+    for (unsigned i = 0; i < 16; ++i)
+    {
+        const unsigned char* pixel = block + i * 4;
+        float projection = pixel[0] * axis[0] + pixel[1] * axis[1] + pixel[2] * axis[2];
+        if (projection < minProjection)
+        {
+            minProjection = projection;
+            for (unsigned c = 0; c < 3; ++c)
+                endpoints[1][c] = pixel[c];
+        }
+        if (projection > maxProjection)
+        {
+            maxProjection = projection;
+            for (unsigned c = 0; c < 3; ++c)
+                endpoints[0][c] = pixel[c];
+        }
+    }
+
+    unsigned short color0 = Pack565(endpoints[0]);
+    unsigned short color1 = Pack565(endpoints[1]);
+    unsigned char indices[16];
+    int error = FitColorIndices(block, color0, color1, indices);
+
+    // Refine the endpoints by a least squares fit to the chosen indices, keeping the result only if it improves
+    static const float weights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+    for (int iteration = 0; iteration < COLOR_REFINE_ITERATIONS && error > 0; ++iteration)
+    {
+        float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+        float ax[3] = { 0.0f, 0.0f, 0.0f };
+        float bx[3] = { 0.0f, 0.0f, 0.0f };
+        for (unsigned i = 0; i < 16; ++i)
+        {
+            float a = weights[indices[i]];
+            float b = 1.0f - a;
+            aa += a * a;
+            ab += a * b;
+            bb += b * b;
+            for (unsigned c = 0; c < 3; ++c)
+            {
+                ax[c] += a * block[i * 4 + c];
+                bx[c] += b * block[i * 4 + c];
+            }
+        }
+
+        float det = aa * bb - ab * ab;
+        if (Abs(det) < M_EPSILON)
+            break;
+        for (unsigned c = 0; c < 3; ++c)
+        {
+            endpoints[0][c] = (ax[c] * bb - bx[c] * ab) / det;
+            endpoints[1][c] = (bx[c] * aa - ax[c] * ab) / det;
+        }
+
+        unsigned short newColor0 = Pack565(endpoints[0]);
+        unsigned short newColor1 = Pack565(endpoints[1]);
+        unsigned char newIndices[16];
+        int newError = FitColorIndices(block, newColor0, newColor1, newIndices);
+        if (newError >= error)
+            break;
+
+        color0 = newColor0;
+        color1 = newColor1;
+        error = newError;
+        memcpy(indices, newIndices, sizeof indices);
+    }
+
+    // The first endpoint must be greater to select the 4-color mode. Swap if necessary, or use only the first entry if equal
+    if (color0 < color1)
+    {
+        static const unsigned char swapped[4] = { 1, 0, 3, 2 };
+        Swap(color0, color1);
+        for (unsigned i = 0; i < 16; ++i)
+            indices[i] = swapped[indices[i]];
+    }
+    else if (color0 == color1)
+        memset(indices, 0, sizeof indices);
+
+    unsigned packedIndices = 0;
+    for (unsigned i = 0; i < 16; ++i)
+        packedIndices |= (unsigned)indices[i] << (i * 2);
+
+    dest[0] = (unsigned char)(color0 & 0xff);
+    dest[1] = (unsigned char)(color0 >> 8);
+    dest[2] = (unsigned char)(color1 & 0xff);
+    dest[3] = (unsigned char)(color1 >> 8);
+    for (unsigned i = 0; i < 4; ++i)
+        dest[4 + i] = (unsigned char)(packedIndices >> (i * 8));
+}
+
+/// Encode the alpha of a 4x4 RGBA block as 8 bytes of DXT5 alpha data.
+static void EncodeAlphaBlock(const unsigned char* block, unsigned char* dest)
+{
+    int alpha0 = 0;
+    int alpha1 = 255;
+    for (unsigned i = 0; i < 16; ++i)
+    {
+        alpha0 = Max(alpha0, (int)block[i * 4 + 3]);
+        alpha1 = Min(alpha1, (int)block[i * 4 + 3]);
+    }
+
+    // With the first endpoint greater, the palette is the endpoints followed by 6 interpolated values
+    int palette[8];
+    palette[0] = alpha0;
+    palette[1] = alpha1;
+    for (int i = 1; i < 7; ++i)
+        palette[i + 1] = ((7 - i) * alpha0 + i * alpha1) / 7;
+
+    unsigned long long packedIndices = 0;
+    if (alpha0 != alpha1)
+    {
+        for (unsigned i = 0; i < 16; ++i)
+        {
+            int alpha = block[i * 4 + 3];
+            unsigned bestIndex = 0;
+            int bestError = M_MAX_INT;
+            for (unsigned j = 0; j < 8; ++j)
+            {
+                int error = Abs(alpha - palette[j]);
+                if (error < bestError)
+                {
+                    bestError = error;
+                    bestIndex = j;
+                }
+            }
+            packedIndices |= (unsigned long long)bestIndex << (i * 3);
+        }
+    }
+
+    dest[0] = (unsigned char)alpha0;
+    dest[1] = (unsigned char)alpha1;
+    for (unsigned i = 0; i < 6; ++i)
+        dest[2 + i] = (unsigned char)(packedIndices >> (i * 8));
+}
+
+/// Encode a range of block rows of a mip level.
+static void EncodeBlockRows(const EncodeLevel& level, int startRow, int endRow)
+{
+    int blocksWide = (level.width_ + 3) / 4;
+    unsigned char block[64];
+
+    for (int by = startRow; by < endRow; ++by)
+    {
+        for (int bx = 0; bx < blocksWide; ++bx)
+        {
+            // Gather the block, replicating the edge pixels of levels smaller than the block
+            for (int y = 0; y < 4; ++y)
+            {
+                int sy = Min(by * 4 + y, level.height_ - 1);
+                for (int x = 0; x < 4; ++x)
+                {
+                    int sx = Min(bx * 4 + x, level.width_ - 1);
+                    memcpy(&block[(y * 4 + x) * 4], level.source_ + (sy * level.width_ + sx) * 4, 4);
+                }
+            }
+
+            unsigned char* dest = level.dest_ + (by * blocksWide + bx) * level.blockSize_;
+            if (level.alpha_)
+            {
+                EncodeAlphaBlock(block, dest);
+                dest += 8;
+            }
+            EncodeColorBlock(block, dest);
+        }
+    }
+}
+
+void EncodeBlockRowsWork(const WorkItem* item, unsigned threadIndex)
+{
+    const EncodeLevel& level = *(reinterpret_cast<EncodeLevel*>(item->aux_));
+    unsigned rowSize = (unsigned)((level.width_ + 3) / 4) * level.blockSize_;
+    int startRow = (int)((reinterpret_cast<unsigned char*>(item->start_) - level.dest_) / rowSize);
+    int endRow = (int)((reinterpret_cast<unsigned char*>(item->end_) - level.dest_) / rowSize);
+
+    EncodeBlockRows(level, startRow, endRow);
+}
+
+/// Return the size of a block compressed level in bytes.
+unsigned GetLevelDataSize(int width, int height, unsigned blockSize)
+{
+    return (unsigned)((width + 3) / 4) * (unsigned)((height + 3) / 4) * blockSize;
+}
+
+/// Load an image file, also generating the mip levels if uncompressed like texture loading does. Return the time taken in microseconds.
+long long LoadImageTimed(Context* context, const String& fileName, SharedPtr<Image>& image)
+{
+    HiresTimer timer;
+    File file(context, fileName);
+    image = new Image(context);
+    if (!image->Load(file))
+        ErrorExit("Failed to load image " + fileName);
+    if (!image->IsCompressed())
+        image->PrecalculateLevels();
+    return timer.GetUSec(false);
+}
+
+void Run(const Vector<String>& arguments)
+{
+    if (arguments.Size() < 2)
+        Help();
+
+    SharedPtr<Context> context(new Context());
+    context->RegisterSubsystem(new FileSystem(context));
+    context->RegisterSubsystem(new Log(context));
+    context->RegisterSubsystem(new WorkQueue(context));
+
+    Vector<String> files;
+    String format;
+    bool mips = true;
+    bool sRGB = false;
+    bool verify = false;
+    unsigned numThreads = GetNumPhysicalCPUs();
+
+    for (unsigned i = 0; i < arguments.Size(); ++i)
+    {
+        String arg = arguments[i];
+        if (arg.Length() > 1 && arg[0] == '-')
+        {
+            String option = arg.Substring(1).ToLower();
+            if (option == "h")
+                Help();
+            else if (option == "f" && i + 1 < arguments.Size())
+                format = arguments[++i].ToLower();
+            else if (option == "nomips")
+                mips = false;
+            else if (option == "srgb")
+                sRGB = true;
+            else if (option == "t" && i + 1 < arguments.Size())
+                numThreads = ToUInt(arguments[++i]);
+            else if (option == "v")
+                verify = true;
+            else
+                ErrorExit("Unrecognized option " + arg);
+        }
+        else
+            files.Push(arg);
+    }
+
+    if (files.Size() != 2)
+        Help();
+    if (!format.Empty() && format != "dxt1" && format != "dxt5")
+        ErrorExit("Unsupported compression format " + format);
+
+    const String& inputFile = files[0];
+    const String& outputFile = files[1];
+
+    // The main thread also encodes, so create one less worker thread
+    WorkQueue* queue = context->GetSubsystem<WorkQueue>();
+    if (numThreads > 1)
+        queue->CreateThreads(numThreads - 1);
+
+    SharedPtr<Image> sourceImage(new Image(context));
+    File source(context, inputFile);
+    if (!sourceImage->Load(source))
+        ErrorExit("Failed to load image " + inputFile);
+    if (sourceImage->IsCompressed())
+        ErrorExit("Input image is already compressed");
+    if (sourceImage->GetDepth() > 1)
+        ErrorExit("3D images are not supported");
+
+    SharedPtr<Image> image = sourceImage->ConvertToRGBA();
+    if (!image)
+        ErrorExit("Failed to convert image to RGBA");
+    image->SetSRGB(sRGB);
+
+    // Choose the format by alpha if not specified
+    if (format.Empty())
+    {
+        format = "dxt1";
+        if (sourceImage->GetComponents() == 2 || sourceImage->GetComponents() == 4)
+        {
+            const unsigned char* pixels = image->GetData();
+            unsigned numPixels = (unsigned)(image->GetWidth() * image->GetHeight());
+            for (unsigned i = 0; i < numPixels; ++i)
+            {
+                if (pixels[i * 4 + 3] < 255)
+                {
+                    format = "dxt5";
+                    break;
+                }
+            }
+        }
+    }
+    bool alpha = format == "dxt5";
+    unsigned blockSize = alpha ? 16 : 8;
+
+    // Build the mip chain. The levels are box filtered in worker threads by Image itself
+    HiresTimer timer;
+    Vector<SharedPtr<Image> > levels;
+    levels.Push(image);
+    while (mips && (levels.Back()->GetWidth() > 1 || levels.Back()->GetHeight() > 1))
+    {
+        SharedPtr<Image> next = levels.Back()->GetNextLevel();
+        if (!next)
+            ErrorExit("Failed to generate mip level");
+        levels.Push(next);
+    }
+    long long mipTime = timer.GetUSec(true);
+
+    // Encode all levels, splitting each into ranges of block rows
+    unsigned totalDataSize = 0;
+    for (unsigned i = 0; i < levels.Size(); ++i)
+        totalDataSize += GetLevelDataSize(levels[i]->GetWidth(), levels[i]->GetHeight(), blockSize);
+    SharedArrayPtr<unsigned char> data(new unsigned char[totalDataSize]);
+
+    Vector<EncodeLevel> encodeLevels(levels.Size());
+    unsigned offset = 0;
+    for (unsigned i = 0; i < levels.Size(); ++i)
+    {
+        EncodeLevel& level = encodeLevels[i];
+        level.source_ = levels[i]->GetData();
+        level.dest_ = data.Get() + offset;
+        level.width_ = levels[i]->GetWidth();
+        level.height_ = levels[i]->GetHeight();
+        level.blockSize_ = blockSize;
+        level.alpha_ = alpha;
+        offset += GetLevelDataSize(level.width_, level.height_, blockSize);
+
+        int blockRows = (level.height_ + 3) / 4;
+        unsigned rowSize = (unsigned)((level.width_ + 3) / 4) * blockSize;
+        int numWorkItems = (int)queue->GetNumThreads() + 1;
+        int rowsPerItem = (blockRows + numWorkItems - 1) / numWorkItems;
+
+        for (int startRow = 0; startRow < blockRows; startRow += rowsPerItem)
+        {
+            int endRow = Min(startRow + rowsPerItem, blockRows);
+
+            SharedPtr<WorkItem> item = queue->GetFreeItem();
+            item->priority_ = M_MAX_UNSIGNED;
+            item->workFunction_ = EncodeBlockRowsWork;
+            item->aux_ = &level;
+            item->start_ = level.dest_ + startRow * rowSize;
+            item->end_ = level.dest_ + endRow * rowSize;
+            queue->AddWorkItem(item);
+        }
+    }
+    queue->Complete(M_MAX_UNSIGNED);
+    long long encodeTime = timer.GetUSec(true);
+
+    // Write the DDS. sRGB requires the DX10 header to specify the format
+    File dest(context, outputFile, FILE_WRITE);
+    if (!dest.IsOpen())
+        ErrorExit("Failed to open output file " + outputFile);
+
+    dest.WriteFileID("DDS ");
+    dest.WriteUInt(124);
+    dest.WriteUInt(DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_LINEARSIZE | DDSD_MIPMAPCOUNT);
+    dest.WriteUInt((unsigned)image->GetHeight());
+    dest.WriteUInt((unsigned)image->GetWidth());
+    dest.WriteUInt(GetLevelDataSize(image->GetWidth(), image->GetHeight(), blockSize));
+    dest.WriteUInt(0);
+    dest.WriteUInt(levels.Size());
+    for (unsigned i = 0; i < 11; ++i)
+        dest.WriteUInt(0);
+    dest.WriteUInt(32);
+    dest.WriteUInt(DDPF_FOURCC);
+    dest.WriteUInt(sRGB ? FOURCC_DX10 : (alpha ? FOURCC_DXT5 : FOURCC_DXT1));
+    for (unsigned i = 0; i < 5; ++i)
+        dest.WriteUInt(0);
+    dest.WriteUInt(DDSCAPS_TEXTURE | (levels.Size() > 1 ? DDSCAPS_COMPLEX | DDSCAPS_MIPMAP : 0));
+    for (unsigned i = 0; i < 4; ++i)
+        dest.WriteUInt(0);
+    if (sRGB)
+    {
+        dest.WriteUInt(alpha ? DDS_DXGI_FORMAT_BC3_UNORM_SRGB : DDS_DXGI_FORMAT_BC1_UNORM_SRGB);
+        dest.WriteUInt(DDS_DIMENSION_TEXTURE2D);
+        dest.WriteUInt(0);
+        dest.WriteUInt(1);
+        dest.WriteUInt(0);
+    }
+    dest.Write(data.Get(), totalDataSize);
+    dest.Close();
+
+    PrintLine("Wrote " + outputFile + ": " + format.ToUpper() + ", " + String(image->GetWidth()) + "x" +
+        String(image->GetHeight()) + ", " + String(levels.Size()) + " levels");
+    PrintLine("Mip generation " + String(mipTime / 1000) + " ms, encoding " + String(encodeTime / 1000) + " ms with " +
+        String(queue->GetNumThreads() + 1) + " threads");
+
+    if (!verify)
+        return;
+
+    // Decode the written file through Image and compare each level against the uncompressed source level
+    SharedPtr<Image> reloadedSource;
+    SharedPtr<Image> compressedImage;
+    long long sourceLoadTime = LoadImageTimed(context, inputFile, reloadedSource);
+    long long compressedLoadTime = LoadImageTimed(context, outputFile, compressedImage);
+    if (compressedImage->GetCompressedFormat() != (alpha ? CF_DXT5 : CF_DXT1) ||
+        compressedImage->GetNumCompressedLevels() != levels.Size())
+        ErrorExit("Written file did not load back with the expected format and levels");
+
+    unsigned uncompressedSize = 0;
+    for (unsigned i = 0; i < levels.Size(); ++i)
+    {
+        Image* level = levels[i];
+        CompressedLevel compressedLevel = compressedImage->GetCompressedLevel(i);
+        unsigned numPixels = (unsigned)(level->GetWidth() * level->GetHeight());
+        SharedArrayPtr<unsigned char> decoded(new unsigned char[numPixels * 4]);
+        if (!compressedLevel.Decompress(decoded.Get()))
+            ErrorExit("Failed to decompress level " + String(i));
+
+        const unsigned char* original = level->GetData();
+        unsigned channels = alpha ? 4 : 3;
+        double squaredError = 0.0;
+        for (unsigned j = 0; j < numPixels; ++j)
+        {
+            for (unsigned c = 0; c < channels; ++c)
+            {
+                double difference = (double)original[j * 4 + c] - (double)decoded[j * 4 + c];
+                squaredError += difference * difference;
+            }
+        }
+
+        double meanSquaredError = squaredError / (double)(numPixels * channels);
+        String psnr = meanSquaredError > 0.0 ? String(10.0 * log10(255.0 * 255.0 / meanSquaredError)) + " dB" : "lossless";
+        PrintLine("Level " + String(i) + " " + String(level->GetWidth()) + "x" + String(level->GetHeight()) + ": RMSE " +
+            String(sqrt(meanSquaredError)) + ", PSNR " + psnr);
+        uncompressedSize += numPixels * 4;
+    }
+
+    PrintLine("Load time: source " + String(sourceLoadTime / 1000) + " ms including mip generation, compressed " +
+        String(compressedLoadTime / 1000) + " ms");
+    PrintLine("Texture memory: uncompressed RGBA " + String(uncompressedSize / 1024) + " KB, compressed " +
+        String(totalDataSize / 1024) + " KB");
+}
@@ -34,6 +34,10 @@
 
 #include <SDL/SDL.h>
 
+#ifdef URHO3D_SSE
+#include <xmmintrin.h>
+#endif
+
 #include "../DebugNew.h"
 
 namespace Urho3D
@@ -127,7 +131,9 @@ bool Audio::SetMode(int bufferLengthMSec, int mixRate, bool stereo, bool interpo
     fragmentSize_ = (unsigned)Min((int)NextPowerOfTwo((unsigned)(mixRate >> 6)), (int)obtained.samples);
     mixRate_ = obtained.freq;
     interpolation_ = interpolation;
-    clipBuffer_ = new int[stereo ? fragmentSize_ << 1 : fragmentSize_];
+    clipBuffer_ = new float[stereo ? fragmentSize_ << 1 : fragmentSize_];
+    // Sound sources may be stereo even if the output is mono
+    workBuffer_ = new float[fragmentSize_ << 1];
 
     LOGINFO("Set audio mode " + String(mixRate_) + " Hz " + (stereo_ ? "stereo" : "mono") + " " +
             (interpolation_ ? "interpolated" : ""));
@@ -260,22 +266,37 @@ void Audio::MixOutput(void* dest, unsigned samples)
             clipSamples <<= 1;
 
         // Clear clip buffer
-        int* clipPtr = clipBuffer_.Get();
-        memset(clipPtr, 0, clipSamples * sizeof(int));
+        float* clipPtr = clipBuffer_.Get();
+        memset(clipPtr, 0, clipSamples * sizeof(float));
 
         // Mix samples to clip buffer
         for (PODVector<SoundSource*>::Iterator i = soundSources_.Begin(); i != soundSources_.End(); ++i)
-            (*i)->Mix(clipPtr, workSamples, mixRate_, stereo_, interpolation_);
+            (*i)->Mix(clipPtr, workBuffer_.Get(), workSamples, mixRate_, stereo_, interpolation_);
 
         // Copy output from clip buffer to destination
 #ifdef EMSCRIPTEN
         float* destPtr = (float*)dest;
         while (clipSamples--)
-            *destPtr++ = (float)Clamp(*clipPtr++, -32768, 32767) / 32768.0f;
+            *destPtr++ = Clamp(*clipPtr++, -32768.0f, 32767.0f) / 32768.0f;
 #else
         short* destPtr = (short*)dest;
+#ifdef URHO3D_SSE
+        const __m128 minValue = _mm_set1_ps(-32768.0f);
+        const __m128 maxValue = _mm_set1_ps(32767.0f);
+        while (clipSamples >= 4)
+        {
+            _mm_storeu_ps(clipPtr, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(clipPtr), minValue), maxValue));
+            destPtr[0] = (short)clipPtr[0];
+            destPtr[1] = (short)clipPtr[1];
+            destPtr[2] = (short)clipPtr[2];
+            destPtr[3] = (short)clipPtr[3];
+            clipPtr += 4;
+            destPtr += 4;
+            clipSamples -= 4;
+        }
+#endif
         while (clipSamples--)
-            *destPtr++ = (short)Clamp(*clipPtr++, -32768, 32767);
+            *destPtr++ = (short)Clamp(*clipPtr++, -32768.0f, 32767.0f);
 #endif
         samples -= workSamples;
         ((unsigned char*&)dest) += sampleSize_ * SAMPLE_SIZE_MUL * workSamples;
@@ -298,6 +319,7 @@ void Audio::Release()
         SDL_CloseAudioDevice(deviceID_);
         deviceID_ = 0;
         clipBuffer_.Reset();
+        workBuffer_.Reset();
     }
 }
 
@@ -115,8 +115,10 @@ private:
     void HandleRenderUpdate(StringHash eventType, VariantMap& eventData);
     /// Stop sound output and release the sound buffer.
     void Release();
-    /// Clipping buffer for mixing.
-    SharedArrayPtr<int> clipBuffer_;
+    /// Floating point clipping buffer for mixing.
+    SharedArrayPtr<float> clipBuffer_;
+    /// Work buffer for resampling sound source data before mixing.
+    SharedArrayPtr<float> workBuffer_;
     /// Audio thread mutex.
     Mutex audioMutex_;
     /// SDL audio device ID.
@@ -29,73 +29,222 @@
 #include "../Core/Context.h"
 #include "../Resource/ResourceCache.h"
 
+#ifdef URHO3D_SSE
+#include <xmmintrin.h>
+#endif
+
 #include "../DebugNew.h"
 
 namespace Urho3D
 {
 
-#define INC_POS_LOOPED() \
-    pos += intAdd; \
-    fractPos += fractAdd; \
-    if (fractPos > 65535) \
-    { \
-        fractPos &= 65535; \
-        ++pos; \
-    } \
-    while (pos >= end) \
-        pos -= (end - repeat); \
-
-#define INC_POS_ONESHOT() \
-    pos += intAdd; \
-    fractPos += fractAdd; \
-    if (fractPos > 65535) \
-    { \
-        fractPos &= 65535; \
-        ++pos; \
-    } \
-    if (pos >= end) \
-    { \
-        pos = 0; \
-        break; \
-    } \
-
-#define INC_POS_STEREO_LOOPED() \
-    pos += (intAdd << 1); \
-    fractPos += fractAdd; \
-    if (fractPos > 65535) \
-    { \
-        fractPos &= 65535; \
-        pos += 2; \
-    } \
-    while (pos >= end) \
-        pos -= (end - repeat); \
-
-#define INC_POS_STEREO_ONESHOT() \
-    pos += (intAdd << 1); \
-    fractPos += fractAdd; \
-    if (fractPos > 65535) \
-    { \
-        fractPos &= 65535; \
-        pos += 2; \
-    } \
-    if (pos >= end) \
-    { \
-        pos = 0; \
-        break; \
-    } \
-
-#define GET_IP_SAMPLE() (((((int)pos[1] - (int)pos[0]) * fractPos) / 65536) + (int)pos[0])
-
-#define GET_IP_SAMPLE_LEFT() (((((int)pos[2] - (int)pos[0]) * fractPos) / 65536) + (int)pos[0])
-
-#define GET_IP_SAMPLE_RIGHT() (((((int)pos[3] - (int)pos[1]) * fractPos) / 65536) + (int)pos[1])
-
 static const float AUTOREMOVE_DELAY = 0.25f;
 
 static const int STREAM_SAFETY_SAMPLES = 4;
 
+// Gains below this are inaudible in 16-bit output, so the source is advanced without mixing
+static const float MIN_AUDIBLE_GAIN = 1.0f / 512.0f;
+
 extern const char* AUDIO_CATEGORY;
 
+/// Read samples from sound data into a float buffer, stepping the playback position in 16.16 fixed point. Return number of sample frames produced.
+template <class T, bool Looped, bool Interpolated, unsigned Channels> static unsigned ResampleLoop(T*& pos, T* end, T* repeat,
+    int& fractPos, int intAdd, int fractAdd, float* dest, unsigned samples)
+{
+    const float fractScale = 1.0f / 65536.0f;
+    unsigned produced = 0;
+
+    while (produced < samples)
+    {
+        if (Interpolated)
+        {
+            float t = (float)fractPos * fractScale;
+            for (unsigned c = 0; c < Channels; ++c)
+            {
+                float s0 = (float)pos[c];
+                float s1 = (float)pos[c + Channels];
+                *dest++ = s0 + (s1 - s0) * t;
+            }
+        }
+        else
+        {
+            for (unsigned c = 0; c < Channels; ++c)
+                *dest++ = (float)pos[c];
+        }
+        ++produced;
+
+        pos += intAdd * Channels;
+        fractPos += fractAdd;
+        if (fractPos > 65535)
+        {
+            fractPos &= 65535;
+            pos += Channels;
+        }
+        if (pos >= end)
+        {
+            if (Looped)
+            {
+                while (pos >= end)
+                    pos -= (end - repeat);
+            }
+            else
+            {
+                pos = 0;
+                break;
+            }
+        }
+    }
+
+    return produced;
+}
+
+/// Select the resampling loop for the sound format and playback mode.
+template <class T> static unsigned ResampleSamples(T*& pos, T* end, T* repeat, int& fractPos, int intAdd, int fractAdd,
+    float* dest, unsigned samples, bool looped, bool stereo, bool interpolation)
+{
+    if (!stereo)
+    {
+        if (looped)
+        {
+            return interpolation ? ResampleLoop<T, true, true, 1>(pos, end, repeat, fractPos, intAdd, fractAdd, dest, samples) :
+                ResampleLoop<T, true, false, 1>(pos, end, repeat, fractPos, intAdd, fractAdd, dest, samples);
+        }
+        else
+        {
+            return interpolation ? ResampleLoop<T, false, true, 1>(pos, end, repeat, fractPos, intAdd, fractAdd, dest, samples) :
+                ResampleLoop<T, false, false, 1>(pos, end, repeat, fractPos, intAdd, fractAdd, dest, samples);
+        }
+    }
+    else
+    {
+        if (looped)
+        {
+            return interpolation ? ResampleLoop<T, true, true, 2>(pos, end, repeat, fractPos, intAdd, fractAdd, dest, samples) :
+                ResampleLoop<T, true, false, 2>(pos, end, repeat, fractPos, intAdd, fractAdd, dest, samples);
+        }
+        else
+        {
+            return interpolation ? ResampleLoop<T, false, true, 2>(pos, end, repeat, fractPos, intAdd, fractAdd, dest, samples) :
+                ResampleLoop<T, false, false, 2>(pos, end, repeat, fractPos, intAdd, fractAdd, dest, samples);
+        }
+    }
+}
+
+/// Accumulate mono samples to a mono buffer with a linear gain ramp.
+static void MixMonoToMono(float* dest, const float* src, unsigned samples, float gain, float gainDelta)
+{
+#ifdef URHO3D_SSE
+    __m128 gains = _mm_set_ps(gain + 3.0f * gainDelta, gain + 2.0f * gainDelta, gain + gainDelta, gain);
+    __m128 gainStep = _mm_set1_ps(4.0f * gainDelta);
+    while (samples >= 4)
+    {
+        __m128 s = _mm_loadu_ps(src);
+        _mm_storeu_ps(dest, _mm_add_ps(_mm_loadu_ps(dest), _mm_mul_ps(s, gains)));
+        gains = _mm_add_ps(gains, gainStep);
+        gain += 4.0f * gainDelta;
+        src += 4;
+        dest += 4;
+        samples -= 4;
+    }
+#endif
+    while (samples--)
+    {
+        *dest++ += *src++ * gain;
+        gain += gainDelta;
+    }
+}
+
+/// Accumulate mono samples to a stereo buffer with linear left and right gain ramps.
+static void MixMonoToStereo(float* dest, const float* src, unsigned samples, float leftGain, float rightGain, float leftDelta,
+    float rightDelta)
+{
+#ifdef URHO3D_SSE
+    __m128 gains0 = _mm_set_ps(rightGain + rightDelta, leftGain + leftDelta, rightGain, leftGain);
+    __m128 gains1 = _mm_set_ps(rightGain + 3.0f * rightDelta, leftGain + 3.0f * leftDelta, rightGain + 2.0f * rightDelta,
+        leftGain + 2.0f * leftDelta);
+    __m128 gainStep = _mm_set_ps(4.0f * rightDelta, 4.0f * leftDelta, 4.0f * rightDelta, 4.0f * leftDelta);
+    while (samples >= 4)
+    {
+        __m128 s = _mm_loadu_ps(src);
+        _mm_storeu_ps(dest, _mm_add_ps(_mm_loadu_ps(dest), _mm_mul_ps(_mm_unpacklo_ps(s, s), gains0)));
+        _mm_storeu_ps(dest + 4, _mm_add_ps(_mm_loadu_ps(dest + 4), _mm_mul_ps(_mm_unpackhi_ps(s, s), gains1)));
+        gains0 = _mm_add_ps(gains0, gainStep);
+        gains1 = _mm_add_ps(gains1, gainStep);
+        leftGain += 4.0f * leftDelta;
+        rightGain += 4.0f * rightDelta;
+        src += 4;
+        dest += 8;
+        samples -= 4;
+    }
+#endif
+    while (samples--)
+    {
+        float s = *src++;
+        *dest++ += s * leftGain;
+        *dest++ += s * rightGain;
+        leftGain += leftDelta;
+        rightGain += rightDelta;
+    }
+}
+
+/// Accumulate stereo samples to a mono buffer with a linear gain ramp.
+static void MixStereoToMono(float* dest, const float* src, unsigned samples, float gain, float gainDelta)
+{
+    // Average the channels
+    gain *= 0.5f;
+    gainDelta *= 0.5f;
+
+#ifdef URHO3D_SSE
+    __m128 gains = _mm_set_ps(gain + 3.0f * gainDelta, gain + 2.0f * gainDelta, gain + gainDelta, gain);
+    __m128 gainStep = _mm_set1_ps(4.0f * gainDelta);
+    while (samples >= 4)
+    {
+        __m128 s0 = _mm_loadu_ps(src);
+        __m128 s1 = _mm_loadu_ps(src + 4);
+        __m128 sum = _mm_add_ps(_mm_shuffle_ps(s0, s1, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(s0, s1, _MM_SHUFFLE(3, 1, 3, 1)));
+        _mm_storeu_ps(dest, _mm_add_ps(_mm_loadu_ps(dest), _mm_mul_ps(sum, gains)));
+        gains = _mm_add_ps(gains, gainStep);
+        gain += 4.0f * gainDelta;
+        src += 8;
+        dest += 4;
+        samples -= 4;
+    }
+#endif
+    while (samples--)
+    {
+        *dest++ += (src[0] + src[1]) * gain;
+        src += 2;
+        gain += gainDelta;
+    }
+}
+
+/// Accumulate stereo samples to a stereo buffer with a linear gain ramp.
+static void MixStereoToStereo(float* dest, const float* src, unsigned samples, float gain, float gainDelta)
+{
+#ifdef URHO3D_SSE
+    __m128 gains0 = _mm_set_ps(gain + gainDelta, gain + gainDelta, gain, gain);
+    __m128 gains1 = _mm_set_ps(gain + 3.0f * gainDelta, gain + 3.0f * gainDelta, gain + 2.0f * gainDelta, gain + 2.0f * gainDelta);
+    __m128 gainStep = _mm_set1_ps(4.0f * gainDelta);
+    while (samples >= 4)
+    {
+        _mm_storeu_ps(dest, _mm_add_ps(_mm_loadu_ps(dest), _mm_mul_ps(_mm_loadu_ps(src), gains0)));
+        _mm_storeu_ps(dest + 4, _mm_add_ps(_mm_loadu_ps(dest + 4), _mm_mul_ps(_mm_loadu_ps(src + 4), gains1)));
+        gains0 = _mm_add_ps(gains0, gainStep);
+        gains1 = _mm_add_ps(gains1, gainStep);
+        gain += 4.0f * gainDelta;
+        src += 8;
+        dest += 8;
+        samples -= 4;
+    }
+#endif
+    while (samples--)
+    {
+        *dest++ += *src++ * gain;
+        *dest++ += *src++ * gain;
+        gain += gainDelta;
+    }
+}
+
 
 SoundSource::SoundSource(Context* context) :
     Component(context),
@@ -109,7 +258,10 @@ SoundSource::SoundSource(Context* context) :
     position_(0),
     fractPosition_(0),
     timePosition_(0.0f),
-    unusedStreamSize_(0)
+    unusedStreamSize_(0),
+    lastLeftGain_(0.0f),
+    lastRightGain_(0.0f),
+    mixGainsValid_(false)
 {
     audio_ = GetSubsystem<Audio>();
 
@@ -315,7 +467,7 @@ void SoundSource::Update(float timeStep)
     }
 }
 
-void SoundSource::Mix(int* dest, unsigned samples, int mixRate, bool stereo, bool interpolation)
+void SoundSource::Mix(float* dest, float* work, unsigned samples, int mixRate, bool stereo, bool interpolation)
 {
     if (!position_ || (!sound_ && !soundStream_) || !IsEnabledEffective())
         return;
@@ -353,42 +505,56 @@ void SoundSource::Mix(int* dest, unsigned samples, int mixRate, bool stereo, boo
     if (!sound)
         return;
 
-    // Choose the correct mixing routine
-    if (!sound->IsStereo())
+    // Calculate the target channel gains. Ramp from the previous gains over the mixed samples to avoid zipper noise
+    float totalGain = masterGain_ * attenuation_ * gain_;
+    float leftGain = totalGain;
+    float rightGain = totalGain;
+    if (stereo && !sound->IsStereo())
     {
-        if (interpolation)
-        {
-            if (stereo)
-                MixMonoToStereoIP(sound, dest, samples, mixRate);
-            else
-                MixMonoToMonoIP(sound, dest, samples, mixRate);
-        }
-        else
-        {
-            if (stereo)
-                MixMonoToStereo(sound, dest, samples, mixRate);
-            else
-                MixMonoToMono(sound, dest, samples, mixRate);
-        }
+        leftGain = (-panning_ + 1.0f) * totalGain;
+        rightGain = (panning_ + 1.0f) * totalGain;
     }
+    if (!mixGainsValid_)
+    {
+        lastLeftGain_ = leftGain;
+        lastRightGain_ = rightGain;
+        mixGainsValid_ = true;
+    }
+
+    if (leftGain < MIN_AUDIBLE_GAIN && rightGain < MIN_AUDIBLE_GAIN && lastLeftGain_ < MIN_AUDIBLE_GAIN &&
+        lastRightGain_ < MIN_AUDIBLE_GAIN)
+        MixZeroVolume(sound, samples, mixRate);
     else
     {
-        if (interpolation)
+        unsigned mixSamples = Resample(sound, work, samples, mixRate, interpolation);
+
+        // Scale 8-bit data to the 16-bit range of the mixing buffer
+        float scale = sound->IsSixteenBit() ? 1.0f : 256.0f;
+        float rampScale = scale / (float)samples;
+        float leftStart = lastLeftGain_ * scale;
+        float rightStart = lastRightGain_ * scale;
+        float leftDelta = (leftGain - lastLeftGain_) * rampScale;
+        float rightDelta = (rightGain - lastRightGain_) * rampScale;
+
+        if (!sound->IsStereo())
         {
             if (stereo)
-                MixStereoToStereoIP(sound, dest, samples, mixRate);
+                MixMonoToStereo(dest, work, mixSamples, leftStart, rightStart, leftDelta, rightDelta);
             else
-                MixStereoToMonoIP(sound, dest, samples, mixRate);
+                MixMonoToMono(dest, work, mixSamples, leftStart, leftDelta);
         }
         else
         {
             if (stereo)
-                MixStereoToStereo(sound, dest, samples, mixRate);
+                MixStereoToStereo(dest, work, mixSamples, leftStart, leftDelta);
             else
-                MixStereoToMono(sound, dest, samples, mixRate);
+                MixStereoToMono(dest, work, mixSamples, leftStart, leftDelta);
         }
     }
 
+    lastLeftGain_ = leftGain;
+    lastRightGain_ = rightGain;
+
     // Update the time position. In stream mode, copy unused data back to the beginning of the stream buffer
     if (soundStream_)
     {
@@ -479,6 +645,7 @@ void SoundSource::PlayLockless(Sound* sound)
                 sound_ = sound;
                 position_ = start;
                 fractPosition_ = 0;
+                mixGainsValid_ = false;
                 return;
             }
         }
@@ -516,6 +683,7 @@ void SoundSource::PlayLockless(SharedPtr<SoundStream> stream)
         unusedStreamSize_ = 0;
         position_ = streamBuffer_->GetStart();
         fractPosition_ = 0;
+        mixGainsValid_ = false;
         return;
     }
 
@@ -552,248 +720,13 @@ void SoundSource::SetPlayPositionLockless(signed char* pos)
     timePosition_ = ((float)(int)(size_t)(pos - sound_->GetStart())) / (sound_->GetSampleSize() * sound_->GetFrequency());
 }
 
-void SoundSource::MixMonoToMono(Sound* sound, int* dest, unsigned samples, int mixRate)
-{
-    float totalGain = masterGain_ * attenuation_ * gain_;
-    int vol = (int)(256.0f * totalGain + 0.5f);
-    if (!vol)
-    {
-        MixZeroVolume(sound, samples, mixRate);
-        return;
-    }
-
-    float add = frequency_ / (float)mixRate;
-    int intAdd = (int)add;
-    int fractAdd = (int)((add - floorf(add)) * 65536.0f);
-    int fractPos = fractPosition_;
-
-    if (sound->IsSixteenBit())
-    {
-        short* pos = (short*)position_;
-        short* end = (short*)sound->GetEnd();
-        short* repeat = (short*)sound->GetRepeat();
-
-        if (sound->IsLooped())
-        {
-            while (samples--)
-            {
-                *dest = *dest + (*pos * vol) / 256;
-                ++dest;
-                INC_POS_LOOPED();
-            }
-            position_ = (signed char*)pos;
-        }
-        else
-        {
-            while (samples--)
-            {
-                *dest = *dest + (*pos * vol) / 256;
-                ++dest;
-                INC_POS_ONESHOT();
-            }
-            position_ = (signed char*)pos;
-        }
-    }
-    else
-    {
-        signed char* pos = (signed char*)position_;
-        signed char* end = sound->GetEnd();
-        signed char* repeat = sound->GetRepeat();
-
-        if (sound->IsLooped())
-        {
-            while (samples--)
-            {
-                *dest = *dest + *pos * vol;
-                ++dest;
-                INC_POS_LOOPED();
-            }
-            position_ = pos;
-        }
-        else
-        {
-            while (samples--)
-            {
-                *dest = *dest + *pos * vol;
-                ++dest;
-                INC_POS_ONESHOT();
-            }
-            position_ = pos;
-        }
-    }
-    fractPosition_ = fractPos;
-}
-
-void SoundSource::MixMonoToStereo(Sound* sound, int* dest, unsigned samples, int mixRate)
-{
-    float totalGain = masterGain_ * attenuation_ * gain_;
-    int leftVol = (int)((-panning_ + 1.0f) * (256.0f * totalGain + 0.5f));
-    int rightVol = (int)((panning_ + 1.0f) * (256.0f * totalGain + 0.5f));
-    if (!leftVol && !rightVol)
-    {
-        MixZeroVolume(sound, samples, mixRate);
-        return;
-    }
-
-    float add = frequency_ / (float)mixRate;
-    int intAdd = (int)add;
-    int fractAdd = (int)((add - floorf(add)) * 65536.0f);
-    int fractPos = fractPosition_;
-
-    if (sound->IsSixteenBit())
-    {
-        short* pos = (short*)position_;
-        short* end = (short*)sound->GetEnd();
-        short* repeat = (short*)sound->GetRepeat();
-
-        if (sound->IsLooped())
-        {
-            while (samples--)
-            {
-                *dest = *dest + (*pos * leftVol) / 256;
-                ++dest;
-                *dest = *dest + (*pos * rightVol) / 256;
-                ++dest;
-                INC_POS_LOOPED();
-            }
-            position_ = (signed char*)pos;
-        }
-        else
-        {
-            while (samples--)
-            {
-                *dest = *dest + (*pos * leftVol) / 256;
-                ++dest;
-                *dest = *dest + (*pos * rightVol) / 256;
-                ++dest;
-                INC_POS_ONESHOT();
-            }
-            position_ = (signed char*)pos;
-        }
-    }
-    else
-    {
-        signed char* pos = (signed char*)position_;
-        signed char* end = sound->GetEnd();
-        signed char* repeat = sound->GetRepeat();
-
-        if (sound->IsLooped())
-        {
-            while (samples--)
-            {
-                *dest = *dest + *pos * leftVol;
-                ++dest;
-                *dest = *dest + *pos * rightVol;
-                ++dest;
-                INC_POS_LOOPED();
-            }
-            position_ = pos;
-        }
-        else
-        {
-            while (samples--)
-            {
-                *dest = *dest + *pos * leftVol;
-                ++dest;
-                *dest = *dest + *pos * rightVol;
-                ++dest;
-                INC_POS_ONESHOT();
-            }
-            position_ = pos;
-        }
-    }
-
-    fractPosition_ = fractPos;
-}
-
-void SoundSource::MixMonoToMonoIP(Sound* sound, int* dest, unsigned samples, int mixRate)
-{
-    float totalGain = masterGain_ * attenuation_ * gain_;
-    int vol = (int)(256.0f * totalGain + 0.5f);
-    if (!vol)
-    {
-        MixZeroVolume(sound, samples, mixRate);
-        return;
-    }
-
-    float add = frequency_ / (float)mixRate;
-    int intAdd = (int)add;
-    int fractAdd = (int)((add - floorf(add)) * 65536.0f);
-    int fractPos = fractPosition_;
-
-    if (sound->IsSixteenBit())
-    {
-        short* pos = (short*)position_;
-        short* end = (short*)sound->GetEnd();
-        short* repeat = (short*)sound->GetRepeat();
-
-        if (sound->IsLooped())
-        {
-            while (samples--)
-            {
-                *dest = *dest + (GET_IP_SAMPLE() * vol) / 256;
-                ++dest;
-                INC_POS_LOOPED();
-            }
-            position_ = (signed char*)pos;
-        }
-        else
-        {
-            while (samples--)
-            {
-                *dest = *dest + (GET_IP_SAMPLE() * vol) / 256;
-                ++dest;
-                INC_POS_ONESHOT();
-            }
-            position_ = (signed char*)pos;
-        }
-    }
-    else
-    {
-        signed char* pos = (signed char*)position_;
-        signed char* end = sound->GetEnd();
-        signed char* repeat = sound->GetRepeat();
-
-        if (sound->IsLooped())
-        {
-            while (samples--)
-            {
-                *dest = *dest + GET_IP_SAMPLE() * vol;
-                ++dest;
-                INC_POS_LOOPED();
-            }
-            position_ = pos;
-        }
-        else
-        {
-            while (samples--)
-            {
-                *dest = *dest + GET_IP_SAMPLE() * vol;
-                ++dest;
-                INC_POS_ONESHOT();
-            }
-            position_ = pos;
-        }
-    }
-
-    fractPosition_ = fractPos;
-}
-
-void SoundSource::MixMonoToStereoIP(Sound* sound, int* dest, unsigned samples, int mixRate)
+unsigned SoundSource::Resample(Sound* sound, float* dest, unsigned samples, int mixRate, bool interpolation)
 {
-    float totalGain = masterGain_ * attenuation_ * gain_;
-    int leftVol = (int)((-panning_ + 1.0f) * (256.0f * totalGain + 0.5f));
-    int rightVol = (int)((panning_ + 1.0f) * (256.0f * totalGain + 0.5f));
-    if (!leftVol && !rightVol)
-    {
-        MixZeroVolume(sound, samples, mixRate);
-        return;
-    }
-
     float add = frequency_ / (float)mixRate;
     int intAdd = (int)add;
     int fractAdd = (int)((add - floorf(add)) * 65536.0f);
     int fractPos = fractPosition_;
+    unsigned produced;
 
     if (sound->IsSixteenBit())
     {
@@ -801,32 +734,9 @@ void SoundSource::MixMonoToStereoIP(Sound* sound, int* dest, unsigned samples, i
         short* end = (short*)sound->GetEnd();
         short* repeat = (short*)sound->GetRepeat();
 
-        if (sound->IsLooped())
-        {
-            while (samples--)
-            {
-                int s = GET_IP_SAMPLE();
-                *dest = *dest + (s * leftVol) / 256;
-                ++dest;
-                *dest = *dest + (s * rightVol) / 256;
-                ++dest;
-                INC_POS_LOOPED();
-            }
-            position_ = (signed char*)pos;
-        }
-        else
-        {
-            while (samples--)
-            {
-                int s = GET_IP_SAMPLE();
-                *dest = *dest + (s * leftVol) / 256;
-                ++dest;
-                *dest = *dest + (s * rightVol) / 256;
-                ++dest;
-                INC_POS_ONESHOT();
-            }
-            position_ = (signed char*)pos;
-        }
+        produced = ResampleSamples(pos, end, repeat, fractPos, intAdd, fractAdd, dest, samples, sound->IsLooped(),
+            sound->IsStereo(), interpolation);
+        position_ = (signed char*)pos;
     }
     else
     {
@@ -834,351 +744,13 @@ void SoundSource::MixMonoToStereoIP(Sound* sound, int* dest, unsigned samples, i
         signed char* end = sound->GetEnd();
         signed char* repeat = sound->GetRepeat();
 
-        if (sound->IsLooped())
-        {
-            while (samples--)
-            {
-                int s = GET_IP_SAMPLE();
-                *dest = *dest + s * leftVol;
-                ++dest;
-                *dest = *dest + s * rightVol;
-                ++dest;
-                INC_POS_LOOPED();
-            }
-            position_ = pos;
-        }
-        else
-        {
-            while (samples--)
-            {
-                int s = GET_IP_SAMPLE();
-                *dest = *dest + s * leftVol;
-                ++dest;
-                *dest = *dest + s * rightVol;
-                ++dest;
-                INC_POS_ONESHOT();
-            }
-            position_ = pos;
-        }
-    }
-
-    fractPosition_ = fractPos;
-}
-
-void SoundSource::MixStereoToMono(Sound* sound, int* dest, unsigned samples, int mixRate)
-{
-    float totalGain = masterGain_ * attenuation_ * gain_;
-    int vol = (int)(256.0f * totalGain + 0.5f);
-    if (!vol)
-    {
-        MixZeroVolume(sound, samples, mixRate);
-        return;
-    }
-
-    float add = frequency_ / (float)mixRate;
-    int intAdd = (int)add;
-    int fractAdd = (int)((add - floorf(add)) * 65536.0f);
-    int fractPos = fractPosition_;
-
-    if (sound->IsSixteenBit())
-    {
-        short* pos = (short*)position_;
-        short* end = (short*)sound->GetEnd();
-        short* repeat = (short*)sound->GetRepeat();
-
-        if (sound->IsLooped())
-        {
-            while (samples--)
-            {
-                int s = ((int)pos[0] + (int)pos[1]) / 2;
-                *dest = *dest + (s * vol) / 256;
-                ++dest;
-                INC_POS_STEREO_LOOPED();
-            }
-            position_ = (signed char*)pos;
-        }
-        else
-        {
-            while (samples--)
-            {
-                int s = ((int)pos[0] + (int)pos[1]) / 2;
-                *dest = *dest + (s * vol) / 256;
-                ++dest;
-                INC_POS_STEREO_ONESHOT();
-            }
-            position_ = (signed char*)pos;
-        }
-    }
-    else
-    {
-        signed char* pos = (signed char*)position_;
-        signed char* end = sound->GetEnd();
-        signed char* repeat = sound->GetRepeat();
-
-        if (sound->IsLooped())
-        {
-            while (samples--)
-            {
-                int s = ((int)pos[0] + (int)pos[1]) / 2;
-                *dest = *dest + s * vol;
-                ++dest;
-                INC_POS_STEREO_LOOPED();
-            }
-            position_ = pos;
-        }
-        else
-        {
-            while (samples--)
-            {
-                int s = ((int)pos[0] + (int)pos[1]) / 2;
-                *dest = *dest + s * vol;
-                ++dest;
-                INC_POS_STEREO_ONESHOT();
-            }
-            position_ = pos;
-        }
-    }
-
-    fractPosition_ = fractPos;
-}
-
-void SoundSource::MixStereoToStereo(Sound* sound, int* dest, unsigned samples, int mixRate)
-{
-    float totalGain = masterGain_ * attenuation_ * gain_;
-    int vol = (int)(256.0f * totalGain + 0.5f);
-    if (!vol)
-    {
-        MixZeroVolume(sound, samples, mixRate);
-        return;
-    }
-
-    float add = frequency_ / (float)mixRate;
-    int intAdd = (int)add;
-    int fractAdd = (int)((add - floorf(add)) * 65536.0f);
-    int fractPos = fractPosition_;
-
-    if (sound->IsSixteenBit())
-    {
-        short* pos = (short*)position_;
-        short* end = (short*)sound->GetEnd();
-        short* repeat = (short*)sound->GetRepeat();
-
-        if (sound->IsLooped())
-        {
-            while (samples--)
-            {
-                *dest = *dest + (pos[0] * vol) / 256;
-                ++dest;
-                *dest = *dest + (pos[1] * vol) / 256;
-                ++dest;
-                INC_POS_STEREO_LOOPED();
-            }
-            position_ = (signed char*)pos;
-        }
-        else
-        {
-            while (samples--)
-            {
-                *dest = *dest + (pos[0] * vol) / 256;
-                ++dest;
-                *dest = *dest + (pos[1] * vol) / 256;
-                ++dest;
-                INC_POS_STEREO_ONESHOT();
-            }
-            position_ = (signed char*)pos;
-        }
-    }
-    else
-    {
-        signed char* pos = (signed char*)position_;
-        signed char* end = sound->GetEnd();
-        signed char* repeat = sound->GetRepeat();
-
-        if (sound->IsLooped())
-        {
-            while (samples--)
-            {
-                *dest = *dest + pos[0] * vol;
-                ++dest;
-                *dest = *dest + pos[1] * vol;
-                ++dest;
-                INC_POS_STEREO_LOOPED();
-            }
-            position_ = pos;
-        }
-        else
-        {
-            while (samples--)
-            {
-                *dest = *dest + pos[0] * vol;
-                ++dest;
-                *dest = *dest + pos[1] * vol;
-                ++dest;
-                INC_POS_STEREO_ONESHOT();
-            }
-            position_ = pos;
-        }
-    }
-
-    fractPosition_ = fractPos;
-}
-
-void SoundSource::MixStereoToMonoIP(Sound* sound, int* dest, unsigned samples, int mixRate)
-{
-    float totalGain = masterGain_ * attenuation_ * gain_;
-    int vol = (int)(256.0f * totalGain + 0.5f);
-    if (!vol)
-    {
-        MixZeroVolume(sound, samples, mixRate);
-        return;
-    }
-
-    float add = frequency_ / (float)mixRate;
-    int intAdd = (int)add;
-    int fractAdd = (int)((add - floorf(add)) * 65536.0f);
-    int fractPos = fractPosition_;
-
-    if (sound->IsSixteenBit())
-    {
-        short* pos = (short*)position_;
-        short* end = (short*)sound->GetEnd();
-        short* repeat = (short*)sound->GetRepeat();
-
-        if (sound->IsLooped())
-        {
-            while (samples--)
-            {
-                int s = (GET_IP_SAMPLE_LEFT() + GET_IP_SAMPLE_RIGHT()) / 2;
-                *dest = *dest + (s * vol) / 256;
-                ++dest;
-                INC_POS_STEREO_LOOPED();
-            }
-            position_ = (signed char*)pos;
-        }
-        else
-        {
-            while (samples--)
-            {
-                int s = (GET_IP_SAMPLE_LEFT() + GET_IP_SAMPLE_RIGHT()) / 2;
-                *dest = *dest + (s * vol) / 256;
-                ++dest;
-                INC_POS_STEREO_ONESHOT();
-            }
-            position_ = (signed char*)pos;
-        }
-    }
-    else
-    {
-        signed char* pos = (signed char*)position_;
-        signed char* end = sound->GetEnd();
-        signed char* repeat = sound->GetRepeat();
-
-        if (sound->IsLooped())
-        {
-            while (samples--)
-            {
-                int s = (GET_IP_SAMPLE_LEFT() + GET_IP_SAMPLE_RIGHT()) / 2;
-                *dest = *dest + s * vol;
-                ++dest;
-                INC_POS_STEREO_LOOPED();
-            }
-            position_ = pos;
-        }
-        else
-        {
-            while (samples--)
-            {
-                int s = (GET_IP_SAMPLE_LEFT() + GET_IP_SAMPLE_RIGHT()) / 2;
-                *dest = *dest + s * vol;
-                ++dest;
-                INC_POS_STEREO_ONESHOT();
-            }
-            position_ = pos;
-        }
-    }
-
-    fractPosition_ = fractPos;
-}
-
-void SoundSource::MixStereoToStereoIP(Sound* sound, int* dest, unsigned samples, int mixRate)
-{
-    float totalGain = masterGain_ * attenuation_ * gain_;
-    int vol = (int)(256.0f * totalGain + 0.5f);
-    if (!vol)
-    {
-        MixZeroVolume(sound, samples, mixRate);
-        return;
-    }
-
-    float add = frequency_ / (float)mixRate;
-    int intAdd = (int)add;
-    int fractAdd = (int)((add - floorf(add)) * 65536.0f);
-    int fractPos = fractPosition_;
-
-    if (sound->IsSixteenBit())
-    {
-        short* pos = (short*)position_;
-        short* end = (short*)sound->GetEnd();
-        short* repeat = (short*)sound->GetRepeat();
-
-        if (sound->IsLooped())
-        {
-            while (samples--)
-            {
-                *dest = *dest + (GET_IP_SAMPLE_LEFT() * vol) / 256;
-                ++dest;
-                *dest = *dest + (GET_IP_SAMPLE_RIGHT() * vol) / 256;
-                ++dest;
-                INC_POS_STEREO_LOOPED();
-            }
-            position_ = (signed char*)pos;
-        }
-        else
-        {
-            while (samples--)
-            {
-                *dest = *dest + (GET_IP_SAMPLE_LEFT() * vol) / 256;
-                ++dest;
-                *dest = *dest + (GET_IP_SAMPLE_RIGHT() * vol) / 256;
-                ++dest;
-                INC_POS_STEREO_ONESHOT();
-            }
-            position_ = (signed char*)pos;
-        }
-    }
-    else
-    {
-        signed char* pos = (signed char*)position_;
-        signed char* end = sound->GetEnd();
-        signed char* repeat = sound->GetRepeat();
-
-        if (sound->IsLooped())
-        {
-            while (samples--)
-            {
-                *dest = *dest + GET_IP_SAMPLE_LEFT() * vol;
-                ++dest;
-                *dest = *dest + GET_IP_SAMPLE_RIGHT() * vol;
-                ++dest;
-                INC_POS_STEREO_LOOPED();
-            }
-            position_ = pos;
-        }
-        else
-        {
-            while (samples--)
-            {
-                *dest = *dest + GET_IP_SAMPLE_LEFT() * vol;
-                ++dest;
-                *dest = *dest + GET_IP_SAMPLE_RIGHT() * vol;
-                ++dest;
-                INC_POS_STEREO_ONESHOT();
-            }
-            position_ = pos;
-        }
+        produced = ResampleSamples(pos, end, repeat, fractPos, intAdd, fractAdd, dest, samples, sound->IsLooped(),
+            sound->IsStereo(), interpolation);
+        position_ = pos;
     }
 
     fractPosition_ = fractPos;
+    return produced;
 }
 
 void SoundSource::MixZeroVolume(Sound* sound, unsigned samples, int mixRate)
@@ -473,27 +473,19 @@ void BillboardSet::UpdateVertexBuffer(const FrameInfo& frame)
     Matrix3x4 billboardTransform = relative_ ? worldTransform : Matrix3x4::IDENTITY;
     Vector3 billboardScale = scaled_ ? worldTransform.Scale() : Vector3::ONE;
 
-    // First check number of enabled billboards
-    for (unsigned i = 0; i < numBillboards; ++i)
-    {
-        if (billboards_[i].enabled_)
-            ++enabledBillboards;
-    }
-
-    sortedBillboards_.Resize(enabledBillboards);
-    unsigned index = 0;
-
-    // Then set initial sort order and distances
+    // Collect the enabled billboards in one pass and set initial sort order and distances
+    sortedBillboards_.Resize(numBillboards);
     for (unsigned i = 0; i < numBillboards; ++i)
     {
         Billboard& billboard = billboards_[i];
         if (billboard.enabled_)
         {
-            sortedBillboards_[index++] = &billboard;
+            sortedBillboards_[enabledBillboards++] = &billboard;
             if (sorted_)
-                billboard.sortDistance_ = frame.camera_->GetDistanceSquared(billboardTransform * billboards_[i].position_);
+                billboard.sortDistance_ = frame.camera_->GetDistanceSquared(billboardTransform * billboard.position_);
         }
     }
+    sortedBillboards_.Resize(enabledBillboards);
 
     batches_[0].geometry_->SetDrawRange(TRIANGLE_LIST, 0, enabledBillboards * 6, false);
 
@@ -68,14 +68,16 @@ bool Texture2D::BeginLoad(Deserializer& source)
         return false;
     }
 
-    // Precalculate mip levels if async loading
-    if (GetAsyncLoadState() == ASYNC_LOADING)
-        loadImage_->PrecalculateLevels();
-
-    // Load the optional parameters file
+    // Load the optional parameters file. If sRGB sampling is requested, generate the mip levels in linear space
     ResourceCache* cache = GetSubsystem<ResourceCache>();
     String xmlName = ReplaceExtension(GetName(), ".xml");
     loadParameters_ = cache->GetTempResource<XMLFile>(xmlName, false);
+    if (loadParameters_ && loadParameters_->GetRoot().GetChild("srgb").GetBool("enable"))
+        loadImage_->SetSRGB(true);
+
+    // Precalculate mip levels if async loading
+    if (GetAsyncLoadState() == ASYNC_LOADING)
+        loadImage_->PrecalculateLevels();
 
     return true;
 }
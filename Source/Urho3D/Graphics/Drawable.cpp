@@ -61,6 +61,7 @@ Drawable::Drawable(Context* context, unsigned char drawableFlags) :
     occluder_(false),
     occludee_(true),
     updateQueued_(false),
+    dynamic_(false),
     zoneDirty_(false),
     octant_(0),
     zone_(0),
@@ -69,6 +70,7 @@ Drawable::Drawable(Context* context, unsigned char drawableFlags) :
     shadowMask_(DEFAULT_SHADOWMASK),
     zoneMask_(DEFAULT_ZONEMASK),
     viewFrameNumber_(0),
+    octreeUpdateFrameNumber_(0),
     distance_(0.0f),
     lodDistance_(0.0f),
     drawDistance_(0.0f),
@@ -393,7 +395,10 @@ void Drawable::AddToOctree()
     {
         Octree* octree = scene->GetComponent<Octree>();
         if (octree)
+        {
             octree->InsertDrawable(this);
+            octree->MarkDynamic(this);
+        }
         else
             LOGERROR("No Octree component in scene, drawable will not render");
     }
@@ -411,6 +416,7 @@ void Drawable::RemoveFromOctree()
         Octree* octree = octant_->GetRoot();
         if (updateQueued_)
             octree->CancelUpdate(this);
+        octree->RemoveDynamic(this);
 
         // Perform subclass specific deinitialization if necessary
         OnRemoveFromOctree();
@@ -239,6 +239,9 @@ public:
     /// Return octree octant.
     Octant* GetOctant() const { return octant_; }
 
+    /// Return whether has been updated or moved in the octree recently. Dynamic drawables are excluded from cached shadow caster queries.
+    bool IsDynamic() const { return dynamic_; }
+
     /// Return current zone.
     Zone* GetZone() const { return zone_; }
 
@@ -332,6 +335,8 @@ protected:
     bool occludee_;
     /// Octree update queued flag.
     bool updateQueued_;
+    /// Recently updated in the octree flag.
+    bool dynamic_;
     /// Zone inconclusive or dirtied flag.
     bool zoneDirty_;
     /// Octree octant.
@@ -348,6 +353,8 @@ protected:
     unsigned zoneMask_;
     /// Last visible frame number.
     unsigned viewFrameNumber_;
+    /// Frame number of the last octree update.
+    unsigned octreeUpdateFrameNumber_;
     /// Current distance to camera.
     float distance_;
     /// LOD scaled distance.
@@ -0,0 +1,428 @@
+//
+// Copyright (c) 2008-2015 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../Precompiled.h"
+
+#include "../Container/Sort.h"
+#include "../Graphics/GeometryOptimizer.h"
+#include "../Math/Vector3.h"
+
+#include "../DebugNew.h"
+
+namespace Urho3D
+{
+
+/// Cache size assumed by the vertex scoring function.
+static const unsigned SCORE_CACHE_SIZE = 32;
+/// Cache size used for finding cluster boundaries, matching the typical post-transform cache of current hardware.
+static const unsigned CLUSTER_CACHE_SIZE = 16;
+static const float CACHE_DECAY_POWER = 1.5f;
+static const float LAST_TRIANGLE_SCORE = 0.75f;
+static const float VALENCE_BOOST_SCALE = 2.0f;
+static const float VALENCE_BOOST_POWER = 0.5f;
+
+/// Triangle cluster for overdraw sorting.
+struct TriangleCluster
+{
+    /// First triangle.
+    unsigned start_;
+    /// Number of triangles.
+    unsigned count_;
+    /// Area-weighted center.
+    Vector3 center_;
+    /// Average normal.
+    Vector3 normal_;
+    /// Sort key: how far the cluster faces out from the mesh center.
+    float sortKey_;
+};
+
+static bool CompareTriangleClusters(const TriangleCluster& lhs, const TriangleCluster& rhs)
+{
+    return lhs.sortKey_ > rhs.sortKey_;
+}
+
+inline unsigned ReadIndex(const void* indexData, unsigned indexSize, unsigned index)
+{
+    if (indexSize == sizeof(unsigned short))
+        return ((const unsigned short*)indexData)[index];
+    else
+        return ((const unsigned*)indexData)[index];
+}
+
+inline void WriteIndex(void* indexData, unsigned indexSize, unsigned index, unsigned value)
+{
+    if (indexSize == sizeof(unsigned short))
+        ((unsigned short*)indexData)[index] = (unsigned short)value;
+    else
+        ((unsigned*)indexData)[index] = value;
+}
+
+/// Read an index range rebased so that the smallest index is zero. Return the number of vertices spanned.
+static unsigned ReadIndices(PODVector<unsigned>& dest, const void* indexData, unsigned indexSize, unsigned indexStart,
+    unsigned indexCount, unsigned& minVertex)
+{
+    dest.Resize(indexCount);
+    minVertex = M_MAX_UNSIGNED;
+    unsigned maxVertex = 0;
+
+    for (unsigned i = 0; i < indexCount; ++i)
+    {
+        unsigned v = ReadIndex(indexData, indexSize, indexStart + i);
+        dest[i] = v;
+        if (v < minVertex)
+            minVertex = v;
+        if (v > maxVertex)
+            maxVertex = v;
+    }
+
+    for (unsigned i = 0; i < indexCount; ++i)
+        dest[i] -= minVertex;
+
+    return maxVertex - minVertex + 1;
+}
+
+/// Simulate a FIFO cache for one triangle and return the number of misses. A timestamp of zero means never transformed.
+inline unsigned UpdateFIFOCache(const unsigned* triangle, PODVector<unsigned>& timeStamps, unsigned& time, unsigned cacheSize)
+{
+    unsigned misses = 0;
+
+    for (unsigned i = 0; i < 3; ++i)
+    {
+        unsigned& stamp = timeStamps[triangle[i]];
+        if (!stamp || time - stamp >= cacheSize)
+        {
+            stamp = ++time;
+            ++misses;
+        }
+    }
+
+    return misses;
+}
+
+inline void ResetFIFOCache(PODVector<unsigned>& timeStamps, unsigned& time)
+{
+    if (timeStamps.Size())
+        memset(&timeStamps[0], 0, timeStamps.Size() * sizeof(unsigned));
+    time = 0;
+}
+
+/// Return the score of a vertex based on its position in the LRU cache and the number of triangles still using it.
+static float GetVertexScore(int cachePosition, unsigned activeTriangles)
+{
+    // No triangles left, so the vertex is of no use
+    if (!activeTriangles)
+        return -1.0f;
+
+    float score = 0.0f;
+    if (cachePosition >= 0)
+    {
+        // The vertices of the last triangle get a fixed score to not favor any of them
+        if (cachePosition < 3)
+            score = LAST_TRIANGLE_SCORE;
+        else
+        {
+            float scaler = 1.0f / (float)(SCORE_CACHE_SIZE - 3);
+            score = powf(1.0f - (float)(cachePosition - 3) * scaler, CACHE_DECAY_POWER);
+        }
+    }
+
+    // Boost vertices with few triangles left so that lone triangles get finished instead of left behind
+    score += VALENCE_BOOST_SCALE * powf((float)activeTriangles, -VALENCE_BOOST_POWER);
+    return score;
+}
+
+void OptimizeVertexCache(void* indexData, unsigned indexSize, unsigned indexStart, unsigned indexCount)
+{
+    // Linear-speed vertex cache optimization from
+    // https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html
+    unsigned triangleCount = indexCount / 3;
+    if (!indexData || triangleCount < 2)
+        return;
+
+    unsigned minVertex;
+    PODVector<unsigned> indices;
+    unsigned vertexCount = ReadIndices(indices, indexData, indexSize, indexStart, triangleCount * 3, minVertex);
+
+    // Build the vertex to triangle adjacency
+    PODVector<unsigned> activeTriangles(vertexCount);
+    PODVector<unsigned> adjacencyOffsets(vertexCount);
+    PODVector<unsigned> adjacency(triangleCount * 3);
+    memset(&activeTriangles[0], 0, vertexCount * sizeof(unsigned));
+
+    for (unsigned i = 0; i < triangleCount * 3; ++i)
+        ++activeTriangles[indices[i]];
+
+    unsigned offset = 0;
+    for (unsigned i = 0; i < vertexCount; ++i)
+    {
+        adjacencyOffsets[i] = offset;
+        offset += activeTriangles[i];
+        activeTriangles[i] = 0;
+    }
+
+    for (unsigned i = 0; i < triangleCount * 3; ++i)
+    {
+        unsigned v = indices[i];
+        adjacency[adjacencyOffsets[v] + activeTriangles[v]++] = i / 3;
+    }
+
+    PODVector<float> vertexScores(vertexCount);
+    for (unsigned i = 0; i < vertexCount; ++i)
+        vertexScores[i] = GetVertexScore(-1, activeTriangles[i]);
+
+    PODVector<bool> emitted(triangleCount);
+    for (unsigned i = 0; i < triangleCount; ++i)
+        emitted[i] = false;
+
+    // The vertices of the new triangle are pushed in front of the previous cache contents, so it may temporarily overflow
+    unsigned cache[SCORE_CACHE_SIZE + 3];
+    unsigned newCache[SCORE_CACHE_SIZE + 3];
+    unsigned cacheCount = 0;
+
+    PODVector<unsigned> output(triangleCount * 3);
+    unsigned nextInput = 0;
+    unsigned bestTriangle = M_MAX_UNSIGNED;
+
+    for (unsigned i = 0; i < triangleCount; ++i)
+    {
+        // If the cached vertices have no triangles left, continue from the next unused triangle in input order
+        if (bestTriangle == M_MAX_UNSIGNED)
+        {
+            while (emitted[nextInput])
+                ++nextInput;
+            bestTriangle = nextInput;
+        }
+
+        const unsigned* triangle = &indices[bestTriangle * 3];
+        output[i * 3] = triangle[0];
+        output[i * 3 + 1] = triangle[1];
+        output[i * 3 + 2] = triangle[2];
+        emitted[bestTriangle] = true;
+
+        unsigned newCacheCount = 0;
+        for (unsigned j = 0; j < 3; ++j)
+        {
+            unsigned v = triangle[j];
+            newCache[newCacheCount++] = v;
+
+            // Remove the triangle from the vertex's active triangles
+            unsigned* triangles = &adjacency[adjacencyOffsets[v]];
+            unsigned& count = activeTriangles[v];
+            for (unsigned k = 0; k < count; ++k)
+            {
+                if (triangles[k] == bestTriangle)
+                {
+                    triangles[k] = triangles[--count];
+                    break;
+                }
+            }
+        }
+
+        for (unsigned j = 0; j < cacheCount; ++j)
+        {
+            unsigned v = cache[j];
+            if (v != triangle[0] && v != triangle[1] && v != triangle[2])
+                newCache[newCacheCount++] = v;
+        }
+
+        // Vertices pushed out of the cache lose their cache score
+        for (unsigned j = SCORE_CACHE_SIZE; j < newCacheCount; ++j)
+            vertexScores[newCache[j]] = GetVertexScore(-1, activeTriangles[newCache[j]]);
+
+        cacheCount = newCacheCount < SCORE_CACHE_SIZE ? newCacheCount : SCORE_CACHE_SIZE;
+        for (unsigned j = 0; j < cacheCount; ++j)
+        {
+            unsigned v = newCache[j];
+            cache[j] = v;
+            vertexScores[v] = GetVertexScore((int)j, activeTriangles[v]);
+        }
+
+        // Rescore the triangles using the cached vertices and pick the best one for the next round
+        bestTriangle = M_MAX_UNSIGNED;
+        float bestScore = -M_INFINITY;
+        for (unsigned j = 0; j < cacheCount; ++j)
+        {
+            unsigned v = cache[j];
+            const unsigned* triangles = &adjacency[adjacencyOffsets[v]];
+            for (unsigned k = 0; k < activeTriangles[v]; ++k)
+            {
+                const unsigned* candidate = &indices[triangles[k] * 3];
+                float score = vertexScores[candidate[0]] + vertexScores[candidate[1]] + vertexScores[candidate[2]];
+                if (score > bestScore)
+                {
+                    bestScore = score;
+                    bestTriangle = triangles[k];
+                }
+            }
+        }
+    }
+
+    for (unsigned i = 0; i < triangleCount * 3; ++i)
+        WriteIndex(indexData, indexSize, indexStart + i, output[i] + minVertex);
+}
+
+void OptimizeOverdraw(void* indexData, unsigned indexSize, unsigned indexStart, unsigned indexCount, const void* vertexData,
+    unsigned vertexSize, float threshold)
+{
+    // Cluster splitting and sorting from Sander, Nehab & Barczak: Fast Triangle Reordering for Vertex Locality and Reduced
+    // Overdraw
+    unsigned triangleCount = indexCount / 3;
+    if (!indexData || !vertexData || triangleCount < 2)
+        return;
+
+    unsigned minVertex;
+    PODVector<unsigned> indices;
+    unsigned vertexCount = ReadIndices(indices, indexData, indexSize, indexStart, triangleCount * 3, minVertex);
+
+    PODVector<unsigned> timeStamps(vertexCount);
+    unsigned time;
+    ResetFIFOCache(timeStamps, time);
+
+    // A triangle missing all its vertices begins a new hard cluster, as the cache optimized order has started over there
+    PODVector<unsigned> hardBoundaries;
+    for (unsigned i = 0; i < triangleCount; ++i)
+    {
+        if (UpdateFIFOCache(&indices[i * 3], timeStamps, time, CLUSTER_CACHE_SIZE) == 3)
+            hardBoundaries.Push(i);
+    }
+    hardBoundaries.Push(triangleCount);
+
+    // Split the hard clusters further whenever the part so far is within the threshold of the whole cluster's miss ratio
+    PODVector<TriangleCluster> clusters;
+    for (unsigned i = 0; i + 1 < hardBoundaries.Size(); ++i)
+    {
+        unsigned start = hardBoundaries[i];
+        unsigned end = hardBoundaries[i + 1];
+
+        ResetFIFOCache(timeStamps, time);
+        unsigned clusterMisses = 0;
+        for (unsigned j = start; j < end; ++j)
+            clusterMisses += UpdateFIFOCache(&indices[j * 3], timeStamps, time, CLUSTER_CACHE_SIZE);
+        float missThreshold = threshold * (float)clusterMisses / (float)(end - start);
+
+        ResetFIFOCache(timeStamps, time);
+        unsigned partStart = start;
+        unsigned partMisses = 0;
+        for (unsigned j = start; j < end; ++j)
+        {
+            partMisses += UpdateFIFOCache(&indices[j * 3], timeStamps, time, CLUSTER_CACHE_SIZE);
+            if ((float)partMisses <= missThreshold * (float)(j + 1 - partStart) || j + 1 == end)
+            {
+                TriangleCluster cluster;
+                cluster.start_ = partStart;
+                cluster.count_ = j + 1 - partStart;
+                clusters.Push(cluster);
+
+                ResetFIFOCache(timeStamps, time);
+                partStart = j + 1;
+                partMisses = 0;
+            }
+        }
+    }
+
+    if (clusters.Size() < 2)
+        return;
+
+    // Draw first the clusters that face outward the most, as they are likely to occlude the rest of the mesh
+    const unsigned char* vertices = (const unsigned char*)vertexData;
+    Vector3 meshCenter = Vector3::ZERO;
+    float meshArea = 0.0f;
+
+    for (unsigned i = 0; i < clusters.Size(); ++i)
+    {
+        TriangleCluster& cluster = clusters[i];
+        Vector3 center = Vector3::ZERO;
+        Vector3 normal = Vector3::ZERO;
+        float clusterArea = 0.0f;
+
+        for (unsigned j = cluster.start_; j < cluster.start_ + cluster.count_; ++j)
+        {
+            const Vector3& v1 = *((const Vector3*)(vertices + (indices[j * 3] + minVertex) * vertexSize));
+            const Vector3& v2 = *((const Vector3*)(vertices + (indices[j * 3 + 1] + minVertex) * vertexSize));
+            const Vector3& v3 = *((const Vector3*)(vertices + (indices[j * 3 + 2] + minVertex) * vertexSize));
+
+            Vector3 cross = (v2 - v1).CrossProduct(v3 - v1);
+            float area = cross.Length();
+            center += (v1 + v2 + v3) * (area / 3.0f);
+            normal += cross;
+            clusterArea += area;
+        }
+
+        meshCenter += center;
+        meshArea += clusterArea;
+        cluster.center_ = clusterArea > 0.0f ? center / clusterArea : center;
+        cluster.normal_ = normal.Normalized();
+    }
+
+    if (meshArea > 0.0f)
+        meshCenter /= meshArea;
+
+    for (unsigned i = 0; i < clusters.Size(); ++i)
+    {
+        TriangleCluster& cluster = clusters[i];
+        cluster.sortKey_ = (cluster.center_ - meshCenter).DotProduct(cluster.normal_);
+    }
+
+    Sort(clusters.Begin(), clusters.End(), CompareTriangleClusters);
+
+    unsigned dest = indexStart;
+    for (unsigned i = 0; i < clusters.Size(); ++i)
+    {
+        const TriangleCluster& cluster = clusters[i];
+        for (unsigned j = cluster.start_ * 3; j < (cluster.start_ + cluster.count_) * 3; ++j)
+            WriteIndex(indexData, indexSize, dest++, indices[j] + minVertex);
+    }
+}
+
+VertexCacheStatistics AnalyzeVertexCache(const void* indexData, unsigned indexSize, unsigned indexStart, unsigned indexCount,
+    unsigned cacheSize)
+{
+    VertexCacheStatistics ret;
+    unsigned triangleCount = indexCount / 3;
+    if (!indexData || !triangleCount || !cacheSize)
+        return ret;
+
+    unsigned minVertex;
+    PODVector<unsigned> indices;
+    unsigned vertexCount = ReadIndices(indices, indexData, indexSize, indexStart, triangleCount * 3, minVertex);
+
+    PODVector<unsigned> timeStamps(vertexCount);
+    unsigned time;
+    ResetFIFOCache(timeStamps, time);
+
+    for (unsigned i = 0; i < triangleCount; ++i)
+        ret.misses_ += UpdateFIFOCache(&indices[i * 3], timeStamps, time, cacheSize);
+
+    // Vertices never referenced still have a zero timestamp
+    for (unsigned i = 0; i < vertexCount; ++i)
+    {
+        if (timeStamps[i])
+            ++ret.vertices_;
+    }
+
+    ret.triangles_ = triangleCount;
+    ret.acmr_ = (float)ret.misses_ / (float)ret.triangles_;
+    ret.atvr_ = (float)ret.misses_ / (float)ret.vertices_;
+    return ret;
+}
+
+}
@@ -0,0 +1,70 @@
+//
+// Copyright (c) 2008-2015 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#ifdef URHO3D_IS_BUILDING
+#include "Urho3D.h"
+#else
+#include <Urho3D/Urho3D.h>
+#endif
+
+namespace Urho3D
+{
+
+/// Post-transform vertex cache efficiency of an indexed triangle list.
+struct VertexCacheStatistics
+{
+    /// Construct zero.
+    VertexCacheStatistics() :
+        triangles_(0),
+        vertices_(0),
+        misses_(0),
+        acmr_(0.0f),
+        atvr_(0.0f)
+    {
+    }
+
+    /// Number of triangles.
+    unsigned triangles_;
+    /// Number of unique vertices.
+    unsigned vertices_;
+    /// Number of vertex shader invocations.
+    unsigned misses_;
+    /// Average cache miss ratio: vertex shader invocations per triangle. The optimum approaches 0.5.
+    float acmr_;
+    /// Average transformed vertex ratio: vertex shader invocations per unique vertex. The optimum is 1.
+    float atvr_;
+};
+
+/// Reorder the triangles of an indexed triangle list for the post-transform vertex cache.
+URHO3D_API void OptimizeVertexCache(void* indexData, unsigned indexSize, unsigned indexStart, unsigned indexCount);
+/// Reorder clusters of vertex cache optimized triangles so that outward facing surfaces are drawn first to reduce overdraw. The
+/// clusters may be split, as long as the cache miss ratio grows at most by the threshold factor. The vertex position must be the
+/// first element.
+URHO3D_API void OptimizeOverdraw(void* indexData, unsigned indexSize, unsigned indexStart, unsigned indexCount,
+    const void* vertexData, unsigned vertexSize, float threshold = 1.05f);
+/// Return the vertex cache efficiency of an indexed triangle list, simulated with a FIFO cache.
+URHO3D_API VertexCacheStatistics AnalyzeVertexCache(const void* indexData, unsigned indexSize, unsigned indexStart,
+    unsigned indexCount, unsigned cacheSize = 16);
+
+}
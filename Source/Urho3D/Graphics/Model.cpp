@@ -25,6 +25,7 @@
 #include "../Core/Context.h"
 #include "../Core/Profiler.h"
 #include "../Graphics/Geometry.h"
+#include "../Graphics/GeometryOptimizer.h"
 #include "../Graphics/IndexBuffer.h"
 #include "../Graphics/Model.h"
 #include "../Graphics/Graphics.h"
@@ -677,6 +678,190 @@ SharedPtr<Model> Model::Clone(const String& cloneName) const
     return ret;
 }
 
+void Model::OptimizeGeometries(bool reorderVertices)
+{
+    PROFILE(OptimizeModelGeometries);
+
+    // Reorder the triangles of each index range once, as LOD levels may share ranges. Ranges that partially overlap another
+    // range can not be reordered safely and are skipped
+    for (unsigned i = 0; i < indexBuffers_.Size(); ++i)
+    {
+        IndexBuffer* ib = indexBuffers_[i];
+        if (!ib)
+            continue;
+        if (!ib->IsShadowed())
+        {
+            LOGWARNING("Can not optimize index buffer " + String(i) + " of model " + GetName() + " without shadow data");
+            continue;
+        }
+
+        unsigned indexSize = ib->GetIndexSize();
+        Vector<Pair<unsigned, unsigned> > ranges;
+        PODVector<Geometry*> users;
+        for (unsigned j = 0; j < geometries_.Size(); ++j)
+        {
+            for (unsigned k = 0; k < geometries_[j].Size(); ++k)
+            {
+                Geometry* geometry = geometries_[j][k];
+                if (!geometry || geometry->GetIndexBuffer() != ib || geometry->GetPrimitiveType() != TRIANGLE_LIST)
+                    continue;
+
+                Pair<unsigned, unsigned> range(geometry->GetIndexStart(), geometry->GetIndexCount());
+                if (!ranges.Contains(range))
+                {
+                    ranges.Push(range);
+                    users.Push(geometry);
+                }
+            }
+        }
+
+        SharedArrayPtr<unsigned char> indexData(new unsigned char[ib->GetIndexCount() * indexSize]);
+        memcpy(indexData.Get(), ib->GetShadowData(), ib->GetIndexCount() * indexSize);
+        bool modified = false;
+
+        for (unsigned j = 0; j < ranges.Size(); ++j)
+        {
+            unsigned start = ranges[j].first_;
+            unsigned end = start + ranges[j].second_;
+            bool overlaps = false;
+            for (unsigned k = 0; k < ranges.Size(); ++k)
+            {
+                if (k != j && ranges[k].first_ < end && ranges[k].first_ + ranges[k].second_ > start)
+                {
+                    overlaps = true;
+                    break;
+                }
+            }
+            if (overlaps)
+                continue;
+
+            OptimizeVertexCache(indexData.Get(), indexSize, start, ranges[j].second_);
+            VertexBuffer* vb = users[j]->GetVertexBuffer(0);
+            if (vb && vb->IsShadowed() && (vb->GetElementMask() & MASK_POSITION))
+                OptimizeOverdraw(indexData.Get(), indexSize, start, ranges[j].second_, vb->GetShadowData(), vb->GetVertexSize());
+            modified = true;
+        }
+
+        if (modified)
+            ib->SetData(indexData.Get());
+    }
+
+    if (!reorderVertices)
+        return;
+
+    // Reorder the vertices into first use order for vertex fetch locality. This is only done when the index data of all the
+    // geometries using the buffer can be remapped, and no morphs refer to vertices by index
+    for (unsigned i = 0; i < vertexBuffers_.Size(); ++i)
+    {
+        VertexBuffer* vb = vertexBuffers_[i];
+        if (!vb || !vb->IsShadowed() || !vb->GetVertexCount() || GetMorphRangeCount(i))
+            continue;
+
+        PODVector<Geometry*> users;
+        bool canReorder = true;
+        for (unsigned j = 0; j < geometries_.Size() && canReorder; ++j)
+        {
+            for (unsigned k = 0; k < geometries_[j].Size(); ++k)
+            {
+                Geometry* geometry = geometries_[j][k];
+                if (!geometry || !geometry->GetVertexBuffers().Contains(SharedPtr<VertexBuffer>(vb)))
+                    continue;
+
+                IndexBuffer* ib = geometry->GetIndexBuffer();
+                if (geometry->GetNumVertexBuffers() > 1 || !ib || !ib->IsShadowed())
+                {
+                    canReorder = false;
+                    break;
+                }
+                users.Push(geometry);
+            }
+        }
+        if (!canReorder || users.Empty())
+            continue;
+
+        unsigned vertexCount = vb->GetVertexCount();
+        unsigned vertexSize = vb->GetVertexSize();
+        PODVector<unsigned> remap(vertexCount);
+        for (unsigned j = 0; j < vertexCount; ++j)
+            remap[j] = M_MAX_UNSIGNED;
+
+        unsigned newVertexCount = 0;
+        for (unsigned j = 0; j < users.Size(); ++j)
+        {
+            Geometry* geometry = users[j];
+            IndexBuffer* ib = geometry->GetIndexBuffer();
+            const unsigned char* indexData = ib->GetShadowData();
+            unsigned end = geometry->GetIndexStart() + geometry->GetIndexCount();
+            for (unsigned k = geometry->GetIndexStart(); k < end; ++k)
+            {
+                unsigned index = ib->GetIndexSize() == sizeof(unsigned) ? ((const unsigned*)indexData)[k] :
+                    ((const unsigned short*)indexData)[k];
+                if (index < vertexCount && remap[index] == M_MAX_UNSIGNED)
+                    remap[index] = newVertexCount++;
+            }
+        }
+
+        // Keep unreferenced vertices at the end
+        for (unsigned j = 0; j < vertexCount; ++j)
+        {
+            if (remap[j] == M_MAX_UNSIGNED)
+                remap[j] = newVertexCount++;
+        }
+
+        SharedArrayPtr<unsigned char> vertexData(new unsigned char[vertexCount * vertexSize]);
+        const unsigned char* oldVertexData = vb->GetShadowData();
+        for (unsigned j = 0; j < vertexCount; ++j)
+            memcpy(vertexData.Get() + remap[j] * vertexSize, oldVertexData + j * vertexSize, vertexSize);
+        vb->SetData(vertexData.Get());
+
+        // Remap each index only once, as LOD levels may share index ranges
+        HashMap<IndexBuffer*, PODVector<bool> > remapped;
+        for (unsigned j = 0; j < users.Size(); ++j)
+        {
+            Geometry* geometry = users[j];
+            IndexBuffer* ib = geometry->GetIndexBuffer();
+            PODVector<bool>& done = remapped[ib];
+            if (done.Empty())
+            {
+                done.Resize(ib->GetIndexCount());
+                for (unsigned k = 0; k < done.Size(); ++k)
+                    done[k] = false;
+            }
+
+            unsigned char* indexData = ib->GetShadowData();
+            unsigned end = geometry->GetIndexStart() + geometry->GetIndexCount();
+            for (unsigned k = geometry->GetIndexStart(); k < end; ++k)
+            {
+                if (done[k])
+                    continue;
+                done[k] = true;
+
+                if (ib->GetIndexSize() == sizeof(unsigned))
+                {
+                    unsigned& index = ((unsigned*)indexData)[k];
+                    if (index < vertexCount)
+                        index = remap[index];
+                }
+                else
+                {
+                    unsigned short& index = ((unsigned short*)indexData)[k];
+                    if (index < vertexCount)
+                        index = (unsigned short)remap[index];
+                }
+            }
+
+            ib->SetDataRange(indexData + geometry->GetIndexStart() * ib->GetIndexSize(), geometry->GetIndexStart(),
+                geometry->GetIndexCount());
+        }
+
+        for (unsigned j = 0; j < users.Size(); ++j)
+        {
+            Geometry* geometry = users[j];
+            geometry->SetDrawRange(geometry->GetPrimitiveType(), geometry->GetIndexStart(), geometry->GetIndexCount(), true);
+        }
+    }
+}
+
 unsigned Model::GetNumGeometryLodLevels(unsigned index) const
 {
     return index < geometries_.Size() ? geometries_[index].Size() : 0;
@@ -147,6 +147,9 @@ public:
     void SetMorphs(const Vector<ModelMorph>& morphs);
     /// Clone the model. The geometry data is deep-copied and can be modified in the clone without affecting the original.
     SharedPtr<Model> Clone(const String& cloneName = String::EMPTY) const;
+    /// Reorder the triangles of the triangle list geometries for the post-transform vertex cache and to draw outward facing
+    /// surfaces first, and optionally reorder the vertices into first use order. Requires shadowed buffers.
+    void OptimizeGeometries(bool reorderVertices = true);
 
     /// Return bounding box.
     const BoundingBox& GetBoundingBox() const { return boundingBox_; }
@@ -46,6 +46,7 @@ namespace Urho3D
 static const float DEFAULT_OCTREE_SIZE = 1000.0f;
 static const int DEFAULT_OCTREE_LEVELS = 8;
 static const int RAYCASTS_PER_WORK_ITEM = 4;
+static const unsigned DYNAMIC_DRAWABLE_FRAMES = 30;
 
 extern const char* SUBSYSTEM_CATEGORY;
 
@@ -332,7 +333,9 @@ void Octant::GetDrawablesOnlyInternal(RayOctreeQuery& query, PODVector<Drawable*
 Octree::Octree(Context* context) :
     Component(context),
     Octant(BoundingBox(-DEFAULT_OCTREE_SIZE, DEFAULT_OCTREE_SIZE), 0, 0, this),
-    numLevels_(DEFAULT_OCTREE_LEVELS)
+    numLevels_(DEFAULT_OCTREE_LEVELS),
+    staticGeneration_(0),
+    frameNumber_(0)
 {
     // Resize threaded ray query intermediate result vector according to number of worker threads
     WorkQueue* workQueue = GetSubsystem<WorkQueue>();
@@ -349,6 +352,9 @@ Octree::~Octree()
     // Reset root pointer from all child octants now so that they do not move their drawables to root
     drawableUpdates_.Clear();
     drawableReinsertions_.Clear();
+    for (PODVector<Drawable*>::Iterator i = dynamicDrawables_.Begin(); i != dynamicDrawables_.End(); ++i)
+        (*i)->dynamic_ = false;
+    dynamicDrawables_.Clear();
     ResetRoot();
 }
 
@@ -396,6 +402,8 @@ void Octree::SetSize(const BoundingBox& box, unsigned numLevels)
 
 void Octree::Update(const FrameInfo& frame)
 {
+    frameNumber_ = frame.frameNumber_;
+
     // Let drawables update themselves before reinsertion. This can be used for animation
     if (!drawableUpdates_.Empty())
     {
@@ -462,6 +470,7 @@ void Octree::Update(const FrameInfo& frame)
             // Skip if no octant or does not belong to this octree anymore
             if (!octant || octant->GetRoot() != this)
                 continue;
+            MarkDynamic(drawable);
             // Skip if still fits the current octant
             if (drawable->IsOccludee() && octant->GetCullingBox().IsInside(box) == INSIDE && octant->CheckDrawableFit(box))
                 continue;
@@ -481,6 +490,20 @@ void Octree::Update(const FrameInfo& frame)
     }
 
     drawableUpdates_.Clear();
+
+    // Drawables that have not been updated for a while become static again
+    for (PODVector<Drawable*>::Iterator i = dynamicDrawables_.Begin(); i != dynamicDrawables_.End();)
+    {
+        Drawable* drawable = *i;
+        if (frameNumber_ - drawable->octreeUpdateFrameNumber_ > DYNAMIC_DRAWABLE_FRAMES)
+        {
+            drawable->dynamic_ = false;
+            i = dynamicDrawables_.Erase(i);
+            ++staticGeneration_;
+        }
+        else
+            ++i;
+    }
 }
 
 void Octree::AddManualDrawable(Drawable* drawable)
@@ -489,6 +512,7 @@ void Octree::AddManualDrawable(Drawable* drawable)
         return;
 
     AddDrawable(drawable);
+    MarkDynamic(drawable);
 }
 
 void Octree::RemoveManualDrawable(Drawable* drawable)
@@ -498,7 +522,10 @@ void Octree::RemoveManualDrawable(Drawable* drawable)
 
     Octant* octant = drawable->GetOctant();
     if (octant && octant->GetRoot() == this)
+    {
+        RemoveDynamic(drawable);
         octant->RemoveDrawable(drawable);
+    }
 }
 
 void Octree::GetDrawables(OctreeQuery& query) const
@@ -625,6 +652,28 @@ void Octree::CancelUpdate(Drawable* drawable)
     drawable->updateQueued_ = false;
 }
 
+void Octree::MarkDynamic(Drawable* drawable)
+{
+    drawable->octreeUpdateFrameNumber_ = frameNumber_;
+    if (!drawable->dynamic_)
+    {
+        drawable->dynamic_ = true;
+        dynamicDrawables_.Push(drawable);
+        ++staticGeneration_;
+    }
+}
+
+void Octree::RemoveDynamic(Drawable* drawable)
+{
+    if (drawable->dynamic_)
+    {
+        drawable->dynamic_ = false;
+        dynamicDrawables_.Remove(drawable);
+    }
+    else
+        ++staticGeneration_;
+}
+
 void Octree::DrawDebugGeometry(bool depthTest)
 {
     DebugRenderer* debug = GetComponent<DebugRenderer>();
@@ -194,11 +194,19 @@ public:
 
     /// Return subdivision levels.
     unsigned GetNumLevels() const { return numLevels_; }
+    /// Return static drawable generation. Changes whenever a static drawable is added or removed, starts moving, or a dynamic drawable becomes static.
+    unsigned GetStaticGeneration() const { return staticGeneration_; }
+    /// Return drawable objects that have been updated or moved recently.
+    const PODVector<Drawable*>& GetDynamicDrawables() const { return dynamicDrawables_; }
 
     /// Mark drawable object as requiring an update and a reinsertion.
     void QueueUpdate(Drawable* drawable);
     /// Cancel drawable object's update.
     void CancelUpdate(Drawable* drawable);
+    /// Mark drawable object as dynamic due to being added, updated or moved.
+    void MarkDynamic(Drawable* drawable);
+    /// Remove drawable object's dynamic status when it is removed from the octree.
+    void RemoveDynamic(Drawable* drawable);
     /// Visualize the component as debug geometry.
     void DrawDebugGeometry(bool depthTest);
 
@@ -210,6 +218,8 @@ private:
     PODVector<Drawable*> drawableUpdates_;
     /// Drawable objects that require reinsertion.
     PODVector<Drawable*> drawableReinsertions_;
+    /// Drawable objects that have been updated or moved recently.
+    PODVector<Drawable*> dynamicDrawables_;
     /// Mutex for octree reinsertions.
     Mutex octreeMutex_;
     /// Current threaded ray query.
@@ -220,6 +230,10 @@ private:
     mutable Vector<PODVector<RayQueryResult> > rayQueryResults_;
     /// Subdivision level.
     unsigned numLevels_;
+    /// Static drawable generation.
+    unsigned staticGeneration_;
+    /// Frame number of the last update.
+    unsigned frameNumber_;
 };
 
 }
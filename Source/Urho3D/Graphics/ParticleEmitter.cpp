@@ -31,6 +31,10 @@
 #include "../Scene/Scene.h"
 #include "../Scene/SceneEvents.h"
 
+#ifdef URHO3D_SSE
+#include <xmmintrin.h>
+#endif
+
 #include "../DebugNew.h"
 
 namespace Urho3D
@@ -40,6 +44,112 @@ extern const char* GEOMETRY_CATEGORY;
 extern const char* faceCameraModeNames[];
 static const unsigned MAX_PARTICLES_IN_FRAME = 100;
 
+static void UpdateParticleArrays(ParticleArrays& arrays, float timeStep, const Vector3& constantForce, float dampingForce,
+    const Vector3& scaleVector, float sizeAdd, float sizeMul)
+{
+    unsigned numParticles = arrays.timer_.Size();
+    if (!numParticles)
+        return;
+
+    float sizeFactor = (timeStep * (sizeMul - 1.0f)) + 1.0f;
+
+    float* velocityX = &arrays.velocityX_[0];
+    float* velocityY = &arrays.velocityY_[0];
+    float* velocityZ = &arrays.velocityZ_[0];
+    float* timer = &arrays.timer_[0];
+    const float* timeToLive = &arrays.timeToLive_[0];
+    float* scale = &arrays.scale_[0];
+    float* deltaX = &arrays.deltaX_[0];
+    float* deltaY = &arrays.deltaY_[0];
+    float* deltaZ = &arrays.deltaZ_[0];
+    unsigned char* aliveMasks = &arrays.aliveMasks_[0];
+
+#ifdef URHO3D_SSE
+    const __m128 step = _mm_set1_ps(timeStep);
+    const __m128 forceX = _mm_set1_ps(timeStep * constantForce.x_);
+    const __m128 forceY = _mm_set1_ps(timeStep * constantForce.y_);
+    const __m128 forceZ = _mm_set1_ps(timeStep * constantForce.z_);
+    const __m128 damping = _mm_set1_ps(-dampingForce);
+    const __m128 scaleX = _mm_set1_ps(scaleVector.x_);
+    const __m128 scaleY = _mm_set1_ps(scaleVector.y_);
+    const __m128 scaleZ = _mm_set1_ps(scaleVector.z_);
+    const __m128 scaleAdd = _mm_set1_ps(timeStep * sizeAdd);
+    const __m128 scaleMul = _mm_set1_ps(sizeFactor);
+    const __m128 zero = _mm_setzero_ps();
+
+    for (unsigned i = 0; i < numParticles; i += 4)
+    {
+        __m128 time = _mm_loadu_ps(timer + i);
+        __m128 alive = _mm_cmplt_ps(time, _mm_loadu_ps(timeToLive + i));
+        int mask = _mm_movemask_ps(alive);
+        aliveMasks[i >> 2] = (unsigned char)mask;
+        if (!mask)
+            continue;
+
+        _mm_storeu_ps(timer + i, _mm_add_ps(time, _mm_and_ps(alive, step)));
+
+        // Velocity: apply constant force, then damping. Particles that are not alive keep their values
+        __m128 oldX = _mm_loadu_ps(velocityX + i);
+        __m128 oldY = _mm_loadu_ps(velocityY + i);
+        __m128 oldZ = _mm_loadu_ps(velocityZ + i);
+        __m128 vx = _mm_add_ps(oldX, forceX);
+        __m128 vy = _mm_add_ps(oldY, forceY);
+        __m128 vz = _mm_add_ps(oldZ, forceZ);
+        vx = _mm_add_ps(vx, _mm_mul_ps(step, _mm_mul_ps(damping, vx)));
+        vy = _mm_add_ps(vy, _mm_mul_ps(step, _mm_mul_ps(damping, vy)));
+        vz = _mm_add_ps(vz, _mm_mul_ps(step, _mm_mul_ps(damping, vz)));
+        vx = _mm_or_ps(_mm_and_ps(alive, vx), _mm_andnot_ps(alive, oldX));
+        vy = _mm_or_ps(_mm_and_ps(alive, vy), _mm_andnot_ps(alive, oldY));
+        vz = _mm_or_ps(_mm_and_ps(alive, vz), _mm_andnot_ps(alive, oldZ));
+        _mm_storeu_ps(velocityX + i, vx);
+        _mm_storeu_ps(velocityY + i, vy);
+        _mm_storeu_ps(velocityZ + i, vz);
+
+        // Position change
+        _mm_storeu_ps(deltaX + i, _mm_mul_ps(_mm_mul_ps(step, vx), scaleX));
+        _mm_storeu_ps(deltaY + i, _mm_mul_ps(_mm_mul_ps(step, vy), scaleY));
+        _mm_storeu_ps(deltaZ + i, _mm_mul_ps(_mm_mul_ps(step, vz), scaleZ));
+
+        // Scaling
+        __m128 oldScale = _mm_loadu_ps(scale + i);
+        __m128 newScale = _mm_mul_ps(_mm_max_ps(_mm_add_ps(oldScale, scaleAdd), zero), scaleMul);
+        _mm_storeu_ps(scale + i, _mm_or_ps(_mm_and_ps(alive, newScale), _mm_andnot_ps(alive, oldScale)));
+    }
+#else
+    for (unsigned i = 0; i < numParticles; i += 4)
+    {
+        unsigned char mask = 0;
+
+        for (unsigned j = i; j < i + 4; ++j)
+        {
+            if (timer[j] >= timeToLive[j])
+                continue;
+
+            mask |= (unsigned char)(1 << (j - i));
+            timer[j] += timeStep;
+
+            velocityX[j] += timeStep * constantForce.x_;
+            velocityY[j] += timeStep * constantForce.y_;
+            velocityZ[j] += timeStep * constantForce.z_;
+            velocityX[j] += timeStep * (-dampingForce * velocityX[j]);
+            velocityY[j] += timeStep * (-dampingForce * velocityY[j]);
+            velocityZ[j] += timeStep * (-dampingForce * velocityZ[j]);
+
+            deltaX[j] = timeStep * velocityX[j] * scaleVector.x_;
+            deltaY[j] = timeStep * velocityY[j] * scaleVector.y_;
+            deltaZ[j] = timeStep * velocityZ[j] * scaleVector.z_;
+
+            scale[j] += timeStep * sizeAdd;
+            if (scale[j] < 0.0f)
+                scale[j] = 0.0f;
+            scale[j] *= sizeFactor;
+        }
+
+        aliveMasks[i >> 2] = mask;
+    }
+#endif
+}
+
 ParticleEmitter::ParticleEmitter(Context* context) :
     BillboardSet(context),
     periodTimer_(0.0f),
@@ -166,6 +276,15 @@ void ParticleEmitter::Update(const FrameInfo& frame)
     if (scaled_ && !relative_)
         scaleVector = node_->GetWorldScale();
 
+    // First advance the timers, velocities and scales of all alive particles as arrays
+    UpdateParticleArrays(particleArrays_, lastTimeStep_, relative_ ? relativeConstantForce : effect_->GetConstantForce(),
+        effect_->GetDampingForce(), scaleVector, effect_->GetSizeAdd(), effect_->GetSizeMul());
+
+    // Then apply the results to the billboards
+    bool updateSize = effect_->GetSizeAdd() != 0.0f || effect_->GetSizeMul() != 1.0f;
+    const Vector<ColorFrame>& colorFrames_ = effect_->GetColorFrames();
+    const Vector<TextureFrame>& textureFrames_ = effect_->GetTextureFrames();
+
     for (unsigned i = 0; i < particles_.Size(); ++i)
     {
         Particle& particle = particles_[i];
@@ -176,69 +295,43 @@ void ParticleEmitter::Update(const FrameInfo& frame)
             needCommit = true;
 
             // Time to live
-            if (particle.timer_ >= particle.timeToLive_)
+            if (!(particleArrays_.aliveMasks_[i >> 2] & (1 << (i & 3))))
             {
                 billboard.enabled_ = false;
                 continue;
             }
-            particle.timer_ += lastTimeStep_;
+            float timer = particleArrays_.timer_[i];
 
-            // Velocity & position
-            const Vector3& constantForce = effect_->GetConstantForce();
-            if (constantForce != Vector3::ZERO)
-            {
-                if (relative_)
-                    particle.velocity_ += lastTimeStep_ * relativeConstantForce;
-                else
-                    particle.velocity_ += lastTimeStep_ * constantForce;
-            }
-
-            float dampingForce = effect_->GetDampingForce();
-            if (dampingForce != 0.0f)
-            {
-                Vector3 force = -dampingForce * particle.velocity_;
-                particle.velocity_ += lastTimeStep_ * force;
-            }
-            billboard.position_ += lastTimeStep_ * particle.velocity_ * scaleVector;
+            // Position
+            billboard.position_ += Vector3(particleArrays_.deltaX_[i], particleArrays_.deltaY_[i], particleArrays_.deltaZ_[i]);
 
             // Rotation
-            billboard.rotation_ += lastTimeStep_ * particle.rotationSpeed_;
+            billboard.rotation_ += lastTimeStep_ * particleArrays_.rotationSpeed_[i];
 
             // Scaling
-            float sizeAdd = effect_->GetSizeAdd();
-            float sizeMul = effect_->GetSizeMul();
-            if (sizeAdd != 0.0f || sizeMul != 1.0f)
-            {
-                particle.scale_ += lastTimeStep_ * sizeAdd;
-                if (particle.scale_ < 0.0f)
-                    particle.scale_ = 0.0f;
-                if (sizeMul != 1.0f)
-                    particle.scale_ *= (lastTimeStep_ * (sizeMul - 1.0f)) + 1.0f;
-                billboard.size_ = particle.size_ * particle.scale_;
-            }
+            if (updateSize)
+                billboard.size_ = particle.size_ * particleArrays_.scale_[i];
 
             // Color interpolation
             unsigned& index = particle.colorIndex_;
-            const Vector<ColorFrame>& colorFrames_ = effect_->GetColorFrames();
             if (index < colorFrames_.Size())
             {
                 if (index < colorFrames_.Size() - 1)
                 {
-                    if (particle.timer_ >= colorFrames_[index + 1].time_)
+                    if (timer >= colorFrames_[index + 1].time_)
                         ++index;
                 }
                 if (index < colorFrames_.Size() - 1)
-                    billboard.color_ = colorFrames_[index].Interpolate(colorFrames_[index + 1], particle.timer_);
+                    billboard.color_ = colorFrames_[index].Interpolate(colorFrames_[index + 1], timer);
                 else
                     billboard.color_ = colorFrames_[index].color_;
             }
 
             // Texture animation
             unsigned& texIndex = particle.texIndex_;
-            const Vector<TextureFrame>& textureFrames_ = effect_->GetTextureFrames();
             if (textureFrames_.Size() && texIndex < textureFrames_.Size() - 1)
             {
-                if (particle.timer_ >= textureFrames_[texIndex + 1].time_)
+                if (timer >= textureFrames_[texIndex + 1].time_)
                 {
                     billboard.uv_ = textureFrames_[texIndex + 1].uv_;
                     ++texIndex;
@@ -282,6 +375,7 @@ void ParticleEmitter::SetNumParticles(unsigned num)
         num = MAX_BILLBOARDS;
 
     particles_.Resize(num);
+    particleArrays_.Resize(num);
     SetNumBillboards(num);
 }
 
@@ -310,6 +404,8 @@ void ParticleEmitter::RemoveAllParticles()
 {
     for (PODVector<Billboard>::Iterator i = billboards_.Begin(); i != billboards_.End(); ++i)
         i->enabled_ = false;
+    for (unsigned i = 0; i < particleArrays_.timeToLive_.Size(); ++i)
+        particleArrays_.timeToLive_[i] = 0.0f;
 
     Commit();
 }
@@ -350,16 +446,20 @@ void ParticleEmitter::SetParticlesAttr(const VariantVector& value)
     unsigned index = 0;
     SetNumParticles(index < value.Size() ? value[index++].GetUInt() : 0);
 
-    for (PODVector<Particle>::Iterator i = particles_.Begin(); i != particles_.End() && index < value.Size(); ++i)
+    for (unsigned i = 0; i < particles_.Size() && index < value.Size(); ++i)
     {
-        i->velocity_ = value[index++].GetVector3();
-        i->size_ = value[index++].GetVector2();
-        i->timer_ = value[index++].GetFloat();
-        i->timeToLive_ = value[index++].GetFloat();
-        i->scale_ = value[index++].GetFloat();
-        i->rotationSpeed_ = value[index++].GetFloat();
-        i->colorIndex_ = (unsigned)value[index++].GetInt();
-        i->texIndex_ = (unsigned)value[index++].GetInt();
+        Particle& particle = particles_[i];
+        Vector3 velocity = value[index++].GetVector3();
+        particleArrays_.velocityX_[i] = velocity.x_;
+        particleArrays_.velocityY_[i] = velocity.y_;
+        particleArrays_.velocityZ_[i] = velocity.z_;
+        particle.size_ = value[index++].GetVector2();
+        particleArrays_.timer_[i] = value[index++].GetFloat();
+        particleArrays_.timeToLive_[i] = value[index++].GetFloat();
+        particleArrays_.scale_[i] = value[index++].GetFloat();
+        particleArrays_.rotationSpeed_[i] = value[index++].GetFloat();
+        particle.colorIndex_ = (unsigned)value[index++].GetInt();
+        particle.texIndex_ = (unsigned)value[index++].GetInt();
     }
 }
 
@@ -374,16 +474,17 @@ VariantVector ParticleEmitter::GetParticlesAttr() const
 
     ret.Reserve(particles_.Size() * 8 + 1);
     ret.Push(particles_.Size());
-    for (PODVector<Particle>::ConstIterator i = particles_.Begin(); i != particles_.End(); ++i)
+    for (unsigned i = 0; i < particles_.Size(); ++i)
     {
-        ret.Push(i->velocity_);
-        ret.Push(i->size_);
-        ret.Push(i->timer_);
-        ret.Push(i->timeToLive_);
-        ret.Push(i->scale_);
-        ret.Push(i->rotationSpeed_);
-        ret.Push(i->colorIndex_);
-        ret.Push(i->texIndex_);
+        const Particle& particle = particles_[i];
+        ret.Push(Vector3(particleArrays_.velocityX_[i], particleArrays_.velocityY_[i], particleArrays_.velocityZ_[i]));
+        ret.Push(particle.size_);
+        ret.Push(particleArrays_.timer_[i]);
+        ret.Push(particleArrays_.timeToLive_[i]);
+        ret.Push(particleArrays_.scale_[i]);
+        ret.Push(particleArrays_.rotationSpeed_[i]);
+        ret.Push(particle.colorIndex_);
+        ret.Push(particle.texIndex_);
     }
     return ret;
 }
@@ -471,12 +572,15 @@ bool ParticleEmitter::EmitNewParticle()
         startDir = node_->GetWorldRotation() * startDir;
     };
 
-    particle.velocity_ = effect_->GetRandomVelocity() * startDir;
+    Vector3 velocity = effect_->GetRandomVelocity() * startDir;
+    particleArrays_.velocityX_[index] = velocity.x_;
+    particleArrays_.velocityY_[index] = velocity.y_;
+    particleArrays_.velocityZ_[index] = velocity.z_;
     particle.size_ = effect_->GetRandomSize();
-    particle.timer_ = 0.0f;
-    particle.timeToLive_ = effect_->GetRandomTimeToLive();
-    particle.scale_ = 1.0f;
-    particle.rotationSpeed_ = effect_->GetRandomRotationSpeed();
+    particleArrays_.timer_[index] = 0.0f;
+    particleArrays_.timeToLive_[index] = effect_->GetRandomTimeToLive();
+    particleArrays_.scale_[index] = 1.0f;
+    particleArrays_.rotationSpeed_[index] = effect_->GetRandomRotationSpeed();
     particle.colorIndex_ = 0;
     particle.texIndex_ = 0;
 
@@ -29,27 +29,71 @@ namespace Urho3D
 
 class ParticleEffect;
 
-/// One particle in the particle system.
+/// One particle in the particle system. The values updated each frame are stored in ParticleArrays.
 struct Particle
 {
-    /// Velocity.
-    Vector3 velocity_;
     /// Original billboard size.
     Vector2 size_;
-    /// Time elapsed from creation.
-    float timer_;
-    /// Lifetime.
-    float timeToLive_;
-    /// Size scaling value.
-    float scale_;
-    /// Rotation speed.
-    float rotationSpeed_;
     /// Current color animation index.
     unsigned colorIndex_;
     /// Current texture animation index.
     unsigned texIndex_;
 };
 
+/// Per-frame updated particle values stored as separate arrays for SIMD processing. The arrays are padded to a multiple of four.
+struct ParticleArrays
+{
+    /// Resize the arrays. The padding particles are initialized as not alive.
+    void Resize(unsigned num)
+    {
+        unsigned oldSize = timer_.Size();
+        unsigned newSize = (num + 3) & ~3U;
+
+        velocityX_.Resize(newSize);
+        velocityY_.Resize(newSize);
+        velocityZ_.Resize(newSize);
+        timer_.Resize(newSize);
+        timeToLive_.Resize(newSize);
+        scale_.Resize(newSize);
+        rotationSpeed_.Resize(newSize);
+        deltaX_.Resize(newSize);
+        deltaY_.Resize(newSize);
+        deltaZ_.Resize(newSize);
+        aliveMasks_.Resize(newSize >> 2);
+
+        for (unsigned i = oldSize < num ? oldSize : num; i < newSize; ++i)
+        {
+            velocityX_[i] = velocityY_[i] = velocityZ_[i] = 0.0f;
+            timer_[i] = timeToLive_[i] = 0.0f;
+            scale_[i] = 1.0f;
+            rotationSpeed_[i] = 0.0f;
+        }
+    }
+
+    /// Velocity X component.
+    PODVector<float> velocityX_;
+    /// Velocity Y component.
+    PODVector<float> velocityY_;
+    /// Velocity Z component.
+    PODVector<float> velocityZ_;
+    /// Time elapsed from creation.
+    PODVector<float> timer_;
+    /// Lifetime.
+    PODVector<float> timeToLive_;
+    /// Size scaling value.
+    PODVector<float> scale_;
+    /// Rotation speed.
+    PODVector<float> rotationSpeed_;
+    /// Position change on the last update, X component.
+    PODVector<float> deltaX_;
+    /// Position change on the last update, Y component.
+    PODVector<float> deltaY_;
+    /// Position change on the last update, Z component.
+    PODVector<float> deltaZ_;
+    /// Bitmasks of the particles that were alive on the last update, one byte per four particles.
+    PODVector<unsigned char> aliveMasks_;
+};
+
 /// %Particle emitter component.
 class URHO3D_API ParticleEmitter : public BillboardSet
 {
@@ -127,6 +171,8 @@ private:
     SharedPtr<ParticleEffect> effect_;
     /// Particles.
     PODVector<Particle> particles_;
+    /// Per-frame updated particle values.
+    ParticleArrays particleArrays_;
     /// Active/inactive period timer.
     float periodTimer_;
     /// New particle emission timer.
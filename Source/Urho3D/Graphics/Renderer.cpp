@@ -548,6 +548,34 @@ unsigned Renderer::GetNumOccluders(bool allViews) const
     return numOccluders;
 }
 
+unsigned Renderer::GetNumShadowCasterCacheHits(bool allViews) const
+{
+    unsigned numHits = 0;
+    unsigned lastView = allViews ? views_.Size() : 1;
+
+    for (unsigned i = 0; i < lastView; ++i)
+    {
+        if (views_[i])
+            numHits += views_[i]->GetNumShadowCasterCacheHits();
+    }
+
+    return numHits;
+}
+
+unsigned Renderer::GetNumShadowCasterCacheMisses(bool allViews) const
+{
+    unsigned numMisses = 0;
+    unsigned lastView = allViews ? views_.Size() : 1;
+
+    for (unsigned i = 0; i < lastView; ++i)
+    {
+        if (views_[i])
+            numMisses += views_[i]->GetNumShadowCasterCacheMisses();
+    }
+
+    return numMisses;
+}
+
 void Renderer::Update(float timeStep)
 {
     PROFILE(UpdateViews);
@@ -289,6 +289,10 @@ public:
     unsigned GetNumShadowMaps(bool allViews = false) const;
     /// Return number of occluders rendered.
     unsigned GetNumOccluders(bool allViews = false) const;
+    /// Return number of shadow caster queries served from the static drawable cache, either in the primary view or all views.
+    unsigned GetNumShadowCasterCacheHits(bool allViews = false) const;
+    /// Return number of shadow caster queries that missed the static drawable cache, either in the primary view or all views.
+    unsigned GetNumShadowCasterCacheMisses(bool allViews = false) const;
 
     /// Return the default zone.
     Zone* GetDefaultZone() const { return defaultZone_; }
@@ -24,8 +24,11 @@
 
 #include "../Core/Context.h"
 #include "../Core/Profiler.h"
+#include "../Core/Timer.h"
+#include "../Graphics/Camera.h"
 #include "../Graphics/DrawableEvents.h"
 #include "../Graphics/Geometry.h"
+#include "../Graphics/GraphicsEvents.h"
 #include "../Graphics/IndexBuffer.h"
 #include "../Graphics/Material.h"
 #include "../Graphics/Octree.h"
@@ -38,6 +41,11 @@
 #include "../Resource/ResourceEvents.h"
 #include "../Scene/Node.h"
 #include "../Scene/Scene.h"
+#include "../Scene/SceneEvents.h"
+
+#ifdef URHO3D_SSE
+#include <xmmintrin.h>
+#endif
 
 #include "../DebugNew.h"
 
@@ -55,6 +63,10 @@ static const unsigned STITCH_NORTH = 1;
 static const unsigned STITCH_SOUTH = 2;
 static const unsigned STITCH_WEST = 4;
 static const unsigned STITCH_EAST = 8;
+static const int DEFAULT_TILE_SIZE = 512;
+static const float DEFAULT_PAGE_DISTANCE = 500.0f;
+static const float PAGE_OUT_DISTANCE_FACTOR = 1.25f;
+static const unsigned MAX_PAGING_POSITIONS = 64;
 
 inline void GrowUpdateRegion(IntRect& updateRegion, int x, int y)
 {
@@ -76,6 +88,25 @@ inline void GrowUpdateRegion(IntRect& updateRegion, int x, int y)
     }
 }
 
+#ifdef URHO3D_SSE
+/// Transform four world positions to heightmap coordinates.
+static inline void TransformToHeightMap(const Matrix3x4& inverse, const Vector2& origin, const Vector3& spacing,
+    const Vector3* worldPositions, float* xPos, float* zPos)
+{
+    __m128 x = _mm_set_ps(worldPositions[3].x_, worldPositions[2].x_, worldPositions[1].x_, worldPositions[0].x_);
+    __m128 y = _mm_set_ps(worldPositions[3].y_, worldPositions[2].y_, worldPositions[1].y_, worldPositions[0].y_);
+    __m128 z = _mm_set_ps(worldPositions[3].z_, worldPositions[2].z_, worldPositions[1].z_, worldPositions[0].z_);
+
+    __m128 localX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(inverse.m00_), x), _mm_mul_ps(_mm_set1_ps(inverse.m01_), y)),
+        _mm_add_ps(_mm_mul_ps(_mm_set1_ps(inverse.m02_), z), _mm_set1_ps(inverse.m03_)));
+    __m128 localZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(inverse.m20_), x), _mm_mul_ps(_mm_set1_ps(inverse.m21_), y)),
+        _mm_add_ps(_mm_mul_ps(_mm_set1_ps(inverse.m22_), z), _mm_set1_ps(inverse.m23_)));
+
+    _mm_storeu_ps(xPos, _mm_div_ps(_mm_sub_ps(localX, _mm_set1_ps(origin.x_)), _mm_set1_ps(spacing.x_)));
+    _mm_storeu_ps(zPos, _mm_div_ps(_mm_sub_ps(localZ, _mm_set1_ps(origin.y_)), _mm_set1_ps(spacing.z_)));
+}
+#endif
+
 Terrain::Terrain(Context* context) :
     Component(context),
     indexBuffer_(new IndexBuffer(context)),
@@ -102,7 +133,13 @@ Terrain::Terrain(Context* context) :
     shadowDistance_(0.0f),
     lodBias_(1.0f),
     maxLights_(0),
-    recreateTerrain_(false)
+    recreateTerrain_(false),
+    numTiles_(IntVector2::ZERO),
+    tileSize_(DEFAULT_TILE_SIZE),
+    pageDistance_(DEFAULT_PAGE_DISTANCE),
+    numTileLoads_(0),
+    totalTileLoadTime_(0),
+    inverseWorldDirty_(true)
 {
     indexBuffer_->SetShadowed(true);
 }
@@ -123,6 +160,10 @@ void Terrain::RegisterObject(Context* context)
     ATTRIBUTE("Vertex Spacing", Vector3, spacing_, DEFAULT_SPACING, AM_DEFAULT);
     ACCESSOR_ATTRIBUTE("Patch Size", GetPatchSize, SetPatchSizeAttr, int, DEFAULT_PATCH_SIZE, AM_DEFAULT);
     ATTRIBUTE("Smooth Height Map", bool, smoothing_, false, AM_DEFAULT);
+    ATTRIBUTE("Tile Height Maps", String, tileHeightMaps_, String::EMPTY, AM_DEFAULT);
+    ATTRIBUTE("Number of Tiles", IntVector2, numTiles_, IntVector2::ZERO, AM_DEFAULT);
+    ATTRIBUTE("Tile Size", int, tileSize_, DEFAULT_TILE_SIZE, AM_DEFAULT);
+    ACCESSOR_ATTRIBUTE("Page Distance", GetPageDistance, SetPageDistance, float, DEFAULT_PAGE_DISTANCE, AM_DEFAULT);
     ACCESSOR_ATTRIBUTE("Is Occluder", IsOccluder, SetOccluder, bool, false, AM_DEFAULT);
     ACCESSOR_ATTRIBUTE("Can Be Occluded", IsOccludee, SetOccludee, bool, true, AM_DEFAULT);
     ACCESSOR_ATTRIBUTE("Cast Shadows", GetCastShadows, SetCastShadows, bool, false, AM_DEFAULT);
@@ -162,6 +203,26 @@ void Terrain::OnSetEnabled()
     }
 }
 
+void Terrain::OnNodeSet(Node* node)
+{
+    if (node)
+        node->AddListener(this);
+
+    inverseWorldDirty_ = true;
+}
+
+void Terrain::OnMarkedDirty(Node* node)
+{
+    inverseWorldDirty_ = true;
+}
+
+void Terrain::OnSceneSet(Scene* scene)
+{
+    Component::OnSceneSet(scene);
+
+    UpdatePagingSubscription();
+}
+
 void Terrain::SetPatchSize(int size)
 {
     if (size < MIN_PATCH_SIZE || size > MAX_PATCH_SIZE || !IsPowerOfTwo((unsigned)size))
@@ -356,6 +417,52 @@ void Terrain::ApplyHeightMap()
         CreateGeometry();
 }
 
+void Terrain::SetTileHeightMaps(const String& name)
+{
+    if (name != tileHeightMaps_)
+    {
+        tileHeightMaps_ = name;
+
+        CreateGeometry();
+        MarkNetworkUpdate();
+    }
+}
+
+void Terrain::SetNumTiles(const IntVector2& numTiles)
+{
+    if (numTiles != numTiles_)
+    {
+        numTiles_ = numTiles;
+
+        CreateGeometry();
+        MarkNetworkUpdate();
+    }
+}
+
+void Terrain::SetTileSize(int size)
+{
+    if (size != tileSize_)
+    {
+        tileSize_ = size;
+
+        CreateGeometry();
+        MarkNetworkUpdate();
+    }
+}
+
+void Terrain::SetPageDistance(float distance)
+{
+    pageDistance_ = Max(distance, 0.0f);
+
+    MarkNetworkUpdate();
+}
+
+void Terrain::AddPagingPosition(const Vector3& worldPosition)
+{
+    if (IsPaged())
+        pagingPositions_.Push(worldPosition);
+}
+
 Image* Terrain::GetHeightMap() const
 {
     return heightMap_;
@@ -383,7 +490,7 @@ float Terrain::GetHeight(const Vector3& worldPosition) const
 {
     if (node_)
     {
-        Vector3 position = node_->GetWorldTransform().Inverse() * worldPosition;
+        Vector3 position = GetInverseWorldTransform() * worldPosition;
         float xPos = (position.x_ - patchWorldOrigin_.x_) / spacing_.x_;
         float zPos = (position.z_ - patchWorldOrigin_.y_) / spacing_.z_;
         float xFrac = xPos - floorf(xPos);
@@ -417,7 +524,7 @@ Vector3 Terrain::GetNormal(const Vector3& worldPosition) const
 {
     if (node_)
     {
-        Vector3 position = node_->GetWorldTransform().Inverse() * worldPosition;
+        Vector3 position = GetInverseWorldTransform() * worldPosition;
         float xPos = (position.x_ - patchWorldOrigin_.x_) / spacing_.x_;
         float zPos = (position.z_ - patchWorldOrigin_.y_) / spacing_.z_;
         float xFrac = xPos - floorf(xPos);
@@ -446,12 +553,253 @@ Vector3 Terrain::GetNormal(const Vector3& worldPosition) const
         return Vector3::UP;
 }
 
+void Terrain::GetHeights(const Vector3* worldPositions, float* heights, unsigned count) const
+{
+    if (!node_)
+    {
+        for (unsigned i = 0; i < count; ++i)
+            heights[i] = 0.0f;
+        return;
+    }
+
+    unsigned i = 0;
+
+#ifdef URHO3D_SSE
+    const Matrix3x4& inverse = GetInverseWorldTransform();
+    /// \todo This assumes that the terrain scene node is upright
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scaleY = _mm_set1_ps(node_->GetWorldScale().y_);
+    const __m128 offsetY = _mm_set1_ps(node_->GetWorldPosition().y_);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        float xPos[4], zPos[4], xFrac[4], zFrac[4], h1[4], h2[4], h3[4];
+        TransformToHeightMap(inverse, patchWorldOrigin_, spacing_, worldPositions + i, xPos, zPos);
+
+        // Choose the triangle and fetch its corner heights per position
+        for (unsigned j = 0; j < 4; ++j)
+        {
+            float xFloor = floorf(xPos[j]);
+            float zFloor = floorf(zPos[j]);
+            int x = (int)xFloor;
+            int z = (int)zFloor;
+            xFrac[j] = xPos[j] - xFloor;
+            zFrac[j] = zPos[j] - zFloor;
+
+            if (xFrac[j] + zFrac[j] >= 1.0f)
+            {
+                h1[j] = GetRawHeight(x + 1, z + 1);
+                h2[j] = GetRawHeight(x, z + 1);
+                h3[j] = GetRawHeight(x + 1, z);
+                xFrac[j] = 1.0f - xFrac[j];
+                zFrac[j] = 1.0f - zFrac[j];
+            }
+            else
+            {
+                h1[j] = GetRawHeight(x, z);
+                h2[j] = GetRawHeight(x + 1, z);
+                h3[j] = GetRawHeight(x, z + 1);
+            }
+        }
+
+        __m128 xf = _mm_loadu_ps(xFrac);
+        __m128 zf = _mm_loadu_ps(zFrac);
+        __m128 h = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(h1), _mm_sub_ps(_mm_sub_ps(one, xf), zf)),
+            _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(h2), xf), _mm_mul_ps(_mm_loadu_ps(h3), zf)));
+        _mm_storeu_ps(heights + i, _mm_add_ps(_mm_mul_ps(h, scaleY), offsetY));
+    }
+#endif
+
+    for (; i < count; ++i)
+        heights[i] = GetHeight(worldPositions[i]);
+}
+
+void Terrain::GetHeights(const PODVector<Vector3>& worldPositions, PODVector<float>& heights) const
+{
+    heights.Resize(worldPositions.Size());
+    if (worldPositions.Size())
+        GetHeights(&worldPositions[0], &heights[0], worldPositions.Size());
+}
+
+void Terrain::GetNormals(const Vector3* worldPositions, Vector3* normals, unsigned count) const
+{
+    if (!node_)
+    {
+        for (unsigned i = 0; i < count; ++i)
+            normals[i] = Vector3::UP;
+        return;
+    }
+
+    unsigned i = 0;
+
+#ifdef URHO3D_SSE
+    const Matrix3x4& inverse = GetInverseWorldTransform();
+    Matrix3 rotation = node_->GetWorldRotation().RotationMatrix();
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        float xPos[4], zPos[4], xFrac[4], zFrac[4];
+        float n1[3][4], n2[3][4], n3[3][4];
+        TransformToHeightMap(inverse, patchWorldOrigin_, spacing_, worldPositions + i, xPos, zPos);
+
+        // Choose the triangle and calculate its corner normals per position, stored as separate X, Y and Z arrays
+        for (unsigned j = 0; j < 4; ++j)
+        {
+            float xFloor = floorf(xPos[j]);
+            float zFloor = floorf(zPos[j]);
+            int x = (int)xFloor;
+            int z = (int)zFloor;
+            xFrac[j] = xPos[j] - xFloor;
+            zFrac[j] = zPos[j] - zFloor;
+            Vector3 c1, c2, c3;
+
+            if (xFrac[j] + zFrac[j] >= 1.0f)
+            {
+                c1 = GetRawNormal(x + 1, z + 1);
+                c2 = GetRawNormal(x, z + 1);
+                c3 = GetRawNormal(x + 1, z);
+                xFrac[j] = 1.0f - xFrac[j];
+                zFrac[j] = 1.0f - zFrac[j];
+            }
+            else
+            {
+                c1 = GetRawNormal(x, z);
+                c2 = GetRawNormal(x + 1, z);
+                c3 = GetRawNormal(x, z + 1);
+            }
+
+            for (unsigned k = 0; k < 3; ++k)
+            {
+                n1[k][j] = c1.Data()[k];
+                n2[k][j] = c2.Data()[k];
+                n3[k][j] = c3.Data()[k];
+            }
+        }
+
+        __m128 xf = _mm_loadu_ps(xFrac);
+        __m128 zf = _mm_loadu_ps(zFrac);
+        __m128 w1 = _mm_sub_ps(_mm_sub_ps(one, xf), zf);
+        __m128 n[3];
+        for (unsigned k = 0; k < 3; ++k)
+        {
+            n[k] = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(n1[k]), w1),
+                _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(n2[k]), xf), _mm_mul_ps(_mm_loadu_ps(n3[k]), zf)));
+        }
+
+        // Normalize, then rotate to world space
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(n[0], n[0]), _mm_mul_ps(n[1], n[1])),
+            _mm_mul_ps(n[2], n[2])));
+        for (unsigned k = 0; k < 3; ++k)
+            n[k] = _mm_div_ps(n[k], length);
+
+        float result[3][4];
+        for (unsigned k = 0; k < 3; ++k)
+        {
+            __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(rotation.Data()[k * 3]), n[0]),
+                _mm_mul_ps(_mm_set1_ps(rotation.Data()[k * 3 + 1]), n[1])), _mm_mul_ps(_mm_set1_ps(rotation.Data()[k * 3 + 2]), n[2]));
+            _mm_storeu_ps(result[k], r);
+        }
+
+        for (unsigned j = 0; j < 4; ++j)
+            normals[i + j] = Vector3(result[0][j], result[1][j], result[2][j]);
+    }
+#endif
+
+    for (; i < count; ++i)
+        normals[i] = GetNormal(worldPositions[i]);
+}
+
+void Terrain::GetNormals(const PODVector<Vector3>& worldPositions, PODVector<Vector3>& normals) const
+{
+    normals.Resize(worldPositions.Size());
+    if (worldPositions.Size())
+        GetNormals(&worldPositions[0], &normals[0], worldPositions.Size());
+}
+
+const Matrix3x4& Terrain::GetInverseWorldTransform() const
+{
+    if (inverseWorldDirty_)
+    {
+        inverseWorld_ = node_ ? node_->GetWorldTransform().Inverse() : Matrix3x4::IDENTITY;
+        inverseWorldDirty_ = false;
+    }
+
+    return inverseWorld_;
+}
+
+bool Terrain::IsResident(const Vector3& worldPosition) const
+{
+    if (!IsPaged())
+        return true;
+    if (!node_)
+        return false;
+
+    Vector3 position = GetInverseWorldTransform() * worldPosition;
+    int xPos = Clamp((int)((position.x_ - patchWorldOrigin_.x_) / spacing_.x_), 0, numVertices_.x_ - 1);
+    int zPos = Clamp((int)((position.z_ - patchWorldOrigin_.y_) / spacing_.z_), 0, numVertices_.y_ - 1);
+    return GetTileHeights(Min(xPos / tileSize_, numTiles_.x_ - 1), Min(zPos / tileSize_, numTiles_.y_ - 1)) != 0;
+}
+
+unsigned Terrain::GetNumResidentTiles() const
+{
+    unsigned num = 0;
+    for (unsigned i = 0; i < tiles_.Size(); ++i)
+    {
+        if (tiles_[i].heightData_)
+            ++num;
+    }
+
+    return num;
+}
+
+unsigned Terrain::GetNumLoadingTiles() const
+{
+    unsigned num = 0;
+    for (unsigned i = 0; i < tiles_.Size(); ++i)
+    {
+        if (tiles_[i].loading_)
+            ++num;
+    }
+
+    return num;
+}
+
+unsigned Terrain::GetHeightDataMemory() const
+{
+    if (IsPaged())
+    {
+        unsigned tileRow = (unsigned)(tileSize_ + 1);
+        return GetNumResidentTiles() * tileRow * tileRow * sizeof(float);
+    }
+
+    unsigned dataSize = (unsigned)(numVertices_.x_ * numVertices_.y_) * sizeof(float);
+    return heightData_ ? (sourceHeightData_ ? 2 * dataSize : dataSize) : 0;
+}
+
+unsigned Terrain::GetPatchGeometryMemory() const
+{
+    unsigned memory = 0;
+    for (unsigned i = 0; i < patches_.Size(); ++i)
+    {
+        TerrainPatch* patch = patches_[i];
+        if (patch)
+        {
+            // Count both the GPU vertex data and the CPU-side positions used for raycasts and occlusion
+            VertexBuffer* vertexBuffer = patch->GetVertexBuffer();
+            memory += vertexBuffer->GetVertexCount() * (vertexBuffer->GetVertexSize() + sizeof(Vector3));
+        }
+    }
+
+    return memory;
+}
+
 IntVector2 Terrain::WorldToHeightMap(const Vector3& worldPosition) const
 {
     if (!node_)
         return IntVector2::ZERO;
 
-    Vector3 position = node_->GetWorldTransform().Inverse() * worldPosition;
+    Vector3 position = GetInverseWorldTransform() * worldPosition;
     int xPos = (int)((position.x_ - patchWorldOrigin_.x_) / spacing_.x_);
     int zPos = (int)((position.z_ - patchWorldOrigin_.y_) / spacing_.z_);
     Clamp(xPos, 0, numVertices_.x_);
@@ -634,6 +982,27 @@ void Terrain::CreateGeometry()
     patchWorldSize_ = Vector2(spacing_.x_ * (float)patchSize_, spacing_.z_ * (float)patchSize_);
     bool updateAll = false;
 
+    // In paged mode the patches are created on demand as the heightmap tiles are loaded
+    if (!tileHeightMaps_.Empty())
+    {
+        if (numTiles_.x_ > 0 && numTiles_.y_ > 0 && tileSize_ >= patchSize_ && !(tileSize_ % patchSize_))
+        {
+            CreatePagedGeometry();
+
+            using namespace TerrainCreated;
+
+            VariantMap& eventData = GetEventDataMap();
+            eventData[P_NODE] = node_;
+            node_->SendEvent(E_TERRAINCREATED, eventData);
+            return;
+        }
+        else
+            LOGERROR("Terrain tile size must be a multiple of the patch size and number of tiles must be positive for paging");
+    }
+
+    if (IsPaged())
+        ClearTiles();
+
     if (heightMap_)
     {
         numPatches_ = IntVector2((heightMap_->GetWidth() - 1) / patchSize_, (heightMap_->GetHeight() - 1) / patchSize_);
@@ -786,8 +1155,6 @@ void Terrain::CreateGeometry()
 
         patches_.Reserve((unsigned)(numPatches_.x_ * numPatches_.y_));
 
-        bool enabled = IsEnabledEffective();
-
         {
             PROFILE(CreatePatches);
 
@@ -795,46 +1162,7 @@ void Terrain::CreateGeometry()
             for (int z = 0; z < numPatches_.y_; ++z)
             {
                 for (int x = 0; x < numPatches_.x_; ++x)
-                {
-                    String nodeName = "Patch_" + String(x) + "_" + String(z);
-                    Node* patchNode = node_->GetChild(nodeName);
-
-                    if (!patchNode)
-                    {
-                        // Create the patch scene node as local and temporary so that it is not unnecessarily serialized to either
-                        // file or replicated over the network
-                        patchNode = node_->CreateChild(nodeName, LOCAL);
-                        patchNode->SetTemporary(true);
-                    }
-
-                    patchNode->SetPosition(Vector3(patchWorldOrigin_.x_ + (float)x * patchWorldSize_.x_, 0.0f,
-                        patchWorldOrigin_.y_ + (float)z * patchWorldSize_.y_));
-
-                    TerrainPatch* patch = patchNode->GetComponent<TerrainPatch>();
-                    if (!patch)
-                    {
-                        patch = patchNode->CreateComponent<TerrainPatch>();
-                        patch->SetOwner(this);
-                        patch->SetCoordinates(IntVector2(x, z));
-
-                        // Copy initial drawable parameters
-                        patch->SetEnabled(enabled);
-                        patch->SetMaterial(material_);
-                        patch->SetDrawDistance(drawDistance_);
-                        patch->SetShadowDistance(shadowDistance_);
-                        patch->SetLodBias(lodBias_);
-                        patch->SetViewMask(viewMask_);
-                        patch->SetLightMask(lightMask_);
-                        patch->SetShadowMask(shadowMask_);
-                        patch->SetZoneMask(zoneMask_);
-                        patch->SetMaxLights(maxLights_);
-                        patch->SetCastShadows(castShadows_);
-                        patch->SetOccluder(occluder_);
-                        patch->SetOccludee(occludee_);
-                    }
-
-                    patches_.Push(WeakPtr<TerrainPatch>(patch));
-                }
+                    patches_.Push(WeakPtr<TerrainPatch>(CreatePatch(x, z)));
             }
         }
 
@@ -900,6 +1228,104 @@ void Terrain::CreateGeometry()
     }
 }
 
+void Terrain::CreatePagedGeometry()
+{
+    PROFILE(CreatePagedTerrain);
+
+    // Remove all previous patches and tiles. Note that pending background loads can not be cancelled; they are ignored
+    PODVector<Node*> oldPatchNodes;
+    node_->GetChildrenWithComponent<TerrainPatch>(oldPatchNodes);
+    for (PODVector<Node*>::Iterator i = oldPatchNodes.Begin(); i != oldPatchNodes.End(); ++i)
+        node_->RemoveChild(*i);
+
+    tiles_.Clear();
+    tileRequests_.Clear();
+    tilesToActivate_.Clear();
+    heightData_.Reset();
+    sourceHeightData_.Reset();
+
+    int patchesPerTile = tileSize_ / patchSize_;
+    numPatches_ = IntVector2(numTiles_.x_ * patchesPerTile, numTiles_.y_ * patchesPerTile);
+    numVertices_ = IntVector2(numPatches_.x_ * patchSize_ + 1, numPatches_.y_ * patchSize_ + 1);
+    patchWorldOrigin_ =
+        Vector2(-0.5f * (float)numPatches_.x_ * patchWorldSize_.x_, -0.5f * (float)numPatches_.y_ * patchWorldSize_.y_);
+
+    // Force full regeneration if paging is later disabled
+    lastNumVertices_ = IntVector2::ZERO;
+    lastPatchSize_ = patchSize_;
+    lastSpacing_ = spacing_;
+
+    tiles_.Resize((unsigned)(numTiles_.x_ * numTiles_.y_));
+    patches_.Clear();
+    patches_.Resize((unsigned)(numPatches_.x_ * numPatches_.y_));
+    numTileLoads_ = 0;
+    totalTileLoadTime_ = 0;
+
+    CreateIndexData();
+    UpdatePagingSubscription();
+}
+
+void Terrain::ClearTiles()
+{
+    // Remove the paged patches, as the non-paged update only creates geometry for the patches it considers changed
+    for (unsigned i = 0; i < patches_.Size(); ++i)
+    {
+        if (patches_[i])
+            node_->RemoveChild(patches_[i]->GetNode());
+    }
+
+    patches_.Clear();
+    tiles_.Clear();
+    tileRequests_.Clear();
+    tilesToActivate_.Clear();
+    pagingPositions_.Clear();
+    ReleaseTileImages();
+
+    UpdatePagingSubscription();
+}
+
+TerrainPatch* Terrain::CreatePatch(int x, int z)
+{
+    String nodeName = "Patch_" + String(x) + "_" + String(z);
+    Node* patchNode = node_->GetChild(nodeName);
+
+    if (!patchNode)
+    {
+        // Create the patch scene node as local and temporary so that it is not unnecessarily serialized to either
+        // file or replicated over the network
+        patchNode = node_->CreateChild(nodeName, LOCAL);
+        patchNode->SetTemporary(true);
+    }
+
+    patchNode->SetPosition(Vector3(patchWorldOrigin_.x_ + (float)x * patchWorldSize_.x_, 0.0f,
+        patchWorldOrigin_.y_ + (float)z * patchWorldSize_.y_));
+
+    TerrainPatch* patch = patchNode->GetComponent<TerrainPatch>();
+    if (!patch)
+    {
+        patch = patchNode->CreateComponent<TerrainPatch>();
+        patch->SetOwner(this);
+        patch->SetCoordinates(IntVector2(x, z));
+
+        // Copy initial drawable parameters
+        patch->SetEnabled(IsEnabledEffective());
+        patch->SetMaterial(material_);
+        patch->SetDrawDistance(drawDistance_);
+        patch->SetShadowDistance(shadowDistance_);
+        patch->SetLodBias(lodBias_);
+        patch->SetViewMask(viewMask_);
+        patch->SetLightMask(lightMask_);
+        patch->SetShadowMask(shadowMask_);
+        patch->SetZoneMask(zoneMask_);
+        patch->SetMaxLights(maxLights_);
+        patch->SetCastShadows(castShadows_);
+        patch->SetOccluder(occluder_);
+        patch->SetOccludee(occludee_);
+    }
+
+    return patch;
+}
+
 void Terrain::CreateIndexData()
 {
     PROFILE(CreateIndexData);
@@ -1063,13 +1489,62 @@ void Terrain::CreateIndexData()
 float Terrain::GetRawHeight(int x, int z) const
 {
     if (!heightData_)
-        return 0.0f;
+        return IsPaged() ? GetPagedHeight(x, z) : 0.0f;
 
     x = Clamp(x, 0, numVertices_.x_ - 1);
     z = Clamp(z, 0, numVertices_.y_ - 1);
     return heightData_[z * numVertices_.x_ + x];
 }
 
+float Terrain::GetPagedHeight(int x, int z) const
+{
+    x = Clamp(x, 0, numVertices_.x_ - 1);
+    z = Clamp(z, 0, numVertices_.y_ - 1);
+    int tileX = Min(x / tileSize_, numTiles_.x_ - 1);
+    int tileZ = Min(z / tileSize_, numTiles_.y_ - 1);
+    const float* heights = GetTileHeights(tileX, tileZ);
+
+    // If the tile is not resident, clamp to the edge of the closest resident neighbor tile. This keeps the normals at the
+    // border of the resident area similar to the edge of a non-paged terrain
+    if (!heights)
+    {
+        int nearX = 2 * (x - tileX * tileSize_) < tileSize_ ? tileX - 1 : tileX + 1;
+        int nearZ = 2 * (z - tileZ * tileSize_) < tileSize_ ? tileZ - 1 : tileZ + 1;
+        int edgeX = Clamp(x, nearX * tileSize_, (nearX + 1) * tileSize_);
+        int edgeZ = Clamp(z, nearZ * tileSize_, (nearZ + 1) * tileSize_);
+
+        if ((heights = GetTileHeights(nearX, tileZ)) != 0)
+        {
+            x = edgeX;
+            tileX = nearX;
+        }
+        else if ((heights = GetTileHeights(tileX, nearZ)) != 0)
+        {
+            z = edgeZ;
+            tileZ = nearZ;
+        }
+        else if ((heights = GetTileHeights(nearX, nearZ)) != 0)
+        {
+            x = edgeX;
+            z = edgeZ;
+            tileX = nearX;
+            tileZ = nearZ;
+        }
+        else
+            return 0.0f;
+    }
+
+    return heights[(z - tileZ * tileSize_) * (tileSize_ + 1) + x - tileX * tileSize_];
+}
+
+const float* Terrain::GetTileHeights(int x, int z) const
+{
+    if (x < 0 || x >= numTiles_.x_ || z < 0 || z >= numTiles_.y_)
+        return 0;
+    else
+        return tiles_[z * numTiles_.x_ + x].heightData_.Get();
+}
+
 float Terrain::GetSourceHeight(int x, int z) const
 {
     if (!sourceHeightData_)
@@ -1206,4 +1681,312 @@ void Terrain::HandleHeightMapReloadFinished(StringHash eventType, VariantMap& ev
     CreateGeometry();
 }
 
+void Terrain::UpdatePagingSubscription()
+{
+    Scene* scene = GetScene();
+
+    if (scene && IsPaged())
+    {
+        SubscribeToEvent(scene, E_SCENEPOSTUPDATE, HANDLER(Terrain, HandleScenePostUpdate));
+        SubscribeToEvent(E_BEGINVIEWUPDATE, HANDLER(Terrain, HandleBeginViewUpdate));
+        SubscribeToEvent(GetSubsystem<ResourceCache>(), E_RESOURCEBACKGROUNDLOADED,
+            HANDLER(Terrain, HandleTileBackgroundLoaded));
+    }
+    else
+    {
+        UnsubscribeFromEvent(E_SCENEPOSTUPDATE);
+        UnsubscribeFromEvent(E_BEGINVIEWUPDATE);
+        UnsubscribeFromEvent(E_RESOURCEBACKGROUNDLOADED);
+    }
+}
+
+void Terrain::UpdatePaging()
+{
+    if (!node_ || !IsPaged())
+        return;
+
+    PROFILE(UpdateTerrainPaging);
+
+    ReleaseTileImages();
+
+    // If no paging positions (for example no views rendered), keep the current tiles
+    if (pagingPositions_.Size())
+    {
+        Matrix3x4 inverseWorld = node_->GetWorldTransform().Inverse();
+        Vector3 scale = node_->GetWorldScale();
+        for (unsigned i = 0; i < pagingPositions_.Size(); ++i)
+            pagingPositions_[i] = inverseWorld * pagingPositions_[i];
+
+        Vector2 tileWorldSize((float)tileSize_ * spacing_.x_, (float)tileSize_ * spacing_.z_);
+        float pageOutDistance = pageDistance_ * PAGE_OUT_DISTANCE_FACTOR;
+
+        for (int z = 0; z < numTiles_.y_; ++z)
+        {
+            for (int x = 0; x < numTiles_.x_; ++x)
+            {
+                Vector2 tileMin(patchWorldOrigin_.x_ + (float)x * tileWorldSize.x_, patchWorldOrigin_.y_ + (float)z *
+                    tileWorldSize.y_);
+                Vector2 tileMax = tileMin + tileWorldSize;
+
+                // Find the horizontal distance from the closest paging position to the tile rectangle
+                float distance = M_INFINITY;
+                for (unsigned i = 0; i < pagingPositions_.Size(); ++i)
+                {
+                    const Vector3& position = pagingPositions_[i];
+                    float dx = Max(Max(tileMin.x_ - position.x_, position.x_ - tileMax.x_), 0.0f) * scale.x_;
+                    float dz = Max(Max(tileMin.y_ - position.z_, position.z_ - tileMax.y_), 0.0f) * scale.z_;
+                    distance = Min(distance, sqrtf(dx * dx + dz * dz));
+                }
+
+                unsigned index = (unsigned)(z * numTiles_.x_ + x);
+                TerrainTile& tile = tiles_[index];
+                if (distance <= pageDistance_)
+                {
+                    if (!tile.heightData_ && !tile.loading_ && !tile.failed_)
+                        RequestTile(index);
+                }
+                else if (distance > pageOutDistance && (tile.heightData_ || tile.loading_))
+                    ReleaseTile(index);
+            }
+        }
+
+        pagingPositions_.Clear();
+    }
+
+    // Create the patches of one loaded tile per frame to limit the time spent on geometry generation
+    while (tilesToActivate_.Size())
+    {
+        unsigned index = tilesToActivate_.Front();
+        tilesToActivate_.Erase(0);
+
+        TerrainTile& tile = tiles_[index];
+        if (tile.loading_ && tile.heightData_)
+        {
+            CreateTilePatches(index);
+            break;
+        }
+    }
+}
+
+String Terrain::GetTileName(int x, int z) const
+{
+    return tileHeightMaps_.Replaced("{X}", String(x)).Replaced("{Z}", String(z));
+}
+
+void Terrain::RequestTile(unsigned index)
+{
+    ResourceCache* cache = GetSubsystem<ResourceCache>();
+    String name = cache->SanitateResourceName(GetTileName(index % numTiles_.x_, index / numTiles_.x_));
+
+    TerrainTile& tile = tiles_[index];
+    tile.loading_ = true;
+    tile.requestTime_ = Time::GetSystemTime();
+
+    // If the image is already loaded, use it immediately. Otherwise wait for the background load to finish. If it is already
+    // queued by someone else the event will still be received
+    Image* image = cache->GetExistingResource<Image>(name);
+    if (image)
+        FinishTileLoad(index, image);
+    else
+    {
+        tileRequests_[StringHash(name)] = index;
+        cache->BackgroundLoadResource<Image>(name);
+    }
+}
+
+void Terrain::FinishTileLoad(unsigned index, Image* image)
+{
+    TerrainTile& tile = tiles_[index];
+
+    // Check if the tile was paged out while loading
+    if (tile.loading_)
+    {
+        if (!image)
+        {
+            tile.loading_ = false;
+            tile.failed_ = true;
+        }
+        else if (image->IsCompressed() || image->GetWidth() != tileSize_ + 1 || image->GetHeight() != tileSize_ + 1)
+        {
+            LOGERROR("Terrain heightmap tile " + image->GetName() + " must be uncompressed and " + String(tileSize_ + 1) +
+                " pixels square");
+            tile.loading_ = false;
+            tile.failed_ = true;
+        }
+        else
+        {
+            PROFILE(CopyTileHeightData);
+
+            unsigned row = (unsigned)(tileSize_ + 1);
+            const unsigned char* src = image->GetData();
+            unsigned imgComps = image->GetComponents();
+            unsigned imgRow = row * imgComps;
+
+            tile.heightData_ = new float[row * row];
+            float* dest = tile.heightData_;
+
+            // As with a full heightmap, north is at the top of the image and the green channel adds accuracy if available
+            for (unsigned z = 0; z < row; ++z)
+            {
+                const unsigned char* srcRow = src + imgRow * (row - 1 - z);
+                for (unsigned x = 0; x < row; ++x)
+                {
+                    if (imgComps == 1)
+                        *dest++ = (float)srcRow[x] * spacing_.y_;
+                    else
+                        *dest++ = ((float)srcRow[imgComps * x] + (float)srcRow[imgComps * x + 1] / 256.0f) * spacing_.y_;
+                }
+            }
+
+            tilesToActivate_.Push(index);
+        }
+    }
+
+    // The heights have been copied, so the image does not need to stay in the resource cache. A background loaded image is
+    // added to the cache only after the loaded event, so release it on the next update
+    if (image)
+        tileImagesToRelease_.Push(image->GetName());
+}
+
+void Terrain::CreateTilePatches(unsigned index)
+{
+    PROFILE(CreateTilePatches);
+
+    int patchesPerTile = tileSize_ / patchSize_;
+    int startX = (int)(index % numTiles_.x_) * patchesPerTile;
+    int startZ = (int)(index / numTiles_.x_) * patchesPerTile;
+    int endX = startX + patchesPerTile;
+    int endZ = startZ + patchesPerTile;
+
+    for (int z = startZ; z < endZ; ++z)
+    {
+        for (int x = startX; x < endX; ++x)
+        {
+            TerrainPatch* patch = CreatePatch(x, z);
+            patches_[z * numPatches_.x_ + x] = patch;
+            CreatePatchGeometry(patch);
+            CalculateLodErrors(patch);
+        }
+    }
+
+    // Regenerate the bordering patches of the neighbor tiles, as their normals depend on this tile's heights. Then update
+    // neighbor links for LOD stitching
+    for (int z = startZ - 1; z <= endZ; ++z)
+    {
+        for (int x = startX - 1; x <= endX; ++x)
+        {
+            TerrainPatch* patch = GetPatch(x, z);
+            if (!patch)
+                continue;
+
+            if (x < startX || x >= endX || z < startZ || z >= endZ)
+                CreatePatchGeometry(patch);
+            SetNeighbors(patch);
+        }
+    }
+
+    TerrainTile& tile = tiles_[index];
+    tile.loading_ = false;
+    totalTileLoadTime_ += Time::GetSystemTime() - tile.requestTime_;
+    ++numTileLoads_;
+}
+
+void Terrain::ReleaseTile(unsigned index)
+{
+    int patchesPerTile = tileSize_ / patchSize_;
+    int startX = (int)(index % numTiles_.x_) * patchesPerTile;
+    int startZ = (int)(index / numTiles_.x_) * patchesPerTile;
+    int endX = startX + patchesPerTile;
+    int endZ = startZ + patchesPerTile;
+    bool hadPatches = false;
+
+    for (int z = startZ; z < endZ; ++z)
+    {
+        for (int x = startX; x < endX; ++x)
+        {
+            WeakPtr<TerrainPatch>& patch = patches_[z * numPatches_.x_ + x];
+            if (patch)
+            {
+                node_->RemoveChild(patch->GetNode());
+                patch.Reset();
+                hadPatches = true;
+            }
+        }
+    }
+
+    TerrainTile& tile = tiles_[index];
+    tile.heightData_.Reset();
+    tile.loading_ = false;
+
+    if (!hadPatches)
+        return;
+
+    // Regenerate the bordering patches of the neighbor tiles, as their normals no longer use this tile's heights, and unlink
+    // them from the removed patches for LOD stitching
+    for (int z = startZ - 1; z <= endZ; ++z)
+    {
+        for (int x = startX - 1; x <= endX; ++x)
+        {
+            if (x >= startX && x < endX && z >= startZ && z < endZ)
+                continue;
+
+            TerrainPatch* patch = GetPatch(x, z);
+            if (patch)
+            {
+                CreatePatchGeometry(patch);
+                SetNeighbors(patch);
+            }
+        }
+    }
+}
+
+void Terrain::ReleaseTileImages()
+{
+    if (tileImagesToRelease_.Empty())
+        return;
+
+    ResourceCache* cache = GetSubsystem<ResourceCache>();
+    for (unsigned i = 0; i < tileImagesToRelease_.Size(); ++i)
+        cache->ReleaseResource(Image::GetTypeStatic(), tileImagesToRelease_[i]);
+    tileImagesToRelease_.Clear();
+}
+
+void Terrain::HandleScenePostUpdate(StringHash eventType, VariantMap& eventData)
+{
+    UpdatePaging();
+}
+
+void Terrain::HandleBeginViewUpdate(StringHash eventType, VariantMap& eventData)
+{
+    using namespace BeginViewUpdate;
+
+    // Record the positions of the cameras rendering this scene for the next paging update. If the scene is not being updated,
+    // only keep the latest positions
+    if (GetScene() != eventData[P_SCENE].GetPtr())
+        return;
+
+    Camera* camera = static_cast<Camera*>(eventData[P_CAMERA].GetPtr());
+    if (camera && camera->GetNode())
+    {
+        if (pagingPositions_.Size() >= MAX_PAGING_POSITIONS)
+            pagingPositions_.Erase(0);
+        pagingPositions_.Push(camera->GetNode()->GetWorldPosition());
+    }
+}
+
+void Terrain::HandleTileBackgroundLoaded(StringHash eventType, VariantMap& eventData)
+{
+    using namespace ResourceBackgroundLoaded;
+
+    HashMap<StringHash, unsigned>::Iterator i = tileRequests_.Find(StringHash(eventData[P_RESOURCENAME].GetString()));
+    if (i == tileRequests_.End())
+        return;
+
+    unsigned index = i->second_;
+    tileRequests_.Erase(i);
+
+    Image* image = eventData[P_SUCCESS].GetBool() ? static_cast<Image*>(eventData[P_RESOURCE].GetPtr()) : 0;
+    FinishTileLoad(index, image);
+}
+
 }
@@ -33,6 +33,27 @@ class Material;
 class Node;
 class TerrainPatch;
 
+/// Heightmap tile of a paged terrain.
+struct TerrainTile
+{
+    /// Construct.
+    TerrainTile() :
+        requestTime_(0),
+        loading_(false),
+        failed_(false)
+    {
+    }
+
+    /// Height data, or null if the tile is not resident.
+    SharedArrayPtr<float> heightData_;
+    /// Time in milliseconds when the tile was requested.
+    unsigned requestTime_;
+    /// Loading flag. Remains set until the patch geometry has been created.
+    bool loading_;
+    /// Load failed flag. The tile is not requested again until the terrain is recreated.
+    bool failed_;
+};
+
 /// Heightmap terrain component.
 class URHO3D_API Terrain : public Component
 {
@@ -52,6 +73,12 @@ public:
     virtual void ApplyAttributes();
     /// Handle enabled/disabled state change.
     virtual void OnSetEnabled();
+    /// Handle scene being assigned.
+    virtual void OnSceneSet(Scene* scene);
+    /// Handle scene node being assigned.
+    virtual void OnNodeSet(Node* node);
+    /// Handle scene node transform dirtied.
+    virtual void OnMarkedDirty(Node* node);
 
     /// Set patch quads per side. Must be a power of two.
     void SetPatchSize(int size);
@@ -87,6 +114,16 @@ public:
     void SetOccludee(bool enable);
     /// Apply changes from the heightmap image.
     void ApplyHeightMap();
+    /// Set heightmap tile resource name for paged mode. {X} and {Z} are replaced with the tile coordinates. Empty disables paging.
+    void SetTileHeightMaps(const String& name);
+    /// Set number of heightmap tiles for paged mode.
+    void SetNumTiles(const IntVector2& numTiles);
+    /// Set heightmap tile size in quads for paged mode. Must be a multiple of the patch size. Tile images are one pixel larger.
+    void SetTileSize(int size);
+    /// Set distance from the cameras within which heightmap tiles are loaded in paged mode.
+    void SetPageDistance(float distance);
+    /// Add a world position to load heightmap tiles around on the next update in paged mode, in addition to the rendered cameras.
+    void AddPagingPosition(const Vector3& worldPosition);
 
     /// Return patch quads per side.
     int GetPatchSize() const { return patchSize_; }
@@ -103,6 +140,34 @@ public:
     /// Return whether smoothing is in use.
     bool GetSmoothing() const { return smoothing_; }
 
+    /// Return heightmap tile resource name for paged mode.
+    const String& GetTileHeightMaps() const { return tileHeightMaps_; }
+
+    /// Return number of heightmap tiles for paged mode.
+    const IntVector2& GetNumTiles() const { return numTiles_; }
+
+    /// Return heightmap tile size in quads for paged mode.
+    int GetTileSize() const { return tileSize_; }
+
+    /// Return tile paging distance.
+    float GetPageDistance() const { return pageDistance_; }
+
+    /// Return whether paged mode is in use.
+    bool IsPaged() const { return !tiles_.Empty(); }
+
+    /// Return whether height data is resident at world coordinates. Always true when not paged.
+    bool IsResident(const Vector3& worldPosition) const;
+    /// Return number of resident heightmap tiles.
+    unsigned GetNumResidentTiles() const;
+    /// Return number of heightmap tiles being loaded.
+    unsigned GetNumLoadingTiles() const;
+    /// Return memory use of resident height data in bytes.
+    unsigned GetHeightDataMemory() const;
+    /// Return memory use of resident patch geometry in bytes.
+    unsigned GetPatchGeometryMemory() const;
+    /// Return average time in milliseconds from requesting a heightmap tile to its patches being created.
+    float GetAverageTileLoadTime() const { return numTileLoads_ ? (float)totalTileLoadTime_ / (float)numTileLoads_ : 0.0f; }
+
     /// Return heightmap image.
     Image* GetHeightMap() const;
     /// Return material.
@@ -115,10 +180,20 @@ public:
     float GetHeight(const Vector3& worldPosition) const;
     /// Return normal at world coordinates.
     Vector3 GetNormal(const Vector3& worldPosition) const;
+    /// Return heights at an array of world coordinates. Evaluates four positions at a time when SSE is enabled.
+    void GetHeights(const Vector3* worldPositions, float* heights, unsigned count) const;
+    /// Return heights at world coordinates.
+    void GetHeights(const PODVector<Vector3>& worldPositions, PODVector<float>& heights) const;
+    /// Return normals at an array of world coordinates. Evaluates four positions at a time when SSE is enabled.
+    void GetNormals(const Vector3* worldPositions, Vector3* normals, unsigned count) const;
+    /// Return normals at world coordinates.
+    void GetNormals(const PODVector<Vector3>& worldPositions, PODVector<Vector3>& normals) const;
+    /// Return inverse world transform. Cached until the scene node is moved.
+    const Matrix3x4& GetInverseWorldTransform() const;
     /// Convert world position to heightmap pixel position. Note that the internal height data representation is reversed vertically, but in the heightmap image north is at the top.
     IntVector2 WorldToHeightMap(const Vector3& worldPosition) const;
 
-    /// Return raw height data.
+    /// Return raw height data. Null in paged mode.
     SharedArrayPtr<float> GetHeightData() const { return heightData_; }
 
     /// Return draw distance.
@@ -175,10 +250,20 @@ public:
 private:
     /// Regenerate terrain geometry.
     void CreateGeometry();
+    /// Set up paged mode. Patches are created as the heightmap tiles are loaded.
+    void CreatePagedGeometry();
+    /// Remove all heightmap tiles and their patches, and leave paged mode.
+    void ClearTiles();
+    /// Create or return an existing patch and its scene node.
+    TerrainPatch* CreatePatch(int x, int z);
     /// Create index data shared by all patches.
     void CreateIndexData();
     /// Return an uninterpolated terrain height value, clamping to edges.
     float GetRawHeight(int x, int z) const;
+    /// Return an uninterpolated terrain height value from the resident heightmap tiles.
+    float GetPagedHeight(int x, int z) const;
+    /// Return height data of a resident heightmap tile, or null if not resident.
+    const float* GetTileHeights(int x, int z) const;
     /// Return a source terrain height value, clamping to edges. The source data is used for smoothing.
     float GetSourceHeight(int x, int z) const;
     /// Return interpolated height for a specific LOD level.
@@ -193,6 +278,28 @@ private:
     bool SetHeightMapInternal(Image* image, bool recreateNow);
     /// Handle heightmap image reload finished.
     void HandleHeightMapReloadFinished(StringHash eventType, VariantMap& eventData);
+    /// Subscribe to or unsubscribe from the events needed for paging.
+    void UpdatePagingSubscription();
+    /// Load and release heightmap tiles based on the paging positions, and create the patches of a loaded tile.
+    void UpdatePaging();
+    /// Return resource name of a heightmap tile.
+    String GetTileName(int x, int z) const;
+    /// Start loading a heightmap tile.
+    void RequestTile(unsigned index);
+    /// Copy the heights of a loaded heightmap tile, or mark it failed if the image is null.
+    void FinishTileLoad(unsigned index, Image* image);
+    /// Create the patches of a loaded heightmap tile and update its neighbors.
+    void CreateTilePatches(unsigned index);
+    /// Remove the patches and height data of a heightmap tile, and update its neighbors.
+    void ReleaseTile(unsigned index);
+    /// Release the loaded heightmap tile images from the resource cache.
+    void ReleaseTileImages();
+    /// Handle scene post-update event.
+    void HandleScenePostUpdate(StringHash eventType, VariantMap& eventData);
+    /// Handle view update begin event.
+    void HandleBeginViewUpdate(StringHash eventType, VariantMap& eventData);
+    /// Handle background loaded resource event.
+    void HandleTileBackgroundLoaded(StringHash eventType, VariantMap& eventData);
 
     /// Shared index buffer.
     SharedPtr<IndexBuffer> indexBuffer_;
@@ -256,6 +363,32 @@ private:
     unsigned maxLights_;
     /// Terrain needs regeneration flag.
     bool recreateTerrain_;
+    /// Heightmap tile resource name for paged mode.
+    String tileHeightMaps_;
+    /// Number of heightmap tiles for paged mode.
+    IntVector2 numTiles_;
+    /// Heightmap tile size in quads for paged mode.
+    int tileSize_;
+    /// Tile paging distance.
+    float pageDistance_;
+    /// Heightmap tiles. Empty when not paged.
+    Vector<TerrainTile> tiles_;
+    /// Heightmap tiles being loaded in the background, by resource name.
+    HashMap<StringHash, unsigned> tileRequests_;
+    /// Loaded heightmap tiles waiting for patch creation.
+    PODVector<unsigned> tilesToActivate_;
+    /// Loaded heightmap tile images to release from the resource cache on the next update.
+    Vector<String> tileImagesToRelease_;
+    /// World positions to load heightmap tiles around on the next update.
+    PODVector<Vector3> pagingPositions_;
+    /// Number of heightmap tiles loaded.
+    unsigned numTileLoads_;
+    /// Total heightmap tile load time in milliseconds.
+    unsigned totalTileLoadTime_;
+    /// Cached inverse world transform.
+    mutable Matrix3x4 inverseWorld_;
+    /// Inverse world transform dirty flag.
+    mutable bool inverseWorldDirty_;
 };
 
 }
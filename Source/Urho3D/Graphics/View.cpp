@@ -64,6 +64,16 @@ static const Vector3* directions[] =
     &Vector3::BACK
 };
 
+static const unsigned LIGHT_CLUSTERS_X = 16;
+static const unsigned LIGHT_CLUSTERS_Y = 8;
+static const unsigned LIGHT_CLUSTERS_Z = 24;
+static const unsigned MIN_CLUSTERED_LIGHTS = 8;
+static const unsigned SHADOW_CASTER_CACHE_FRAMES = 60;
+static const float SHADOW_CASTER_CACHE_MARGIN = 0.25f;
+static const unsigned MIN_INDEXED_ZONES = 8;
+static const unsigned ZONES_PER_INDEX_LEAF = 4;
+static const unsigned MAX_ZONE_INDEX_DEPTH = 64;
+
 /// %Frustum octree query for shadowcasters.
 class ShadowCasterOctreeQuery : public FrustumOctreeQuery
 {
@@ -243,6 +253,89 @@ void ProcessLightWork(const WorkItem* item, unsigned threadIndex)
     view->ProcessLight(*query, threadIndex);
 }
 
+void AssignClusteredLightsWork(const WorkItem* item, unsigned threadIndex)
+{
+    View* view = reinterpret_cast<View*>(item->aux_);
+    Drawable** start = reinterpret_cast<Drawable**>(item->start_);
+    Drawable** end = reinterpret_cast<Drawable**>(item->end_);
+    const Matrix3x4& viewMatrix = view->camera_->GetView();
+    const PODVector<unsigned>& unclusteredLights = view->unclusteredLights_;
+    const Vector<ClusteredLight>& clusteredLights = view->clusteredLights_;
+    unsigned numWords = view->clusterLightWords_;
+    PerThreadClusterResult& result = view->clusterResults_[threadIndex];
+    PODVector<unsigned>& lightBits = result.lightBits_;
+    lightBits.Resize(numWords);
+    unsigned minCluster[3];
+    unsigned maxCluster[3];
+
+    while (start != end)
+    {
+        Drawable* drawable = *start++;
+        unsigned lightMask = view->GetLightMask(drawable);
+
+        // Directional lights affect all geometries that match the light mask
+        for (unsigned i = 0; i < unclusteredLights.Size(); ++i)
+        {
+            unsigned queryIndex = unclusteredLights[i];
+            if (lightMask & view->lightQueryResults_[queryIndex].light_->GetLightMask())
+            {
+                result.queryIndices_.Push(queryIndex);
+                result.litGeometries_.Push(drawable);
+            }
+        }
+
+        // Combine the light bits of all clusters the geometry covers, then perform exact tests on the candidate lights.
+        // "Infinite" objects like skybox are not included in the scene Z range, so test them against all lights
+        const BoundingBox& box = drawable->GetWorldBoundingBox();
+        if (drawable->GetMinZ() == M_LARGE_VALUE)
+        {
+            memset(&lightBits[0], 0xff, numWords * sizeof(unsigned));
+            lightBits[numWords - 1] = clusteredLights.Size() & 31 ? (1u << (clusteredLights.Size() & 31)) - 1 : M_MAX_UNSIGNED;
+        }
+        else
+        {
+            if (!view->GetLightClusterRange(box.Transformed(viewMatrix), minCluster, maxCluster))
+                continue;
+
+            memset(&lightBits[0], 0, numWords * sizeof(unsigned));
+            for (unsigned z = minCluster[2]; z <= maxCluster[2]; ++z)
+            {
+                for (unsigned y = minCluster[1]; y <= maxCluster[1]; ++y)
+                {
+                    const unsigned* clusterBits = &view->clusterLightBits_[((z * LIGHT_CLUSTERS_Y + y) * LIGHT_CLUSTERS_X +
+                        minCluster[0]) * numWords];
+                    for (unsigned x = minCluster[0]; x <= maxCluster[0]; ++x)
+                    {
+                        for (unsigned j = 0; j < numWords; ++j)
+                            lightBits[j] |= *clusterBits++;
+                    }
+                }
+            }
+        }
+
+        for (unsigned j = 0; j < numWords; ++j)
+        {
+            unsigned bits = lightBits[j];
+            unsigned index = j << 5;
+            while (bits)
+            {
+                if (bits & 1)
+                {
+                    const ClusteredLight& light = clusteredLights[index];
+                    if ((lightMask & light.lightMask_) && (light.type_ == LIGHT_POINT ? light.sphere_.IsInsideFast(box) :
+                        light.frustum_.IsInsideFast(box)) != OUTSIDE)
+                    {
+                        result.queryIndices_.Push(light.queryIndex_);
+                        result.litGeometries_.Push(drawable);
+                    }
+                }
+                bits >>= 1;
+                ++index;
+            }
+        }
+    }
+}
+
 void UpdateDrawableGeometriesWork(const WorkItem* item, unsigned threadIndex)
 {
     const FrameInfo& frame = *(reinterpret_cast<FrameInfo*>(item->aux_));
@@ -296,12 +389,16 @@ View::View(Context* context) :
     cameraZone_(0),
     farClipZone_(0),
     renderTarget_(0),
-    substituteRenderTarget_(0)
+    substituteRenderTarget_(0),
+    useLightClusters_(false),
+    numShadowCasterCacheHits_(0),
+    numShadowCasterCacheMisses_(0)
 {
     // Create octree query and scene results vector for each thread
     unsigned numThreads = GetSubsystem<WorkQueue>()->GetNumThreads() + 1; // Worker threads + main thread
     tempDrawables_.Resize(numThreads);
     sceneResults_.Resize(numThreads);
+    clusterResults_.Resize(numThreads);
     frame_.camera_ = 0;
 }
 
@@ -813,6 +910,11 @@ void View::GetDrawables()
     if (farClipZone_ == renderer_->GetDefaultZone())
         farClipZone_ = cameraZone_;
 
+    // With many visible zones, build a bounding volume hierarchy for the drawables' zone lookups. The zone inverse transforms
+    // are also copied so that the worker threads do not need to calculate them
+    if (!cameraZoneOverride_)
+        UpdateZoneIndex();
+
     // If occlusion in use, get & render the occluders
     occlusionBuffer_ = 0;
     if (maxOccluderTriangles_ > 0)
@@ -940,22 +1042,252 @@ void View::ProcessLights()
     WorkQueue* queue = GetSubsystem<WorkQueue>();
     lightQueryResults_.Resize(lights_.Size());
 
+    // Assign the shadow caster query caches here, as the cache map can not be modified from the worker threads
+    for (unsigned i = 0; i < lightQueryResults_.Size(); ++i)
+    {
+        LightQueryResult& query = lightQueryResults_[i];
+        Light* light = lights_[i];
+        query.light_ = light;
+        query.shadowCasterCache_ = 0;
+
+        if (drawShadows_ && light->GetCastShadows() && !light->GetPerVertex())
+        {
+            ShadowCasterCache& cache = shadowCasterCaches_[light];
+            // The light may be a new object at the address of a destroyed one
+            if (cache.light_ != light)
+            {
+                cache = ShadowCasterCache();
+                cache.light_ = light;
+            }
+            cache.lastFrameNumber_ = frame_.frameNumber_;
+            cache.numHits_ = 0;
+            cache.numMisses_ = 0;
+            query.shadowCasterCache_ = &cache;
+        }
+    }
+
+    // With many point and spot lights, assign lit geometries in one pass instead of an octree query per light
+    useLightClusters_ = BuildLightClusters();
+    if (useLightClusters_)
+        AssignClusteredLights();
+
     for (unsigned i = 0; i < lightQueryResults_.Size(); ++i)
     {
         SharedPtr<WorkItem> item = queue->GetFreeItem();
         item->priority_ = M_MAX_UNSIGNED;
         item->workFunction_ = ProcessLightWork;
         item->aux_ = this;
+        item->start_ = &lightQueryResults_[i];
+        queue->AddWorkItem(item);
+    }
 
-        LightQueryResult& query = lightQueryResults_[i];
-        query.light_ = lights_[i];
+    // Ensure all lights have been processed before proceeding
+    queue->Complete(M_MAX_UNSIGNED);
 
-        item->start_ = &query;
+    numShadowCasterCacheHits_ = 0;
+    numShadowCasterCacheMisses_ = 0;
+    for (unsigned i = 0; i < lightQueryResults_.Size(); ++i)
+    {
+        ShadowCasterCache* cache = lightQueryResults_[i].shadowCasterCache_;
+        if (cache)
+        {
+            numShadowCasterCacheHits_ += cache->numHits_;
+            numShadowCasterCacheMisses_ += cache->numMisses_;
+        }
+    }
+
+    // Remove caches of lights that have been destroyed or have not been visible for a while
+    for (HashMap<Light*, ShadowCasterCache>::Iterator i = shadowCasterCaches_.Begin(); i != shadowCasterCaches_.End();)
+    {
+        if (!i->second_.light_ || frame_.frameNumber_ - i->second_.lastFrameNumber_ > SHADOW_CASTER_CACHE_FRAMES)
+            i = shadowCasterCaches_.Erase(i);
+        else
+            ++i;
+    }
+}
+
+bool View::BuildLightClusters()
+{
+    clusteredLights_.Clear();
+    unclusteredLights_.Clear();
+
+    unsigned numLocalLights = 0;
+    for (unsigned i = 0; i < lights_.Size(); ++i)
+    {
+        if (lights_[i]->GetLightType() != LIGHT_DIRECTIONAL)
+            ++numLocalLights;
+    }
+    if (numLocalLights < MIN_CLUSTERED_LIGHTS || geometries_.Empty())
+        return false;
+
+    PROFILE(BuildLightClusters);
+
+    // The grid spans the Z range of the visible scene. Depth slices are exponential for perspective cameras
+    clusterProjection_ = camera_->GetProjection(false);
+    if (!camera_->IsOrthographic())
+    {
+        clusterNearZ_ = Max(minZ_, camera_->GetNearClip());
+        clusterFarZ_ = Max(Min(maxZ_, camera_->GetFarClip()), clusterNearZ_ * 1.001f);
+        clusterDepthScale_ = (float)LIGHT_CLUSTERS_Z / logf(clusterFarZ_ / clusterNearZ_);
+    }
+    else
+    {
+        clusterNearZ_ = minZ_;
+        clusterFarZ_ = Max(Min(maxZ_, camera_->GetFarClip()), clusterNearZ_ + M_EPSILON);
+        clusterDepthScale_ = (float)LIGHT_CLUSTERS_Z / (clusterFarZ_ - clusterNearZ_);
+    }
+
+    clusterLightWords_ = (numLocalLights + 31) >> 5;
+    clusterLightBits_.Resize(LIGHT_CLUSTERS_X * LIGHT_CLUSTERS_Y * LIGHT_CLUSTERS_Z * clusterLightWords_);
+    memset(&clusterLightBits_[0], 0, clusterLightBits_.Size() * sizeof(unsigned));
+
+    const Matrix3x4& viewMatrix = camera_->GetView();
+    unsigned minCluster[3];
+    unsigned maxCluster[3];
+
+    for (unsigned i = 0; i < lights_.Size(); ++i)
+    {
+        Light* light = lights_[i];
+        LightType type = light->GetLightType();
+        if (type == LIGHT_DIRECTIONAL)
+        {
+            unclusteredLights_.Push(i);
+            continue;
+        }
+
+        unsigned index = clusteredLights_.Size();
+        clusteredLights_.Resize(index + 1);
+        ClusteredLight& clusteredLight = clusteredLights_.Back();
+        clusteredLight.queryIndex_ = i;
+        clusteredLight.type_ = type;
+        clusteredLight.lightMask_ = light->GetLightMask();
+        if (type == LIGHT_POINT)
+            clusteredLight.sphere_ = Sphere(light->GetNode()->GetWorldPosition(), light->GetRange());
+        else
+            clusteredLight.frustum_ = light->GetFrustum();
+
+        if (!GetLightClusterRange(light->GetWorldBoundingBox().Transformed(viewMatrix), minCluster, maxCluster))
+            continue;
+
+        unsigned word = index >> 5;
+        unsigned bit = 1u << (index & 31);
+        for (unsigned z = minCluster[2]; z <= maxCluster[2]; ++z)
+        {
+            for (unsigned y = minCluster[1]; y <= maxCluster[1]; ++y)
+            {
+                for (unsigned x = minCluster[0]; x <= maxCluster[0]; ++x)
+                    clusterLightBits_[((z * LIGHT_CLUSTERS_Y + y) * LIGHT_CLUSTERS_X + x) * clusterLightWords_ + word] |= bit;
+            }
+        }
+    }
+
+    return true;
+}
+
+void View::AssignClusteredLights()
+{
+    PROFILE(AssignClusteredLights);
+
+    WorkQueue* queue = GetSubsystem<WorkQueue>();
+
+    for (unsigned i = 0; i < clusterResults_.Size(); ++i)
+    {
+        clusterResults_[i].queryIndices_.Clear();
+        clusterResults_[i].litGeometries_.Clear();
+    }
+
+    int numWorkItems = queue->GetNumThreads() + 1; // Worker threads + main thread
+    int geometriesPerItem = geometries_.Size() / numWorkItems;
+
+    PODVector<Drawable*>::Iterator start = geometries_.Begin();
+    for (int i = 0; i < numWorkItems; ++i)
+    {
+        SharedPtr<WorkItem> item = queue->GetFreeItem();
+        item->priority_ = M_MAX_UNSIGNED;
+        item->workFunction_ = AssignClusteredLightsWork;
+        item->aux_ = this;
+
+        PODVector<Drawable*>::Iterator end = geometries_.End();
+        if (i < numWorkItems - 1 && end - start > geometriesPerItem)
+            end = start + geometriesPerItem;
+
+        item->start_ = &(*start);
+        item->end_ = &(*end);
         queue->AddWorkItem(item);
+
+        start = end;
     }
 
-    // Ensure all lights have been processed before proceeding
     queue->Complete(M_MAX_UNSIGNED);
+
+    // Combine the lit geometries from the threads into the light query results
+    for (unsigned i = 0; i < lightQueryResults_.Size(); ++i)
+        lightQueryResults_[i].litGeometries_.Clear();
+
+    for (unsigned i = 0; i < clusterResults_.Size(); ++i)
+    {
+        const PerThreadClusterResult& result = clusterResults_[i];
+        for (unsigned j = 0; j < result.queryIndices_.Size(); ++j)
+            lightQueryResults_[result.queryIndices_[j]].litGeometries_.Push(result.litGeometries_[j]);
+    }
+}
+
+bool View::GetLightClusterRange(const BoundingBox& viewBox, unsigned* minCluster, unsigned* maxCluster) const
+{
+    // Boxes in front of the grid can not contribute to visible pixels. Boxes beyond it are clamped to the last depth slice
+    if (viewBox.max_.z_ < clusterNearZ_)
+        return false;
+    float nearZ = Clamp(viewBox.min_.z_, clusterNearZ_, clusterFarZ_);
+    float farZ = Clamp(viewBox.max_.z_, clusterNearZ_, clusterFarZ_);
+
+    const Matrix4& proj = clusterProjection_;
+    float x[4];
+    float y[4];
+
+    if (!camera_->IsOrthographic())
+    {
+        // Projected coordinates are monotonic in x / z and y / z, so the extremes are found at the corners of the box
+        float invNearZ = 1.0f / nearZ;
+        float invFarZ = 1.0f / farZ;
+        x[0] = viewBox.min_.x_ * invNearZ;
+        x[1] = viewBox.min_.x_ * invFarZ;
+        x[2] = viewBox.max_.x_ * invNearZ;
+        x[3] = viewBox.max_.x_ * invFarZ;
+        y[0] = viewBox.min_.y_ * invNearZ;
+        y[1] = viewBox.min_.y_ * invFarZ;
+        y[2] = viewBox.max_.y_ * invNearZ;
+        y[3] = viewBox.max_.y_ * invFarZ;
+        for (unsigned i = 0; i < 4; ++i)
+        {
+            x[i] = proj.m00_ * x[i] + proj.m02_;
+            y[i] = proj.m11_ * y[i] + proj.m12_;
+        }
+
+        minCluster[2] = (unsigned)Clamp((int)(logf(nearZ / clusterNearZ_) * clusterDepthScale_), 0, (int)LIGHT_CLUSTERS_Z - 1);
+        maxCluster[2] = (unsigned)Clamp((int)(logf(farZ / clusterNearZ_) * clusterDepthScale_), 0, (int)LIGHT_CLUSTERS_Z - 1);
+    }
+    else
+    {
+        x[0] = x[1] = proj.m00_ * viewBox.min_.x_ + proj.m03_;
+        x[2] = x[3] = proj.m00_ * viewBox.max_.x_ + proj.m03_;
+        y[0] = y[1] = proj.m11_ * viewBox.min_.y_ + proj.m13_;
+        y[2] = y[3] = proj.m11_ * viewBox.max_.y_ + proj.m13_;
+
+        minCluster[2] = (unsigned)Clamp((int)((nearZ - clusterNearZ_) * clusterDepthScale_), 0, (int)LIGHT_CLUSTERS_Z - 1);
+        maxCluster[2] = (unsigned)Clamp((int)((farZ - clusterNearZ_) * clusterDepthScale_), 0, (int)LIGHT_CLUSTERS_Z - 1);
+    }
+
+    // Boxes extending outside the screen are clamped to the edge clusters
+    float minX = Min(Min(x[0], x[1]), Min(x[2], x[3]));
+    float maxX = Max(Max(x[0], x[1]), Max(x[2], x[3]));
+    float minY = Min(Min(y[0], y[1]), Min(y[2], y[3]));
+    float maxY = Max(Max(y[0], y[1]), Max(y[2], y[3]));
+
+    minCluster[0] = (unsigned)Clamp((int)((minX + 1.0f) * 0.5f * LIGHT_CLUSTERS_X), 0, (int)LIGHT_CLUSTERS_X - 1);
+    maxCluster[0] = (unsigned)Clamp((int)((maxX + 1.0f) * 0.5f * LIGHT_CLUSTERS_X), 0, (int)LIGHT_CLUSTERS_X - 1);
+    minCluster[1] = (unsigned)Clamp((int)((minY + 1.0f) * 0.5f * LIGHT_CLUSTERS_Y), 0, (int)LIGHT_CLUSTERS_Y - 1);
+    maxCluster[1] = (unsigned)Clamp((int)((maxY + 1.0f) * 0.5f * LIGHT_CLUSTERS_Y), 0, (int)LIGHT_CLUSTERS_Y - 1);
+    return true;
 }
 
 void View::GetLightBatches()
@@ -2147,26 +2479,42 @@ void View::ProcessLight(LightQueryResult& query, unsigned threadIndex)
     if (isShadowed && type == LIGHT_POINT)
         isShadowed = false;
 #endif
-    // Get lit geometries. They must match the light mask and be inside the main camera frustum to be considered
+    // Get lit geometries. They must match the light mask and be inside the main camera frustum to be considered.
+    // If the light cluster grid is in use, they have already been assigned
     PODVector<Drawable*>& tempDrawables = tempDrawables_[threadIndex];
-    query.litGeometries_.Clear();
+    bool assignLitGeometries = !useLightClusters_;
+    if (assignLitGeometries)
+        query.litGeometries_.Clear();
 
     switch (type)
     {
     case LIGHT_DIRECTIONAL:
-        for (unsigned i = 0; i < geometries_.Size(); ++i)
+        if (assignLitGeometries)
         {
-            if (GetLightMask(geometries_[i]) & light->GetLightMask())
-                query.litGeometries_.Push(geometries_[i]);
+            for (unsigned i = 0; i < geometries_.Size(); ++i)
+            {
+                if (GetLightMask(geometries_[i]) & light->GetLightMask())
+                    query.litGeometries_.Push(geometries_[i]);
+            }
         }
         break;
 
     case LIGHT_SPOT:
+        // The octree query result is reused for shadow casters, so it is still needed for shadowed clustered lights
+        if (assignLitGeometries || (isShadowed && !query.litGeometries_.Empty()))
         {
-            FrustumOctreeQuery octreeQuery(tempDrawables, light->GetFrustum(), DRAWABLE_GEOMETRY,
-                camera_->GetViewMask());
-            octree_->GetDrawables(octreeQuery);
-            for (unsigned i = 0; i < tempDrawables.Size(); ++i)
+            if (isShadowed && query.shadowCasterCache_)
+            {
+                Frustum lightFrustum = light->GetFrustum();
+                GetCachedShadowCasterDrawables(*query.shadowCasterCache_, query.shadowCasterCache_->queries_[0], &lightFrustum, 0,
+                    false, tempDrawables);
+            }
+            else
+            {
+                FrustumOctreeQuery octreeQuery(tempDrawables, light->GetFrustum(), DRAWABLE_GEOMETRY, camera_->GetViewMask());
+                octree_->GetDrawables(octreeQuery);
+            }
+            for (unsigned i = 0; assignLitGeometries && i < tempDrawables.Size(); ++i)
             {
                 if (tempDrawables[i]->IsInView(frame_) && (GetLightMask(tempDrawables[i]) & light->GetLightMask()))
                     query.litGeometries_.Push(tempDrawables[i]);
@@ -2175,11 +2523,20 @@ void View::ProcessLight(LightQueryResult& query, unsigned threadIndex)
         break;
 
     case LIGHT_POINT:
+        if (assignLitGeometries || (isShadowed && !query.litGeometries_.Empty()))
         {
-            SphereOctreeQuery octreeQuery(tempDrawables, Sphere(light->GetNode()->GetWorldPosition(), light->GetRange()),
-                DRAWABLE_GEOMETRY, camera_->GetViewMask());
-            octree_->GetDrawables(octreeQuery);
-            for (unsigned i = 0; i < tempDrawables.Size(); ++i)
+            Sphere lightSphere(light->GetNode()->GetWorldPosition(), light->GetRange());
+            if (isShadowed && query.shadowCasterCache_)
+            {
+                GetCachedShadowCasterDrawables(*query.shadowCasterCache_, query.shadowCasterCache_->queries_[0], 0, &lightSphere,
+                    false, tempDrawables);
+            }
+            else
+            {
+                SphereOctreeQuery octreeQuery(tempDrawables, lightSphere, DRAWABLE_GEOMETRY, camera_->GetViewMask());
+                octree_->GetDrawables(octreeQuery);
+            }
+            for (unsigned i = 0; assignLitGeometries && i < tempDrawables.Size(); ++i)
             {
                 if (tempDrawables[i]->IsInView(frame_) && (GetLightMask(tempDrawables[i]) & light->GetLightMask()))
                     query.litGeometries_.Push(tempDrawables[i]);
@@ -2219,8 +2576,16 @@ void View::ProcessLight(LightQueryResult& query, unsigned threadIndex)
                 continue;
 
             // Reuse lit geometry query for all except directional lights
-            ShadowCasterOctreeQuery query(tempDrawables, shadowCameraFrustum, DRAWABLE_GEOMETRY, camera_->GetViewMask());
-            octree_->GetDrawables(query);
+            if (query.shadowCasterCache_)
+            {
+                GetCachedShadowCasterDrawables(*query.shadowCasterCache_, query.shadowCasterCache_->queries_[i],
+                    &shadowCameraFrustum, 0, true, tempDrawables);
+            }
+            else
+            {
+                ShadowCasterOctreeQuery query(tempDrawables, shadowCameraFrustum, DRAWABLE_GEOMETRY, camera_->GetViewMask());
+                octree_->GetDrawables(query);
+            }
         }
 
         // Check which shadow casters actually contribute to the shadowing
@@ -2233,6 +2598,87 @@ void View::ProcessLight(LightQueryResult& query, unsigned threadIndex)
         query.numSplits_ = 0;
 }
 
+void View::GetCachedShadowCasterDrawables(ShadowCasterCache& cache, CachedShadowCasterQuery& cachedQuery, const Frustum* frustum,
+    const Sphere* sphere, bool shadowCastersOnly, PODVector<Drawable*>& result)
+{
+    unsigned staticGeneration = octree_->GetStaticGeneration();
+    bool valid = cachedQuery.valid_ && cachedQuery.octree_.Get() == octree_ && cachedQuery.staticGeneration_ == staticGeneration;
+
+    // Directional light splits follow the camera, so their frustums are different on nearly every frame. Therefore query an
+    // enlarged box around the frustum and reuse the result while the frustum stays inside it
+    BoundingBox frustumBox;
+    if (frustum)
+    {
+        frustumBox.Define(*frustum);
+        if (valid)
+            valid = cachedQuery.box_.IsInside(frustumBox) == INSIDE;
+    }
+    else if (valid)
+        valid = cachedQuery.sphere_ == *sphere;
+
+    if (valid)
+        ++cache.numHits_;
+    else
+    {
+        ++cache.numMisses_;
+
+        // Query with all view masks so that the cached result is not camera-specific
+        if (frustum)
+        {
+            Vector3 margin = frustumBox.HalfSize() * SHADOW_CASTER_CACHE_MARGIN;
+            cachedQuery.box_ = BoundingBox(frustumBox.min_ - margin, frustumBox.max_ + margin);
+            BoxOctreeQuery octreeQuery(result, cachedQuery.box_, DRAWABLE_GEOMETRY);
+            octree_->GetDrawables(octreeQuery);
+        }
+        else
+        {
+            SphereOctreeQuery octreeQuery(result, *sphere, DRAWABLE_GEOMETRY);
+            octree_->GetDrawables(octreeQuery);
+            cachedQuery.sphere_ = *sphere;
+        }
+
+        cachedQuery.drawables_.Clear();
+        for (PODVector<Drawable*>::ConstIterator i = result.Begin(); i != result.End(); ++i)
+        {
+            if (!(*i)->IsDynamic())
+                cachedQuery.drawables_.Push(*i);
+        }
+
+        cachedQuery.octree_ = octree_;
+        cachedQuery.staticGeneration_ = staticGeneration;
+        cachedQuery.valid_ = true;
+    }
+
+    // Combine the static drawables with the dynamic drawables inside the query volume. Apply the same tests as the uncached
+    // octree query: the view mask, the shadow casting flag for shadow caster queries, and the exact frustum, as the cached box
+    // is larger
+    unsigned viewMask = camera_->GetViewMask();
+    result.Clear();
+
+    for (PODVector<Drawable*>::ConstIterator i = cachedQuery.drawables_.Begin(); i != cachedQuery.drawables_.End(); ++i)
+    {
+        Drawable* drawable = *i;
+        if (!(drawable->GetViewMask() & viewMask) || (shadowCastersOnly && !drawable->GetCastShadows()))
+            continue;
+
+        if (!frustum || frustum->IsInsideFast(drawable->GetWorldBoundingBox()) != OUTSIDE)
+            result.Push(drawable);
+    }
+
+    const PODVector<Drawable*>& dynamicDrawables = octree_->GetDynamicDrawables();
+    for (PODVector<Drawable*>::ConstIterator i = dynamicDrawables.Begin(); i != dynamicDrawables.End(); ++i)
+    {
+        Drawable* drawable = *i;
+        if (!(drawable->GetDrawableFlags() & DRAWABLE_GEOMETRY) || !(drawable->GetViewMask() & viewMask) ||
+            (shadowCastersOnly && !drawable->GetCastShadows()))
+            continue;
+
+        const BoundingBox& box = drawable->GetWorldBoundingBox();
+        if ((frustum ? frustum->IsInsideFast(box) : sphere->IsInsideFast(box)) != OUTSIDE)
+            result.Push(drawable);
+    }
+}
+
 void View::ProcessShadowCasters(LightQueryResult& query, const PODVector<Drawable*>& drawables, unsigned splitIndex)
 {
     Light* light = query.light_;
@@ -2636,6 +3082,8 @@ void View::FindZone(Drawable* drawable)
     if (lastZone && (lastZone->GetViewMask() & camera_->GetViewMask()) && lastZone->GetPriority() >= highestZonePriority_ &&
         (drawable->GetZoneMask() & lastZone->GetZoneMask()) && lastZone->IsInside(center))
         newZone = lastZone;
+    else if (!zoneIndexNodes_.Empty())
+        newZone = QueryZoneIndex(center, drawable->GetZoneMask());
     else
     {
         for (PODVector<Zone*>::Iterator i = zones_.Begin(); i != zones_.End(); ++i)
@@ -2653,6 +3101,148 @@ void View::FindZone(Drawable* drawable)
     drawable->SetZone(newZone, temporary);
 }
 
+void View::UpdateZoneIndex()
+{
+    if (zones_.Size() < MIN_INDEXED_ZONES)
+    {
+        zoneIndexEntries_.Clear();
+        zoneIndexOrder_.Clear();
+        zoneIndexNodes_.Clear();
+        return;
+    }
+
+    // Rebuild only if the visible zones, or their transforms, sizes, priorities or zone masks have changed
+    bool changed = zoneIndexEntries_.Size() != zones_.Size();
+    for (unsigned i = 0; i < zones_.Size() && !changed; ++i)
+    {
+        const ZoneIndexEntry& entry = zoneIndexEntries_[i];
+        Zone* zone = zones_[i];
+        if (entry.zone_ != zone || entry.priority_ != zone->GetPriority() || entry.zoneMask_ != zone->GetZoneMask() ||
+            entry.boundingBox_ != zone->GetBoundingBox() || entry.inverseWorld_ != zone->GetInverseWorldTransform())
+            changed = true;
+    }
+    if (!changed)
+        return;
+
+    PROFILE(BuildZoneIndex);
+
+    zoneIndexEntries_.Resize(zones_.Size());
+    zoneIndexOrder_.Resize(zones_.Size());
+    for (unsigned i = 0; i < zones_.Size(); ++i)
+    {
+        ZoneIndexEntry& entry = zoneIndexEntries_[i];
+        Zone* zone = zones_[i];
+        entry.zone_ = zone;
+        entry.inverseWorld_ = zone->GetInverseWorldTransform();
+        entry.boundingBox_ = zone->GetBoundingBox();
+        entry.worldBoundingBox_ = zone->GetWorldBoundingBox();
+        entry.priority_ = zone->GetPriority();
+        entry.zoneMask_ = zone->GetZoneMask();
+        zoneIndexOrder_[i] = i;
+    }
+
+    zoneIndexNodes_.Resize(1);
+    BuildZoneIndexNode(0, 0, zones_.Size());
+}
+
+void View::BuildZoneIndexNode(unsigned nodeIndex, unsigned first, unsigned count)
+{
+    BoundingBox box;
+    BoundingBox centerBox;
+    int maxPriority = M_MIN_INT;
+    for (unsigned i = first; i < first + count; ++i)
+    {
+        const ZoneIndexEntry& entry = zoneIndexEntries_[zoneIndexOrder_[i]];
+        box.Merge(entry.worldBoundingBox_);
+        centerBox.Merge(entry.worldBoundingBox_.Center());
+        if (entry.priority_ > maxPriority)
+            maxPriority = entry.priority_;
+    }
+
+    ZoneIndexNode& node = zoneIndexNodes_[nodeIndex];
+    node.boundingBox_ = box;
+    node.maxPriority_ = maxPriority;
+
+    if (count <= ZONES_PER_INDEX_LEAF)
+    {
+        node.first_ = first;
+        node.count_ = count;
+        return;
+    }
+
+    // Split at the median of zone centers along the longest axis
+    Vector3 size = centerBox.Size();
+    unsigned axis = size.x_ >= size.y_ && size.x_ >= size.z_ ? 0 : (size.y_ >= size.z_ ? 1 : 2);
+    PODVector<ZoneIndexSortKey> keys(count);
+    for (unsigned i = 0; i < count; ++i)
+    {
+        unsigned entryIndex = zoneIndexOrder_[first + i];
+        keys[i].key_ = zoneIndexEntries_[entryIndex].worldBoundingBox_.Center().Data()[axis];
+        keys[i].entryIndex_ = entryIndex;
+    }
+    Sort(keys.Begin(), keys.End());
+    for (unsigned i = 0; i < count; ++i)
+        zoneIndexOrder_[first + i] = keys[i].entryIndex_;
+
+    unsigned childIndex = zoneIndexNodes_.Size();
+    node.first_ = childIndex;
+    node.count_ = 0;
+    // Note: the node reference is invalidated by the resize
+    zoneIndexNodes_.Resize(childIndex + 2);
+
+    unsigned half = count >> 1;
+    BuildZoneIndexNode(childIndex, first, half);
+    BuildZoneIndexNode(childIndex + 1, first + half, count - half);
+}
+
+Zone* View::QueryZoneIndex(const Vector3& point, unsigned zoneMask) const
+{
+    Zone* bestZone = 0;
+    int bestPriority = M_MIN_INT;
+    unsigned bestIndex = M_MAX_UNSIGNED;
+
+    unsigned stack[MAX_ZONE_INDEX_DEPTH];
+    unsigned stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize)
+    {
+        const ZoneIndexNode& node = zoneIndexNodes_[stack[--stackSize]];
+        // Skip subtrees that can not contain a higher (or equal, with an earlier index) priority zone
+        if (node.maxPriority_ < bestPriority || node.boundingBox_.IsInside(point) == OUTSIDE)
+            continue;
+
+        if (node.count_)
+        {
+            for (unsigned i = node.first_; i < node.first_ + node.count_; ++i)
+            {
+                unsigned entryIndex = zoneIndexOrder_[i];
+                const ZoneIndexEntry& entry = zoneIndexEntries_[entryIndex];
+                // On equal priority prefer the zone that is first in the visible zones list, like a linear search would
+                if ((entry.priority_ > bestPriority || (bestZone && entry.priority_ == bestPriority && entryIndex < bestIndex)) &&
+                    (zoneMask & entry.zoneMask_) && entry.boundingBox_.IsInside(entry.inverseWorld_ * point) != OUTSIDE)
+                {
+                    bestZone = entry.zone_;
+                    bestPriority = entry.priority_;
+                    bestIndex = entryIndex;
+                }
+            }
+        }
+        else
+        {
+            // Visit the child with the higher maximum priority first to prune more
+            unsigned first = node.first_;
+            unsigned second = node.first_ + 1;
+            if (zoneIndexNodes_[first].maxPriority_ < zoneIndexNodes_[second].maxPriority_)
+                Swap(first, second);
+            stack[stackSize++] = second;
+            stack[stackSize++] = first;
+        }
+    }
+
+    return bestZone;
+}
+
 Technique* View::GetTechnique(Drawable* drawable, Material* material)
 {
     if (!material)
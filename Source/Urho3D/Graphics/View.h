@@ -51,11 +51,60 @@ class Zone;
 struct RenderPathCommand;
 struct WorkItem;
 
+/// Static drawables from a cached shadow caster octree query.
+struct CachedShadowCasterQuery
+{
+    /// Construct as invalid.
+    CachedShadowCasterQuery() :
+        staticGeneration_(0),
+        valid_(false)
+    {
+    }
+
+    /// Query box, enclosing the frustum of spot lights and directional light splits with a margin.
+    BoundingBox box_;
+    /// Query sphere. Used for point lights.
+    Sphere sphere_;
+    /// Octree that was queried.
+    WeakPtr<Octree> octree_;
+    /// Octree static drawable generation at the time of the query.
+    unsigned staticGeneration_;
+    /// Static drawables returned by the query.
+    PODVector<Drawable*> drawables_;
+    /// Valid flag.
+    bool valid_;
+};
+
+/// Cached shadow caster octree queries for a light.
+struct ShadowCasterCache
+{
+    /// Construct.
+    ShadowCasterCache() :
+        lastFrameNumber_(0),
+        numHits_(0),
+        numMisses_(0)
+    {
+    }
+
+    /// Light.
+    WeakPtr<Light> light_;
+    /// Cached queries. Point and spot lights use only the first.
+    CachedShadowCasterQuery queries_[MAX_LIGHT_SPLITS];
+    /// Frame number the cache was last used on.
+    unsigned lastFrameNumber_;
+    /// Cache hits during the current frame.
+    unsigned numHits_;
+    /// Cache misses during the current frame.
+    unsigned numMisses_;
+};
+
 /// Intermediate light processing result.
 struct LightQueryResult
 {
     /// Light.
     Light* light_;
+    /// Shadow caster query cache. Null if the light is not shadowed.
+    ShadowCasterCache* shadowCasterCache_;
     /// Lit geometries.
     PODVector<Drawable*> litGeometries_;
     /// Shadow casters.
@@ -106,6 +155,74 @@ struct PerThreadSceneResult
     float maxZ_;
 };
 
+/// Point or spot light binned into the view space light cluster grid.
+struct ClusteredLight
+{
+    /// Index of the light query result.
+    unsigned queryIndex_;
+    /// Light type.
+    LightType type_;
+    /// Light mask.
+    unsigned lightMask_;
+    /// Light range sphere. Used for point lights.
+    Sphere sphere_;
+    /// Light frustum. Used for spot lights.
+    Frustum frustum_;
+};
+
+/// Per-thread lit geometry collection structure for clustered light assignment.
+struct PerThreadClusterResult
+{
+    /// Light query result indices.
+    PODVector<unsigned> queryIndices_;
+    /// Lit geometries, one for each light query result index.
+    PODVector<Drawable*> litGeometries_;
+    /// Combined light bitmask of the clusters covered by a geometry.
+    PODVector<unsigned> lightBits_;
+};
+
+/// Visible zone data for accelerated zone lookup.
+struct ZoneIndexEntry
+{
+    /// Zone.
+    Zone* zone_;
+    /// Zone inverse world transform.
+    Matrix3x4 inverseWorld_;
+    /// Zone local space bounding box.
+    BoundingBox boundingBox_;
+    /// Zone world space bounding box.
+    BoundingBox worldBoundingBox_;
+    /// Zone priority.
+    int priority_;
+    /// Zone mask.
+    unsigned zoneMask_;
+};
+
+/// Zone bounding volume hierarchy node.
+struct ZoneIndexNode
+{
+    /// World space bounding box of the zones in the subtree.
+    BoundingBox boundingBox_;
+    /// Highest zone priority in the subtree.
+    int maxPriority_;
+    /// Index of the first child node, or first zone index entry for a leaf node.
+    unsigned first_;
+    /// Number of zones for a leaf node, or 0 for an inner node with two children.
+    unsigned count_;
+};
+
+/// Zone index build sort key.
+struct ZoneIndexSortKey
+{
+    /// Test for less than with another sort key.
+    bool operator <(const ZoneIndexSortKey& rhs) const { return key_ < rhs.key_; }
+
+    /// Zone center coordinate on the split axis.
+    float key_;
+    /// Zone index entry.
+    unsigned entryIndex_;
+};
+
 static const unsigned MAX_VIEWPORT_TEXTURES = 2;
 
 /// Internal structure for 3D rendering work. Created for each backbuffer and texture viewport, but not for shadow cameras.
@@ -113,6 +230,7 @@ class URHO3D_API View : public Object
 {
     friend void CheckVisibilityWork(const WorkItem* item, unsigned threadIndex);
     friend void ProcessLightWork(const WorkItem* item, unsigned threadIndex);
+    friend void AssignClusteredLightsWork(const WorkItem* item, unsigned threadIndex);
 
     OBJECT(View);
 
@@ -164,6 +282,12 @@ public:
     /// Return light batch queues.
     const Vector<LightBatchQueue>& GetLightQueues() const { return lightQueues_; }
 
+    /// Return number of shadow caster queries served from the cache on the current frame.
+    unsigned GetNumShadowCasterCacheHits() const { return numShadowCasterCacheHits_; }
+
+    /// Return number of shadow caster queries that missed the cache on the current frame.
+    unsigned GetNumShadowCasterCacheMisses() const { return numShadowCasterCacheMisses_; }
+
     /// Set global (per-frame) shader parameters. Called by Batch and internally by View.
     void SetGlobalShaderParameters();
     /// Set camera-specific shader parameters. Called by Batch and internally by View.
@@ -178,6 +302,12 @@ private:
     void GetBatches();
     /// Get lit geometries and shadowcasters for visible lights.
     void ProcessLights();
+    /// Bin point and spot lights into the light cluster grid. Return true if enough lights to use the grid.
+    bool BuildLightClusters();
+    /// Assign lit geometries for all lights in a single pass using the light cluster grid.
+    void AssignClusteredLights();
+    /// Return the range of light clusters covered by a view space bounding box. Return false if outside the grid depth range.
+    bool GetLightClusterRange(const BoundingBox& viewBox, unsigned* minCluster, unsigned* maxCluster) const;
     /// Get batches from lit geometries and shadowcasters.
     void GetLightBatches();
     /// Get unlit batches.
@@ -214,6 +344,9 @@ private:
     void DrawOccluders(OcclusionBuffer* buffer, const PODVector<Drawable*>& occluders);
     /// Query for lit geometries and shadow casters for a light.
     void ProcessLight(LightQueryResult& query, unsigned threadIndex);
+    /// Return shadow caster candidates using cached static drawables and the octree's dynamic drawables. Either frustum or sphere should be non-null. Return the same drawables as a frustum or sphere octree query, or a shadow caster query if shadowCastersOnly is true.
+    void GetCachedShadowCasterDrawables(ShadowCasterCache& cache, CachedShadowCasterQuery& cachedQuery, const Frustum* frustum,
+        const Sphere* sphere, bool shadowCastersOnly, PODVector<Drawable*>& result);
     /// Process shadow casters' visibilities and build their combined view- or projection-space bounding box.
     void ProcessShadowCasters(LightQueryResult& query, const PODVector<Drawable*>& drawables, unsigned splitIndex);
     /// Set up initial shadow camera view(s).
@@ -233,6 +366,12 @@ private:
     IntRect GetShadowMapViewport(Light* light, unsigned splitIndex, Texture2D* shadowMap);
     /// Find and set a new zone for a drawable when it has moved.
     void FindZone(Drawable* drawable);
+    /// Rebuild the zone bounding volume hierarchy if the visible zones have changed.
+    void UpdateZoneIndex();
+    /// Build a zone bounding volume hierarchy node and its children recursively.
+    void BuildZoneIndexNode(unsigned nodeIndex, unsigned first, unsigned count);
+    /// Return the highest priority zone containing a point from the zone bounding volume hierarchy.
+    Zone* QueryZoneIndex(const Vector3& point, unsigned zoneMask) const;
     /// Return material technique, considering the drawable's LOD distance.
     Technique* GetTechnique(Drawable* drawable, Material* material);
     /// Check if material should render an auxiliary view (if it has a camera attached.)
@@ -356,6 +495,12 @@ private:
     Vector<PerThreadSceneResult> sceneResults_;
     /// Visible zones.
     PODVector<Zone*> zones_;
+    /// Visible zone data for the zone bounding volume hierarchy, in the same order as the visible zones.
+    PODVector<ZoneIndexEntry> zoneIndexEntries_;
+    /// Zone index entries ordered for the bounding volume hierarchy leaves.
+    PODVector<unsigned> zoneIndexOrder_;
+    /// Zone bounding volume hierarchy nodes. Empty if there are too few visible zones to use it.
+    PODVector<ZoneIndexNode> zoneIndexNodes_;
     /// Visible geometry objects.
     PODVector<Drawable*> geometries_;
     /// Geometry objects that will be updated in the main thread.
@@ -373,6 +518,32 @@ private:
     HashMap<StringHash, Texture*> renderTargets_;
     /// Intermediate light processing results.
     Vector<LightQueryResult> lightQueryResults_;
+    /// Point and spot lights binned into the light cluster grid.
+    Vector<ClusteredLight> clusteredLights_;
+    /// Light query result indices of lights tested against all geometries.
+    PODVector<unsigned> unclusteredLights_;
+    /// Light bitmasks for each light cluster.
+    PODVector<unsigned> clusterLightBits_;
+    /// Per-thread clustered light assignment results.
+    Vector<PerThreadClusterResult> clusterResults_;
+    /// Camera projection used for binning to the light cluster grid.
+    Matrix4 clusterProjection_;
+    /// Light cluster grid near Z.
+    float clusterNearZ_;
+    /// Light cluster grid far Z.
+    float clusterFarZ_;
+    /// Light cluster grid depth slice scale.
+    float clusterDepthScale_;
+    /// Number of 32-bit words in each light cluster's bitmask.
+    unsigned clusterLightWords_;
+    /// Lit geometries assigned using the light cluster grid flag.
+    bool useLightClusters_;
+    /// Shadow caster query caches by light.
+    HashMap<Light*, ShadowCasterCache> shadowCasterCaches_;
+    /// Shadow caster query cache hits during the current frame.
+    unsigned numShadowCasterCacheHits_;
+    /// Shadow caster query cache misses during the current frame.
+    unsigned numShadowCasterCacheMisses_;
     /// Info for scene render passes defined by the renderpath.
     Vector<ScenePassInfo> scenePasses_;
     /// Per-pixel light queues.
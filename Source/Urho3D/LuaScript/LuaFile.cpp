@@ -24,10 +24,14 @@
 
 #include "../Core/Context.h"
 #include "../IO/Deserializer.h"
+#include "../IO/File.h"
 #include "../IO/FileSystem.h"
 #include "../IO/Log.h"
+#include "../IO/VectorBuffer.h"
 #include "../LuaScript/LuaFile.h"
+#include "../LuaScript/LuaScript.h"
 #include "../Core/ProcessUtils.h"
+#include "../Core/Timer.h"
 #include "../IO/Serializer.h"
 
 extern "C"
@@ -41,9 +45,18 @@ extern "C"
 namespace Urho3D
 {
 
+static const unsigned BYTECODE_CACHE_VERSION = 1;
+
+static int ByteCodeWriter(lua_State* L, const void* data, size_t size, void* userData)
+{
+    VectorBuffer* buffer = static_cast<VectorBuffer*>(userData);
+    return buffer->Write(data, (unsigned)size) == size ? 0 : 1;
+}
+
 LuaFile::LuaFile(Context* context) :
     Resource(context),
     size_(0),
+    checksum_(0),
     hasLoaded_(false),
     hasExecuted_(false)
 {
@@ -72,6 +85,14 @@ bool LuaFile::BeginLoad(Deserializer& source)
     if (source.Read(data_, size_) != size_)
         return false;
 
+    // Calculate checksum for identifying the file in the bytecode cache
+    const String& name = GetName();
+    checksum_ = 0;
+    for (unsigned i = 0; i < name.Length(); ++i)
+        checksum_ = SDBMHash(checksum_, (unsigned char)name[i]);
+    for (unsigned i = 0; i < size_; ++i)
+        checksum_ = SDBMHash(checksum_, (unsigned char)data_[i]);
+
     SetMemoryUse(size_);
 
     return true;
@@ -99,6 +120,7 @@ bool LuaFile::LoadChunk(lua_State* luaState)
     if (!luaState)
         return false;
 
+    HiresTimer loadTimer;
     int top = lua_gettop(luaState);
 
     // Get file base name
@@ -109,6 +131,25 @@ bool LuaFile::LoadChunk(lua_State* luaState)
         name = name.Substring(0, extPos);
     }
 
+    // Check the bytecode cache, unless the file is already bytecode
+    String cacheFileName;
+    LuaScript* luaScript = GetSubsystem<LuaScript>();
+    if (luaScript && !luaScript->GetByteCodeCacheDir().Empty() && data_[0] != LUA_SIGNATURE[0])
+    {
+#ifdef URHO3D_LUAJIT
+        cacheFileName = luaScript->GetByteCodeCacheDir() + ToString("%08x.ljc", checksum_);
+#else
+        cacheFileName = luaScript->GetByteCodeCacheDir() + ToString("%08x.luc", checksum_);
+#endif
+        if (LoadCachedChunk(luaState, cacheFileName, name))
+        {
+            LOGINFOF("Loaded Lua script %s from bytecode cache in %d ms", GetName().CString(),
+                (int)(loadTimer.GetUSec(false) / 1000));
+            hasLoaded_ = true;
+            return true;
+        }
+    }
+
     int error = luaL_loadbuffer(luaState, data_, size_, name.CString());
     if (error)
     {
@@ -118,12 +159,80 @@ bool LuaFile::LoadChunk(lua_State* luaState)
         return false;
     }
 
-    LOGINFO("Loaded Lua script " + GetName());
+    if (!cacheFileName.Empty())
+        SaveCachedChunk(luaState, cacheFileName);
+
+    LOGINFOF("Loaded Lua script %s in %d ms", GetName().CString(), (int)(loadTimer.GetUSec(false) / 1000));
     hasLoaded_ = true;
 
     return true;
 }
 
+bool LuaFile::LoadCachedChunk(lua_State* luaState, const String& cacheFileName, const String& chunkName)
+{
+    if (!GetSubsystem<FileSystem>()->FileExists(cacheFileName))
+        return false;
+
+    File file(context_, cacheFileName);
+    if (!file.IsOpen() || file.ReadFileID() != "ULBC")
+        return false;
+
+    if (file.ReadUInt() != BYTECODE_CACHE_VERSION || file.ReadUInt() != checksum_ || file.ReadUInt() != size_)
+    {
+        LOGDEBUG("Ignoring outdated bytecode cache " + cacheFileName);
+        return false;
+    }
+
+    unsigned byteCodeSize = file.GetSize() - file.GetPosition();
+    if (!byteCodeSize)
+        return false;
+
+    SharedArrayPtr<char> byteCode(new char[byteCodeSize]);
+    if (file.Read(byteCode.Get(), byteCodeSize) != byteCodeSize)
+        return false;
+
+    int top = lua_gettop(luaState);
+    if (luaL_loadbuffer(luaState, byteCode.Get(), byteCodeSize, chunkName.CString()))
+    {
+        LOGWARNING("Ignoring unloadable bytecode cache " + cacheFileName);
+        lua_settop(luaState, top);
+        return false;
+    }
+
+    return true;
+}
+
+void LuaFile::SaveCachedChunk(lua_State* luaState, const String& cacheFileName)
+{
+    VectorBuffer buffer;
+    if (lua_dump(luaState, ByteCodeWriter, &buffer) || !buffer.GetSize())
+    {
+        LOGWARNING("Could not dump bytecode of Lua script " + GetName());
+        return;
+    }
+
+    FileSystem* fileSystem = GetSubsystem<FileSystem>();
+    String pathName = GetPath(cacheFileName);
+    if (!fileSystem->DirExists(pathName) && !fileSystem->CreateDir(pathName))
+    {
+        LOGWARNING("Could not create bytecode cache directory " + pathName);
+        return;
+    }
+
+    File file(context_, cacheFileName, FILE_WRITE);
+    if (!file.IsOpen())
+    {
+        LOGWARNING("Could not write bytecode cache " + cacheFileName);
+        return;
+    }
+
+    file.WriteFileID("ULBC");
+    file.WriteUInt(BYTECODE_CACHE_VERSION);
+    file.WriteUInt(checksum_);
+    file.WriteUInt(size_);
+    file.Write(buffer.GetData(), buffer.GetSize());
+}
+
 bool LuaFile::LoadAndExecute(lua_State* luaState)
 {
     if (hasExecuted_)
@@ -54,10 +54,17 @@ public:
     bool LoadAndExecute(lua_State* luaState);
 
 private:
+    /// Load up-to-date bytecode from the bytecode cache as chunk. Return true if successful.
+    bool LoadCachedChunk(lua_State* luaState, const String& cacheFileName, const String& chunkName);
+    /// Save the loaded chunk on top of the stack to the bytecode cache.
+    void SaveCachedChunk(lua_State* luaState, const String& cacheFileName);
+
     /// File size.
     unsigned size_;
     /// File data.
     SharedArrayPtr<char> data_;
+    /// Checksum of the file name and data.
+    unsigned checksum_;
     /// Has loaded.
     bool hasLoaded_;
     /// Has executed.
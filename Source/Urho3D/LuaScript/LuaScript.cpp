@@ -328,6 +328,11 @@ void LuaScript::SetExecuteConsoleCommands(bool enable)
         UnsubscribeFromEvent(E_CONSOLECOMMAND);
 }
 
+void LuaScript::SetByteCodeCacheDir(const String& path)
+{
+    byteCodeCacheDir_ = path.Empty() ? String::EMPTY : AddTrailingSlash(path);
+}
+
 void LuaScript::RegisterLoader()
 {
     // Get package.loaders table
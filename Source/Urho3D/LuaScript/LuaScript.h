@@ -81,6 +81,8 @@ public:
     void SendEvent(const String& eventName, VariantMap& eventData);
     /// Set whether to execute engine console commands as script code.
     void SetExecuteConsoleCommands(bool enable);
+    /// Set bytecode cache directory. Lua files loaded from source are saved there as bytecode keyed by a checksum of the source, and loaded from there on subsequent loads. Empty (default) disables the cache.
+    void SetByteCodeCacheDir(const String& path);
 
     /// Return Lua state.
     lua_State* GetState() const { return luaState_; }
@@ -93,6 +95,9 @@ public:
     /// Return whether is executing engine console commands as script code.
     bool GetExecuteConsoleCommands() const { return executeConsoleCommands_; }
 
+    /// Return bytecode cache directory.
+    const String& GetByteCodeCacheDir() const { return byteCodeCacheDir_; }
+
 private:
     /// Register loader.
     void RegisterLoader();
@@ -120,6 +125,8 @@ private:
     LuaFunction* coroutineUpdate_;
     /// Flag for executing engine console commands as script code. Default to true.
     bool executeConsoleCommands_;
+    /// Bytecode cache directory.
+    String byteCodeCacheDir_;
     /// Function pointer to function map.
     HashMap<const void*, SharedPtr<LuaFunction> > functionPointerToFunctionMap_;
     /// Function name to function map.
@@ -402,14 +402,27 @@ template <typename T> int tolua_pushurho3dpodvectorusertype(lua_State* L, const
     return 1;
 }
 
+template <typename T> int tolua_pushurho3dpodvectorvalue(lua_State* L, const PODVector<T>& vector, const char* typeName)
+{
+    lua_newtable(L);
+    for (unsigned i = 0; i < vector.Size(); ++i)
+    {
+        // Plain value types are stored inside the userdata, so they need neither heap allocation nor garbage collection
+        tolua_pushusertype_value(L, &vector[i], sizeof(T), typeName);
+        lua_rawseti(L, -2, i + 1);
+    }
+
+    return 1;
+}
+
 template <> int ToluaPushPODVector<Vector3>(lua_State* L, void* data, const char*)
 {
-    return tolua_pushurho3dpodvectorusertype(L, *((const PODVector<Vector3>*)data), "Vector3");
+    return tolua_pushurho3dpodvectorvalue(L, *((const PODVector<Vector3>*)data), "Vector3");
 }
 
 template <> int ToluaPushPODVector<IntVector2>(lua_State* L, void* data, const char*)
 {
-    return tolua_pushurho3dpodvectorusertype(L, *((const PODVector<IntVector2>*)data), "IntVector2");
+    return tolua_pushurho3dpodvectorvalue(L, *((const PODVector<IntVector2>*)data), "IntVector2");
 }
 
 template <> int ToluaPushPODVector<OctreeQueryResult>(lua_State* L, void* data, const char*)
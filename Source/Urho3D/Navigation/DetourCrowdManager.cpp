@@ -24,6 +24,7 @@
 
 #include "../Scene/Component.h"
 #include "../Core/Context.h"
+#include "../Core/WorkQueue.h"
 #include "../Navigation/CrowdAgent.h"
 #include "../Graphics/DebugRenderer.h"
 #include "../Navigation/DetourCrowdManager.h"
@@ -52,13 +53,100 @@ namespace Urho3D
 extern const char* NAVIGATION_CATEGORY;
 
 static const unsigned DEFAULT_MAX_AGENTS = 512;
+static const int MIN_AGENTS_PER_WORK_ITEM = 32;
+
+/// Range of active crowd agents processed by one work item.
+struct CrowdAgentRange
+{
+    /// First active agent index.
+    int begin_;
+    /// One past the last active agent index.
+    int end_;
+};
+
+/// Distributes the per-agent phases of the crowd update to the work queue threads.
+class CrowdUpdateDispatcher : public dtCrowdParallelDispatcher
+{
+public:
+    /// Construct.
+    CrowdUpdateDispatcher(WorkQueue* workQueue, unsigned maxThreads) :
+        workQueue_(workQueue),
+        maxThreads_(maxThreads),
+        phase_(0)
+    {
+    }
+
+    /// Process one update phase for the active agents and wait for completion.
+    virtual void dispatch(dtCrowd* crowd, const int phase, const int nagents);
+
+    /// Work queue.
+    WeakPtr<WorkQueue> workQueue_;
+    /// Number of threads the crowd has per-thread data for, including the main thread.
+    unsigned maxThreads_;
+    /// Current update phase.
+    int phase_;
+    /// Agent ranges of the current phase.
+    PODVector<CrowdAgentRange> ranges_;
+};
+
+void UpdateCrowdAgentsWork(const WorkItem* item, unsigned threadIndex)
+{
+    dtCrowd* crowd = reinterpret_cast<dtCrowd*>(item->aux_);
+    CrowdUpdateDispatcher* dispatcher = reinterpret_cast<CrowdUpdateDispatcher*>(item->end_);
+    const CrowdAgentRange* range = reinterpret_cast<const CrowdAgentRange*>(item->start_);
+
+    crowd->updateAgentRange(dispatcher->phase_, range->begin_, range->end_, (int)threadIndex);
+}
+
+void CrowdUpdateDispatcher::dispatch(dtCrowd* crowd, const int phase, const int nagents)
+{
+    WorkQueue* queue = workQueue_;
+    // Small crowds are cheaper to update without the synchronization. Also update in the main thread
+    // if the work queue has more threads than there is per-thread data for
+    if (!queue || nagents < MIN_AGENTS_PER_WORK_ITEM * 2 || queue->GetNumThreads() + 1 > maxThreads_)
+    {
+        crowd->updateAgentRange(phase, 0, nagents, 0);
+        return;
+    }
+
+    // The agents have been sorted spatially by the crowd, so contiguous ranges are also spatially coherent
+    int numWorkItems = Min((int)maxThreads_, nagents / MIN_AGENTS_PER_WORK_ITEM);
+    int agentsPerItem = nagents / numWorkItems;
+
+    phase_ = phase;
+    ranges_.Resize((unsigned)numWorkItems);
+
+    int start = 0;
+    for (int i = 0; i < numWorkItems; ++i)
+    {
+        int end = nagents;
+        if (i < numWorkItems - 1 && end - start > agentsPerItem)
+            end = start + agentsPerItem;
+
+        ranges_[i].begin_ = start;
+        ranges_[i].end_ = end;
+
+        SharedPtr<WorkItem> item = queue->GetFreeItem();
+        item->priority_ = M_MAX_UNSIGNED;
+        item->workFunction_ = UpdateCrowdAgentsWork;
+        item->aux_ = crowd;
+        item->start_ = &ranges_[i];
+        item->end_ = this;
+        queue->AddWorkItem(item);
+
+        start = end;
+    }
+
+    queue->Complete(M_MAX_UNSIGNED);
+}
 
 DetourCrowdManager::DetourCrowdManager(Context* context) :
     Component(context),
     maxAgents_(DEFAULT_MAX_AGENTS),
     crowd_(0),
     navigationMesh_(0),
-    agentDebug_(0)
+    agentDebug_(0),
+    updateDispatcher_(0)
 {
     agentBuffer_.Resize(maxAgents_);
 }
@@ -69,6 +157,8 @@ DetourCrowdManager::~DetourCrowdManager()
     crowd_ = 0;
     delete agentDebug_;
     agentDebug_ = 0;
+    delete updateDispatcher_;
+    updateDispatcher_ = 0;
 }
 
 void DetourCrowdManager::RegisterObject(Context* context)
@@ -247,6 +337,22 @@ bool DetourCrowdManager::CreateCrowd()
         return false;
     }
 
+    // Process the per-agent steering, neighbour queries and local avoidance in worker threads when available
+    delete updateDispatcher_;
+    updateDispatcher_ = 0;
+    WorkQueue* queue = GetSubsystem<WorkQueue>();
+    if (queue && queue->GetNumThreads())
+    {
+        unsigned maxThreads = queue->GetNumThreads() + 1;
+        updateDispatcher_ = new CrowdUpdateDispatcher(queue, maxThreads);
+        if (!crowd_->setParallelDispatcher(updateDispatcher_, (int)maxThreads))
+        {
+            LOGWARNING("Could not allocate per-thread data for DetourCrowd, updating in the main thread");
+            delete updateDispatcher_;
+            updateDispatcher_ = 0;
+        }
+    }
+
     // Setup local avoidance params to different qualities.
     dtObstacleAvoidanceParams params;
     memcpy(&params, crowd_->getObstacleAvoidanceParams(0), sizeof(dtObstacleAvoidanceParams));
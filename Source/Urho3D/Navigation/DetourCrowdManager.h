@@ -32,6 +32,7 @@ namespace Urho3D
 {
 
 class CrowdAgent;
+class CrowdUpdateDispatcher;
 class NavigationMesh;
 
 enum NavigationQuality
@@ -141,6 +142,8 @@ private:
     PODVector<dtCrowdAgent*> agentBuffer_;
     /// Container for fetching agents from DetourCrowd during update.
     PODVector<CrowdAgent*> agents_;
+    /// Dispatcher for running the per-agent crowd update phases in worker threads.
+    CrowdUpdateDispatcher* updateDispatcher_;
 };
 
 }
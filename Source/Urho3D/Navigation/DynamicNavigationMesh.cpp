@@ -26,6 +26,7 @@
 
 #include "../Math/BoundingBox.h"
 #include "../Core/Context.h"
+#include "../Core/WorkQueue.h"
 #include "../Navigation/CrowdAgent.h"
 #include "../Graphics/DebugRenderer.h"
 #include "../IO/Log.h"
@@ -39,6 +40,7 @@
 #include "../Core/Profiler.h"
 #include "../Scene/Scene.h"
 #include "../Scene/SceneEvents.h"
+#include "../Core/Timer.h"
 
 #include <LZ4/lz4.h>
 #include <cfloat>
@@ -61,6 +63,10 @@ namespace Urho3D
 extern const char* NAVIGATION_CATEGORY;
 
 static const int DEFAULT_MAX_OBSTACLES = 1024;
+static const int TILE_WORK_ITEMS_PER_THREAD = 4;
+static const unsigned DEFAULT_MAX_TILE_UPDATES = 1;
+static const unsigned TILE_UPDATE_WORK_PRIORITY = 0;
+static const int TILE_ALLOCATOR_SIZE = 32000;
 
 struct DynamicNavigationMesh::TileCacheData
 {
@@ -68,6 +74,36 @@ struct DynamicNavigationMesh::TileCacheData
     int dataSize;
 };
 
+/// Build task of one dynamic navigation mesh tile for the worker threads.
+struct DynamicNavigationTileBuildTask
+{
+    /// Geometry collected for the build.
+    Vector<NavigationGeometryInfo>* geometryList_;
+    /// Tile X coordinate.
+    int x_;
+    /// Tile Z coordinate.
+    int z_;
+    /// Resulting compressed tile cache layers.
+    PODVector<DynamicNavigationMesh::TileCacheData> layers_;
+};
+
+void BuildDynamicNavigationTilesWork(const WorkItem* item, unsigned threadIndex)
+{
+    DynamicNavigationMesh* navMesh = reinterpret_cast<DynamicNavigationMesh*>(item->aux_);
+    DynamicNavigationTileBuildTask* start = reinterpret_cast<DynamicNavigationTileBuildTask*>(item->start_);
+    DynamicNavigationTileBuildTask* end = reinterpret_cast<DynamicNavigationTileBuildTask*>(item->end_);
+
+    while (start != end)
+    {
+        DynamicNavigationMesh::TileCacheData tiles[TILECACHE_MAXLAYERS];
+        int layerCt = navMesh->BuildTile(*start->geometryList_, start->x_, start->z_, tiles);
+        start->layers_.Resize(layerCt);
+        for (int i = 0; i < layerCt; ++i)
+            start->layers_[i] = tiles[i];
+        ++start;
+    }
+}
+
 struct TileCompressor : public dtTileCacheCompressor
 {
     virtual int maxCompressedSize(const int bufferSize)
@@ -98,9 +134,12 @@ struct MeshProcess : public dtTileCacheMeshProcess
     PODVector<unsigned short> offMeshFlags_;
     PODVector<unsigned char> offMeshAreas_;
     PODVector<unsigned char> offMeshDir_;
+    /// Use the connection data collected beforehand in the main thread, as tiles are being built in worker threads.
+    bool useCachedConnections_;
 
     inline MeshProcess(DynamicNavigationMesh* owner) :
-        owner_(owner)
+        owner_(owner),
+        useCachedConnections_(false)
     {
     }
 
@@ -114,33 +153,20 @@ struct MeshProcess : public dtTileCacheMeshProcess
                 polyFlags[i] = RC_WALKABLE_AREA;
         }
 
-        BoundingBox bounds;
-        rcVcopy(&bounds.min_.x_, params->bmin);
-        rcVcopy(&bounds.max_.x_, params->bmin);
+        if (!useCachedConnections_)
+        {
+            BoundingBox bounds;
+            rcVcopy(&bounds.min_.x_, params->bmin);
+            rcVcopy(&bounds.max_.x_, params->bmin);
 
-        // collect off-mesh connections
-        PODVector<OffMeshConnection*> offMeshConnections = owner_->CollectOffMeshConnections(bounds);
+            // collect off-mesh connections
+            PODVector<OffMeshConnection*> offMeshConnections = owner_->CollectOffMeshConnections(bounds);
+            if (offMeshConnections.Size() != offMeshRadii_.Size())
+                SetConnectionData(offMeshConnections);
+        }
 
-        if (offMeshConnections.Size() > 0)
+        if (offMeshRadii_.Size() > 0)
         {
-            if (offMeshConnections.Size() != offMeshRadii_.Size())
-            {
-                Matrix3x4 inverse = owner_->GetNode()->GetWorldTransform().Inverse();
-                ClearConnectionData();
-                for (unsigned i = 0; i < offMeshConnections.Size(); ++i)
-                {
-                    OffMeshConnection* connection = offMeshConnections[i];
-                    Vector3 start = inverse * connection->GetNode()->GetWorldPosition();
-                    Vector3 end = inverse * connection->GetEndPoint()->GetWorldPosition();
-
-                    offMeshVertices_.Push(start);
-                    offMeshVertices_.Push(end);
-                    offMeshRadii_.Push(connection->GetRadius());
-                    offMeshFlags_.Push(connection->GetMask());
-                    offMeshAreas_.Push((unsigned char)connection->GetAreaID());
-                    offMeshDir_.Push(connection->IsBidirectional() ? DT_OFFMESH_CON_BIDIR : 0);
-                }
-            }
             params->offMeshConCount = offMeshRadii_.Size();
             params->offMeshConVerts = &offMeshVertices_[0].x_;
             params->offMeshConRad = &offMeshRadii_[0];
@@ -150,6 +176,25 @@ struct MeshProcess : public dtTileCacheMeshProcess
         }
     }
 
+    void SetConnectionData(const PODVector<OffMeshConnection*>& offMeshConnections)
+    {
+        Matrix3x4 inverse = owner_->GetNode()->GetWorldTransform().Inverse();
+        ClearConnectionData();
+        for (unsigned i = 0; i < offMeshConnections.Size(); ++i)
+        {
+            OffMeshConnection* connection = offMeshConnections[i];
+            Vector3 start = inverse * connection->GetNode()->GetWorldPosition();
+            Vector3 end = inverse * connection->GetEndPoint()->GetWorldPosition();
+
+            offMeshVertices_.Push(start);
+            offMeshVertices_.Push(end);
+            offMeshRadii_.Push(connection->GetRadius());
+            offMeshFlags_.Push(connection->GetMask());
+            offMeshAreas_.Push((unsigned char)connection->GetAreaID());
+            offMeshDir_.Push(connection->IsBidirectional() ? DT_OFFMESH_CON_BIDIR : 0);
+        }
+    }
+
     void ClearConnectionData()
     {
         offMeshVertices_.Clear();
@@ -209,17 +254,61 @@ struct LinearAllocator : public dtTileCacheAlloc
     }
 };
 
+/// Rebuild task of one tile cache tile affected by obstacle changes, for the worker threads.
+struct DynamicNavigationTileUpdateTask
+{
+    /// Construct.
+    DynamicNavigationTileUpdateTask() :
+        ref_(0),
+        navData_(0),
+        navDataSize_(0),
+        status_(DT_FAILURE),
+        buildTime_(0)
+    {
+    }
+
+    /// Compressed tile reference.
+    dtCompressedTileRef ref_;
+    /// Copy of the obstacles affecting the tile.
+    PODVector<dtTileCacheObstacle> obstacles_;
+    /// Resulting navigation mesh tile data. Null if the tile is empty.
+    unsigned char* navData_;
+    /// Resulting navigation mesh tile data size.
+    int navDataSize_;
+    /// Build status.
+    dtStatus status_;
+    /// Build time in microseconds.
+    unsigned buildTime_;
+    /// Work item. Not pooled, so that its completion flag remains valid until the result is swapped in.
+    SharedPtr<WorkItem> item_;
+};
+
+void UpdateDynamicNavigationTileWork(const WorkItem* item, unsigned threadIndex)
+{
+    DynamicNavigationMesh* navMesh = reinterpret_cast<DynamicNavigationMesh*>(item->aux_);
+    DynamicNavigationTileUpdateTask* task = reinterpret_cast<DynamicNavigationTileUpdateTask*>(item->start_);
+
+    HiresTimer timer;
+    task->status_ = navMesh->tileCache_->buildNavMeshTileData(task->ref_, task->obstacles_.Empty() ? 0 : &task->obstacles_[0],
+        (int)task->obstacles_.Size(), navMesh->threadAllocators_[threadIndex], &task->navData_, &task->navDataSize_);
+    task->buildTime_ = (unsigned)timer.GetUSec(false);
+}
+
 
 DynamicNavigationMesh::DynamicNavigationMesh(Context* context) :
     NavigationMesh(context),
     tileCache_(0),
     maxObstacles_(1024),
-    drawObstacles_(false)
+    drawObstacles_(false),
+    maxTileUpdates_(DEFAULT_MAX_TILE_UPDATES),
+    tileUpdateBudget_(0.0f),
+    threadedTileUpdates_(false),
+    averageTileBuildTime_(0)
 {
     //64 is the largest tile-size that DetourTileCache will tolerate without silently failing
     tileSize_ = 64;
     partitionType_ = NAVMESH_PARTITION_MONOTONE;
-    allocator_ = new LinearAllocator(32000); //32kb to start
+    allocator_ = new LinearAllocator(TILE_ALLOCATOR_SIZE); //32kb to start
     compressor_ = new TileCompressor();
     meshProcessor_ = new MeshProcess(this);
 }
@@ -233,6 +322,9 @@ DynamicNavigationMesh::~DynamicNavigationMesh()
     compressor_ = 0;
     delete meshProcessor_;
     meshProcessor_ = 0;
+    for (unsigned i = 0; i < threadAllocators_.Size(); ++i)
+        delete threadAllocators_[i];
+    threadAllocators_.Clear();
 }
 
 void DynamicNavigationMesh::RegisterObject(Context* context)
@@ -242,6 +334,9 @@ void DynamicNavigationMesh::RegisterObject(Context* context)
     COPY_BASE_ATTRIBUTES(NavigationMesh);
     ACCESSOR_ATTRIBUTE("Max Obstacles", GetMaxObstacles, SetMaxObstacles, unsigned, DEFAULT_MAX_OBSTACLES, AM_DEFAULT);
     ACCESSOR_ATTRIBUTE("Draw Obstacles", GetDrawObstacles, SetDrawObstacles, bool, false, AM_DEFAULT);
+    ACCESSOR_ATTRIBUTE("Max Tile Updates", GetMaxTileUpdates, SetMaxTileUpdates, unsigned, DEFAULT_MAX_TILE_UPDATES, AM_DEFAULT);
+    ACCESSOR_ATTRIBUTE("Tile Update Budget", GetTileUpdateBudget, SetTileUpdateBudget, float, 0.0f, AM_DEFAULT);
+    ACCESSOR_ATTRIBUTE("Threaded Tile Updates", GetThreadedTileUpdates, SetThreadedTileUpdates, bool, false, AM_DEFAULT);
 }
 
 bool DynamicNavigationMesh::Build()
@@ -344,29 +439,7 @@ bool DynamicNavigationMesh::Build()
         }
 
         // Build each tile
-        unsigned numTiles = 0;
-
-        for (int z = 0; z < numTilesZ_; ++z)
-        {
-            for (int x = 0; x < numTilesX_; ++x)
-            {
-                TileCacheData tiles[TILECACHE_MAXLAYERS];
-                int layerCt = BuildTile(geometryList, x, z, tiles);
-                for (int i = 0; i < layerCt; ++i)
-                {
-                    dtCompressedTileRef tileRef;
-                    int status = tileCache_->addTile(tiles[i].data, tiles[i].dataSize, DT_COMPRESSEDTILE_FREE_DATA, &tileRef);
-                    if (dtStatusFailed(status))
-                    {
-                        dtFree(tiles[i].data);
-                        tiles[i].data = 0x0;
-                    }
-                }
-                ++numTiles;
-            }
-            for (int x = 0; x < numTilesX_; ++x)
-                tileCache_->buildNavMeshTilesAt(x, z, navMesh_);
-        }
+        unsigned numTiles = BuildTiles(geometryList, IntVector2::ZERO, IntVector2(numTilesX_ - 1, numTilesZ_ - 1));
 
         // For a full build it's necessary to update the nav mesh
         // not doing so will cause dependent components to crash, like DetourCrowdManager
@@ -425,40 +498,7 @@ bool DynamicNavigationMesh::Build(const BoundingBox& boundingBox)
     int ex = Clamp((int)((localSpaceBox.max_.x_ - boundingBox_.min_.x_) / tileEdgeLength), 0, numTilesX_ - 1);
     int ez = Clamp((int)((localSpaceBox.max_.z_ - boundingBox_.min_.z_) / tileEdgeLength), 0, numTilesZ_ - 1);
 
-    unsigned numTiles = 0;
-
-    for (int z = sz; z <= ez; ++z)
-    {
-        for (int x = sx; x <= ex; ++x)
-        {
-            dtCompressedTileRef existing[TILECACHE_MAXLAYERS];
-            const int existingCt = tileCache_->getTilesAt(x, z, existing, TILECACHE_MAXLAYERS);
-            for (int i = 0; i < existingCt; ++i)
-            {
-                unsigned char* data = 0x0;
-                if (!dtStatusFailed(tileCache_->removeTile(existing[i], &data, 0)) && data != 0x0)
-                    dtFree(data);
-            }
-
-            TileCacheData tiles[TILECACHE_MAXLAYERS];
-            int layerCt = BuildTile(geometryList, x, z, tiles);
-            for (int i = 0; i < layerCt; ++i)
-            {
-                dtCompressedTileRef tileRef;
-                int status = tileCache_->addTile(tiles[i].data, tiles[i].dataSize, DT_COMPRESSEDTILE_FREE_DATA, &tileRef);
-                if (dtStatusFailed(status))
-                {
-                    dtFree(tiles[i].data);
-                    tiles[i].data = 0x0;
-                }
-                else
-                {
-                    tileCache_->buildNavMeshTile(tileRef, navMesh_);
-                    ++numTiles;
-                }
-            }
-        }
-    }
+    unsigned numTiles = BuildTiles(geometryList, IntVector2(sx, sz), IntVector2(ex, ez));
 
     LOGDEBUG("Rebuilt " + String(numTiles) + " tiles of the navigation mesh");
     return true;
@@ -667,24 +707,148 @@ PODVector<unsigned char> DynamicNavigationMesh::GetNavigationDataAttr() const
     return ret.GetBuffer();
 }
 
-int DynamicNavigationMesh::BuildTile(Vector<NavigationGeometryInfo>& geometryList, int x, int z, TileCacheData* tiles)
+void DynamicNavigationMesh::SetMaxTileUpdates(unsigned maxTileUpdates)
 {
-    PROFILE(BuildNavigationMeshTile);
+    maxTileUpdates_ = maxTileUpdates ? maxTileUpdates : 1;
+}
 
-    tileCache_->removeTile(navMesh_->getTileRefAt(x, z, 0), 0, 0);
+void DynamicNavigationMesh::SetTileUpdateBudget(float milliseconds)
+{
+    tileUpdateBudget_ = Max(milliseconds, 0.0f);
+}
 
-    float tileEdgeLength = (float)tileSize_ * cellSize_;
+void DynamicNavigationMesh::SetThreadedTileUpdates(bool enable)
+{
+    // Rebuilds already running in worker threads are swapped in on the next update regardless
+    threadedTileUpdates_ = enable;
+}
 
-    BoundingBox tileBoundingBox(Vector3(
-        boundingBox_.min_.x_ + tileEdgeLength * (float)x,
-        boundingBox_.min_.y_,
-        boundingBox_.min_.z_ + tileEdgeLength * (float)z
-        ),
-        Vector3(
-        boundingBox_.min_.x_ + tileEdgeLength * (float)(x + 1),
-        boundingBox_.max_.y_,
-        boundingBox_.min_.z_ + tileEdgeLength * (float)(z + 1)
-        ));
+void DynamicNavigationMesh::ResetTileUpdateStats()
+{
+    tileUpdateStats_ = NavigationTileUpdateStats();
+}
+
+unsigned DynamicNavigationMesh::GetNumPendingTileUpdates() const
+{
+    return tileCache_ ? (unsigned)tileCache_->getPendingTileCount() : 0;
+}
+
+unsigned DynamicNavigationMesh::BuildTiles(Vector<NavigationGeometryInfo>& geometryList, const IntVector2& from,
+    const IntVector2& to)
+{
+    PROFILE(BuildNavigationMeshTiles);
+
+    // The tiles being rebuilt in worker threads must not be removed under them
+    FinishTileUpdates(true);
+
+    // Remove previous tiles (if any) and prepare the build tasks in the main thread
+    Vector<DynamicNavigationTileBuildTask> tasks;
+    for (int z = from.y_; z <= to.y_; ++z)
+    {
+        for (int x = from.x_; x <= to.x_; ++x)
+        {
+            dtCompressedTileRef existing[TILECACHE_MAXLAYERS];
+            const int existingCt = tileCache_->getTilesAt(x, z, existing, TILECACHE_MAXLAYERS);
+            for (int i = 0; i < existingCt; ++i)
+            {
+                unsigned char* data = 0x0;
+                if (!dtStatusFailed(tileCache_->removeTile(existing[i], &data, 0)) && data != 0x0)
+                    dtFree(data);
+            }
+
+            DynamicNavigationTileBuildTask task;
+            task.geometryList_ = &geometryList;
+            task.x_ = x;
+            task.z_ = z;
+            tasks.Push(task);
+        }
+    }
+
+    if (tasks.Empty())
+        return 0;
+
+    // Build the tile layers in worker threads. Use several work items per thread, as the cost of tiles varies greatly
+    // depending on their geometry
+    WorkQueue* queue = GetSubsystem<WorkQueue>();
+    if (queue)
+    {
+        PROFILE(BuildNavigationMeshTileData);
+
+        int numWorkItems = Min((int)tasks.Size(), (int)(queue->GetNumThreads() + 1) * TILE_WORK_ITEMS_PER_THREAD);
+        int tasksPerItem = Max((int)(tasks.Size() / numWorkItems), 1);
+
+        Vector<DynamicNavigationTileBuildTask>::Iterator start = tasks.Begin();
+        for (int i = 0; i < numWorkItems; ++i)
+        {
+            SharedPtr<WorkItem> item = queue->GetFreeItem();
+            item->priority_ = M_MAX_UNSIGNED;
+            item->workFunction_ = BuildDynamicNavigationTilesWork;
+            item->aux_ = this;
+
+            Vector<DynamicNavigationTileBuildTask>::Iterator end = tasks.End();
+            if (i < numWorkItems - 1 && end - start > tasksPerItem)
+                end = start + tasksPerItem;
+
+            item->start_ = &(*start);
+            item->end_ = &(*end);
+            queue->AddWorkItem(item);
+
+            start = end;
+        }
+
+        queue->Complete(M_MAX_UNSIGNED);
+    }
+    else
+    {
+        WorkItem item;
+        item.aux_ = this;
+        item.start_ = &(*tasks.Begin());
+        item.end_ = &(*tasks.End());
+        BuildDynamicNavigationTilesWork(&item, 0);
+    }
+
+    // Add the finished layers to the tile cache and build the navigation mesh tiles in the main thread
+    for (unsigned i = 0; i < tasks.Size(); ++i)
+    {
+        DynamicNavigationTileBuildTask& task = tasks[i];
+        PODVector<TileCacheData>& layers = task.layers_;
+
+        for (unsigned j = 0; j < layers.Size(); ++j)
+        {
+            dtCompressedTileRef tileRef;
+            int status = tileCache_->addTile(layers[j].data, layers[j].dataSize, DT_COMPRESSEDTILE_FREE_DATA, &tileRef);
+            if (dtStatusFailed(status))
+            {
+                dtFree(layers[j].data);
+                layers[j].data = 0x0;
+            }
+        }
+
+        tileCache_->buildNavMeshTilesAt(task.x_, task.z_, navMesh_);
+
+        if (layers.Size())
+        {
+            // Send a notification of the rebuild of this tile to anyone interested
+            BoundingBox tileBoundingBox = GetTileBoundingBox(task.x_, task.z_);
+
+            using namespace NavigationAreaRebuilt;
+            VariantMap& eventData = GetContext()->GetEventDataMap();
+            eventData[P_NODE] = GetNode();
+            eventData[P_MESH] = this;
+            eventData[P_BOUNDSMIN] = Variant(tileBoundingBox.min_);
+            eventData[P_BOUNDSMAX] = Variant(tileBoundingBox.max_);
+            SendEvent(E_NAVIGATION_AREA_REBUILT, eventData);
+        }
+    }
+
+    return tasks.Size();
+}
+
+int DynamicNavigationMesh::BuildTile(Vector<NavigationGeometryInfo>& geometryList, int x, int z, TileCacheData* tiles)
+{
+    PROFILE(BuildNavigationMeshTile);
+
+    BoundingBox tileBoundingBox = GetTileBoundingBox(x, z);
 
     DynamicNavBuildData build(allocator_);
 
@@ -839,17 +1003,6 @@ int DynamicNavigationMesh::BuildTile(Vector<NavigationGeometryInfo>& geometryLis
             ++retCt;
     }
 
-    // Send a notification of the rebuild of this tile to anyone interested
-    {
-        using namespace NavigationAreaRebuilt;
-        VariantMap& eventData = GetContext()->GetEventDataMap();
-        eventData[P_NODE] = GetNode();
-        eventData[P_MESH] = this;
-        eventData[P_BOUNDSMIN] = Variant(tileBoundingBox.min_);
-        eventData[P_BOUNDSMAX] = Variant(tileBoundingBox.max_);
-        SendEvent(E_NAVIGATION_AREA_REBUILT, eventData);
-    }
-
     return retCt;
 }
 
@@ -879,6 +1032,9 @@ void DynamicNavigationMesh::ReleaseNavigationMesh()
 
 void DynamicNavigationMesh::ReleaseTileCache()
 {
+    FinishTileUpdates(false);
+    obstacleRequests_.Clear();
+
     dtFreeTileCache(tileCache_);
     tileCache_ = 0;
 }
@@ -903,6 +1059,8 @@ void DynamicNavigationMesh::AddObstacle(Obstacle* obstacle, bool silent)
 
         // Because dtTileCache doesn't process obstacle requests while updating tiles 
         // it's necessary update until sufficient request space is available
+        if (tileCache_->isObstacleQueueFull())
+            FinishTileUpdates(true);
         while (tileCache_->isObstacleQueueFull())
             tileCache_->update(1, navMesh_);
 
@@ -913,6 +1071,7 @@ void DynamicNavigationMesh::AddObstacle(Obstacle* obstacle, bool silent)
         }
         obstacle->obstacleId_ = refHolder;
         assert(refHolder > 0);
+        AddObstacleRequest(refHolder);
 
         if (!silent)
         {
@@ -943,6 +1102,8 @@ void DynamicNavigationMesh::RemoveObstacle(Obstacle* obstacle, bool silent)
     {
         // Because dtTileCache doesn't process obstacle requests while updating tiles 
         // it's necessary update until sufficient request space is available
+        if (tileCache_->isObstacleQueueFull())
+            FinishTileUpdates(true);
         while (tileCache_->isObstacleQueueFull())
             tileCache_->update(1, navMesh_);
 
@@ -951,6 +1112,7 @@ void DynamicNavigationMesh::RemoveObstacle(Obstacle* obstacle, bool silent)
             LOGERROR("Failed to remove obstacle");
             return;
         }
+        AddObstacleRequest(obstacle->obstacleId_);
         obstacle->obstacleId_ = 0;
         // Require a node in order to send an event
         if (!silent && obstacle->GetNode())
@@ -972,7 +1134,226 @@ void DynamicNavigationMesh::HandleSceneSubsystemUpdate(StringHash eventType, Var
     using namespace SceneSubsystemUpdate;
 
     if (tileCache_ && navMesh_ && IsEnabledEffective())
-        tileCache_->update(eventData[P_TIMESTEP].GetFloat(), navMesh_);
+        UpdateTiles();
+
+    // Process the asynchronous path requests after the tile cache has been updated
+    NavigationMesh::HandleSceneSubsystemUpdate(eventType, eventData);
+}
+
+void DynamicNavigationMesh::UpdateTiles()
+{
+    PROFILE(UpdateNavigationTiles);
+
+    HiresTimer timer;
+    unsigned numUpdated = 0;
+
+    // Swap in the tiles rebuilt in worker threads since the last frame. New rebuilds are started only after all
+    // results have been swapped in
+    if (!tileUpdateTasks_.Empty())
+        numUpdated += CommitTileUpdates(timer, true);
+
+    if (tileUpdateTasks_.Empty())
+    {
+        WorkQueue* queue = GetSubsystem<WorkQueue>();
+        if (threadedTileUpdates_ && queue && queue->GetNumThreads())
+            StartTileUpdates(queue);
+        else
+        {
+            // Rebuild in the main thread until the tile count or time budget is exhausted
+            long long budget = (long long)(tileUpdateBudget_ * 1000.0f);
+            while (numUpdated < maxTileUpdates_ && tileCache_->processObstacleRequests())
+            {
+                tileCache_->update(0, navMesh_);
+                ++numUpdated;
+                if (budget > 0 && timer.GetUSec(false) >= budget)
+                    break;
+            }
+        }
+    }
+
+    UpdateObstacleRequests();
+
+    tileUpdateStats_.numTilesUpdated_ += numUpdated;
+    tileUpdateStats_.numTilesUpdatedLastFrame_ = numUpdated;
+    tileUpdateStats_.numPendingTiles_ = GetNumPendingTileUpdates();
+    tileUpdateStats_.numPendingObstacleRequests_ = obstacleRequests_.Size();
+    tileUpdateStats_.lastUpdateTime_ = (unsigned)timer.GetUSec(false);
+}
+
+void DynamicNavigationMesh::StartTileUpdates(WorkQueue* queue)
+{
+    unsigned numPending = (unsigned)tileCache_->processObstacleRequests();
+    if (!numPending)
+        return;
+
+    // The tile cache's allocator is reset for every tile, so each thread needs its own
+    unsigned numThreads = queue->GetNumThreads() + 1;
+    while (threadAllocators_.Size() < numThreads)
+        threadAllocators_.Push(new LinearAllocator(TILE_ALLOCATOR_SIZE));
+
+    // Collect the off-mesh connections in the main thread, as the mesh processor runs in the worker threads
+    MeshProcess* meshProcess = static_cast<MeshProcess*>(meshProcessor_);
+    meshProcess->SetConnectionData(CollectOffMeshConnections(boundingBox_));
+    meshProcess->useCachedConnections_ = true;
+
+    PODVector<dtTileCacheObstacle> obstacles((unsigned)tileCache_->getObstacleCount());
+    unsigned numTiles = numPending < maxTileUpdates_ ? numPending : maxTileUpdates_;
+
+    // Start only as many rebuilds as the threads are estimated to finish within the time budget, based on the average
+    // rebuild time so far. At least one tile is always rebuilt
+    long long budget = (long long)(tileUpdateBudget_ * 1000.0f);
+    if (budget > 0 && averageTileBuildTime_ > 0)
+    {
+        unsigned maxTiles = (unsigned)(budget * numThreads / averageTileBuildTime_);
+        if (maxTiles < 1)
+            maxTiles = 1;
+        if (numTiles > maxTiles)
+            numTiles = maxTiles;
+    }
+
+    for (unsigned i = 0; i < numTiles; ++i)
+    {
+        DynamicNavigationTileUpdateTask* task = new DynamicNavigationTileUpdateTask();
+        task->ref_ = tileCache_->getPendingTile(i);
+
+        // Copy the obstacles affecting the tile, as they may change while the tile is being rebuilt
+        int numObstacles = obstacles.Empty() ? 0 : tileCache_->getTileObstacles(task->ref_, &obstacles[0], (int)obstacles.Size());
+        task->obstacles_.Resize((unsigned)numObstacles);
+        for (int j = 0; j < numObstacles; ++j)
+            task->obstacles_[j] = obstacles[j];
+
+        SharedPtr<WorkItem> item(new WorkItem());
+        item->priority_ = TILE_UPDATE_WORK_PRIORITY;
+        item->workFunction_ = UpdateDynamicNavigationTileWork;
+        item->aux_ = this;
+        item->start_ = task;
+        task->item_ = item;
+
+        tileUpdateTasks_.Push(task);
+        queue->AddWorkItem(item);
+    }
+}
+
+unsigned DynamicNavigationMesh::CommitTileUpdates(HiresTimer& timer, bool useBudget)
+{
+    long long budget = useBudget ? (long long)(tileUpdateBudget_ * 1000.0f) : 0;
+    unsigned numCommitted = 0;
+
+    for (unsigned i = 0; i < tileUpdateTasks_.Size();)
+    {
+        DynamicNavigationTileUpdateTask* task = tileUpdateTasks_[i];
+        if (!task->item_->completed_)
+        {
+            ++i;
+            continue;
+        }
+
+        // The navigation mesh takes ownership of the data. A failed build leaves the old tile in place
+        if (!dtStatusFailed(task->status_))
+            tileCache_->replaceNavMeshTile(task->ref_, task->navData_, task->navDataSize_, navMesh_);
+        tileCache_->markTileUpdated(task->ref_);
+
+        // Keep a moving average of the rebuild time for limiting the rebuilds started per frame
+        averageTileBuildTime_ = averageTileBuildTime_ ? (averageTileBuildTime_ * 3 + task->buildTime_) / 4 : task->buildTime_;
+        if (!averageTileBuildTime_)
+            averageTileBuildTime_ = 1;
+
+        delete task;
+        tileUpdateTasks_.Erase(i);
+        ++numCommitted;
+
+        if (budget > 0 && timer.GetUSec(false) >= budget)
+            break;
+    }
+
+    if (tileUpdateTasks_.Empty())
+        static_cast<MeshProcess*>(meshProcessor_)->useCachedConnections_ = false;
+
+    return numCommitted;
+}
+
+void DynamicNavigationMesh::FinishTileUpdates(bool commit)
+{
+    if (tileUpdateTasks_.Empty())
+        return;
+
+    PROFILE(FinishNavigationTileUpdates);
+
+    // Rebuild the tiles not yet taken by the worker threads in the main thread, and wait for the rest. If the work queue
+    // no longer exists, its threads have been stopped and the remaining items will never be run
+    WorkQueue* queue = GetSubsystem<WorkQueue>();
+    for (unsigned i = 0; i < tileUpdateTasks_.Size(); ++i)
+    {
+        WorkItem* item = tileUpdateTasks_[i]->item_;
+        if (!queue || item->completed_)
+            continue;
+
+        if (queue->RemoveWorkItem(tileUpdateTasks_[i]->item_))
+        {
+            if (commit)
+                UpdateDynamicNavigationTileWork(item, 0);
+            item->completed_ = true;
+        }
+        else
+        {
+            while (!item->completed_)
+                Time::Sleep(0);
+        }
+    }
+
+    if (commit)
+    {
+        HiresTimer timer;
+        unsigned numCommitted = CommitTileUpdates(timer, false);
+        tileUpdateStats_.numTilesUpdated_ += numCommitted;
+    }
+
+    // Discard what remains
+    for (unsigned i = 0; i < tileUpdateTasks_.Size(); ++i)
+    {
+        DynamicNavigationTileUpdateTask* task = tileUpdateTasks_[i];
+        if (task->item_->completed_ && task->navData_)
+            dtFree(task->navData_);
+        delete task;
+    }
+    tileUpdateTasks_.Clear();
+    static_cast<MeshProcess*>(meshProcessor_)->useCachedConnections_ = false;
+}
+
+void DynamicNavigationMesh::AddObstacleRequest(unsigned obstacleRef)
+{
+    NavigationObstacleRequest request;
+    request.obstacleRef_ = obstacleRef;
+    request.requestTime_ = Time::GetSystemTime();
+    obstacleRequests_.Push(request);
+}
+
+void DynamicNavigationMesh::UpdateObstacleRequests()
+{
+    if (obstacleRequests_.Empty())
+        return;
+
+    unsigned currentTime = Time::GetSystemTime();
+
+    for (unsigned i = 0; i < obstacleRequests_.Size();)
+    {
+        // An added obstacle is reflected in the navigation mesh once processed, a removed one once its reference has
+        // become invalid
+        const dtTileCacheObstacle* ob = tileCache_->getObstacleByRef(obstacleRequests_[i].obstacleRef_);
+        if (ob && ob->state != DT_OBSTACLE_PROCESSED)
+        {
+            ++i;
+            continue;
+        }
+
+        unsigned latency = currentTime - obstacleRequests_[i].requestTime_;
+        ++tileUpdateStats_.numObstacleRequests_;
+        tileUpdateStats_.totalLatency_ += latency;
+        if (latency > tileUpdateStats_.maxLatency_)
+            tileUpdateStats_.maxLatency_ = latency;
+
+        obstacleRequests_.Erase(i);
+    }
 }
 
 }
@@ -35,14 +35,66 @@ struct dtTileCachePolyMesh;
 namespace Urho3D
 {
 
+class HiresTimer;
 class OffMeshConnection;
 class Obstacle;
+class WorkQueue;
+struct DynamicNavigationTileUpdateTask;
+
+/// Obstacle add or remove request waiting for the navigation mesh to be updated.
+struct NavigationObstacleRequest
+{
+    /// Tile cache obstacle reference.
+    unsigned obstacleRef_;
+    /// Time of the request in milliseconds.
+    unsigned requestTime_;
+};
+
+/// Dynamic navigation mesh tile update statistics.
+struct URHO3D_API NavigationTileUpdateStats
+{
+    /// Construct.
+    NavigationTileUpdateStats() :
+        numPendingTiles_(0),
+        numPendingObstacleRequests_(0),
+        numTilesUpdated_(0),
+        numTilesUpdatedLastFrame_(0),
+        lastUpdateTime_(0),
+        numObstacleRequests_(0),
+        totalLatency_(0),
+        maxLatency_(0)
+    {
+    }
+
+    /// Return average latency from obstacle change to navigation mesh update in milliseconds.
+    float GetAverageLatency() const { return numObstacleRequests_ ? (float)totalLatency_ / (float)numObstacleRequests_ : 0.0f; }
+
+    /// Number of tiles waiting to be rebuilt, including the ones being rebuilt in worker threads.
+    unsigned numPendingTiles_;
+    /// Number of obstacle add and remove requests not yet reflected in the navigation mesh.
+    unsigned numPendingObstacleRequests_;
+    /// Number of rebuilt tiles.
+    unsigned numTilesUpdated_;
+    /// Number of tiles rebuilt or swapped in during the last frame.
+    unsigned numTilesUpdatedLastFrame_;
+    /// Main thread time spent updating the tiles during the last frame in microseconds.
+    unsigned lastUpdateTime_;
+    /// Number of obstacle add and remove requests reflected in the navigation mesh.
+    unsigned numObstacleRequests_;
+    /// Sum of obstacle request latencies in milliseconds.
+    unsigned totalLatency_;
+    /// Maximum obstacle request latency in milliseconds.
+    unsigned maxLatency_;
+};
 
 class URHO3D_API DynamicNavigationMesh : public NavigationMesh
 {
     OBJECT(DynamicNavigationMesh)
     friend class Obstacle;
     friend struct MeshProcess;
+    friend struct DynamicNavigationTileBuildTask;
+    friend void BuildDynamicNavigationTilesWork(const WorkItem* item, unsigned threadIndex);
+    friend void UpdateDynamicNavigationTileWork(const WorkItem* item, unsigned threadIndex);
 
 public:
     /// Constructor.
@@ -77,6 +129,26 @@ public:
     /// Return whether to draw Obstacles.
     bool GetDrawObstacles() const { return drawObstacles_; }
 
+    /// Set the maximum number of tiles rebuilt per frame due to obstacle changes.
+    void SetMaxTileUpdates(unsigned maxTileUpdates);
+    /// Return the maximum number of tiles rebuilt per frame.
+    unsigned GetMaxTileUpdates() const { return maxTileUpdates_; }
+    /// Set the main thread time budget in milliseconds for rebuilding tiles per frame. 0 = limited only by the tile count. At least one tile is always rebuilt. With threaded updates, also limits the rebuilds started per frame to those estimated to finish within the budget in each thread.
+    void SetTileUpdateBudget(float milliseconds);
+    /// Return the main thread time budget for rebuilding tiles per frame.
+    float GetTileUpdateBudget() const { return tileUpdateBudget_; }
+    /// Set whether to rebuild the tiles in worker threads. The results are swapped in at the start of the next frame.
+    void SetThreadedTileUpdates(bool enable);
+    /// Return whether tiles are rebuilt in worker threads.
+    bool GetThreadedTileUpdates() const { return threadedTileUpdates_; }
+
+    /// Reset the tile update statistics.
+    void ResetTileUpdateStats();
+    /// Return number of tiles waiting to be rebuilt.
+    unsigned GetNumPendingTileUpdates() const;
+    /// Return tile update statistics.
+    const NavigationTileUpdateStats& GetTileUpdateStats() const { return tileUpdateStats_; }
+
 protected:
     struct TileCacheData;
 
@@ -92,13 +164,28 @@ protected:
     /// Used by Obstacle class to remove itself from the tile cache, if 'silent' an event will not be raised.
     void RemoveObstacle(Obstacle*, bool silent = false);
 
-    /// Build one tile of the navigation mesh. Return true if successful.
+    /// Build the compressed layers of one tile without modifying the tile cache. Can be called from worker threads. Return number of layers built.
     int BuildTile(Vector<NavigationGeometryInfo>& geometryList, int x, int z, TileCacheData*);
+    /// Build a rectangular range of tiles. The layers are built in worker threads and added to the tile cache in the main thread. Return number of tiles built.
+    virtual unsigned BuildTiles(Vector<NavigationGeometryInfo>& geometryList, const IntVector2& from, const IntVector2& to);
     /// Off-mesh connections to be rebuilt in the mesh processor.
     PODVector<OffMeshConnection*> CollectOffMeshConnections(const BoundingBox& bounds);
     /// Release the navigation mesh, query, and tile cache.
     virtual void ReleaseNavigationMesh();
 
+    /// Rebuild the tiles affected by obstacle changes within the per-frame limits.
+    void UpdateTiles();
+    /// Start rebuilding pending tiles in worker threads.
+    void StartTileUpdates(WorkQueue* queue);
+    /// Swap in tiles rebuilt by worker threads within the time budget. Return number of tiles swapped in.
+    unsigned CommitTileUpdates(HiresTimer& timer, bool useBudget);
+    /// Wait for the tile rebuilds in worker threads to finish, then either swap in or discard the results.
+    void FinishTileUpdates(bool commit);
+    /// Track an obstacle request for latency statistics.
+    void AddObstacleRequest(unsigned obstacleRef);
+    /// Update the obstacle requests that have been reflected in the navigation mesh.
+    void UpdateObstacleRequests();
+
 private:
     /// Free the tile cache.
     void ReleaseTileCache();
@@ -115,6 +202,22 @@ private:
     unsigned maxObstacles_;
     /// Debug draw Obstacles.
     bool drawObstacles_;
+    /// Maximum number of tiles rebuilt per frame.
+    unsigned maxTileUpdates_;
+    /// Main thread time budget for rebuilding tiles per frame in milliseconds.
+    float tileUpdateBudget_;
+    /// Rebuild tiles in worker threads.
+    bool threadedTileUpdates_;
+    /// Moving average of the tile rebuild time in worker threads in microseconds.
+    unsigned averageTileBuildTime_;
+    /// Tile rebuilds in worker threads.
+    PODVector<DynamicNavigationTileUpdateTask*> tileUpdateTasks_;
+    /// Allocators for rebuilding tiles in worker threads, indexed by thread.
+    PODVector<dtTileCacheAlloc*> threadAllocators_;
+    /// Obstacle requests waiting for the navigation mesh to be updated.
+    PODVector<NavigationObstacleRequest> obstacleRequests_;
+    /// Tile update statistics.
+    NavigationTileUpdateStats tileUpdateStats_;
 };
 
 }
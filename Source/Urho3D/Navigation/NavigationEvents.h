@@ -43,6 +43,16 @@ EVENT(E_NAVIGATION_AREA_REBUILT, NavigationAreaRebuilt)
     PARAM(P_BOUNDSMAX, BoundsMax); // Vector3
 }
 
+/// Asynchronous path request has been completed.
+EVENT(E_NAVIGATION_PATH_RESULT, NavigationPathResult)
+{
+    PARAM(P_NODE, Node); // Node pointer
+    PARAM(P_MESH, Mesh); // NavigationMesh pointer
+    PARAM(P_REQUESTID, RequestID); // unsigned
+    PARAM(P_SUCCESS, Success); // bool
+    PARAM(P_PATH, Path); // VariantVector of world space path points (Vector3)
+}
+
 /// Crowd agent has been repositioned.
 EVENT(E_CROWD_AGENT_REPOSITION, CrowdAgentReposition)
 {
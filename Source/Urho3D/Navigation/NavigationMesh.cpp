@@ -26,6 +26,8 @@
 #include "../Physics/CollisionShape.h"
 #endif
 #include "../Core/Context.h"
+#include "../Core/Timer.h"
+#include "../Core/WorkQueue.h"
 #include "../Graphics/DebugRenderer.h"
 #include "../Graphics/Drawable.h"
 #include "../Navigation/DynamicNavigationMesh.h"
@@ -42,6 +44,7 @@
 #include "../Navigation/OffMeshConnection.h"
 #include "../Core/Profiler.h"
 #include "../Scene/Scene.h"
+#include "../Scene/SceneEvents.h"
 #include "../Graphics/StaticModel.h"
 #include "../Graphics/TerrainPatch.h"
 #include "../IO/VectorBuffer.h"
@@ -83,8 +86,10 @@ static const float DEFAULT_EDGE_MAX_ERROR = 1.3f;
 static const float DEFAULT_DETAIL_SAMPLE_DISTANCE = 6.0f;
 static const float DEFAULT_DETAIL_SAMPLE_MAX_ERROR = 1.0f;
 
-static const int MAX_POLYS = 2048;
+static const int DEFAULT_PATH_REQUEST_ITERATIONS = 1000;
 
+static const int MAX_POLYS = 2048;
+static const int TILE_WORK_ITEMS_PER_THREAD = 4;
 
 /// Temporary data for finding a path.
 struct FindPathData
@@ -101,12 +106,103 @@ struct FindPathData
     unsigned char pathAreras_[MAX_POLYS];
 };
 
+/// Asynchronous path request.
+struct NavigationPathRequest
+{
+    /// Request ID.
+    unsigned id_;
+    /// Start point in navigation mesh local space.
+    Vector3 start_;
+    /// End point in navigation mesh local space.
+    Vector3 end_;
+    /// Search extents.
+    Vector3 extents_;
+    /// System time of the request in milliseconds.
+    unsigned requestTime_;
+    /// Success flag.
+    bool success_;
+    /// Resulting path points in navigation mesh local space.
+    PODVector<Vector3> path_;
+};
+
+/// Asynchronous path query lane. Requests are searched one at a time using the lane's own Detour query.
+struct NavigationPathQueryLane
+{
+    /// Construct.
+    NavigationPathQueryLane() :
+        query_(0),
+        pathData_(new FindPathData()),
+        active_(false),
+        numIterations_(0)
+    {
+    }
+
+    /// Destruct.
+    ~NavigationPathQueryLane()
+    {
+        dtFreeNavMeshQuery(query_);
+        delete pathData_;
+    }
+
+    /// Detour navigation mesh query.
+    dtNavMeshQuery* query_;
+    /// Temporary data for finding a path.
+    FindPathData* pathData_;
+    /// Queued requests. The front request is being searched if the active flag is set.
+    List<NavigationPathRequest> requests_;
+    /// Completed requests waiting to be sent in the main thread.
+    Vector<NavigationPathRequest> finished_;
+    /// Sliced search in progress flag.
+    bool active_;
+    /// Search iterations during the current update.
+    unsigned numIterations_;
+};
+
+void ProcessPathQueryLaneWork(const WorkItem* item, unsigned threadIndex)
+{
+    NavigationMesh* navMesh = reinterpret_cast<NavigationMesh*>(item->aux_);
+    navMesh->ProcessPathQueryLane(reinterpret_cast<NavigationPathQueryLane*>(item->start_));
+}
+
+/// Build task of one navigation mesh tile for the worker threads.
+struct NavigationTileBuildTask
+{
+    /// Geometry collected for the build.
+    Vector<NavigationGeometryInfo>* geometryList_;
+    /// Tile X coordinate.
+    int x_;
+    /// Tile Z coordinate.
+    int z_;
+    /// Resulting Detour tile data, null if the tile is empty.
+    unsigned char* navData_;
+    /// Resulting Detour tile data size.
+    int navDataSize_;
+    /// Success flag.
+    bool success_;
+};
+
+void BuildNavigationTilesWork(const WorkItem* item, unsigned threadIndex)
+{
+    NavigationMesh* navMesh = reinterpret_cast<NavigationMesh*>(item->aux_);
+    NavigationTileBuildTask* start = reinterpret_cast<NavigationTileBuildTask*>(item->start_);
+    NavigationTileBuildTask* end = reinterpret_cast<NavigationTileBuildTask*>(item->end_);
+
+    while (start != end)
+    {
+        start->success_ = navMesh->BuildTileData(*start->geometryList_, start->x_, start->z_, start->navData_,
+            start->navDataSize_);
+        ++start;
+    }
+}
+
 NavigationMesh::NavigationMesh(Context* context) :
     Component(context),
     navMesh_(0),
     navMeshQuery_(0),
     queryFilter_(new dtQueryFilter()),
     pathData_(new FindPathData()),
+    nextPathRequestID_(1),
+    pathRequestIterations_(DEFAULT_PATH_REQUEST_ITERATIONS),
     tileSize_(DEFAULT_TILE_SIZE),
     cellSize_(DEFAULT_CELL_SIZE),
     cellHeight_(DEFAULT_CELL_HEIGHT),
@@ -134,6 +230,10 @@ NavigationMesh::~NavigationMesh()
 {
     ReleaseNavigationMesh();
 
+    for (unsigned i = 0; i < pathQueryLanes_.Size(); ++i)
+        delete pathQueryLanes_[i];
+    pathQueryLanes_.Clear();
+
     delete queryFilter_;
     queryFilter_ = 0;
 
@@ -406,16 +506,7 @@ bool NavigationMesh::Build()
         }
 
         // Build each tile
-        unsigned numTiles = 0;
-
-        for (int z = 0; z < numTilesZ_; ++z)
-        {
-            for (int x = 0; x < numTilesX_; ++x)
-            {
-                if (BuildTile(geometryList, x, z))
-                    ++numTiles;
-            }
-        }
+        unsigned numTiles = BuildTiles(geometryList, IntVector2::ZERO, IntVector2(numTilesX_ - 1, numTilesZ_ - 1));
 
         LOGDEBUG("Built navigation mesh with " + String(numTiles) + " tiles");
 
@@ -460,16 +551,7 @@ bool NavigationMesh::Build(const BoundingBox& boundingBox)
     int ex = Clamp((int)((localSpaceBox.max_.x_ - boundingBox_.min_.x_) / tileEdgeLength), 0, numTilesX_ - 1);
     int ez = Clamp((int)((localSpaceBox.max_.z_ - boundingBox_.min_.z_) / tileEdgeLength), 0, numTilesZ_ - 1);
 
-    unsigned numTiles = 0;
-
-    for (int z = sz; z <= ez; ++z)
-    {
-        for (int x = sx; x <= ex; ++x)
-        {
-            if (BuildTile(geometryList, x, z))
-                ++numTiles;
-        }
-    }
+    unsigned numTiles = BuildTiles(geometryList, IntVector2(sx, sz), IntVector2(ex, ez));
 
     LOGDEBUG("Rebuilt " + String(numTiles) + " tiles of the navigation mesh");
     return true;
@@ -565,6 +647,85 @@ void NavigationMesh::FindPath(PODVector<Vector3>& dest, const Vector3& start, co
         dest.Push(transform * pathData_->pathPoints_[i]);
 }
 
+unsigned NavigationMesh::RequestPath(const Vector3& start, const Vector3& end, const Vector3& extents)
+{
+    if (!node_)
+        return 0;
+
+    if (pathQueryLanes_.Empty())
+    {
+        // Use one lane per worker thread plus the main thread
+        WorkQueue* queue = GetSubsystem<WorkQueue>();
+        unsigned numLanes = queue ? queue->GetNumThreads() + 1 : 1;
+        for (unsigned i = 0; i < numLanes; ++i)
+            pathQueryLanes_.Push(new NavigationPathQueryLane());
+    }
+
+    // Navigation data is in local space. Transform path points from world to local
+    Matrix3x4 inverse = node_->GetWorldTransform().Inverse();
+
+    NavigationPathRequest request;
+    request.id_ = nextPathRequestID_++;
+    if (!nextPathRequestID_)
+        nextPathRequestID_ = 1;
+    request.start_ = inverse * start;
+    request.end_ = inverse * end;
+    request.extents_ = extents;
+    request.requestTime_ = Time::GetSystemTime();
+    request.success_ = false;
+
+    // Queue to the least loaded lane
+    NavigationPathQueryLane* bestLane = pathQueryLanes_[0];
+    for (unsigned i = 1; i < pathQueryLanes_.Size(); ++i)
+    {
+        if (pathQueryLanes_[i]->requests_.Size() < bestLane->requests_.Size())
+            bestLane = pathQueryLanes_[i];
+    }
+    bestLane->requests_.Push(request);
+    ++pathQueryStats_.numRequests_;
+
+    return request.id_;
+}
+
+bool NavigationMesh::CancelPathRequest(unsigned requestID)
+{
+    for (unsigned i = 0; i < pathQueryLanes_.Size(); ++i)
+    {
+        NavigationPathQueryLane* lane = pathQueryLanes_[i];
+        for (List<NavigationPathRequest>::Iterator j = lane->requests_.Begin(); j != lane->requests_.End(); ++j)
+        {
+            if (j->id_ == requestID)
+            {
+                // If the sliced search of the request was in progress, the next request starts from the beginning
+                if (j == lane->requests_.Begin())
+                    lane->active_ = false;
+                lane->requests_.Erase(j);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void NavigationMesh::SetPathRequestIterations(int iterations)
+{
+    pathRequestIterations_ = Max(iterations, 1);
+}
+
+void NavigationMesh::ResetPathQueryStats()
+{
+    pathQueryStats_ = NavigationPathQueryStats();
+}
+
+unsigned NavigationMesh::GetNumPendingPathRequests() const
+{
+    unsigned numPending = 0;
+    for (unsigned i = 0; i < pathQueryLanes_.Size(); ++i)
+        numPending += pathQueryLanes_[i]->requests_.Size();
+    return numPending;
+}
+
 Vector3 NavigationMesh::GetRandomPoint()
 {
     if (!InitializeQuery())
@@ -807,6 +968,8 @@ void NavigationMesh::CollectGeometries(Vector<NavigationGeometryInfo>& geometryL
         if (connection->IsEnabledEffective() && connection->GetEndPoint())
         {
             const Matrix3x4& transform = connection->GetNode()->GetWorldTransform();
+            // Make sure the end point transform is also up to date, as tiles may be built in worker threads
+            connection->GetEndPoint()->GetWorldTransform();
 
             NavigationGeometryInfo info;
             info.component_ = connection;
@@ -1085,18 +1248,111 @@ bool NavigationMesh::BuildTile(Vector<NavigationGeometryInfo>& geometryList, int
     // Remove previous tile (if any)
     navMesh_->removeTile(navMesh_->getTileRefAt(x, z, 0), 0, 0);
 
-    float tileEdgeLength = (float)tileSize_ * cellSize_;
+    unsigned char* navData = 0;
+    int navDataSize = 0;
 
-    BoundingBox tileBoundingBox(Vector3(
-        boundingBox_.min_.x_ + tileEdgeLength * (float)x,
-        boundingBox_.min_.y_,
-        boundingBox_.min_.z_ + tileEdgeLength * (float)z
-    ),
-    Vector3(
-        boundingBox_.min_.x_ + tileEdgeLength * (float)(x + 1),
-        boundingBox_.max_.y_,
-        boundingBox_.min_.z_ + tileEdgeLength * (float)(z + 1)
-    ));
+    if (!BuildTileData(geometryList, x, z, navData, navDataSize))
+        return false;
+    if (!navData)
+        return true; // Nothing to do
+
+    return AddTile(x, z, navData, navDataSize);
+}
+
+unsigned NavigationMesh::BuildTiles(Vector<NavigationGeometryInfo>& geometryList, const IntVector2& from, const IntVector2& to)
+{
+    PROFILE(BuildNavigationMeshTiles);
+
+    unsigned numTiles = 0;
+    WorkQueue* queue = GetSubsystem<WorkQueue>();
+
+    if (!queue)
+    {
+        for (int z = from.y_; z <= to.y_; ++z)
+        {
+            for (int x = from.x_; x <= to.x_; ++x)
+            {
+                if (BuildTile(geometryList, x, z))
+                    ++numTiles;
+            }
+        }
+
+        return numTiles;
+    }
+
+    // Remove previous tiles (if any) and prepare the build tasks in the main thread
+    PODVector<NavigationTileBuildTask> tasks;
+    for (int z = from.y_; z <= to.y_; ++z)
+    {
+        for (int x = from.x_; x <= to.x_; ++x)
+        {
+            navMesh_->removeTile(navMesh_->getTileRefAt(x, z, 0), 0, 0);
+
+            NavigationTileBuildTask task;
+            task.geometryList_ = &geometryList;
+            task.x_ = x;
+            task.z_ = z;
+            task.navData_ = 0;
+            task.navDataSize_ = 0;
+            task.success_ = false;
+            tasks.Push(task);
+        }
+    }
+
+    if (tasks.Empty())
+        return 0;
+
+    // Run the Recast pipeline for the tiles in worker threads. Each task has its own build data and Recast context.
+    // Use several work items per thread, as the cost of tiles varies greatly depending on their geometry
+    {
+        PROFILE(BuildNavigationMeshTileData);
+
+        int numWorkItems = Min((int)tasks.Size(), (int)(queue->GetNumThreads() + 1) * TILE_WORK_ITEMS_PER_THREAD);
+        int tasksPerItem = Max((int)(tasks.Size() / numWorkItems), 1);
+
+        PODVector<NavigationTileBuildTask>::Iterator start = tasks.Begin();
+        for (int i = 0; i < numWorkItems; ++i)
+        {
+            SharedPtr<WorkItem> item = queue->GetFreeItem();
+            item->priority_ = M_MAX_UNSIGNED;
+            item->workFunction_ = BuildNavigationTilesWork;
+            item->aux_ = this;
+
+            PODVector<NavigationTileBuildTask>::Iterator end = tasks.End();
+            if (i < numWorkItems - 1 && end - start > tasksPerItem)
+                end = start + tasksPerItem;
+
+            item->start_ = &(*start);
+            item->end_ = &(*end);
+            queue->AddWorkItem(item);
+
+            start = end;
+        }
+
+        queue->Complete(M_MAX_UNSIGNED);
+    }
+
+    // Add the finished tiles to the navigation mesh in the main thread
+    for (unsigned i = 0; i < tasks.Size(); ++i)
+    {
+        NavigationTileBuildTask& task = tasks[i];
+        if (!task.success_)
+            continue;
+
+        if (!task.navData_ || AddTile(task.x_, task.z_, task.navData_, task.navDataSize_))
+            ++numTiles;
+    }
+
+    return numTiles;
+}
+
+bool NavigationMesh::BuildTileData(Vector<NavigationGeometryInfo>& geometryList, int x, int z, unsigned char*& navData,
+    int& navDataSize)
+{
+    navData = 0;
+    navDataSize = 0;
+
+    BoundingBox tileBoundingBox = GetTileBoundingBox(x, z);
 
     SimpleNavBuildData build;
 
@@ -1251,9 +1507,6 @@ bool NavigationMesh::BuildTile(Vector<NavigationGeometryInfo>& geometryList, int
             build.polyMesh_->flags[i] = 0x1;
     }
 
-    unsigned char* navData = 0;
-    int navDataSize = 0;
-
     dtNavMeshCreateParams params;
     memset(&params, 0, sizeof params);
     params.verts = build.polyMesh_->verts;
@@ -1296,6 +1549,11 @@ bool NavigationMesh::BuildTile(Vector<NavigationGeometryInfo>& geometryList, int
         return false;
     }
 
+    return true;
+}
+
+bool NavigationMesh::AddTile(int x, int z, unsigned char* navData, int navDataSize)
+{
     if (dtStatusFailed(navMesh_->addTile(navData, navDataSize, DT_TILE_FREE_DATA, 0, 0)))
     {
         LOGERROR("Failed to add navigation mesh tile");
@@ -1305,6 +1563,8 @@ bool NavigationMesh::BuildTile(Vector<NavigationGeometryInfo>& geometryList, int
 
     // Send a notification of the rebuild of this tile to anyone interested
     {
+        BoundingBox tileBoundingBox = GetTileBoundingBox(x, z);
+
         using namespace NavigationAreaRebuilt;
         VariantMap& eventData = GetContext()->GetEventDataMap();
         eventData[P_NODE] = GetNode();
@@ -1316,6 +1576,221 @@ bool NavigationMesh::BuildTile(Vector<NavigationGeometryInfo>& geometryList, int
     return true;
 }
 
+BoundingBox NavigationMesh::GetTileBoundingBox(int x, int z) const
+{
+    float tileEdgeLength = (float)tileSize_ * cellSize_;
+
+    return BoundingBox(Vector3(
+        boundingBox_.min_.x_ + tileEdgeLength * (float)x,
+        boundingBox_.min_.y_,
+        boundingBox_.min_.z_ + tileEdgeLength * (float)z
+    ),
+    Vector3(
+        boundingBox_.min_.x_ + tileEdgeLength * (float)(x + 1),
+        boundingBox_.max_.y_,
+        boundingBox_.min_.z_ + tileEdgeLength * (float)(z + 1)
+    ));
+}
+
+void NavigationMesh::OnSceneSet(Scene* scene)
+{
+    // Subscribe to the scene subsystem update, which will process the asynchronous path requests
+    if (scene)
+        SubscribeToEvent(scene, E_SCENESUBSYSTEMUPDATE, HANDLER(NavigationMesh, HandleSceneSubsystemUpdate));
+    else
+        UnsubscribeFromEvent(E_SCENESUBSYSTEMUPDATE);
+}
+
+void NavigationMesh::HandleSceneSubsystemUpdate(StringHash eventType, VariantMap& eventData)
+{
+    if (IsEnabledEffective())
+        UpdatePathRequests();
+}
+
+void NavigationMesh::UpdatePathRequests()
+{
+    if (!node_ || !GetNumPendingPathRequests())
+        return;
+
+    PROFILE(UpdatePathRequests);
+
+    HiresTimer updateTimer;
+    WorkQueue* queue = GetSubsystem<WorkQueue>();
+
+    for (unsigned i = 0; i < pathQueryLanes_.Size(); ++i)
+    {
+        NavigationPathQueryLane* lane = pathQueryLanes_[i];
+        lane->numIterations_ = 0;
+
+        if (lane->requests_.Empty())
+            continue;
+
+        // Initialize the lane's query for the current navigation mesh. If there is no navigation mesh the requests fail
+        if (navMesh_ && !lane->query_)
+        {
+            lane->query_ = dtAllocNavMeshQuery();
+            if (!lane->query_ || dtStatusFailed(lane->query_->init(navMesh_, MAX_POLYS)))
+            {
+                LOGERROR("Could not init navigation mesh query");
+                dtFreeNavMeshQuery(lane->query_);
+                lane->query_ = 0;
+            }
+        }
+
+        if (queue)
+        {
+            SharedPtr<WorkItem> item = queue->GetFreeItem();
+            item->priority_ = M_MAX_UNSIGNED;
+            item->workFunction_ = ProcessPathQueryLaneWork;
+            item->aux_ = this;
+            item->start_ = lane;
+            queue->AddWorkItem(item);
+        }
+        else
+            ProcessPathQueryLane(lane);
+    }
+
+    if (queue)
+        queue->Complete(M_MAX_UNSIGNED);
+
+    // Send the results in the main thread
+    const Matrix3x4& transform = node_->GetWorldTransform();
+    unsigned currentTime = Time::GetSystemTime();
+    pathQueryStats_.numCompletedLastUpdate_ = 0;
+    pathQueryStats_.numIterationsLastUpdate_ = 0;
+
+    WeakPtr<NavigationMesh> self(this);
+
+    for (unsigned i = 0; i < pathQueryLanes_.Size(); ++i)
+    {
+        NavigationPathQueryLane* lane = pathQueryLanes_[i];
+        pathQueryStats_.numIterationsLastUpdate_ += lane->numIterations_;
+
+        Vector<NavigationPathRequest> finished;
+        Swap(finished, lane->finished_);
+
+        for (unsigned j = 0; j < finished.Size(); ++j)
+        {
+            NavigationPathRequest& request = finished[j];
+
+            unsigned latency = currentTime - request.requestTime_;
+            ++pathQueryStats_.numCompleted_;
+            ++pathQueryStats_.numCompletedLastUpdate_;
+            if (!request.success_)
+                ++pathQueryStats_.numFailed_;
+            pathQueryStats_.totalLatency_ += latency;
+            if (latency > pathQueryStats_.maxLatency_)
+                pathQueryStats_.maxLatency_ = latency;
+
+            VariantVector path(request.path_.Size());
+            for (unsigned k = 0; k < request.path_.Size(); ++k)
+                path[k] = transform * request.path_[k];
+
+            using namespace NavigationPathResult;
+            VariantMap& eventData = GetContext()->GetEventDataMap();
+            eventData[P_NODE] = node_;
+            eventData[P_MESH] = this;
+            eventData[P_REQUESTID] = request.id_;
+            eventData[P_SUCCESS] = request.success_;
+            eventData[P_PATH] = path;
+            SendEvent(E_NAVIGATION_PATH_RESULT, eventData);
+
+            // Stop if the navigation mesh was removed by an event handler
+            if (self.Expired() || !node_)
+                return;
+        }
+    }
+
+    pathQueryStats_.lastUpdateTime_ = (unsigned)updateTimer.GetUSec(false);
+}
+
+void NavigationMesh::ProcessPathQueryLane(NavigationPathQueryLane* lane)
+{
+    dtNavMeshQuery* query = lane->query_;
+    FindPathData* pathData = lane->pathData_;
+    int iterations = pathRequestIterations_;
+
+    while (!lane->requests_.Empty() && iterations > 0)
+    {
+        NavigationPathRequest& request = lane->requests_.Front();
+        dtStatus status = DT_FAILURE;
+
+        if (query)
+        {
+            if (!lane->active_)
+            {
+                dtPolyRef startRef;
+                dtPolyRef endRef;
+                query->findNearestPoly(&request.start_.x_, &request.extents_.x_, queryFilter_, &startRef, 0);
+                query->findNearestPoly(&request.end_.x_, &request.extents_.x_, queryFilter_, &endRef, 0);
+
+                if (startRef && endRef)
+                {
+                    status = query->initSlicedFindPath(startRef, endRef, &request.start_.x_, &request.end_.x_, queryFilter_);
+                    lane->active_ = !dtStatusFailed(status);
+                }
+            }
+
+            if (lane->active_)
+            {
+                int doneIterations = 0;
+                status = query->updateSlicedFindPath(iterations, &doneIterations);
+                doneIterations = Max(doneIterations, 1);
+                iterations -= doneIterations;
+                lane->numIterations_ += doneIterations;
+
+                // Continue in the next update if the iteration budget ran out
+                if (dtStatusInProgress(status))
+                    break;
+
+                lane->active_ = false;
+            }
+        }
+
+        if (dtStatusSucceed(status))
+        {
+            int numPolys = 0;
+            int numPathPoints = 0;
+            query->finalizeSlicedFindPath(pathData->polys_, &numPolys, MAX_POLYS);
+
+            if (numPolys)
+            {
+                Vector3 actualLocalEnd = request.end_;
+
+                // If full path was not found, clamp end point to the end polygon
+                dtPolyRef endRef;
+                query->findNearestPoly(&request.end_.x_, &request.extents_.x_, queryFilter_, &endRef, 0);
+                if (pathData->polys_[numPolys - 1] != endRef)
+                    query->closestPointOnPoly(pathData->polys_[numPolys - 1], &request.end_.x_, &actualLocalEnd.x_, 0);
+
+                query->findStraightPath(&request.start_.x_, &actualLocalEnd.x_, pathData->polys_, numPolys,
+                    &pathData->pathPoints_[0].x_, pathData->pathFlags_, pathData->pathPolys_, &numPathPoints, MAX_POLYS);
+
+                request.path_.Resize(numPathPoints);
+                for (int i = 0; i < numPathPoints; ++i)
+                    request.path_[i] = pathData->pathPoints_[i];
+            }
+
+            request.success_ = numPathPoints > 0;
+        }
+
+        lane->finished_.Push(request);
+        lane->requests_.PopFront();
+    }
+}
+
+void NavigationMesh::ReleasePathQueryLanes()
+{
+    // Queued requests are kept, but searches in progress restart from the beginning with the new navigation mesh
+    for (unsigned i = 0; i < pathQueryLanes_.Size(); ++i)
+    {
+        NavigationPathQueryLane* lane = pathQueryLanes_[i];
+        dtFreeNavMeshQuery(lane->query_);
+        lane->query_ = 0;
+        lane->active_ = false;
+    }
+}
+
 bool NavigationMesh::InitializeQuery()
 {
     if (!navMesh_ || !node_)
@@ -1348,6 +1823,8 @@ void NavigationMesh::ReleaseNavigationMesh()
     dtFreeNavMeshQuery(navMeshQuery_);
     navMeshQuery_ = 0;
 
+    ReleasePathQueryLanes();
+
     numTilesX_ = 0;
     numTilesZ_ = 0;
     boundingBox_.min_ = boundingBox_.max_ = Vector3::ZERO;
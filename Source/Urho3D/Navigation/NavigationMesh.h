@@ -53,6 +53,8 @@ class Geometry;
 
 struct FindPathData;
 struct NavBuildData;
+struct NavigationPathQueryLane;
+struct WorkItem;
 
 /// Description of a navigation mesh geometry component, with transform and bounds information.
 struct NavigationGeometryInfo
@@ -67,11 +69,50 @@ struct NavigationGeometryInfo
     BoundingBox boundingBox_;
 };
 
+/// Asynchronous path query statistics.
+struct URHO3D_API NavigationPathQueryStats
+{
+    /// Construct.
+    NavigationPathQueryStats() :
+        numRequests_(0),
+        numCompleted_(0),
+        numFailed_(0),
+        numCompletedLastUpdate_(0),
+        numIterationsLastUpdate_(0),
+        lastUpdateTime_(0),
+        totalLatency_(0),
+        maxLatency_(0)
+    {
+    }
+
+    /// Return average latency from request to result in milliseconds.
+    float GetAverageLatency() const { return numCompleted_ ? (float)totalLatency_ / (float)numCompleted_ : 0.0f; }
+
+    /// Total number of requests queued.
+    unsigned numRequests_;
+    /// Number of completed requests, including failed ones.
+    unsigned numCompleted_;
+    /// Number of failed requests.
+    unsigned numFailed_;
+    /// Number of requests completed during the last update.
+    unsigned numCompletedLastUpdate_;
+    /// Number of search iterations during the last update.
+    unsigned numIterationsLastUpdate_;
+    /// Time spent processing the requests during the last update in microseconds.
+    unsigned lastUpdateTime_;
+    /// Sum of request latencies in milliseconds.
+    unsigned totalLatency_;
+    /// Maximum request latency in milliseconds.
+    unsigned maxLatency_;
+};
+
 /// Navigation mesh component. Collects the navigation geometry from child nodes with the Navigable component and responds to path queries.
 class URHO3D_API NavigationMesh : public Component
 {
     OBJECT(NavigationMesh);
     friend class DetourCrowdManager;
+    friend void BuildNavigationTilesWork(const WorkItem* item, unsigned threadIndex);
+    friend void ProcessPathQueryLaneWork(const WorkItem* item, unsigned threadIndex);
 
 public:
     /// Construct.
@@ -124,6 +165,14 @@ public:
     Vector3 MoveAlongSurface(const Vector3& start, const Vector3& end, const Vector3& extents=Vector3::ONE, int maxVisited=3);
     /// Find a path between world space points. Return non-empty list of points if successful. Extents specifies how far off the navigation mesh the points can be.
     void FindPath(PODVector<Vector3>& dest, const Vector3& start, const Vector3& end, const Vector3& extents = Vector3::ONE);
+    /// Queue an asynchronous path request between world space points. The search is performed in worker threads during the scene subsystem update, sliced over several frames if necessary, and the result is sent with the E_NAVIGATION_PATH_RESULT event. Return request ID.
+    unsigned RequestPath(const Vector3& start, const Vector3& end, const Vector3& extents = Vector3::ONE);
+    /// Cancel a queued path request. Return true if the request was still pending.
+    bool CancelPathRequest(unsigned requestID);
+    /// Set maximum number of path search iterations per path query thread and scene update.
+    void SetPathRequestIterations(int iterations);
+    /// Reset asynchronous path query statistics.
+    void ResetPathQueryStats();
     /// Return a random point on the navigation mesh.
     Vector3 GetRandomPoint();
     /// Return a random point on the navigation mesh within a circle. The circle radius is only a guideline and in practice the returned point may be further away.
@@ -177,6 +226,12 @@ public:
     BoundingBox GetWorldBoundingBox() const;
     /// Return number of tiles.
     IntVector2 GetNumTiles() const { return IntVector2(numTilesX_, numTilesZ_); }
+    /// Return maximum number of path search iterations per path query thread and scene update.
+    int GetPathRequestIterations() const { return pathRequestIterations_; }
+    /// Return number of asynchronous path requests not yet completed.
+    unsigned GetNumPendingPathRequests() const;
+    /// Return asynchronous path query statistics.
+    const NavigationPathQueryStats& GetPathQueryStats() const { return pathQueryStats_; }
 
     /// Set the partition type used for polygon generation.
     void SetPartitionType(NavmeshPartitionType aType);
@@ -199,6 +254,10 @@ public:
     bool GetDrawNavAreas() const { return drawNavAreas_; }
 
 protected:
+    /// Subscribe to events when assigned to a scene.
+    virtual void OnSceneSet(Scene* scene);
+    /// Process the asynchronous path requests.
+    void HandleSceneSubsystemUpdate(StringHash eventType, VariantMap& eventData);
     /// Collect geometry from under Navigable components.
     void CollectGeometries(Vector<NavigationGeometryInfo>& geometryList);
     /// Visit nodes and collect navigable geometry.
@@ -209,10 +268,24 @@ protected:
     void AddTriMeshGeometry(NavBuildData* build, Geometry* geometry, const Matrix3x4& transform);
     /// Build one tile of the navigation mesh. Return true if successful.
     virtual bool BuildTile(Vector<NavigationGeometryInfo>& geometryList, int x, int z);
+    /// Build a rectangular range of tiles. The Recast processing is done in worker threads and the finished tiles are added to the navigation mesh in the main thread. Return number of tiles built.
+    virtual unsigned BuildTiles(Vector<NavigationGeometryInfo>& geometryList, const IntVector2& from, const IntVector2& to);
+    /// Build the Detour data of one tile without modifying the navigation mesh. Can be called from worker threads. Return true if successful; the data is null if the tile has no geometry.
+    bool BuildTileData(Vector<NavigationGeometryInfo>& geometryList, int x, int z, unsigned char*& navData, int& navDataSize);
+    /// Add built Detour data of one tile to the navigation mesh and send the area rebuilt event. Takes ownership of the data. Return true if successful.
+    bool AddTile(int x, int z, unsigned char* navData, int navDataSize);
+    /// Return local space bounding box of a tile.
+    BoundingBox GetTileBoundingBox(int x, int z) const;
     /// Ensure that the navigation mesh query is initialized. Return true if successful.
     bool InitializeQuery();
     /// Release the navigation mesh and the query.
     virtual void ReleaseNavigationMesh();
+    /// Process the asynchronous path requests in worker threads and send the results.
+    void UpdatePathRequests();
+    /// Continue the path searches of one path query lane within the iteration budget. Called from worker threads.
+    void ProcessPathQueryLane(NavigationPathQueryLane* lane);
+    /// Release the path query lanes.
+    void ReleasePathQueryLanes();
 
     /// Identifying name for this navigation mesh.
     String meshName_;
@@ -224,6 +297,14 @@ protected:
     dtQueryFilter* queryFilter_;
     /// Temporary data for finding a path.
     FindPathData* pathData_;
+    /// Asynchronous path query lanes. Each has its own Detour query and is processed by one work item at a time.
+    PODVector<NavigationPathQueryLane*> pathQueryLanes_;
+    /// Next asynchronous path request ID.
+    unsigned nextPathRequestID_;
+    /// Maximum path search iterations per path query lane and scene update.
+    int pathRequestIterations_;
+    /// Asynchronous path query statistics.
+    NavigationPathQueryStats pathQueryStats_;
     /// Tile size.
     int tileSize_;
     /// Cell size.
@@ -681,7 +681,11 @@ void PhysicsWorld::HandleSceneSubsystemUpdate(StringHash eventType, VariantMap&
 
 void PhysicsWorld::PreStep(float timeStep)
 {
-    // Send pre-step event
+    // Update logic components, then send pre-step event
+    Scene* scene = GetScene();
+    if (scene)
+        scene->UpdateLogicComponents(USE_FIXEDUPDATE, timeStep);
+
     using namespace PhysicsPreStep;
 
     VariantMap& eventData = GetEventDataMap();
@@ -707,7 +711,11 @@ void PhysicsWorld::PostStep(float timeStep)
 
     SendCollisionEvents();
 
-    // Send post-step event
+    // Update logic components, then send post-step event
+    Scene* scene = GetScene();
+    if (scene)
+        scene->UpdateLogicComponents(USE_FIXEDPOSTUPDATE, timeStep);
+
     using namespace PhysicsPostStep;
 
     VariantMap& eventData = GetEventDataMap();
@@ -24,6 +24,8 @@
 
 #include "../Core/Context.h"
 #include "../Core/Profiler.h"
+#include "../Core/Thread.h"
+#include "../Core/WorkQueue.h"
 #include "../IO/File.h"
 #include "../IO/FileSystem.h"
 #include "../IO/Log.h"
@@ -79,6 +81,9 @@ static const unsigned DDS_DXGI_FORMAT_BC2_UNORM_SRGB = 75;
 static const unsigned DDS_DXGI_FORMAT_BC3_UNORM = 77;
 static const unsigned DDS_DXGI_FORMAT_BC3_UNORM_SRGB = 78;
 
+static const int MIN_PARALLEL_MIP_PIXELS = 256 * 256;
+static const unsigned LINEAR_TO_SRGB_SIZE = 16384;
+
 namespace Urho3D
 {
 
@@ -238,6 +243,140 @@ bool CompressedLevel::Decompress(unsigned char* dest)
     }
 }
 
+/// Conversion tables for averaging sRGB data in linear space. Linear values are 16-bit.
+struct SRGBTables
+{
+    /// Construct and fill the tables.
+    SRGBTables()
+    {
+        for (unsigned i = 0; i < 256; ++i)
+        {
+            float value = (float)i / 255.0f;
+            float linear = value <= 0.04045f ? value / 12.92f : powf((value + 0.055f) / 1.055f, 2.4f);
+            toLinear_[i] = (unsigned short)(linear * 65535.0f + 0.5f);
+        }
+        for (unsigned i = 0; i < LINEAR_TO_SRGB_SIZE; ++i)
+        {
+            float linear = (float)i / (float)(LINEAR_TO_SRGB_SIZE - 1);
+            float value = linear <= 0.0031308f ? linear * 12.92f : 1.055f * powf(linear, 1.0f / 2.4f) - 0.055f;
+            toSRGB_[i] = (unsigned char)(value * 255.0f + 0.5f);
+        }
+    }
+
+    /// sRGB to linear table.
+    unsigned short toLinear_[256];
+    /// Linear to sRGB table, indexed by the 14 highest bits of the linear value.
+    unsigned char toSRGB_[LINEAR_TO_SRGB_SIZE];
+};
+
+static const SRGBTables srgbTables;
+
+/// 2D mip level generation parameters shared by the work items of one level.
+struct MipLevelRows
+{
+    /// Source level pixel data.
+    const unsigned char* source_;
+    /// Destination level pixel data.
+    unsigned char* dest_;
+    /// Source level width.
+    int sourceWidth_;
+    /// Destination level width.
+    int destWidth_;
+    /// Number of color components.
+    unsigned components_;
+    /// Average color channels in linear space.
+    bool sRGB_;
+};
+
+/// Box filter a range of destination rows from the two source rows above each.
+static void DownsampleRows(const MipLevelRows& rows, int startY, int endY)
+{
+    unsigned components = rows.components_;
+    unsigned sourceRowSize = (unsigned)rows.sourceWidth_ * components;
+    unsigned destRowSize = (unsigned)rows.destWidth_ * components;
+    int destWidth = rows.destWidth_;
+
+    for (int y = startY; y < endY; ++y)
+    {
+        const unsigned char* inUpper = rows.source_ + (y * 2) * sourceRowSize;
+        const unsigned char* inLower = inUpper + sourceRowSize;
+        unsigned char* out = rows.dest_ + y * destRowSize;
+
+        if (rows.sRGB_)
+        {
+            // The last channel of 2 and 4 component images is alpha, which is averaged as is
+            unsigned colorChannels = (components == 2 || components == 4) ? components - 1 : components;
+            const unsigned short* toLinear = srgbTables.toLinear_;
+
+            for (int x = 0; x < destWidth; ++x)
+            {
+                const unsigned char* upper = inUpper + x * 2 * components;
+                const unsigned char* lower = inLower + x * 2 * components;
+                unsigned char* dest = out + x * components;
+
+                for (unsigned c = 0; c < colorChannels; ++c)
+                {
+                    unsigned sum = (unsigned)toLinear[upper[c]] + toLinear[upper[c + components]] + toLinear[lower[c]] +
+                        toLinear[lower[c + components]];
+                    dest[c] = srgbTables.toSRGB_[sum >> 4];
+                }
+                if (colorChannels < components)
+                {
+                    unsigned a = components - 1;
+                    dest[a] = (unsigned char)(((unsigned)upper[a] + upper[a + components] + lower[a] + lower[a + components])
+                        >> 2);
+                }
+            }
+        }
+        else if (components == 4)
+        {
+            // Average all four channels of a pixel at once within a 32-bit word: sum the upper 6 bits of each channel
+            // pre-shifted down, then add the carry from the sum of the lowest 2 bits. The result is exact
+            const unsigned* upper = reinterpret_cast<const unsigned*>(inUpper);
+            const unsigned* lower = reinterpret_cast<const unsigned*>(inLower);
+            unsigned* dest = reinterpret_cast<unsigned*>(out);
+
+            for (int x = 0; x < destWidth; ++x)
+            {
+                unsigned a = upper[x * 2];
+                unsigned b = upper[x * 2 + 1];
+                unsigned c = lower[x * 2];
+                unsigned d = lower[x * 2 + 1];
+                unsigned high = ((a >> 2) & 0x3f3f3f3f) + ((b >> 2) & 0x3f3f3f3f) + ((c >> 2) & 0x3f3f3f3f) +
+                    ((d >> 2) & 0x3f3f3f3f);
+                unsigned low = (((a & 0x03030303) + (b & 0x03030303) + (c & 0x03030303) + (d & 0x03030303)) >> 2) &
+                    0x03030303;
+                dest[x] = high + low;
+            }
+        }
+        else
+        {
+            for (int x = 0; x < destWidth; ++x)
+            {
+                const unsigned char* upper = inUpper + x * 2 * components;
+                const unsigned char* lower = inLower + x * 2 * components;
+                unsigned char* dest = out + x * components;
+
+                for (unsigned c = 0; c < components; ++c)
+                {
+                    dest[c] = (unsigned char)(((unsigned)upper[c] + upper[c + components] + lower[c] + lower[c + components])
+                        >> 2);
+                }
+            }
+        }
+    }
+}
+
+void DownsampleRowsWork(const WorkItem* item, unsigned threadIndex)
+{
+    const MipLevelRows& rows = *(reinterpret_cast<MipLevelRows*>(item->aux_));
+    unsigned destRowSize = (unsigned)rows.destWidth_ * rows.components_;
+    int startY = (int)((reinterpret_cast<unsigned char*>(item->start_) - rows.dest_) / destRowSize);
+    int endY = (int)((reinterpret_cast<unsigned char*>(item->end_) - rows.dest_) / destRowSize);
+
+    DownsampleRows(rows, startY, endY);
+}
+
 Image::Image(Context* context) :
     Resource(context),
     width_(0),
@@ -375,7 +514,7 @@ bool Image::BeginLoad(Deserializer& source)
             {
                 blocksWide = (x + 3) / 4;
                 blocksHeight = (y + 3) / 4;
-                dataSize += blockSize * blocksWide * blocksWide * Max(z, 1);
+                dataSize += blockSize * blocksWide * blocksHeight * Max(z, 1);
             }
         }
         else
@@ -845,6 +984,15 @@ void Image::SetPixelInt(int x, int y, int z, unsigned uintColor)
     }
 }
 
+void Image::SetSRGB(bool enable)
+{
+    if (enable != sRGB_)
+    {
+        sRGB_ = enable;
+        nextLevel_.Reset();
+    }
+}
+
 void Image::SetData(const unsigned char* pixelData)
 {
     if (!data_)
@@ -1057,16 +1205,26 @@ bool Image::Resize(int width, int height)
     if (!data_ || width <= 0 || height <= 0)
         return false;
 
-    /// \todo Reducing image size does not sample all needed pixels
+    // When reducing the size, first box filter through the mip levels so that bilinear resampling does not skip pixels
+    const Image* source = this;
+    SharedPtr<Image> level;
+    while (source->width_ >= width * 2 && source->height_ >= height * 2)
+    {
+        level = source->GetNextLevel();
+        if (!level)
+            break;
+        source = level;
+    }
+
     SharedArrayPtr<unsigned char> newData(new unsigned char[width * height * components_]);
     for (int y = 0; y < height; ++y)
     {
         for (int x = 0; x < width; ++x)
         {
             // Calculate float coordinates between 0 - 1 for resampling
-            float xF = (width_ > 1) ? (float)x / (float)(width - 1) : 0.0f;
-            float yF = (height_ > 1) ? (float)y / (float)(height - 1) : 0.0f;
-            unsigned uintColor = GetPixelBilinear(xF, yF).ToUInt();
+            float xF = (width > 1) ? (float)x / (float)(width - 1) : 0.0f;
+            float yF = (height > 1) ? (float)y / (float)(height - 1) : 0.0f;
+            unsigned uintColor = source->GetPixelBilinear(xF, yF).ToUInt();
             unsigned char* dest = newData + (y * width + x) * components_;
             unsigned char* src = (unsigned char*)&uintColor;
 
@@ -1091,6 +1249,7 @@ bool Image::Resize(int width, int height)
     width_ = width;
     height_ = height;
     data_ = newData;
+    nextLevel_.Reset();
     SetMemoryUse(width * height * depth_ * components_);
     return true;
 }
@@ -1361,6 +1520,7 @@ SharedPtr<Image> Image::GetNextLevel() const
         mipImage->SetSize(widthOut, heightOut, depthOut, components_);
     else
         mipImage->SetSize(widthOut, heightOut, components_);
+    mipImage->sRGB_ = sRGB_;
 
     const unsigned char* pixelDataIn = data_.Get();
     unsigned char* pixelDataOut = mipImage->data_.Get();
@@ -1372,126 +1532,108 @@ SharedPtr<Image> Image::GetNextLevel() const
         if (widthOut < heightOut)
             widthOut = heightOut;
 
-        switch (components_)
+        if (sRGB_)
         {
-        case 1:
-            for (int x = 0; x < widthOut; ++x)
-                pixelDataOut[x] = (unsigned char)(((unsigned)pixelDataIn[x * 2] + pixelDataIn[x * 2 + 1]) >> 1);
-            break;
+            // Average the color channels in linear space like the 2D case. Alpha is averaged as is
+            unsigned components = components_;
+            unsigned colorChannels = (components == 2 || components == 4) ? components - 1 : components;
+            const unsigned short* toLinear = srgbTables.toLinear_;
 
-        case 2:
-            for (int x = 0; x < widthOut * 2; x += 2)
-            {
-                pixelDataOut[x] = (unsigned char)(((unsigned)pixelDataIn[x * 2] + pixelDataIn[x * 2 + 2]) >> 1);
-                pixelDataOut[x + 1] = (unsigned char)(((unsigned)pixelDataIn[x * 2 + 1] + pixelDataIn[x * 2 + 3]) >> 1);
-            }
-            break;
-
-        case 3:
-            for (int x = 0; x < widthOut * 3; x += 3)
+            for (int x = 0; x < widthOut; ++x)
             {
-                pixelDataOut[x] = (unsigned char)(((unsigned)pixelDataIn[x * 2] + pixelDataIn[x * 2 + 3]) >> 1);
-                pixelDataOut[x + 1] = (unsigned char)(((unsigned)pixelDataIn[x * 2 + 1] + pixelDataIn[x * 2 + 4]) >> 1);
-                pixelDataOut[x + 2] = (unsigned char)(((unsigned)pixelDataIn[x * 2 + 2] + pixelDataIn[x * 2 + 5]) >> 1);
-            }
-            break;
+                const unsigned char* in = pixelDataIn + x * 2 * components;
+                unsigned char* out = pixelDataOut + x * components;
 
-        case 4:
-            for (int x = 0; x < widthOut * 4; x += 4)
-            {
-                pixelDataOut[x] = (unsigned char)(((unsigned)pixelDataIn[x * 2] + pixelDataIn[x * 2 + 4]) >> 1);
-                pixelDataOut[x + 1] = (unsigned char)(((unsigned)pixelDataIn[x * 2 + 1] + pixelDataIn[x * 2 + 5]) >> 1);
-                pixelDataOut[x + 2] = (unsigned char)(((unsigned)pixelDataIn[x * 2 + 2] + pixelDataIn[x * 2 + 6]) >> 1);
-                pixelDataOut[x + 3] = (unsigned char)(((unsigned)pixelDataIn[x * 2 + 3] + pixelDataIn[x * 2 + 7]) >> 1);
+                for (unsigned c = 0; c < colorChannels; ++c)
+                    out[c] = srgbTables.toSRGB_[((unsigned)toLinear[in[c]] + toLinear[in[c + components]]) >> 3];
+                if (colorChannels < components)
+                {
+                    unsigned a = components - 1;
+                    out[a] = (unsigned char)(((unsigned)in[a] + in[a + components]) >> 1);
+                }
             }
-            break;
-
-        default:
-            assert(false);  // Should never reach here
-            break;
         }
-    }
-    // 2D case
-    else if (depth_ == 1)
-    {
-        switch (components_)
+        else
         {
-        case 1:
-            for (int y = 0; y < heightOut; ++y)
+            switch (components_)
             {
-                const unsigned char* inUpper = &pixelDataIn[(y * 2) * width_];
-                const unsigned char* inLower = &pixelDataIn[(y * 2 + 1) * width_];
-                unsigned char* out = &pixelDataOut[y * widthOut];
-
+            case 1:
                 for (int x = 0; x < widthOut; ++x)
-                {
-                    out[x] = (unsigned char)(((unsigned)inUpper[x * 2] + inUpper[x * 2 + 1] +
-                                              inLower[x * 2] + inLower[x * 2 + 1]) >> 2);
-                }
-            }
-            break;
-
-        case 2:
-            for (int y = 0; y < heightOut; ++y)
-            {
-                const unsigned char* inUpper = &pixelDataIn[(y * 2) * width_ * 2];
-                const unsigned char* inLower = &pixelDataIn[(y * 2 + 1) * width_ * 2];
-                unsigned char* out = &pixelDataOut[y * widthOut * 2];
+                    pixelDataOut[x] = (unsigned char)(((unsigned)pixelDataIn[x * 2] + pixelDataIn[x * 2 + 1]) >> 1);
+                break;
 
+            case 2:
                 for (int x = 0; x < widthOut * 2; x += 2)
                 {
-                    out[x] = (unsigned char)(((unsigned)inUpper[x * 2] + inUpper[x * 2 + 2] +
-                                              inLower[x * 2] + inLower[x * 2 + 2]) >> 2);
-                    out[x + 1] = (unsigned char)(((unsigned)inUpper[x * 2 + 1] + inUpper[x * 2 + 3] +
-                                                  inLower[x * 2 + 1] + inLower[x * 2 + 3]) >> 2);
+                    pixelDataOut[x] = (unsigned char)(((unsigned)pixelDataIn[x * 2] + pixelDataIn[x * 2 + 2]) >> 1);
+                    pixelDataOut[x + 1] = (unsigned char)(((unsigned)pixelDataIn[x * 2 + 1] + pixelDataIn[x * 2 + 3]) >> 1);
                 }
-            }
-            break;
-
-        case 3:
-            for (int y = 0; y < heightOut; ++y)
-            {
-                const unsigned char* inUpper = &pixelDataIn[(y * 2) * width_ * 3];
-                const unsigned char* inLower = &pixelDataIn[(y * 2 + 1) * width_ * 3];
-                unsigned char* out = &pixelDataOut[y * widthOut * 3];
+                break;
 
+            case 3:
                 for (int x = 0; x < widthOut * 3; x += 3)
                 {
-                    out[x] = (unsigned char)(((unsigned)inUpper[x * 2] + inUpper[x * 2 + 3] +
-                                              inLower[x * 2] + inLower[x * 2 + 3]) >> 2);
-                    out[x + 1] = (unsigned char)(((unsigned)inUpper[x * 2 + 1] + inUpper[x * 2 + 4] +
-                                                  inLower[x * 2 + 1] + inLower[x * 2 + 4]) >> 2);
-                    out[x + 2] = (unsigned char)(((unsigned)inUpper[x * 2 + 2] + inUpper[x * 2 + 5] +
-                                                  inLower[x * 2 + 2] + inLower[x * 2 + 5]) >> 2);
+                    pixelDataOut[x] = (unsigned char)(((unsigned)pixelDataIn[x * 2] + pixelDataIn[x * 2 + 3]) >> 1);
+                    pixelDataOut[x + 1] = (unsigned char)(((unsigned)pixelDataIn[x * 2 + 1] + pixelDataIn[x * 2 + 4]) >> 1);
+                    pixelDataOut[x + 2] = (unsigned char)(((unsigned)pixelDataIn[x * 2 + 2] + pixelDataIn[x * 2 + 5]) >> 1);
                 }
-            }
-            break;
-
-        case 4:
-            for (int y = 0; y < heightOut; ++y)
-            {
-                const unsigned char* inUpper = &pixelDataIn[(y * 2) * width_ * 4];
-                const unsigned char* inLower = &pixelDataIn[(y * 2 + 1) * width_ * 4];
-                unsigned char* out = &pixelDataOut[y * widthOut * 4];
+                break;
 
+            case 4:
                 for (int x = 0; x < widthOut * 4; x += 4)
                 {
-                    out[x] = (unsigned char)(((unsigned)inUpper[x * 2] + inUpper[x * 2 + 4] +
-                                              inLower[x * 2] + inLower[x * 2 + 4]) >> 2);
-                    out[x + 1] = (unsigned char)(((unsigned)inUpper[x * 2 + 1] + inUpper[x * 2 + 5] +
-                                                  inLower[x * 2 + 1] + inLower[x * 2 + 5]) >> 2);
-                    out[x + 2] = (unsigned char)(((unsigned)inUpper[x * 2 + 2] + inUpper[x * 2 + 6] +
-                                                  inLower[x * 2 + 2] + inLower[x * 2 + 6]) >> 2);
-                    out[x + 3] = (unsigned char)(((unsigned)inUpper[x * 2 + 3] + inUpper[x * 2 + 7] +
-                                                  inLower[x * 2 + 3] + inLower[x * 2 + 7]) >> 2);
+                    pixelDataOut[x] = (unsigned char)(((unsigned)pixelDataIn[x * 2] + pixelDataIn[x * 2 + 4]) >> 1);
+                    pixelDataOut[x + 1] = (unsigned char)(((unsigned)pixelDataIn[x * 2 + 1] + pixelDataIn[x * 2 + 5]) >> 1);
+                    pixelDataOut[x + 2] = (unsigned char)(((unsigned)pixelDataIn[x * 2 + 2] + pixelDataIn[x * 2 + 6]) >> 1);
+                    pixelDataOut[x + 3] = (unsigned char)(((unsigned)pixelDataIn[x * 2 + 3] + pixelDataIn[x * 2 + 7]) >> 1);
                 }
+                break;
+
+            default:
+                assert(false);  // Should never reach here
+                break;
             }
-            break;
+        }
+    }
+    // 2D case
+    else if (depth_ == 1)
+    {
+        MipLevelRows rows;
+        rows.source_ = pixelDataIn;
+        rows.dest_ = pixelDataOut;
+        rows.sourceWidth_ = width_;
+        rows.destWidth_ = widthOut;
+        rows.components_ = components_;
+        rows.sRGB_ = sRGB_;
+
+        // Split large levels into row ranges for the worker threads. The work queue can only be used from the main thread,
+        // so asynchronous texture loading processes the rows in the loader thread
+        WorkQueue* queue = GetSubsystem<WorkQueue>();
+        if (queue && queue->GetNumThreads() && Thread::IsMainThread() && widthOut * heightOut >= MIN_PARALLEL_MIP_PIXELS)
+        {
+            unsigned destRowSize = (unsigned)widthOut * components_;
+            int numWorkItems = (int)queue->GetNumThreads() + 1; // Worker threads + main thread
+            int rowsPerItem = (heightOut + numWorkItems - 1) / numWorkItems;
 
-        default:
-            assert(false);  // Should never reach here
-            break;
+            for (int startY = 0; startY < heightOut; startY += rowsPerItem)
+            {
+                int endY = startY + rowsPerItem;
+                if (endY > heightOut)
+                    endY = heightOut;
+
+                SharedPtr<WorkItem> item = queue->GetFreeItem();
+                item->priority_ = M_MAX_UNSIGNED;
+                item->workFunction_ = DownsampleRowsWork;
+                item->aux_ = &rows;
+                item->start_ = pixelDataOut + startY * destRowSize;
+                item->end_ = pixelDataOut + endY * destRowSize;
+                queue->AddWorkItem(item);
+            }
+
+            queue->Complete(M_MAX_UNSIGNED);
         }
+        else
+            DownsampleRows(rows, 0, heightOut);
     }
     // 3D case
     else
@@ -110,6 +110,8 @@ public:
     bool SetSize(int width, int height, int depth, unsigned components);
     /// Set new image data.
     void SetData(const unsigned char* pixelData);
+    /// Set whether the data is sRGB. Mip levels of uncompressed 2D data are then generated by averaging in linear space.
+    void SetSRGB(bool enable);
     /// Set a 2D pixel.
     void SetPixel(int x, int y, const Color& color);
     /// Set a 3D pixel.
@@ -124,7 +126,7 @@ public:
     bool FlipHorizontal();
     /// Flip image vertically. Return true if successful.
     bool FlipVertical();
-    /// Resize image by bilinear resampling. Return true if successful.
+    /// Resize image by bilinear resampling, box filtering first when reducing the size. Return true if successful.
     bool Resize(int width, int height);
     /// Clear the image with a color.
     void Clear(const Color& color);
@@ -142,7 +144,7 @@ public:
     bool IsCubemap() const { return cubemap_; }
     /// Whether this texture has been detected as a volume, only relevant for DDS.
     bool IsArray() const { return array_; }
-    /// Whether this texture is in sRGB, only relevant for DDS.
+    /// Whether this texture is in sRGB. Detected from DDS or set manually.
     bool IsSRGB() const { return sRGB_; }
 
     /// Return a 2D pixel color.
@@ -182,7 +184,7 @@ public:
     /// Return number of compressed mip levels.
     unsigned GetNumCompressedLevels() const { return numCompressedLevels_; }
 
-    /// Return next mip level by bilinear filtering.
+    /// Return next mip level by box filtering. Large 2D levels are processed in worker threads if called from the main thread.
     SharedPtr<Image> GetNextLevel() const;
     /// Return the next sibling image of an array or cubemap.
     SharedPtr<Image> GetNextSibling() const { return nextSibling_;  }
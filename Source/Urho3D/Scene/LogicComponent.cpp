@@ -22,14 +22,8 @@
 
 #include "../Precompiled.h"
 
-#include "../IO/Log.h"
-#ifdef URHO3D_PHYSICS
-#include "../Physics/PhysicsEvents.h"
-#include "../Physics/PhysicsWorld.h"
-#endif
 #include "../Scene/LogicComponent.h"
 #include "../Scene/Scene.h"
-#include "../Scene/SceneEvents.h"
 
 namespace Urho3D
 {
@@ -38,12 +32,19 @@ LogicComponent::LogicComponent(Context* context) :
     Component(context),
     updateEventMask_(USE_UPDATE | USE_POSTUPDATE | USE_FIXEDUPDATE | USE_FIXEDPOSTUPDATE),
     currentEventMask_(0),
-    delayedStartCalled_(false)
+    delayedStartCalled_(false),
+    parallelUpdate_(false)
 {
+    for (unsigned i = 0; i < NUM_LOGIC_UPDATE_PHASES; ++i)
+        updateIndices_[i] = M_MAX_UNSIGNED;
 }
 
 LogicComponent::~LogicComponent()
 {
+    // Ensure the scene does not keep a dangling pointer in its update lists
+    Scene* scene = updateScene_;
+    if (scene && currentEventMask_)
+        scene->RemoveLogicUpdate(this, currentEventMask_);
 }
 
 void LogicComponent::OnSetEnabled()
@@ -76,6 +77,50 @@ void LogicComponent::SetUpdateEventMask(unsigned char mask)
     }
 }
 
+void LogicComponent::SetParallelUpdate(bool enable)
+{
+    if (enable != parallelUpdate_)
+    {
+        // The parallel and serial components are in separate update lists, so re-add to the scene
+        Scene* scene = updateScene_;
+        if (scene && currentEventMask_)
+        {
+            scene->RemoveLogicUpdate(this, currentEventMask_);
+            parallelUpdate_ = enable;
+            scene->AddLogicUpdate(this, currentEventMask_);
+        }
+        else
+            parallelUpdate_ = enable;
+    }
+}
+
+void LogicComponent::CallUpdate(unsigned char phase, float timeStep)
+{
+    switch (phase)
+    {
+    case USE_UPDATE:
+        // Execute user-defined delayed start function before first update
+        if (!delayedStartCalled_ && !CallDelayedStart())
+            return;
+
+        // Then execute user-defined update function
+        Update(timeStep);
+        break;
+
+    case USE_POSTUPDATE:
+        PostUpdate(timeStep);
+        break;
+
+    case USE_FIXEDUPDATE:
+        FixedUpdate(timeStep);
+        break;
+
+    case USE_FIXEDPOSTUPDATE:
+        FixedPostUpdate(timeStep);
+        break;
+    }
+}
+
 void LogicComponent::OnNodeSet(Node* node)
 {
     if (node)
@@ -96,12 +141,10 @@ void LogicComponent::OnSceneSet(Scene* scene)
         UpdateEventSubscription();
     else
     {
-        UnsubscribeFromEvent(E_SCENEUPDATE);
-        UnsubscribeFromEvent(E_SCENEPOSTUPDATE);
-#ifdef URHO3D_PHYSICS
-        UnsubscribeFromEvent(E_PHYSICSPRESTEP);
-        UnsubscribeFromEvent(E_PHYSICSPOSTSTEP);
-#endif
+        Scene* oldScene = updateScene_;
+        if (oldScene && currentEventMask_)
+            oldScene->RemoveLogicUpdate(this, currentEventMask_);
+        updateScene_.Reset();
         currentEventMask_ = 0;
     }
 }
@@ -112,112 +155,35 @@ void LogicComponent::UpdateEventSubscription()
     if (!scene)
         return;
 
-    bool enabled = IsEnabledEffective();
-
-    bool needUpdate = enabled && ((updateEventMask_ & USE_UPDATE) || !delayedStartCalled_);
-    if (needUpdate && !(currentEventMask_ & USE_UPDATE))
-    {
-        SubscribeToEvent(scene, E_SCENEUPDATE, HANDLER(LogicComponent, HandleSceneUpdate));
-        currentEventMask_ |= USE_UPDATE;
-    }
-    else if (!needUpdate && (currentEventMask_ & USE_UPDATE))
-    {
-        UnsubscribeFromEvent(scene, E_SCENEUPDATE);
-        currentEventMask_ &= ~USE_UPDATE;
-    }
-
-    bool needPostUpdate = enabled && (updateEventMask_ & USE_POSTUPDATE);
-    if (needPostUpdate && !(currentEventMask_ & USE_POSTUPDATE))
-    {
-        SubscribeToEvent(scene, E_SCENEPOSTUPDATE, HANDLER(LogicComponent, HandleScenePostUpdate));
-        currentEventMask_ |= USE_POSTUPDATE;
-    }
-    else if (!needUpdate && (currentEventMask_ & USE_POSTUPDATE))
-    {
-        UnsubscribeFromEvent(scene, E_SCENEPOSTUPDATE);
-        currentEventMask_ &= ~USE_POSTUPDATE;
-    }
-
-#ifdef URHO3D_PHYSICS
-    PhysicsWorld* world = scene->GetComponent<PhysicsWorld>();
-    if (!world)
-        return;
+    // The update phase is also needed to execute the delayed start function
+    unsigned char neededMask = 0;
+    if (IsEnabledEffective())
+        neededMask = delayedStartCalled_ ? updateEventMask_ : (unsigned char)(updateEventMask_ | USE_UPDATE);
 
-    bool needFixedUpdate = enabled && (updateEventMask_ & USE_FIXEDUPDATE);
-    if (needFixedUpdate && !(currentEventMask_ & USE_FIXEDUPDATE))
-    {
-        SubscribeToEvent(world, E_PHYSICSPRESTEP, HANDLER(LogicComponent, HandlePhysicsPreStep));
-        currentEventMask_ |= USE_FIXEDUPDATE;
-    }
-    else if (!needFixedUpdate && (currentEventMask_ & USE_FIXEDUPDATE))
-    {
-        UnsubscribeFromEvent(world, E_PHYSICSPRESTEP);
-        currentEventMask_ &= ~USE_FIXEDUPDATE;
-    }
+    unsigned char removeMask = currentEventMask_ & ~neededMask;
+    unsigned char addMask = neededMask & ~currentEventMask_;
+    if (removeMask)
+        scene->RemoveLogicUpdate(this, removeMask);
+    if (addMask)
+        scene->AddLogicUpdate(this, addMask);
 
-    bool needFixedPostUpdate = enabled && (updateEventMask_ & USE_FIXEDPOSTUPDATE);
-    if (needFixedPostUpdate && !(currentEventMask_ & USE_FIXEDPOSTUPDATE))
-    {
-        SubscribeToEvent(world, E_PHYSICSPOSTSTEP, HANDLER(LogicComponent, HandlePhysicsPostStep));
-        currentEventMask_ |= USE_FIXEDPOSTUPDATE;
-    }
-    else if (!needFixedPostUpdate && (currentEventMask_ & USE_FIXEDPOSTUPDATE))
-    {
-        UnsubscribeFromEvent(world, E_PHYSICSPOSTSTEP);
-        currentEventMask_ &= ~USE_FIXEDPOSTUPDATE;
-    }
-#endif
+    updateScene_ = scene;
+    currentEventMask_ = neededMask;
 }
 
-void LogicComponent::HandleSceneUpdate(StringHash eventType, VariantMap& eventData)
+bool LogicComponent::CallDelayedStart()
 {
-    using namespace SceneUpdate;
+    DelayedStart();
+    delayedStartCalled_ = true;
 
-    // Execute user-defined delayed start function before first update
-    if (!delayedStartCalled_)
+    // If did not need actual update events, leave the update list now
+    if (!(updateEventMask_ & USE_UPDATE))
     {
-        DelayedStart();
-        delayedStartCalled_ = true;
-
-        // If did not need actual update events, unsubscribe now
-        if (!(updateEventMask_ & USE_UPDATE))
-        {
-            UnsubscribeFromEvent(GetScene(), E_SCENEUPDATE);
-            currentEventMask_ &= ~USE_UPDATE;
-            return;
-        }
+        UpdateEventSubscription();
+        return false;
     }
-
-    // Then execute user-defined update function
-    Update(eventData[P_TIMESTEP].GetFloat());
-}
-
-void LogicComponent::HandleScenePostUpdate(StringHash eventType, VariantMap& eventData)
-{
-    using namespace ScenePostUpdate;
-
-    // Execute user-defined post-update function
-    PostUpdate(eventData[P_TIMESTEP].GetFloat());
-}
-
-#ifdef URHO3D_PHYSICS
-
-void LogicComponent::HandlePhysicsPreStep(StringHash eventType, VariantMap& eventData)
-{
-    using namespace PhysicsPreStep;
-
-    // Execute user-defined fixed update function
-    FixedUpdate(eventData[P_TIMESTEP].GetFloat());
-}
-
-void LogicComponent::HandlePhysicsPostStep(StringHash eventType, VariantMap& eventData)
-{
-    using namespace PhysicsPostStep;
-
-    // Execute user-defined fixed post-update function
-    FixedPostUpdate(eventData[P_TIMESTEP].GetFloat());
+    else
+        return true;
 }
 
-#endif
-
 }
@@ -35,12 +35,18 @@ static const unsigned char USE_POSTUPDATE = 0x2;
 static const unsigned char USE_FIXEDUPDATE = 0x4;
 /// Bitmask for using the physics post-update event.
 static const unsigned char USE_FIXEDPOSTUPDATE = 0x8;
+/// Number of logic component update phases.
+static const unsigned NUM_LOGIC_UPDATE_PHASES = 4;
 
-/// Helper base class for user-defined game logic components that hooks up to update events and forwards them to virtual functions similar to ScriptInstance class.
+class Scene;
+
+/// Helper base class for user-defined game logic components that hooks up to update events and forwards them to virtual functions similar to ScriptInstance class. The scene calls the update functions directly from per-phase update lists.
 class URHO3D_API LogicComponent : public Component
 {
     OBJECT(LogicComponent);
 
+    friend class Scene;
+
     /// Construct.
     LogicComponent(Context* context);
     /// Destruct.
@@ -69,10 +75,17 @@ class URHO3D_API LogicComponent : public Component
 
     /// Set what update events should be subscribed to. Use this for optimization: by default all are in use. Note that this is not an attribute and is not saved or network-serialized, therefore it should always be called eg. in the subclass constructor.
     void SetUpdateEventMask(unsigned char mask);
+    /// Set whether the update functions may be called in parallel with other components on the work queue threads. Default false. The update functions must then only modify the component's own node and components, and must not create or remove scene content.
+    void SetParallelUpdate(bool enable);
+    /// Call the update function of an update phase, identified by its update event mask bit. Called by Scene.
+    void CallUpdate(unsigned char phase, float timeStep);
 
     /// Return what update events are subscribed to.
     unsigned char GetUpdateEventMask() const { return updateEventMask_; }
 
+    /// Return whether the update functions may be called in parallel.
+    bool GetParallelUpdate() const { return parallelUpdate_; }
+
     /// Return whether the DelayedStart() function has been called.
     bool IsDelayedStartCalled() const { return delayedStartCalled_; }
 
@@ -83,24 +96,23 @@ protected:
     virtual void OnSceneSet(Scene* scene);
 
 private:
-    /// Subscribe/unsubscribe to update events based on current enabled state and update event mask.
+    /// Add to or remove from the scene's update lists based on current enabled state and update event mask.
     void UpdateEventSubscription();
-    /// Handle scene update event.
-    void HandleSceneUpdate(StringHash eventType, VariantMap& eventData);
-    /// Handle scene post-update event.
-    void HandleScenePostUpdate(StringHash eventType, VariantMap& eventData);
-#ifdef URHO3D_PHYSICS
-    /// Handle physics pre-step event.
-    void HandlePhysicsPreStep(StringHash eventType, VariantMap& eventData);
-    /// Handle physics post-step event.
-    void HandlePhysicsPostStep(StringHash eventType, VariantMap& eventData);
-#endif
+    /// Call the delayed start function. Return whether the update function is still needed.
+    bool CallDelayedStart();
+
+    /// Scene whose update lists the component is in.
+    WeakPtr<Scene> updateScene_;
+    /// Indices in the scene's update lists per update phase.
+    unsigned updateIndices_[NUM_LOGIC_UPDATE_PHASES];
     /// Requested event subscription mask.
     unsigned char updateEventMask_;
     /// Current event subscription mask.
     unsigned char currentEventMask_;
     /// Flag for delayed start.
     bool delayedStartCalled_;
+    /// Parallel update flag.
+    bool parallelUpdate_;
 };
 
 }
@@ -40,6 +40,12 @@
 namespace Urho3D
 {
 
+/// Check that nodes and components can be added to or removed from a scene.
+static bool CheckStructureChange(Scene* scene)
+{
+    return !scene || scene->CheckStructureChange();
+}
+
 Node::Node(Context* context) :
     Animatable(context),
     networkUpdate_(false),
@@ -576,7 +582,8 @@ void Node::MarkDirty()
 Node* Node::CreateChild(const String& name, CreateMode mode, unsigned id)
 {
     Node* newNode = CreateChild(id, mode);
-    newNode->SetName(name);
+    if (newNode)
+        newNode->SetName(name);
     return newNode;
 }
 
@@ -593,6 +600,9 @@ void Node::AddChild(Node* node, unsigned index)
             return;
         parent = parent->parent_;
     }
+    // Check that both the old and the new scene can be modified
+    if (!CheckStructureChange(scene_) || !CheckStructureChange(node->scene_))
+        return;
 
     // Keep a shared ptr to the node while transfering
     SharedPtr<Node> nodeShared(node);
@@ -646,7 +656,7 @@ void Node::AddChild(Node* node, unsigned index)
 
 void Node::RemoveChild(Node* node)
 {
-    if (!node)
+    if (!node || !CheckStructureChange(scene_))
         return;
 
     for (Vector<SharedPtr<Node> >::Iterator i = children_.Begin(); i != children_.End(); ++i)
@@ -666,6 +676,10 @@ void Node::RemoveAllChildren()
 
 void Node::RemoveChildren(bool removeReplicated, bool removeLocal, bool recursive)
 {
+    // Removal is always allowed when the node is being destroyed
+    if (Refs() > 0 && !CheckStructureChange(scene_))
+        return;
+
     unsigned numRemoved = 0;
 
     for (unsigned i = children_.Size() - 1; i < children_.Size(); --i)
@@ -694,6 +708,9 @@ void Node::RemoveChildren(bool removeReplicated, bool removeLocal, bool recursiv
 
 Component* Node::CreateComponent(StringHash type, CreateMode mode, unsigned id)
 {
+    if (!CheckStructureChange(scene_))
+        return 0;
+
     // Do not attempt to create replicated components to local nodes, as that may lead to component ID overwrite
     // as replicated components are synced over
     if (id_ >= FIRST_LOCAL_ID && mode == REPLICATED)
@@ -772,6 +789,9 @@ Component* Node::CloneComponent(Component* component, CreateMode mode, unsigned
 
 void Node::RemoveComponent(Component* component)
 {
+    if (!CheckStructureChange(scene_))
+        return;
+
     for (Vector<SharedPtr<Component> >::Iterator i = components_.Begin(); i != components_.End(); ++i)
     {
         if (*i == component)
@@ -787,6 +807,9 @@ void Node::RemoveComponent(Component* component)
 
 void Node::RemoveComponent(StringHash type)
 {
+    if (!CheckStructureChange(scene_))
+        return;
+
     for (Vector<SharedPtr<Component> >::Iterator i = components_.Begin(); i != components_.End(); ++i)
     {
         if ((*i)->GetType() == type)
@@ -802,6 +825,10 @@ void Node::RemoveComponent(StringHash type)
 
 void Node::RemoveComponents(bool removeReplicated, bool removeLocal)
 {
+    // Removal is always allowed when the node is being destroyed
+    if (Refs() > 0 && !CheckStructureChange(scene_))
+        return;
+
     unsigned numRemoved = 0;
 
     for (unsigned i = components_.Size() - 1; i < components_.Size(); --i)
@@ -828,6 +855,9 @@ void Node::RemoveComponents(bool removeReplicated, bool removeLocal)
 
 void Node::RemoveComponents(StringHash type)
 {
+    if (!CheckStructureChange(scene_))
+        return;
+
     unsigned numRemoved = 0;
 
     for (unsigned i = components_.Size() - 1; i < components_.Size(); --i)
@@ -858,6 +888,9 @@ Node* Node::Clone(CreateMode mode)
         return 0;
     }
 
+    if (!CheckStructureChange(scene_))
+        return 0;
+
     PROFILE(CloneNode);
 
     SceneResolver resolver;
@@ -1206,6 +1239,9 @@ const PODVector<unsigned char>& Node::GetNetParentAttr() const
 
 bool Node::Load(Deserializer& source, SceneResolver& resolver, bool readChildren, bool rewriteIDs, CreateMode mode)
 {
+    if (!CheckStructureChange(scene_))
+        return false;
+
     // Remove all children and components first in case this is not a fresh load
     RemoveAllChildren();
     RemoveAllComponents();
@@ -1250,6 +1286,9 @@ bool Node::Load(Deserializer& source, SceneResolver& resolver, bool readChildren
 
 bool Node::LoadXML(const XMLElement& source, SceneResolver& resolver, bool readChildren, bool rewriteIDs, CreateMode mode)
 {
+    if (!CheckStructureChange(scene_))
+        return false;
+
     // Remove all children and components first in case this is not a fresh load
     RemoveAllChildren();
     RemoveAllComponents();
@@ -1426,6 +1465,9 @@ void Node::MarkReplicationDirty()
 
 Node* Node::CreateChild(unsigned id, CreateMode mode)
 {
+    if (!CheckStructureChange(scene_))
+        return 0;
+
     SharedPtr<Node> newNode(new Node(context_));
 
     // If zero ID specified, or the ID is already taken, let the scene assign
@@ -1444,7 +1486,7 @@ Node* Node::CreateChild(unsigned id, CreateMode mode)
 
 void Node::AddComponent(Component* component, unsigned id, CreateMode mode)
 {
-    if (!component)
+    if (!component || !CheckStructureChange(scene_))
         return;
 
     components_.Push(SharedPtr<Component>(component));
@@ -1667,6 +1709,9 @@ void Node::SetEnabled(bool enable, bool recursive, bool storeSelf)
 
 Component* Node::SafeCreateComponent(const String& typeName, StringHash type, CreateMode mode, unsigned id)
 {
+    if (!CheckStructureChange(scene_))
+        return 0;
+
     // Do not attempt to create replicated components to local nodes, as that may lead to component ID overwrite
     // as replicated components are synced over
     if (id_ >= FIRST_LOCAL_ID && mode == REPLICATED)
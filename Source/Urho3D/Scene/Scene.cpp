@@ -54,8 +54,33 @@ const char* SUBSYSTEM_CATEGORY = "Subsystem";
 static const float DEFAULT_SMOOTHING_CONSTANT = 50.0f;
 static const float DEFAULT_SNAP_THRESHOLD = 5.0f;
 
+/// Parallel logic component update work data.
+struct LogicUpdateWork
+{
+    /// Update phase mask bit.
+    unsigned char phase_;
+    /// Time step.
+    float timeStep_;
+};
+
+void UpdateLogicComponentsWork(const WorkItem* item, unsigned threadIndex)
+{
+    const LogicUpdateWork* work = reinterpret_cast<const LogicUpdateWork*>(item->aux_);
+    LogicComponent** start = reinterpret_cast<LogicComponent**>(item->start_);
+    LogicComponent** end = reinterpret_cast<LogicComponent**>(item->end_);
+
+    while (start != end)
+    {
+        LogicComponent* component = *start;
+        if (component)
+            component->CallUpdate(work->phase_, work->timeStep_);
+        ++start;
+    }
+}
+
 Scene::Scene(Context* context) :
     Node(context),
+    logicUpdatesDirty_(0),
     replicatedNodeID_(FIRST_REPLICATED_ID),
     replicatedComponentID_(FIRST_REPLICATED_ID),
     localNodeID_(FIRST_LOCAL_ID),
@@ -68,7 +93,8 @@ Scene::Scene(Context* context) :
     snapThreshold_(DEFAULT_SNAP_THRESHOLD),
     updateEnabled_(true),
     asyncLoading_(false),
-    threadedUpdate_(false)
+    threadedUpdate_(false),
+    structureLocked_(false)
 {
     // Assign an ID to self so that nodes can refer to this node as a parent
     SetID(GetFreeNodeID(REPLICATED));
@@ -114,6 +140,9 @@ bool Scene::Load(Deserializer& source, bool setInstanceDefault)
 {
     PROFILE(LoadScene);
 
+    if (!CheckStructureChange())
+        return false;
+
     StopAsyncLoading();
 
     // Check ID
@@ -165,6 +194,9 @@ bool Scene::LoadXML(const XMLElement& source, bool setInstanceDefault)
 {
     PROFILE(LoadSceneXML);
 
+    if (!CheckStructureChange())
+        return false;
+
     StopAsyncLoading();
 
     // Load the whole scene, then perform post-load if successfully loaded
@@ -249,6 +281,9 @@ bool Scene::LoadAsync(File* file, LoadMode mode)
         return false;
     }
 
+    if (!CheckStructureChange())
+        return false;
+
     StopAsyncLoading();
 
     // Check ID
@@ -322,6 +357,9 @@ bool Scene::LoadAsyncXML(File* file, LoadMode mode)
         return false;
     }
 
+    if (!CheckStructureChange())
+        return false;
+
     StopAsyncLoading();
 
     SharedPtr<XMLFile> xml(new XMLFile(context_));
@@ -397,6 +435,9 @@ Node* Scene::Instantiate(Deserializer& source, const Vector3& position, const Qu
 {
     PROFILE(Instantiate);
 
+    if (!CheckStructureChange())
+        return 0;
+
     SceneResolver resolver;
     unsigned nodeID = source.ReadUInt();
     // Rewrite IDs when instantiating
@@ -420,6 +461,9 @@ Node* Scene::InstantiateXML(const XMLElement& source, const Vector3& position, c
 {
     PROFILE(InstantiateXML);
 
+    if (!CheckStructureChange())
+        return 0;
+
     SceneResolver resolver;
     unsigned nodeID = source.GetUInt("id");
     // Rewrite IDs when instantiating
@@ -450,6 +494,9 @@ Node* Scene::InstantiateXML(Deserializer& source, const Vector3& position, const
 
 void Scene::Clear(bool clearReplicated, bool clearLocal)
 {
+    if (!CheckStructureChange())
+        return;
+
     StopAsyncLoading();
 
     RemoveChildren(clearReplicated, clearLocal, true);
@@ -600,7 +647,8 @@ void Scene::Update(float timeStep)
     eventData[P_SCENE] = this;
     eventData[P_TIMESTEP] = timeStep;
 
-    // Update variable timestep logic
+    // Update variable timestep logic. Logic components are updated first, then other event subscribers
+    UpdateLogicComponents(USE_UPDATE, timeStep);
     SendEvent(E_SCENEUPDATE, eventData);
 
     // Update scene attribute animation.
@@ -624,6 +672,7 @@ void Scene::Update(float timeStep)
     }
 
     // Post-update variable timestep logic
+    UpdateLogicComponents(USE_POSTUPDATE, timeStep);
     SendEvent(E_SCENEPOSTUPDATE, eventData);
 
     // Note: using a float for elapsed time accumulation is inherently inaccurate. The purpose of this value is
@@ -656,12 +705,136 @@ void Scene::EndThreadedUpdate()
     }
 }
 
+bool Scene::CheckStructureChange() const
+{
+    if (!structureLocked_)
+        return true;
+
+    LOGERROR("Adding or removing nodes and components is not supported while the scene structure is locked");
+    return false;
+}
+
 void Scene::DelayedMarkedDirty(Component* component)
 {
     MutexLock lock(sceneMutex_);
     delayedDirtyComponents_.Push(component);
 }
 
+void Scene::UpdateLogicComponents(unsigned char updateMask, float timeStep)
+{
+    for (unsigned i = 0; i < NUM_LOGIC_UPDATE_PHASES; ++i)
+    {
+        unsigned char phase = (unsigned char)(1 << i);
+        if (!(updateMask & phase))
+            continue;
+
+        if (logicUpdatesDirty_ & phase)
+        {
+            CompactLogicUpdates(logicUpdates_[i], i);
+            CompactLogicUpdates(parallelLogicUpdates_[i], i);
+            logicUpdatesDirty_ &= ~phase;
+        }
+
+        // Components may be added or removed during the update, so index the list instead of iterating. Removed components
+        // are nulled out, and added components are updated starting from the next update
+        PODVector<LogicComponent*>& components = logicUpdates_[i];
+        unsigned numComponents = components.Size();
+        if (numComponents)
+        {
+            PROFILE(UpdateLogic);
+
+            for (unsigned j = 0; j < numComponents; ++j)
+            {
+                LogicComponent* component = components[j];
+                if (component)
+                    component->CallUpdate(phase, timeStep);
+            }
+        }
+
+        PODVector<LogicComponent*>& parallelComponents = parallelLogicUpdates_[i];
+        if (parallelComponents.Empty())
+            continue;
+
+        PROFILE(UpdateLogicParallel);
+
+        // Execute the delayed start functions on the main thread, as they may modify the scene
+        if (phase == USE_UPDATE)
+        {
+            for (unsigned j = 0; j < parallelComponents.Size(); ++j)
+            {
+                LogicComponent* component = parallelComponents[j];
+                if (component && !component->IsDelayedStartCalled())
+                    component->CallDelayedStart();
+            }
+        }
+
+        WorkQueue* queue = GetSubsystem<WorkQueue>();
+        LogicUpdateWork work;
+        work.phase_ = phase;
+        work.timeStep_ = timeStep;
+
+        numComponents = parallelComponents.Size();
+        unsigned numWorkItems = queue->GetNumThreads() + 1;
+        unsigned componentsPerItem = (numComponents + numWorkItems - 1) / numWorkItems;
+
+        BeginThreadedUpdate();
+
+        LogicComponent** start = &parallelComponents[0];
+        for (unsigned j = 0; j < numComponents; j += componentsPerItem)
+        {
+            unsigned end = j + componentsPerItem;
+            if (end > numComponents)
+                end = numComponents;
+
+            SharedPtr<WorkItem> item = queue->GetFreeItem();
+            item->priority_ = M_MAX_UNSIGNED;
+            item->workFunction_ = UpdateLogicComponentsWork;
+            item->aux_ = &work;
+            item->start_ = start + j;
+            item->end_ = start + end;
+            queue->AddWorkItem(item);
+        }
+
+        queue->Complete(M_MAX_UNSIGNED);
+
+        EndThreadedUpdate();
+    }
+}
+
+void Scene::AddLogicUpdate(LogicComponent* component, unsigned char updateMask)
+{
+    for (unsigned i = 0; i < NUM_LOGIC_UPDATE_PHASES; ++i)
+    {
+        if (updateMask & (1 << i))
+        {
+            PODVector<LogicComponent*>& components = component->GetParallelUpdate() ? parallelLogicUpdates_[i] :
+                logicUpdates_[i];
+            component->updateIndices_[i] = components.Size();
+            components.Push(component);
+        }
+    }
+}
+
+void Scene::RemoveLogicUpdate(LogicComponent* component, unsigned char updateMask)
+{
+    for (unsigned i = 0; i < NUM_LOGIC_UPDATE_PHASES; ++i)
+    {
+        if (updateMask & (1 << i))
+        {
+            // Null out the entry to keep the list valid for an ongoing update. It will be compacted before the next update
+            PODVector<LogicComponent*>& components = component->GetParallelUpdate() ? parallelLogicUpdates_[i] :
+                logicUpdates_[i];
+            unsigned index = component->updateIndices_[i];
+            if (index < components.Size() && components[index] == component)
+            {
+                components[index] = 0;
+                logicUpdatesDirty_ |= 1 << i;
+            }
+            component->updateIndices_[i] = M_MAX_UNSIGNED;
+        }
+    }
+}
+
 unsigned Scene::GetFreeNodeID(CreateMode mode)
 {
     if (mode == REPLICATED)
@@ -1147,6 +1320,22 @@ void Scene::PreloadResources(File* file, bool isSceneFile)
         PreloadResources(file, false);
 }
 
+void Scene::CompactLogicUpdates(PODVector<LogicComponent*>& components, unsigned phase)
+{
+    unsigned numComponents = 0;
+    for (unsigned i = 0; i < components.Size(); ++i)
+    {
+        LogicComponent* component = components[i];
+        if (component)
+        {
+            component->updateIndices_[phase] = numComponents;
+            components[numComponents++] = component;
+        }
+    }
+
+    components.Resize(numComponents);
+}
+
 void Scene::PreloadResourcesXML(const XMLElement& element)
 {
     ResourceCache* cache = GetSubsystem<ResourceCache>();
@@ -25,6 +25,7 @@
 #include "../Container/HashSet.h"
 #include "../Core/Mutex.h"
 #include "../Resource/XMLElement.h"
+#include "../Scene/LogicComponent.h"
 #include "../Scene/Node.h"
 #include "../Scene/SceneResolver.h"
 
@@ -194,9 +195,22 @@ public:
     void EndThreadedUpdate();
     /// Add a component to the delayed dirty notify queue. Is thread-safe.
     void DelayedMarkedDirty(Component* component);
+    /// Call the update functions of logic components for the update phases in the mask. Parallel update components are updated on the work queue threads during a threaded update. Called by Update and PhysicsWorld.
+    void UpdateLogicComponents(unsigned char updateMask, float timeStep);
+    /// Add a logic component to the update lists of the update phases in the mask. Called by LogicComponent.
+    void AddLogicUpdate(LogicComponent* component, unsigned char updateMask);
+    /// Remove a logic component from the update lists of the update phases in the mask. Called by LogicComponent.
+    void RemoveLogicUpdate(LogicComponent* component, unsigned char updateMask);
+
+    /// Set whether adding or removing nodes and components is refused. Used while script object methods are executed in parallel.
+    void SetStructureLocked(bool enable) { structureLocked_ = enable; }
 
     /// Return threaded update flag.
     bool IsThreadedUpdate() const { return threadedUpdate_; }
+    /// Return whether adding or removing nodes and components is refused.
+    bool IsStructureLocked() const { return structureLocked_; }
+    /// Check that nodes and components can be added or removed. Log an error and return false if the structure is locked.
+    bool CheckStructureChange() const;
 
     /// Get free node ID, either non-local or local.
     unsigned GetFreeNodeID(CreateMode mode);
@@ -242,6 +256,8 @@ private:
     void PreloadResources(File* file, bool isSceneFile);
     /// Preload resources from an XML scene or object prefab file.
     void PreloadResourcesXML(const XMLElement& element);
+    /// Remove the entries of removed logic components from an update list.
+    void CompactLogicUpdates(PODVector<LogicComponent*>& components, unsigned phase);
 
     /// Replicated scene nodes by ID.
     HashMap<unsigned, Node*> replicatedNodes_;
@@ -267,10 +283,16 @@ private:
     HashSet<unsigned> networkUpdateComponents_;
     /// Delayed dirty notification queue for components.
     PODVector<Component*> delayedDirtyComponents_;
+    /// Logic components to update per update phase. Removed components are null until compacted.
+    PODVector<LogicComponent*> logicUpdates_[NUM_LOGIC_UPDATE_PHASES];
+    /// Parallel update logic components to update per update phase. Removed components are null until compacted.
+    PODVector<LogicComponent*> parallelLogicUpdates_[NUM_LOGIC_UPDATE_PHASES];
     /// Mutex for the delayed dirty notification queue.
     Mutex sceneMutex_;
     /// Preallocated event data map for smoothing update events.
     VariantMap smoothingData_;
+    /// Update phases whose update lists contain removed components.
+    unsigned logicUpdatesDirty_;
     /// Next free non-local node ID.
     unsigned replicatedNodeID_;
     /// Next free non-local component ID.
@@ -297,6 +319,8 @@ private:
     bool asyncLoading_;
     /// Threaded update flag.
     bool threadedUpdate_;
+    /// Structure locked flag.
+    bool structureLocked_;
 };
 
 /// Register Scene library objects.
@@ -62,6 +62,31 @@ template <class T, class U> U* RefCast(T* t)
     return dynamic_cast<U*>(t);
 }
 
+/// Template function for adding a reference to a RefCounted object from script. Reference counts are not atomic, so serialize
+/// the operation while script object methods are executed in parallel.
+template <class T> void RefCountedAddRef(T* ptr)
+{
+    if (Script::IsExecutingParallel())
+    {
+        MutexLock lock(Script::GetParallelMutex());
+        ptr->AddRef();
+    }
+    else
+        ptr->AddRef();
+}
+
+/// Template function for releasing a reference to a RefCounted object from script.
+template <class T> void RefCountedReleaseRef(T* ptr)
+{
+    if (Script::IsExecutingParallel())
+    {
+        MutexLock lock(Script::GetParallelMutex());
+        ptr->ReleaseRef();
+    }
+    else
+        ptr->ReleaseRef();
+}
+
 /// Template function for Vector to array conversion.
 template <class T> CScriptArray* VectorToArray(const Vector<T>& vector, const char* arrayName)
 {
@@ -130,7 +155,7 @@ template <class T> CScriptArray* VectorToHandleArray(const Vector<T*>& vector, c
             // Increment reference count for storing in the array
             T* ptr = vector[i];
             if (ptr)
-                ptr->AddRef();
+                RefCountedAddRef(ptr);
             *(static_cast<T**>(arr->At(i))) = ptr;
         }
 
@@ -154,7 +179,7 @@ template <class T> CScriptArray* VectorToHandleArray(const PODVector<T*>& vector
             // Increment reference count for storing in the array
             T* ptr = vector[i];
             if (ptr)
-                ptr->AddRef();
+                RefCountedAddRef(ptr);
             *(static_cast<T**>(arr->At(i))) = ptr;
         }
 
@@ -178,7 +203,7 @@ template <class T> CScriptArray* VectorToHandleArray(const Vector<SharedPtr<T> >
             // Increment reference count for storing in the array
             T* ptr = vector[i];
             if (ptr)
-                ptr->AddRef();
+                RefCountedAddRef(ptr);
             *(static_cast<T**>(arr->At(i))) = ptr;
         }
 
@@ -337,8 +362,8 @@ template <class T> void RegisterDeserializer(asIScriptEngine* engine, const char
 template <class T> void RegisterRefCounted(asIScriptEngine* engine, const char* className)
 {
     engine->RegisterObjectType(className, 0, asOBJ_REF);
-    engine->RegisterObjectBehaviour(className, asBEHAVE_ADDREF, "void f()", asMETHODPR(T, AddRef, (), void), asCALL_THISCALL);
-    engine->RegisterObjectBehaviour(className, asBEHAVE_RELEASE, "void f()", asMETHODPR(T, ReleaseRef, (), void), asCALL_THISCALL);
+    engine->RegisterObjectBehaviour(className, asBEHAVE_ADDREF, "void f()", asFUNCTION(RefCountedAddRef<T>), asCALL_CDECL_OBJLAST);
+    engine->RegisterObjectBehaviour(className, asBEHAVE_RELEASE, "void f()", asFUNCTION(RefCountedReleaseRef<T>), asCALL_CDECL_OBJLAST);
     engine->RegisterObjectMethod(className, "int get_refs() const", asMETHODPR(T, Refs, () const, int), asCALL_THISCALL);
     engine->RegisterObjectMethod(className, "int get_weakRefs() const", asMETHODPR(T, WeakRefs, () const, int), asCALL_THISCALL);
     RegisterSubclass<RefCounted, T>(engine, "RefCounted", className);
@@ -346,7 +371,13 @@ template <class T> void RegisterRefCounted(asIScriptEngine* engine, const char*
 
 template <class T> void ObjectSendEvent(const String& eventType, VariantMap& eventData, T* ptr)
 {
-    if (ptr)
+    if (!ptr)
+        return;
+
+    // Events from parallel script object methods are sent once all the parallel calls have been executed
+    if (Script::IsExecutingParallel())
+        GetScriptContext()->GetSubsystem<Script>()->DeferEvent(ptr, StringHash(eventType), eventData);
+    else
         ptr->SendEvent(StringHash(eventType), eventData);
 }
 
@@ -765,7 +765,7 @@ static void SendEvent(const String& eventType, VariantMap& eventData)
 {
     Object* sender = GetScriptContextEventListenerObject();
     if (sender)
-        sender->SendEvent(eventType, eventData);
+        ObjectSendEvent<Object>(eventType, eventData, sender);
 }
 
 static void SubscribeToEvent(const String& eventType, const String& handlerName)
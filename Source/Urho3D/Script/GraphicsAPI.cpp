@@ -461,8 +461,8 @@ static void RegisterTextures(asIScriptEngine* engine)
     engine->RegisterObjectMethod("Viewport", "Vector3 ScreenToWorldPoint(int, int, float) const", asMETHOD(Viewport, ScreenToWorldPoint), asCALL_THISCALL);
 
     engine->RegisterObjectType("RenderSurface", 0, asOBJ_REF);
-    engine->RegisterObjectBehaviour("RenderSurface", asBEHAVE_ADDREF, "void f()", asMETHOD(RenderSurface, AddRef), asCALL_THISCALL);
-    engine->RegisterObjectBehaviour("RenderSurface", asBEHAVE_RELEASE, "void f()", asMETHOD(RenderSurface, ReleaseRef), asCALL_THISCALL);
+    engine->RegisterObjectBehaviour("RenderSurface", asBEHAVE_ADDREF, "void f()", asFUNCTION(RefCountedAddRef<RenderSurface>), asCALL_CDECL_OBJLAST);
+    engine->RegisterObjectBehaviour("RenderSurface", asBEHAVE_RELEASE, "void f()", asFUNCTION(RefCountedReleaseRef<RenderSurface>), asCALL_CDECL_OBJLAST);
     engine->RegisterObjectMethod("RenderSurface", "void QueueUpdate()", asMETHOD(RenderSurface, QueueUpdate), asCALL_THISCALL);
     engine->RegisterObjectMethod("RenderSurface", "Texture@+ get_parentTexture() const", asMETHOD(RenderSurface, GetParentTexture), asCALL_THISCALL);
     engine->RegisterObjectMethod("RenderSurface", "int get_width() const", asMETHOD(RenderSurface, GetWidth), asCALL_THISCALL);
@@ -865,6 +865,7 @@ static void RegisterModel(asIScriptEngine* engine)
     engine->RegisterObjectMethod("Model", "Model@ Clone(const String&in cloneName = String()) const", asFUNCTION(ModelClone), asCALL_CDECL_OBJLAST);
     engine->RegisterObjectMethod("Model", "bool SetGeometry(uint, uint, Geometry@+)", asMETHOD(Model, SetGeometry), asCALL_THISCALL);
     engine->RegisterObjectMethod("Model", "Geometry@+ GetGeometry(uint, uint) const", asMETHOD(Model, GetGeometry), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Model", "void OptimizeGeometries(bool reorderVertices = true)", asMETHOD(Model, OptimizeGeometries), asCALL_THISCALL);
     engine->RegisterObjectMethod("Model", "void set_boundingBox(const BoundingBox&in)", asMETHOD(Model, SetBoundingBox), asCALL_THISCALL);
     engine->RegisterObjectMethod("Model", "const BoundingBox& get_boundingBox() const", asMETHOD(Model, GetBoundingBox), asCALL_THISCALL);
     engine->RegisterObjectMethod("Model", "Skeleton@+ get_skeleton()", asMETHOD(Model, GetSkeleton), asCALL_THISCALL);
@@ -1420,6 +1421,20 @@ static void RegisterDecalSet(asIScriptEngine* engine)
     engine->RegisterObjectMethod("DecalSet", "Zone@+ get_zone() const", asMETHOD(DecalSet, GetZone), asCALL_THISCALL);
 }
 
+static CScriptArray* TerrainGetHeights(CScriptArray* worldPositions, Terrain* ptr)
+{
+    PODVector<float> heights;
+    ptr->GetHeights(ArrayToPODVector<Vector3>(worldPositions), heights);
+    return VectorToArray<float>(heights, "Array<float>");
+}
+
+static CScriptArray* TerrainGetNormals(CScriptArray* worldPositions, Terrain* ptr)
+{
+    PODVector<Vector3> normals;
+    ptr->GetNormals(ArrayToPODVector<Vector3>(worldPositions), normals);
+    return VectorToArray<Vector3>(normals, "Array<Vector3>");
+}
+
 static void RegisterTerrain(asIScriptEngine* engine)
 {
     RegisterDrawable<TerrainPatch>(engine, "TerrainPatch");
@@ -1427,14 +1442,32 @@ static void RegisterTerrain(asIScriptEngine* engine)
     engine->RegisterObjectMethod("Terrain", "void ApplyHeightMap()", asMETHOD(Terrain, ApplyHeightMap), asCALL_THISCALL);
     engine->RegisterObjectMethod("Terrain", "float GetHeight(const Vector3&in) const", asMETHOD(Terrain, GetHeight), asCALL_THISCALL);
     engine->RegisterObjectMethod("Terrain", "Vector3 GetNormal(const Vector3&in) const", asMETHOD(Terrain, GetNormal), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Terrain", "Array<float>@ GetHeights(Array<Vector3>@+) const", asFUNCTION(TerrainGetHeights), asCALL_CDECL_OBJLAST);
+    engine->RegisterObjectMethod("Terrain", "Array<Vector3>@ GetNormals(Array<Vector3>@+) const", asFUNCTION(TerrainGetNormals), asCALL_CDECL_OBJLAST);
     engine->RegisterObjectMethod("Terrain", "TerrainPatch@+ GetPatch(int, int) const", asMETHODPR(Terrain, GetPatch, (int, int) const, TerrainPatch*), asCALL_THISCALL);
     engine->RegisterObjectMethod("Terrain", "IntVector2 WorldToHeightMap(const Vector3&in) const", asMETHOD(Terrain, WorldToHeightMap), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Terrain", "bool IsResident(const Vector3&in) const", asMETHOD(Terrain, IsResident), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Terrain", "void AddPagingPosition(const Vector3&in)", asMETHOD(Terrain, AddPagingPosition), asCALL_THISCALL);
     engine->RegisterObjectMethod("Terrain", "void set_material(Material@+)", asMETHOD(Terrain, SetMaterial), asCALL_THISCALL);
     engine->RegisterObjectMethod("Terrain", "Material@+ get_material() const", asMETHOD(Terrain, GetMaterial), asCALL_THISCALL);
     engine->RegisterObjectMethod("Terrain", "void set_smoothing(bool)", asMETHOD(Terrain, SetSmoothing), asCALL_THISCALL);
     engine->RegisterObjectMethod("Terrain", "bool get_smoothing() const", asMETHOD(Terrain, GetSmoothing), asCALL_THISCALL);
     engine->RegisterObjectMethod("Terrain", "void set_heightMap(Image@+)", asMETHOD(Terrain, SetHeightMap), asCALL_THISCALL);
     engine->RegisterObjectMethod("Terrain", "Image@+ get_heightMap() const", asMETHOD(Terrain, GetHeightMap), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Terrain", "void set_tileHeightMaps(const String&in)", asMETHOD(Terrain, SetTileHeightMaps), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Terrain", "const String& get_tileHeightMaps() const", asMETHOD(Terrain, GetTileHeightMaps), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Terrain", "void set_numTiles(const IntVector2&in)", asMETHOD(Terrain, SetNumTiles), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Terrain", "const IntVector2& get_numTiles() const", asMETHOD(Terrain, GetNumTiles), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Terrain", "void set_tileSize(int)", asMETHOD(Terrain, SetTileSize), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Terrain", "int get_tileSize() const", asMETHOD(Terrain, GetTileSize), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Terrain", "void set_pageDistance(float)", asMETHOD(Terrain, SetPageDistance), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Terrain", "float get_pageDistance() const", asMETHOD(Terrain, GetPageDistance), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Terrain", "bool get_paged() const", asMETHOD(Terrain, IsPaged), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Terrain", "uint get_numResidentTiles() const", asMETHOD(Terrain, GetNumResidentTiles), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Terrain", "uint get_numLoadingTiles() const", asMETHOD(Terrain, GetNumLoadingTiles), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Terrain", "uint get_heightDataMemory() const", asMETHOD(Terrain, GetHeightDataMemory), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Terrain", "uint get_patchGeometryMemory() const", asMETHOD(Terrain, GetPatchGeometryMemory), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Terrain", "float get_averageTileLoadTime() const", asMETHOD(Terrain, GetAverageTileLoadTime), asCALL_THISCALL);
     engine->RegisterObjectMethod("Terrain", "void set_patchSize(int)", asMETHOD(Terrain, SetPatchSize), asCALL_THISCALL);
     engine->RegisterObjectMethod("Terrain", "int get_patchSize() const", asMETHOD(Terrain, GetPatchSize), asCALL_THISCALL);
     engine->RegisterObjectMethod("Terrain", "void set_spacing(const Vector3&in)", asMETHOD(Terrain, SetSpacing), asCALL_THISCALL);
@@ -1621,6 +1654,8 @@ static void RegisterRenderer(asIScriptEngine* engine)
     engine->RegisterObjectMethod("Renderer", "uint get_numLights(bool) const", asMETHOD(Renderer, GetNumLights), asCALL_THISCALL);
     engine->RegisterObjectMethod("Renderer", "uint get_numShadowMaps(bool) const", asMETHOD(Renderer, GetNumShadowMaps), asCALL_THISCALL);
     engine->RegisterObjectMethod("Renderer", "uint get_numOccluders(bool) const", asMETHOD(Renderer, GetNumOccluders), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Renderer", "uint get_numShadowCasterCacheHits(bool) const", asMETHOD(Renderer, GetNumShadowCasterCacheHits), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Renderer", "uint get_numShadowCasterCacheMisses(bool) const", asMETHOD(Renderer, GetNumShadowCasterCacheMisses), asCALL_THISCALL);
     engine->RegisterGlobalFunction("Renderer@+ get_renderer()", asFUNCTION(GetRenderer), asCALL_CDECL);
 }
 
@@ -71,6 +71,9 @@ template<class T> static void RegisterNavMeshBase(asIScriptEngine* engine, const
     engine->RegisterObjectMethod(name, "float GetAreaCost(uint) const", asMETHOD(T, GetAreaCost), asCALL_THISCALL);
     engine->RegisterObjectMethod(name, "Vector3 FindNearestPoint(const Vector3&in, const Vector3&in extents = Vector3(1.0, 1.0, 1.0))", asMETHOD(T, FindNearestPoint), asCALL_THISCALL);
     engine->RegisterObjectMethod(name, "Vector3 MoveAlongSurface(const Vector3&in, const Vector3&in, const Vector3&in extents = Vector3(1.0, 1.0, 1.0), uint = 3)", asMETHOD(T, MoveAlongSurface), asCALL_THISCALL);
+    engine->RegisterObjectMethod(name, "uint RequestPath(const Vector3&in, const Vector3&in, const Vector3&in extents = Vector3(1.0, 1.0, 1.0))", asMETHOD(T, RequestPath), asCALL_THISCALL);
+    engine->RegisterObjectMethod(name, "bool CancelPathRequest(uint)", asMETHOD(T, CancelPathRequest), asCALL_THISCALL);
+    engine->RegisterObjectMethod(name, "void ResetPathQueryStats()", asMETHOD(T, ResetPathQueryStats), asCALL_THISCALL);
     engine->RegisterObjectMethod(name, "Vector3 GetRandomPoint()", asMETHOD(T, GetRandomPoint), asCALL_THISCALL);
     engine->RegisterObjectMethod(name, "Vector3 GetRandomPointInCircle(const Vector3&in, float, const Vector3&in extents = Vector3(1.0, 1.0, 1.0))", asMETHOD(T, GetRandomPointInCircle), asCALL_THISCALL);
     engine->RegisterObjectMethod(name, "float GetDistanceToWall(const Vector3&in, float, const Vector3&in extents = Vector3(1.0, 1.0, 1.0))", asMETHOD(T, GetDistanceToWall), asCALL_THISCALL);
@@ -108,6 +111,9 @@ template<class T> static void RegisterNavMeshBase(asIScriptEngine* engine, const
     engine->RegisterObjectMethod(name, "const BoundingBox& get_boundingBox() const", asMETHOD(T, GetBoundingBox), asCALL_THISCALL);
     engine->RegisterObjectMethod(name, "BoundingBox get_worldBoundingBox() const", asMETHOD(T, GetWorldBoundingBox), asCALL_THISCALL);
     engine->RegisterObjectMethod(name, "IntVector2 get_numTiles() const", asMETHOD(T, GetNumTiles), asCALL_THISCALL);
+    engine->RegisterObjectMethod(name, "void set_pathRequestIterations(int)", asMETHOD(T, SetPathRequestIterations), asCALL_THISCALL);
+    engine->RegisterObjectMethod(name, "int get_pathRequestIterations() const", asMETHOD(T, GetPathRequestIterations), asCALL_THISCALL);
+    engine->RegisterObjectMethod(name, "uint get_numPendingPathRequests() const", asMETHOD(T, GetNumPendingPathRequests), asCALL_THISCALL);
     engine->RegisterObjectMethod(name, "void set_partitionType()", asMETHOD(T, SetPartitionType), asCALL_THISCALL);
     engine->RegisterObjectMethod(name, "NavmeshPartitionType get_partitionType()", asMETHOD(T, GetPartitionType), asCALL_THISCALL);
     engine->RegisterObjectMethod(name, "void set_drawOffMeshConnections(bool)", asMETHOD(T, SetDrawOffMeshConnections), asCALL_THISCALL);
@@ -137,6 +143,14 @@ void RegisterDynamicNavigationMesh(asIScriptEngine* engine)
     engine->RegisterObjectMethod("DynamicNavigationMesh", "bool get_drawObstacles() const", asMETHOD(DynamicNavigationMesh, GetDrawObstacles), asCALL_THISCALL);
     engine->RegisterObjectMethod("DynamicNavigationMesh", "void set_maxObstacles(uint)", asMETHOD(DynamicNavigationMesh, SetMaxObstacles), asCALL_THISCALL);
     engine->RegisterObjectMethod("DynamicNavigationMesh", "uint get_maxObstacles() const", asMETHOD(DynamicNavigationMesh, GetMaxObstacles), asCALL_THISCALL);
+    engine->RegisterObjectMethod("DynamicNavigationMesh", "void ResetTileUpdateStats()", asMETHOD(DynamicNavigationMesh, ResetTileUpdateStats), asCALL_THISCALL);
+    engine->RegisterObjectMethod("DynamicNavigationMesh", "void set_maxTileUpdates(uint)", asMETHOD(DynamicNavigationMesh, SetMaxTileUpdates), asCALL_THISCALL);
+    engine->RegisterObjectMethod("DynamicNavigationMesh", "uint get_maxTileUpdates() const", asMETHOD(DynamicNavigationMesh, GetMaxTileUpdates), asCALL_THISCALL);
+    engine->RegisterObjectMethod("DynamicNavigationMesh", "void set_tileUpdateBudget(float)", asMETHOD(DynamicNavigationMesh, SetTileUpdateBudget), asCALL_THISCALL);
+    engine->RegisterObjectMethod("DynamicNavigationMesh", "float get_tileUpdateBudget() const", asMETHOD(DynamicNavigationMesh, GetTileUpdateBudget), asCALL_THISCALL);
+    engine->RegisterObjectMethod("DynamicNavigationMesh", "void set_threadedTileUpdates(bool)", asMETHOD(DynamicNavigationMesh, SetThreadedTileUpdates), asCALL_THISCALL);
+    engine->RegisterObjectMethod("DynamicNavigationMesh", "bool get_threadedTileUpdates() const", asMETHOD(DynamicNavigationMesh, GetThreadedTileUpdates), asCALL_THISCALL);
+    engine->RegisterObjectMethod("DynamicNavigationMesh", "uint get_numPendingTileUpdates() const", asMETHOD(DynamicNavigationMesh, GetNumPendingTileUpdates), asCALL_THISCALL);
 }
 
 void RegisterOffMeshConnection(asIScriptEngine* engine)
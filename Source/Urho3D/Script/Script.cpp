@@ -23,9 +23,17 @@
 #include "../Precompiled.h"
 
 #include "../Core/Profiler.h"
+#include "../Core/Thread.h"
+#include "../Core/WorkQueue.h"
 #include "../Engine/EngineEvents.h"
+#include "../IO/FileSystem.h"
 #include "../IO/Log.h"
+#ifdef URHO3D_PHYSICS
+#include "../Physics/PhysicsEvents.h"
+#include "../Physics/PhysicsWorld.h"
+#endif
 #include "../Scene/Scene.h"
+#include "../Scene/SceneEvents.h"
 #include "../Script/Addons.h"
 #include "../Script/Script.h"
 #include "../Script/ScriptAPI.h"
@@ -37,13 +45,51 @@
 namespace Urho3D
 {
 
+bool Script::executingParallel_ = false;
+Mutex Script::parallelMutex_;
+
+/// Parallel script call work data.
+struct ParallelScriptWork
+{
+    /// Script subsystem.
+    Script* script_;
+    /// Time step.
+    float timeStep_;
+};
+
+void ExecuteParallelScriptsWork(const WorkItem* item, unsigned threadIndex)
+{
+    const ParallelScriptWork* work = reinterpret_cast<const ParallelScriptWork*>(item->aux_);
+    ParallelScriptCall* start = reinterpret_cast<ParallelScriptCall*>(item->start_);
+    ParallelScriptCall* end = reinterpret_cast<ParallelScriptCall*>(item->end_);
+    asIScriptContext* context = work->script_->GetThreadContext(threadIndex);
+
+    while (start != end)
+    {
+        // Skip objects whose script instance has released them after the call was queued
+        if (start->object_->GetUserData() && context->Prepare(start->method_) >= 0)
+        {
+            context->SetObject(start->object_);
+            context->SetArgFloat(0, work->timeStep_);
+            context->Execute();
+        }
+        ++start;
+    }
+
+    context->Unprepare();
+}
+
 Script::Script(Context* context) :
     Object(context),
     scriptEngine_(0),
     immediateContext_(0),
     scriptNestingLevel_(0),
-    executeConsoleCommands_(false)
+    executeConsoleCommands_(false),
+    parallelCallsSubscribed_(false)
 {
+    // Prepare AngelScript for script execution from the work queue threads
+    asPrepareMultithread();
+
     scriptEngine_ = asCreateScriptEngine(ANGELSCRIPT_VERSION);
     if (!scriptEngine_)
     {
@@ -110,6 +156,10 @@ Script::~Script()
 
     for (unsigned i = 0; i < scriptFileContexts_.Size(); ++i)
         scriptFileContexts_[i]->Release();
+    for (unsigned i = 0; i < threadContexts_.Size(); ++i)
+        threadContexts_[i]->Release();
+    for (unsigned i = 0; i < parallelCalls_.Size(); ++i)
+        parallelCalls_[i].object_->Release();
 
     if (scriptEngine_)
     {
@@ -123,6 +173,9 @@ bool Script::Execute(const String& line)
     // Note: compiling code each time is slow. Not to be used for performance-critical or repeating activity
     PROFILE(ExecuteImmediate);
 
+    if (!CheckSerialExecution("Executing script code"))
+        return false;
+
     ClearObjectTypeCache();
 
     String wrappedLine = "void f(){\n" + line + ";\n}";
@@ -175,6 +228,62 @@ void Script::SetExecuteConsoleCommands(bool enable)
         UnsubscribeFromEvent(E_CONSOLECOMMAND);
 }
 
+void Script::SetByteCodeCacheDir(const String& path)
+{
+    byteCodeCacheDir_ = path.Empty() ? String::EMPTY : AddTrailingSlash(path);
+}
+
+void Script::AddParallelCall(asIScriptObject* object, asIScriptFunction* method)
+{
+    if (!object || !method)
+        return;
+
+    // Subscribe to the update events without a sender, so that the handlers are called after the script instances have queued
+    // their calls
+    if (!parallelCallsSubscribed_)
+    {
+        SubscribeToEvent(E_SCENEUPDATE, HANDLER(Script, HandleSceneUpdate));
+        SubscribeToEvent(E_SCENEPOSTUPDATE, HANDLER(Script, HandleSceneUpdate));
+#ifdef URHO3D_PHYSICS
+        SubscribeToEvent(E_PHYSICSPRESTEP, HANDLER(Script, HandlePhysicsStep));
+        SubscribeToEvent(E_PHYSICSPOSTSTEP, HANDLER(Script, HandlePhysicsStep));
+#endif
+        parallelCallsSubscribed_ = true;
+    }
+
+    // Keep the object alive until the call has been executed
+    object->AddRef();
+
+    ParallelScriptCall call;
+    call.object_ = object;
+    call.method_ = method;
+    parallelCalls_.Push(call);
+}
+
+void Script::DeferEvent(Object* sender, StringHash eventType, const VariantMap& eventData)
+{
+    if (!sender)
+        return;
+
+    // The copy touches reference counts of the sender and of pointers in the event data, so do it under the lock
+    MutexLock lock(parallelMutex_);
+
+    DeferredScriptEvent event;
+    event.sender_ = sender;
+    event.eventType_ = eventType;
+    event.eventData_ = eventData;
+    deferredEvents_.Push(event);
+}
+
+bool Script::CheckSerialExecution(const char* action)
+{
+    if (!executingParallel_ && Thread::IsMainThread())
+        return true;
+
+    LOGERRORF("%s is not supported from worker threads or parallel script object methods", action);
+    return false;
+}
+
 void Script::MessageCallback(const asSMessageInfo* msg)
 {
     String message;
@@ -245,6 +354,9 @@ void Script::ClearObjectTypeCache()
 
 asIObjectType* Script::GetObjectType(const char* declaration)
 {
+    // Script API functions may query object types also from the work queue threads during parallel script execution
+    MutexLock lock(objectTypeMutex_);
+
     HashMap<const char*, asIObjectType*>::ConstIterator i = objectTypes_.Find(declaration);
     if (i != objectTypes_.End())
         return i->second_;
@@ -256,6 +368,9 @@ asIObjectType* Script::GetObjectType(const char* declaration)
 
 asIScriptContext* Script::GetScriptFileContext()
 {
+    if (!CheckSerialExecution("Executing script functions"))
+        return 0;
+
     while (scriptNestingLevel_ >= scriptFileContexts_.Size())
     {
         asIScriptContext* newContext = scriptEngine_->CreateContext();
@@ -266,6 +381,94 @@ asIScriptContext* Script::GetScriptFileContext()
     return scriptFileContexts_[scriptNestingLevel_];
 }
 
+void Script::ExecuteParallelCalls(Scene* scene, float timeStep)
+{
+    if (parallelCalls_.Empty())
+        return;
+
+    PROFILE(ExecuteScriptsParallel);
+
+    WorkQueue* queue = GetSubsystem<WorkQueue>();
+    unsigned numThreads = queue->GetNumThreads() + 1;
+    while (threadContexts_.Size() < numThreads)
+    {
+        asIScriptContext* newContext = scriptEngine_->CreateContext();
+        newContext->SetExceptionCallback(asMETHOD(Script, ExceptionCallback), this, asCALL_THISCALL);
+        threadContexts_.Push(newContext);
+    }
+
+    ParallelScriptWork work;
+    work.script_ = this;
+    work.timeStep_ = timeStep;
+
+    unsigned numCalls = parallelCalls_.Size();
+    unsigned callsPerItem = (numCalls + numThreads - 1) / numThreads;
+
+    // Resolve the world transforms of the script objects' nodes and their parents now, so that reading them in parallel does
+    // not update them lazily from several threads
+    for (unsigned i = 0; i < numCalls; ++i)
+    {
+        ScriptInstance* instance = static_cast<ScriptInstance*>(parallelCalls_[i].object_->GetUserData());
+        Node* node = instance ? instance->GetNode() : 0;
+        if (node)
+            node->GetWorldTransform();
+    }
+
+    // Put the scene into threaded mode so that transform changes from the scripts defer their dirty notifications, and lock
+    // its structure. Set the parallel execution flag before adding the work items, as the worker threads start executing
+    // them immediately
+    if (scene)
+    {
+        scene->BeginThreadedUpdate();
+        scene->SetStructureLocked(true);
+    }
+    executingParallel_ = true;
+
+    ParallelScriptCall* start = &parallelCalls_[0];
+    for (unsigned i = 0; i < numCalls; i += callsPerItem)
+    {
+        unsigned end = i + callsPerItem;
+        if (end > numCalls)
+            end = numCalls;
+
+        SharedPtr<WorkItem> item = queue->GetFreeItem();
+        item->priority_ = M_MAX_UNSIGNED;
+        item->workFunction_ = ExecuteParallelScriptsWork;
+        item->aux_ = &work;
+        item->start_ = start + i;
+        item->end_ = start + end;
+        queue->AddWorkItem(item);
+    }
+
+    queue->Complete(M_MAX_UNSIGNED);
+    executingParallel_ = false;
+
+    if (scene)
+    {
+        scene->SetStructureLocked(false);
+        scene->EndThreadedUpdate();
+    }
+
+    for (unsigned i = 0; i < numCalls; ++i)
+        parallelCalls_[i].object_->Release();
+    parallelCalls_.Clear();
+
+    // Send the events from the parallel calls now that the main thread is the only one executing script code again. The
+    // handlers may cause further parallel execution, so take a copy of the queue first
+    if (!deferredEvents_.Empty())
+    {
+        Vector<DeferredScriptEvent> events = deferredEvents_;
+        deferredEvents_.Clear();
+
+        for (unsigned i = 0; i < events.Size(); ++i)
+        {
+            Object* sender = events[i].sender_;
+            if (sender)
+                sender->SendEvent(events[i].eventType_, events[i].eventData_);
+        }
+    }
+}
+
 void Script::HandleConsoleCommand(StringHash eventType, VariantMap& eventData)
 {
     using namespace ConsoleCommand;
@@ -273,6 +476,25 @@ void Script::HandleConsoleCommand(StringHash eventType, VariantMap& eventData)
         Execute(eventData[P_COMMAND].GetString());
 }
 
+void Script::HandleSceneUpdate(StringHash eventType, VariantMap& eventData)
+{
+    // The scene update and post-update events share the parameter layout
+    using namespace SceneUpdate;
+
+    ExecuteParallelCalls(static_cast<Scene*>(eventData[P_SCENE].GetPtr()), eventData[P_TIMESTEP].GetFloat());
+}
+
+#ifdef URHO3D_PHYSICS
+void Script::HandlePhysicsStep(StringHash eventType, VariantMap& eventData)
+{
+    // The physics pre-step and post-step events share the parameter layout
+    using namespace PhysicsPreStep;
+
+    PhysicsWorld* world = static_cast<PhysicsWorld*>(eventData[P_WORLD].GetPtr());
+    ExecuteParallelCalls(world ? world->GetScene() : 0, eventData[P_TIMESTEP].GetFloat());
+}
+#endif
+
 void RegisterScriptLibrary(Context* context)
 {
     ScriptFile::RegisterObject(context);
@@ -28,7 +28,9 @@
 class asIObjectType;
 class asIScriptContext;
 class asIScriptEngine;
+class asIScriptFunction;
 class asIScriptModule;
+class asIScriptObject;
 
 struct asSMessageInfo;
 
@@ -49,6 +51,26 @@ enum DumpMode
     MAX_DUMP_MODES
 };
 
+/// Script object method queued for parallel execution.
+struct ParallelScriptCall
+{
+    /// Script object.
+    asIScriptObject* object_;
+    /// Method.
+    asIScriptFunction* method_;
+};
+
+/// Event sent from a parallel script method, deferred until the parallel calls have been executed.
+struct DeferredScriptEvent
+{
+    /// Sender.
+    WeakPtr<Object> sender_;
+    /// Event type.
+    StringHash eventType_;
+    /// Event data.
+    VariantMap eventData_;
+};
+
 /// Scripting subsystem. Allows execution of AngelScript.
 class URHO3D_API Script : public Object
 {
@@ -70,6 +92,8 @@ public:
     void SetDefaultScene(Scene* scene);
     /// Set whether to execute engine console commands as script code.
     void SetExecuteConsoleCommands(bool enable);
+    /// Set bytecode cache directory. Script files compiled from source are saved there as bytecode keyed by a checksum of the source and its includes, and loaded from there on subsequent loads. Empty (default) disables the cache.
+    void SetByteCodeCacheDir(const String& path);
     /// Print the whole script API (all registered classes, methods and properties) to the log. No-ops when URHO3D_LOGGING not defined.
     void DumpAPI(DumpMode mode = DOXYGEN, const String& sourceTree = String::EMPTY);
     /// Log a message from the script engine.
@@ -93,6 +117,9 @@ public:
     /// Return whether is executing engine console commands as script code.
     bool GetExecuteConsoleCommands() const { return executeConsoleCommands_; }
 
+    /// Return bytecode cache directory.
+    const String& GetByteCodeCacheDir() const { return byteCodeCacheDir_; }
+
     /// Clear the inbuild object type cache.
     void ClearObjectTypeCache();
     /// Query for an inbuilt object type by constant declaration. Can not be used for script types.
@@ -101,6 +128,20 @@ public:
     /// Return the script module create/delete mutex.
     Mutex& GetModuleMutex() { return moduleMutex_; }
 
+    /// Queue a script object update method taking the time step for parallel execution on the work queue threads. The queue is executed after the scene update or physics step event being handled has been sent to the script objects. Called by ScriptInstance.
+    void AddParallelCall(asIScriptObject* object, asIScriptFunction* method);
+    /// Return the execution context of a work queue thread (0 = main thread) for parallel execution.
+    asIScriptContext* GetThreadContext(unsigned threadIndex) const { return threadContexts_[threadIndex]; }
+    /// Queue an event sent from a parallel script method. It is sent from the main thread once all parallel calls have been executed.
+    void DeferEvent(Object* sender, StringHash eventType, const VariantMap& eventData);
+
+    /// Return whether script object methods are being executed in parallel.
+    static bool IsExecutingParallel() { return executingParallel_; }
+    /// Return the mutex for serializing reference counting and event queuing from script during parallel execution.
+    static Mutex& GetParallelMutex() { return parallelMutex_; }
+    /// Check that an operation which must not be performed during parallel execution, or from a worker thread, can be performed. Log an error and return false if not.
+    static bool CheckSerialExecution(const char* action);
+
 private:
     /// Increase script nesting level.
     void IncScriptNestingLevel() { ++scriptNestingLevel_; }
@@ -115,8 +156,16 @@ private:
     asIScriptContext* GetScriptFileContext();
     /// Output a sanitated row of script API. No-ops when URHO3D_LOGGING not defined.
     void OutputAPIRow(DumpMode mode, const String& row, bool removeReference = false, String separator = ";");
+    /// Execute the queued parallel script calls.
+    void ExecuteParallelCalls(Scene* scene, float timeStep);
     /// Handle a console command event.
     void HandleConsoleCommand(StringHash eventType, VariantMap& eventData);
+    /// Handle scene update or post-update event to execute the queued parallel script calls.
+    void HandleSceneUpdate(StringHash eventType, VariantMap& eventData);
+#ifdef URHO3D_PHYSICS
+    /// Handle physics pre-step or post-step event to execute the queued parallel script calls.
+    void HandlePhysicsStep(StringHash eventType, VariantMap& eventData);
+#endif
 
     /// AngelScript engine.
     asIScriptEngine* scriptEngine_;
@@ -128,14 +177,31 @@ private:
     WeakPtr<Scene> defaultScene_;
     /// Script function/method execution contexts.
     Vector<asIScriptContext*> scriptFileContexts_;
+    /// Parallel execution contexts per work queue thread.
+    Vector<asIScriptContext*> threadContexts_;
+    /// Queued parallel script calls.
+    PODVector<ParallelScriptCall> parallelCalls_;
+    /// Events sent during parallel execution.
+    Vector<DeferredScriptEvent> deferredEvents_;
     /// Search cache for inbuilt object types.
     HashMap<const char*, asIObjectType*> objectTypes_;
+    /// Bytecode cache directory.
+    String byteCodeCacheDir_;
     /// Script module create/delete mutex.
     Mutex moduleMutex_;
+    /// Inbuilt object type cache mutex.
+    Mutex objectTypeMutex_;
     /// Current script execution nesting level.
     unsigned scriptNestingLevel_;
     /// Flag for executing engine console commands as script code. Default to true.
     bool executeConsoleCommands_;
+    /// Flag for being subscribed to the events that execute the parallel script calls.
+    bool parallelCallsSubscribed_;
+
+    /// Parallel execution flag.
+    static bool executingParallel_;
+    /// Parallel execution reference counting and event queue mutex.
+    static Mutex parallelMutex_;
 };
 
 /// Register Script library objects.
@@ -246,6 +246,8 @@ static void RegisterScriptInstance(asIScriptEngine* engine)
     engine->RegisterObjectMethod("ScriptInstance", "ScriptObject@+ get_scriptObject() const", asMETHOD(ScriptInstance, GetScriptObject), asCALL_THISCALL);
     engine->RegisterObjectMethod("ScriptInstance", "void set_className(const String&in)", asMETHOD(ScriptInstance, SetClassName), asCALL_THISCALL);
     engine->RegisterObjectMethod("ScriptInstance", "const String& get_className() const", asMETHOD(ScriptInstance, GetClassName), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ScriptInstance", "void set_parallelUpdate(bool)", asMETHOD(ScriptInstance, SetParallelUpdate), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ScriptInstance", "bool get_parallelUpdate() const", asMETHOD(ScriptInstance, GetParallelUpdate), asCALL_THISCALL);
     engine->RegisterGlobalFunction("ScriptInstance@+ get_self()", asFUNCTION(GetSelf), asCALL_CDECL);
 
     // Register convenience functions for controlling self, similar to event sending
@@ -275,6 +277,8 @@ static void RegisterScript(asIScriptEngine* engine)
     engine->RegisterObjectMethod("Script", "Scene@+ get_defaultScene() const", asMETHOD(Script, GetDefaultScene), asCALL_THISCALL);
     engine->RegisterObjectMethod("Script", "void set_executeConsoleCommands(bool)", asMETHOD(Script, SetExecuteConsoleCommands), asCALL_THISCALL);
     engine->RegisterObjectMethod("Script", "bool get_executeConsoleCommands() const", asMETHOD(Script, GetExecuteConsoleCommands), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Script", "void set_byteCodeCacheDir(const String&in)", asMETHOD(Script, SetByteCodeCacheDir), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Script", "const String& get_byteCodeCacheDir() const", asMETHOD(Script, GetByteCodeCacheDir), asCALL_THISCALL);
     engine->RegisterGlobalFunction("Script@+ get_script()", asFUNCTION(GetScript), asCALL_CDECL);
 }
 
@@ -25,6 +25,8 @@
 #include "../Core/Context.h"
 #include "../Core/CoreEvents.h"
 #include "../Core/Profiler.h"
+#include "../Core/Timer.h"
+#include "../IO/File.h"
 #include "../IO/FileSystem.h"
 #include "../IO/Log.h"
 #include "../IO/MemoryBuffer.h"
@@ -40,6 +42,8 @@
 namespace Urho3D
 {
 
+static const unsigned BYTECODE_CACHE_VERSION = 2;
+
 /// Helper class for saving AngelScript bytecode.
 class ByteCodeSerializer : public asIBinaryStream
 {
@@ -98,7 +102,10 @@ ScriptFile::ScriptFile(Context* context) :
     script_(GetSubsystem<Script>()),
     scriptModule_(0),
     compiled_(false),
-    subscribed_(false)
+    subscribed_(false),
+    loadByteCodeSize_(0),
+    checksum_(0),
+    sourceSize_(0)
 {
 }
 
@@ -116,6 +123,9 @@ bool ScriptFile::BeginLoad(Deserializer& source)
 {
     ReleaseModule();
     loadByteCode_.Reset();
+    cacheFileName_.Clear();
+    checksum_ = 0;
+    sourceSize_ = 0;
 
     asIScriptEngine* engine = script_->GetScriptEngine();
 
@@ -146,12 +156,26 @@ bool ScriptFile::BeginLoad(Deserializer& source)
     // Not bytecode: add the initial section and check for includes.
     // Perform actual building during EndLoad(), as AngelScript can not multithread module compilation,
     // and static initializers may access arbitrary engine functionality which may not be thread-safe
-    return AddScriptSection(engine, source);
+    if (!AddScriptSection(engine, source))
+        return false;
+
+    // Check the bytecode cache now that the checksum of all the sections is known. The sections stay in the module, so that
+    // compiling is still possible if the cached bytecode turns out to be unloadable
+    const String& cacheDir = script_->GetByteCodeCacheDir();
+    if (!cacheDir.Empty())
+    {
+        cacheFileName_ = cacheDir + ToString("%08x.asc", checksum_);
+        LoadByteCodeCache();
+    }
+
+    return true;
 }
 
 bool ScriptFile::EndLoad()
 {
+    HiresTimer loadTimer;
     bool success = false;
+    bool useCache = !cacheFileName_.Empty();
 
     // Load from bytecode if available, else compile
     if (loadByteCode_)
@@ -161,17 +185,24 @@ bool ScriptFile::EndLoad()
 
         if (scriptModule_->LoadByteCode(&deserializer) >= 0)
         {
-            LOGINFO("Loaded script module " + GetName() + " from bytecode");
+            LOGINFOF("Loaded script module %s from %s in %d ms", GetName().CString(), useCache ? "bytecode cache" : "bytecode",
+                (int)(loadTimer.GetUSec(false) / 1000));
             success = true;
         }
+        else if (useCache)
+            LOGWARNING("Ignoring unloadable bytecode cache " + cacheFileName_);
     }
-    else
+
+    if (!success && (!loadByteCode_ || useCache))
     {
         int result = scriptModule_->Build();
         if (result >= 0)
         {
-            LOGINFO("Compiled script module " + GetName());
+            LOGINFOF("Compiled script module %s in %d ms", GetName().CString(), (int)(loadTimer.GetUSec(false) / 1000));
             success = true;
+
+            if (useCache)
+                SaveByteCodeCache();
         }
         else
             LOGERROR("Failed to compile script module " + GetName());
@@ -295,7 +326,7 @@ bool ScriptFile::Execute(asIScriptFunction* function, const VariantVector& param
     Script* scriptSystem = script_;
 
     asIScriptContext* context = scriptSystem->GetScriptFileContext();
-    if (context->Prepare(function) < 0)
+    if (!context || context->Prepare(function) < 0)
         return false;
 
     SetParameters(context, function, parameters);
@@ -336,7 +367,7 @@ bool ScriptFile::Execute(asIScriptObject* object, asIScriptFunction* method, con
     Script* scriptSystem = script_;
 
     asIScriptContext* context = scriptSystem->GetScriptFileContext();
-    if (context->Prepare(method) < 0)
+    if (!context || context->Prepare(method) < 0)
         return false;
 
     context->SetObject(object);
@@ -351,6 +382,30 @@ bool ScriptFile::Execute(asIScriptObject* object, asIScriptFunction* method, con
     return success;
 }
 
+bool ScriptFile::Execute(asIScriptObject* object, asIScriptFunction* method, float param, bool unprepare)
+{
+    // This is called for each script object on each frame, so do not add a profiling block per call
+    if (!compiled_ || !object || !method)
+        return false;
+
+    Script* scriptSystem = script_;
+
+    asIScriptContext* context = scriptSystem->GetScriptFileContext();
+    if (!context || context->Prepare(method) < 0)
+        return false;
+
+    context->SetObject(object);
+    context->SetArgFloat(0, param);
+
+    scriptSystem->IncScriptNestingLevel();
+    bool success = context->Execute() >= 0;
+    if (unprepare)
+        context->Unprepare();
+    scriptSystem->DecScriptNestingLevel();
+
+    return success;
+}
+
 void ScriptFile::DelayedExecute(float delay, bool repeat, const String& declaration, const VariantVector& parameters)
 {
     DelayedCall call;
@@ -392,6 +447,9 @@ asIScriptObject* ScriptFile::CreateObject(const String& className, bool useInter
         return 0;
 
     asIScriptContext* context = script_->GetScriptFileContext();
+    if (!context)
+        return 0;
+
     asIObjectType* type = 0;
     if (useInterface)
     {
@@ -569,6 +627,15 @@ bool ScriptFile::AddScriptSection(asIScriptEngine* engine, Deserializer& source)
     SharedArrayPtr<char> buffer(new char[dataSize]);
     source.Read((void*)buffer.Get(), dataSize);
 
+    // Include the section name and contents in the checksum, so that changing any of the include files invalidates the
+    // cached bytecode
+    const String& sectionName = source.GetName();
+    for (unsigned i = 0; i < sectionName.Length(); ++i)
+        checksum_ = SDBMHash(checksum_, (unsigned char)sectionName[i]);
+    for (unsigned i = 0; i < dataSize; ++i)
+        checksum_ = SDBMHash(checksum_, (unsigned char)buffer[i]);
+    sourceSize_ += dataSize;
+
     // Pre-parse for includes
     // Adapted from Angelscript's scriptbuilder add-on
     Vector<String> includeFiles;
@@ -691,6 +758,84 @@ bool ScriptFile::AddScriptSection(asIScriptEngine* engine, Deserializer& source)
     return true;
 }
 
+bool ScriptFile::LoadByteCodeCache()
+{
+    if (!GetSubsystem<FileSystem>()->FileExists(cacheFileName_))
+        return false;
+
+    File file(context_, cacheFileName_);
+    if (!file.IsOpen() || file.ReadFileID() != "UASC")
+        return false;
+
+    // The bytecode depends also on the registered script API, so check that it has not changed
+    asIScriptEngine* engine = script_->GetScriptEngine();
+    if (file.ReadUInt() != BYTECODE_CACHE_VERSION || file.ReadUInt() != (unsigned)ANGELSCRIPT_VERSION ||
+        file.ReadUInt() != engine->GetObjectTypeCount() || file.ReadUInt() != engine->GetGlobalFunctionCount() ||
+        file.ReadUInt() != checksum_)
+    {
+        LOGDEBUG("Ignoring outdated bytecode cache " + cacheFileName_);
+        return false;
+    }
+
+    // The checksum also names the cache file, so verify the script name and the source size to tell apart different
+    // scripts whose checksums collide
+    if (file.ReadString() != GetName() || file.ReadUInt() != sourceSize_)
+    {
+        LOGDEBUG("Ignoring outdated bytecode cache " + cacheFileName_);
+        return false;
+    }
+
+    loadByteCodeSize_ = file.GetSize() - file.GetPosition();
+    if (!loadByteCodeSize_)
+        return false;
+
+    loadByteCode_ = new unsigned char[loadByteCodeSize_];
+    if (file.Read(loadByteCode_.Get(), loadByteCodeSize_) != loadByteCodeSize_)
+    {
+        loadByteCode_.Reset();
+        return false;
+    }
+
+    return true;
+}
+
+void ScriptFile::SaveByteCodeCache()
+{
+    FileSystem* fileSystem = GetSubsystem<FileSystem>();
+    String pathName = GetPath(cacheFileName_);
+    if (!fileSystem->DirExists(pathName) && !fileSystem->CreateDir(pathName))
+    {
+        LOGWARNING("Could not create bytecode cache directory " + pathName);
+        return;
+    }
+
+    File file(context_, cacheFileName_, FILE_WRITE);
+    if (!file.IsOpen())
+    {
+        LOGWARNING("Could not write bytecode cache " + cacheFileName_);
+        return;
+    }
+
+    asIScriptEngine* engine = script_->GetScriptEngine();
+    file.WriteFileID("UASC");
+    file.WriteUInt(BYTECODE_CACHE_VERSION);
+    file.WriteUInt(ANGELSCRIPT_VERSION);
+    file.WriteUInt(engine->GetObjectTypeCount());
+    file.WriteUInt(engine->GetGlobalFunctionCount());
+    file.WriteUInt(checksum_);
+    file.WriteString(GetName());
+    file.WriteUInt(sourceSize_);
+
+    // Keep the debug info so that script exceptions report the same line numbers as when compiled from source
+    ByteCodeSerializer serializer = ByteCodeSerializer(file);
+    if (scriptModule_->SaveByteCode(&serializer, false) < 0)
+    {
+        file.Close();
+        fileSystem->Delete(cacheFileName_);
+        LOGWARNING("Could not save bytecode of script module " + GetName());
+    }
+}
+
 void ScriptFile::SetParameters(asIScriptContext* context, asIScriptFunction* function, const VariantVector& parameters)
 {
     unsigned paramCount = function->GetParamCount();
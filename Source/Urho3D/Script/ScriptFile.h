@@ -85,6 +85,8 @@ public:
     /// Execute an object method.
     bool Execute(asIScriptObject* object, asIScriptFunction* method, const VariantVector& parameters = Variant::emptyVariantVector,
         bool unprepare = true);
+    /// Execute an object method that takes a single float parameter, such as a time step. Sets the parameter directly without Variant conversion.
+    bool Execute(asIScriptObject* object, asIScriptFunction* method, float param, bool unprepare = true);
     /// Add a delay-executed function call, optionally repeating.
     void DelayedExecute
         (float delay, bool repeat, const String& declaration, const VariantVector& parameters = Variant::emptyVariantVector);
@@ -114,6 +116,10 @@ private:
     void AddEventHandlerInternal(Object* sender, StringHash eventType, const String& handlerName);
     /// Add a script section, checking for includes recursively. Return true if successful.
     bool AddScriptSection(asIScriptEngine* engine, Deserializer& source);
+    /// Read up-to-date bytecode for the added script sections from the bytecode cache. Return true if found.
+    bool LoadByteCodeCache();
+    /// Save the compiled bytecode to the bytecode cache.
+    void SaveByteCodeCache();
     /// Set parameters for a function or method.
     void SetParameters(asIScriptContext* context, asIScriptFunction* function, const VariantVector& parameters);
     /// Release the script module.
@@ -145,6 +151,12 @@ private:
     SharedArrayPtr<unsigned char> loadByteCode_;
     /// Byte code size for asynchronous loading.
     unsigned loadByteCodeSize_;
+    /// Checksum of the script sections, including the include files.
+    unsigned checksum_;
+    /// Total size of the script sections, including the include files.
+    unsigned sourceSize_;
+    /// Bytecode cache file name, empty if the cache is not used.
+    String cacheFileName_;
 };
 
 /// Helper class for forwarding events to script objects that are not part of a scene.
@@ -66,7 +66,8 @@ ScriptInstance::ScriptInstance(Context* context) :
     script_(GetSubsystem<Script>()),
     scriptObject_(0),
     subscribed_(false),
-    subscribedPostFixed_(false)
+    subscribedPostFixed_(false),
+    parallelUpdate_(false)
 {
     ClearScriptMethods();
     ClearScriptAttributes();
@@ -260,7 +261,7 @@ bool ScriptInstance::Execute(asIScriptFunction* method, const VariantVector& par
 
 void ScriptInstance::DelayedExecute(float delay, bool repeat, const String& declaration, const VariantVector& parameters)
 {
-    if (!scriptObject_)
+    if (!scriptObject_ || !Script::CheckSerialExecution("Delayed method execution"))
         return;
 
     DelayedCall call;
@@ -277,6 +278,9 @@ void ScriptInstance::DelayedExecute(float delay, bool repeat, const String& decl
 
 void ScriptInstance::ClearDelayedExecute(const String& declaration)
 {
+    if (!Script::CheckSerialExecution("Delayed method execution"))
+        return;
+
     if (declaration.Empty())
         delayedCalls_.Clear();
     else
@@ -293,7 +297,7 @@ void ScriptInstance::ClearDelayedExecute(const String& declaration)
 
 void ScriptInstance::AddEventHandler(StringHash eventType, const String& handlerName)
 {
-    if (!scriptObject_)
+    if (!scriptObject_ || !Script::CheckSerialExecution("Subscribing to events"))
         return;
 
     String declaration = "void " + handlerName + "(StringHash, VariantMap&)";
@@ -314,7 +318,7 @@ void ScriptInstance::AddEventHandler(StringHash eventType, const String& handler
 
 void ScriptInstance::AddEventHandler(Object* sender, StringHash eventType, const String& handlerName)
 {
-    if (!scriptObject_)
+    if (!scriptObject_ || !Script::CheckSerialExecution("Subscribing to events"))
         return;
 
     if (!sender)
@@ -341,29 +345,49 @@ void ScriptInstance::AddEventHandler(Object* sender, StringHash eventType, const
 
 void ScriptInstance::RemoveEventHandler(StringHash eventType)
 {
+    if (!Script::CheckSerialExecution("Unsubscribing from events"))
+        return;
+
     UnsubscribeFromEvent(eventType);
 }
 
 void ScriptInstance::RemoveEventHandler(Object* sender, StringHash eventType)
 {
+    if (!Script::CheckSerialExecution("Unsubscribing from events"))
+        return;
+
     UnsubscribeFromEvent(sender, eventType);
 }
 
 void ScriptInstance::RemoveEventHandlers(Object* sender)
 {
+    if (!Script::CheckSerialExecution("Unsubscribing from events"))
+        return;
+
     UnsubscribeFromEvents(sender);
 }
 
 void ScriptInstance::RemoveEventHandlers()
 {
+    if (!Script::CheckSerialExecution("Unsubscribing from events"))
+        return;
+
     UnsubscribeFromAllEventsExcept(PODVector<StringHash>(), true);
 }
 
 void ScriptInstance::RemoveEventHandlersExcept(const PODVector<StringHash>& exceptions)
 {
+    if (!Script::CheckSerialExecution("Unsubscribing from events"))
+        return;
+
     UnsubscribeFromAllEventsExcept(exceptions, true);
 }
 
+void ScriptInstance::SetParallelUpdate(bool enable)
+{
+    parallelUpdate_ = enable;
+}
+
 bool ScriptInstance::IsA(const String& className) const
 {
     // Early out for the easiest case where that's what we are
@@ -740,6 +764,15 @@ void ScriptInstance::UpdateEventSubscription()
     }
 }
 
+void ScriptInstance::ExecuteUpdateMethod(asIScriptFunction* method, float timeStep)
+{
+    // Delayed calls and delayed start have been executed by now, so only the update method itself is deferred
+    if (parallelUpdate_)
+        script_->AddParallelCall(scriptObject_, method);
+    else
+        scriptFile_->Execute(scriptObject_, method, timeStep);
+}
+
 void ScriptInstance::HandleSceneUpdate(StringHash eventType, VariantMap& eventData)
 {
     if (!scriptObject_)
@@ -780,11 +813,7 @@ void ScriptInstance::HandleSceneUpdate(StringHash eventType, VariantMap& eventDa
     }
 
     if (methods_[METHOD_UPDATE])
-    {
-        VariantVector parameters;
-        parameters.Push(timeStep);
-        scriptFile_->Execute(scriptObject_, methods_[METHOD_UPDATE], parameters);
-    }
+        ExecuteUpdateMethod(methods_[METHOD_UPDATE], timeStep);
 }
 
 void ScriptInstance::HandleScenePostUpdate(StringHash eventType, VariantMap& eventData)
@@ -794,9 +823,7 @@ void ScriptInstance::HandleScenePostUpdate(StringHash eventType, VariantMap& eve
 
     using namespace ScenePostUpdate;
 
-    VariantVector parameters;
-    parameters.Push(eventData[P_TIMESTEP]);
-    scriptFile_->Execute(scriptObject_, methods_[METHOD_POSTUPDATE], parameters);
+    ExecuteUpdateMethod(methods_[METHOD_POSTUPDATE], eventData[P_TIMESTEP].GetFloat());
 }
 
 #ifdef URHO3D_PHYSICS
@@ -808,9 +835,7 @@ void ScriptInstance::HandlePhysicsPreStep(StringHash eventType, VariantMap& even
 
     using namespace PhysicsPreStep;
 
-    VariantVector parameters;
-    parameters.Push(eventData[P_TIMESTEP]);
-    scriptFile_->Execute(scriptObject_, methods_[METHOD_FIXEDUPDATE], parameters);
+    ExecuteUpdateMethod(methods_[METHOD_FIXEDUPDATE], eventData[P_TIMESTEP].GetFloat());
 }
 
 void ScriptInstance::HandlePhysicsPostStep(StringHash eventType, VariantMap& eventData)
@@ -820,9 +845,7 @@ void ScriptInstance::HandlePhysicsPostStep(StringHash eventType, VariantMap& eve
 
     using namespace PhysicsPostStep;
 
-    VariantVector parameters;
-    parameters.Push(eventData[P_TIMESTEP]);
-    scriptFile_->Execute(scriptObject_, methods_[METHOD_FIXEDPOSTUPDATE], parameters);
+    ExecuteUpdateMethod(methods_[METHOD_FIXEDPOSTUPDATE], eventData[P_TIMESTEP].GetFloat());
 }
 
 #endif
@@ -109,6 +109,11 @@ public:
         (float delay, bool repeat, const String& declaration, const VariantVector& parameters = Variant::emptyVariantVector);
     /// Clear pending delay-executed method calls. If empty declaration given, clears all.
     void ClearDelayedExecute(const String& declaration = String::EMPTY);
+    /// Set whether to execute the update methods in parallel with other script objects on the work queue threads. Changing the scene structure, event subscription, delayed calls and executing other script code are refused with an error, and sent events are deferred until all parallel calls have been executed. Other engine state is not synchronized: the methods must not modify state that other parallel methods read, or access other subsystems. See the scripting documentation for details.
+    void SetParallelUpdate(bool enable);
+
+    /// Return whether update methods are executed in parallel.
+    bool GetParallelUpdate() const { return parallelUpdate_; }
 
     /// Return script file.
     ScriptFile* GetScriptFile() const { return scriptFile_; }
@@ -162,6 +167,8 @@ private:
     void ClearScriptAttributes();
     /// Subscribe/unsubscribe from scene updates as necessary.
     void UpdateEventSubscription();
+    /// Execute an update method immediately, or queue it for parallel execution.
+    void ExecuteUpdateMethod(asIScriptFunction* method, float timeStep);
     /// Handle scene update event.
     void HandleSceneUpdate(StringHash eventType, VariantMap& eventData);
     /// Handle scene post-update event.
@@ -199,6 +206,8 @@ private:
     bool subscribed_;
     /// Subscribed to scene post and fixed update events flag.
     bool subscribedPostFixed_;
+    /// Parallel update flag.
+    bool parallelUpdate_;
 };
 
 /// Return the Urho3D context of the active script context.
@@ -352,6 +352,16 @@ static void RegisterListView(asIScriptEngine* engine)
     engine->RegisterObjectMethod("ListView", "bool get_clearSelectionOnDefocus() const", asMETHOD(ListView, GetClearSelectionOnDefocus), asCALL_THISCALL);
     engine->RegisterObjectMethod("ListView", "void set_selectOnClickEnd(bool)", asMETHOD(ListView, SetSelectOnClickEnd), asCALL_THISCALL);
     engine->RegisterObjectMethod("ListView", "bool get_selectOnClickEnd() const", asMETHOD(ListView, GetSelectOnClickEnd), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ListView", "void SetVirtualItemType(const String&in, const String&in style = String())", asMETHOD(ListView, SetVirtualItemType), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ListView", "void RefreshVirtualItems()", asMETHOD(ListView, RefreshVirtualItems), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ListView", "void set_virtualMode(bool)", asMETHOD(ListView, SetVirtualMode), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ListView", "bool get_virtualMode() const", asMETHOD(ListView, GetVirtualMode), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ListView", "void set_virtualItemCount(uint)", asMETHOD(ListView, SetVirtualItemCount), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ListView", "uint get_virtualItemCount() const", asMETHOD(ListView, GetVirtualItemCount), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ListView", "void set_virtualItemHeight(int)", asMETHOD(ListView, SetVirtualItemHeight), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ListView", "int get_virtualItemHeight() const", asMETHOD(ListView, GetVirtualItemHeight), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ListView", "const String& get_virtualItemType() const", asMETHOD(ListView, GetVirtualItemType), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ListView", "const String& get_virtualItemStyle() const", asMETHOD(ListView, GetVirtualItemStyle), asCALL_THISCALL);
 }
 
 static void RegisterText(asIScriptEngine* engine)
@@ -735,6 +745,12 @@ static void RegisterUI(asIScriptEngine* engine)
     engine->RegisterObjectMethod("UI", "bool get_useMutableGlyphs() const", asMETHOD(UI, GetUseMutableGlyphs), asCALL_THISCALL);
     engine->RegisterObjectMethod("UI", "void set_forceAutoHint(bool)", asMETHOD(UI, SetForceAutoHint), asCALL_THISCALL);
     engine->RegisterObjectMethod("UI", "bool get_forceAutoHint() const", asMETHOD(UI, GetForceAutoHint), asCALL_THISCALL);
+    engine->RegisterObjectMethod("UI", "void set_retainBatches(bool)", asMETHOD(UI, SetRetainBatches), asCALL_THISCALL);
+    engine->RegisterObjectMethod("UI", "bool get_retainBatches() const", asMETHOD(UI, GetRetainBatches), asCALL_THISCALL);
+    engine->RegisterObjectMethod("UI", "void set_useSharedFontAtlas(bool)", asMETHOD(UI, SetUseSharedFontAtlas), asCALL_THISCALL);
+    engine->RegisterObjectMethod("UI", "bool get_useSharedFontAtlas() const", asMETHOD(UI, GetUseSharedFontAtlas), asCALL_THISCALL);
+    engine->RegisterObjectMethod("UI", "void set_fontCacheDir(const String&in)", asMETHOD(UI, SetFontCacheDir), asCALL_THISCALL);
+    engine->RegisterObjectMethod("UI", "const String& get_fontCacheDir() const", asMETHOD(UI, GetFontCacheDir), asCALL_THISCALL);
     engine->RegisterGlobalFunction("UI@+ get_ui()", asFUNCTION(GetUI), asCALL_CDECL);
 }
 
@@ -129,6 +129,8 @@ public:
     void ApplyOSCursorShape();
 
 protected:
+    /// Return whether the retained rendering batches need to be regenerated. Always true due to the hotspot offset.
+    virtual bool IsBatchesDirty() const { return true; }
     /// Handle operating system mouse cursor visibility change event.
     void HandleMouseVisibleChanged(StringHash eventType, VariantMap& eventData);
 
@@ -97,6 +97,8 @@ public:
     void SetSelectionAttr(unsigned index);
 
 protected:
+    /// Return whether the retained rendering batches need to be regenerated. Always true due to rendering the selected item.
+    virtual bool IsBatchesDirty() const { return true; }
     /// Filter implicit attributes in serialization process.
     virtual bool FilterImplicitAttributes(XMLElement& dest) const;
     /// Filter implicit attributes in serialization process.
@@ -28,11 +28,13 @@
 #include "../IO/Deserializer.h"
 #include "../IO/FileSystem.h"
 #include "../UI/Font.h"
+#include "../UI/FontAtlas.h"
 #include "../UI/FontFaceBitmap.h"
 #include "../UI/FontFaceFreeType.h"
 #include "../Resource/ResourceCache.h"
 #include "../Resource/XMLElement.h"
 #include "../Resource/XMLFile.h"
+#include "../UI/UI.h"
 
 #include "../DebugNew.h"
 
@@ -45,6 +47,7 @@ static const int MAX_POINT_SIZE = 96;
 Font::Font(Context* context) :
     Resource(context),
     fontDataSize_(0),
+    checksum_(0),
     absoluteOffset_(IntVector2::ZERO),
     scaledOffset_(Vector2::ZERO),
     fontType_(FONT_NONE),
@@ -72,7 +75,7 @@ bool Font::BeginLoad(Deserializer& source)
         return true;
 
     fontType_ = FONT_NONE;
-    faces_.Clear();
+    ReleaseFaces();
 
     fontDataSize_ = source.GetSize();
     if (fontDataSize_)
@@ -80,6 +83,11 @@ bool Font::BeginLoad(Deserializer& source)
         fontData_ = new unsigned char[fontDataSize_];
         if (source.Read(&fontData_[0], fontDataSize_) != fontDataSize_)
             return false;
+
+        // Calculate checksum for identifying the font in the glyph cache
+        checksum_ = 0;
+        for (unsigned i = 0; i < fontDataSize_; ++i)
+            checksum_ = SDBMHash(checksum_, fontData_[i]);
     }
     else
     {
@@ -147,8 +155,12 @@ FontFace* Font::GetFace(int pointSize)
             return i->second_;
         else
         {
-            // Erase and reload face if texture data lost (OpenGL mode only)
-            faces_.Erase(i);
+            // Erase and reload face if texture data lost (OpenGL mode only). When the faces share an atlas, all of them
+            // must be reloaded
+            if (atlas_)
+                ReleaseFaces();
+            else
+                faces_.Erase(i);
         }
     }
 
@@ -173,9 +185,18 @@ IntVector2 Font::GetTotalGlyphOffset(int pointSize) const
     return absoluteOffset_ + IntVector2((int)multipliedOffset.x_, (int)multipliedOffset.y_);
 }
 
+FontAtlas* Font::GetAtlas()
+{
+    if (!atlas_)
+        atlas_ = new FontAtlas(this, GetSubsystem<UI>()->GetMaxFontTextureSize());
+
+    return atlas_;
+}
+
 void Font::ReleaseFaces()
 {
     faces_.Clear();
+    atlas_.Reset();
 }
 
 void Font::LoadParameters()
@@ -28,6 +28,7 @@
 namespace Urho3D
 {
 
+class FontAtlas;
 class FontFace;
 
 static const int FONT_TEXTURE_MIN_SIZE = 128;
@@ -79,6 +80,12 @@ public:
     /// Return the total effective offset for a point size.
     IntVector2 GetTotalGlyphOffset(int pointSize) const;
 
+    /// Return glyph texture atlas shared by the font faces. Created on first request.
+    FontAtlas* GetAtlas();
+
+    /// Return checksum of the font data.
+    unsigned GetChecksum() const { return checksum_; }
+
     /// Release font faces and recreate them next time when requested. Called when font textures lost or global font properties change.
     void ReleaseFaces();
 
@@ -96,6 +103,10 @@ private:
     SharedArrayPtr<unsigned char> fontData_;
     /// Size of font data.
     unsigned fontDataSize_;
+    /// Checksum of font data.
+    unsigned checksum_;
+    /// Shared glyph texture atlas.
+    SharedPtr<FontAtlas> atlas_;
     /// Absolute position adjustment for glyphs.
     IntVector2 absoluteOffset_;
     /// Point size scaled position adjustment for glyphs.
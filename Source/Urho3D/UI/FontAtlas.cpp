@@ -0,0 +1,134 @@
+//
+// Copyright (c) 2008-2015 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "../Precompiled.h"
+
+#include "../Graphics/Graphics.h"
+#include "../Graphics/Texture2D.h"
+#include "../IO/Log.h"
+#include "../UI/Font.h"
+#include "../UI/FontAtlas.h"
+
+#include "../DebugNew.h"
+
+namespace Urho3D
+{
+
+FontAtlas::FontAtlas(Font* font, int pageSize) :
+    font_(font),
+    pageSize_(pageSize)
+{
+}
+
+FontAtlas::~FontAtlas()
+{
+    if (font_)
+    {
+        // Deduct the page texture data size from the parent font
+        unsigned totalTextureSize = pageData_.Size() * pageSize_ * pageSize_;
+        font_->SetMemoryUse(font_->GetMemoryUse() - totalTextureSize);
+    }
+}
+
+bool FontAtlas::Allocate(int width, int height, unsigned& page, int& x, int& y)
+{
+    if (width > pageSize_ || height > pageSize_)
+        return false;
+
+    // Fill the pages first-fit, so that space freed by an earlier page filling up can still be used by smaller glyphs
+    for (unsigned i = 0; i < allocators_.Size(); ++i)
+    {
+        if (allocators_[i].Allocate(width, height, x, y))
+        {
+            page = i;
+            return true;
+        }
+    }
+
+    SharedArrayPtr<unsigned char> data(new unsigned char[pageSize_ * pageSize_]);
+    memset(data.Get(), 0, (size_t)(pageSize_ * pageSize_));
+    pageData_.Push(data);
+    allocators_.Push(AreaAllocator(pageSize_, pageSize_));
+    dirtyRows_.Push(IntVector2(0, pageSize_));
+    font_->SetMemoryUse(font_->GetMemoryUse() + pageSize_ * pageSize_);
+
+    page = allocators_.Size() - 1;
+    return allocators_.Back().Allocate(width, height, x, y);
+}
+
+unsigned char* FontAtlas::GetPageData(unsigned page) const
+{
+    return page < pageData_.Size() ? pageData_[page].Get() : 0;
+}
+
+void FontAtlas::MarkDirty(unsigned page, int y, int height)
+{
+    if (page >= dirtyRows_.Size())
+        return;
+
+    IntVector2& rows = dirtyRows_[page];
+    if (rows.y_ <= rows.x_)
+        rows = IntVector2(y, y + height);
+    else
+    {
+        rows.x_ = Min(rows.x_, y);
+        rows.y_ = Max(rows.y_, y + height);
+    }
+}
+
+bool FontAtlas::Commit()
+{
+    for (unsigned i = 0; i < pageData_.Size(); ++i)
+    {
+        if (i >= textures_.Size())
+        {
+            SharedPtr<Texture2D> texture(new Texture2D(font_->GetContext()));
+            texture->SetMipsToSkip(QUALITY_LOW, 0); // No quality reduction
+            texture->SetNumLevels(1); // No mipmaps
+            texture->SetAddressMode(COORD_U, ADDRESS_BORDER);
+            texture->SetAddressMode(COORD_V, ADDRESS_BORDER);
+            texture->SetBorderColor(Color(0.0f, 0.0f, 0.0f, 0.0f));
+            if (!texture->SetSize(pageSize_, pageSize_, Graphics::GetAlphaFormat()))
+            {
+                LOGERROR("Could not create font atlas texture");
+                return false;
+            }
+            textures_.Push(texture);
+        }
+
+        IntVector2& rows = dirtyRows_[i];
+        if (rows.y_ > rows.x_)
+        {
+            if (!textures_[i]->SetData(0, 0, rows.x_, pageSize_, rows.y_ - rows.x_, pageData_[i].Get() + rows.x_ * pageSize_))
+            {
+                LOGERROR("Could not update font atlas texture");
+                return false;
+            }
+            rows = IntVector2::ZERO;
+        }
+    }
+
+    return true;
+}
+
+}
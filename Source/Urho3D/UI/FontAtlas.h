@@ -0,0 +1,77 @@
+//
+// Copyright (c) 2008-2015 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#pragma once
+
+#include "../Container/ArrayPtr.h"
+#include "../Container/Ptr.h"
+#include "../Math/AreaAllocator.h"
+#include "../Math/Vector2.h"
+
+namespace Urho3D
+{
+
+class Font;
+class Texture2D;
+
+/// %Font glyph texture atlas shared between the faces (point sizes) of a font. Consists of square pages of a fixed size.
+class URHO3D_API FontAtlas : public RefCounted
+{
+public:
+    /// Construct with page size.
+    FontAtlas(Font* font, int pageSize);
+    /// Destruct.
+    ~FontAtlas();
+
+    /// Allocate a glyph area, adding a new page if necessary. Return true and the page and position if successful.
+    bool Allocate(int width, int height, unsigned& page, int& x, int& y);
+    /// Return the pixel data of a page for writing glyphs. Mark the written rows dirty before committing.
+    unsigned char* GetPageData(unsigned page) const;
+    /// Mark rows of a page changed.
+    void MarkDirty(unsigned page, int y, int height);
+    /// Create textures for new pages and upload the changed rows. Return true if successful.
+    bool Commit();
+
+    /// Return page size.
+    int GetPageSize() const { return pageSize_; }
+    /// Return number of pages.
+    unsigned GetNumPages() const { return pageData_.Size(); }
+    /// Return page textures. Valid after committing.
+    const Vector<SharedPtr<Texture2D> >& GetTextures() const { return textures_; }
+
+private:
+    /// Parent font.
+    Font* font_;
+    /// Page width and height.
+    int pageSize_;
+    /// Area allocators of the pages.
+    Vector<AreaAllocator> allocators_;
+    /// Pixel data of the pages.
+    Vector<SharedArrayPtr<unsigned char> > pageData_;
+    /// Textures of the pages.
+    Vector<SharedPtr<Texture2D> > textures_;
+    /// Changed row range of the pages as top (x) and bottom (y). Empty if bottom is not greater than top.
+    PODVector<IntVector2> dirtyRows_;
+};
+
+}
@@ -23,12 +23,16 @@
 #include "../Precompiled.h"
 
 #include "../Core/Context.h"
+#include "../Core/Timer.h"
+#include "../Core/WorkQueue.h"
 #include "../Graphics/Graphics.h"
 #include "../Graphics/Texture2D.h"
+#include "../IO/File.h"
 #include "../IO/FileSystem.h"
 #include "../IO/Log.h"
 #include "../IO/MemoryBuffer.h"
 #include "../UI/Font.h"
+#include "../UI/FontAtlas.h"
 #include "../UI/FontFaceFreeType.h"
 #include "../UI/UI.h"
 
@@ -41,6 +45,8 @@
 namespace Urho3D
 {
 
+static const unsigned GLYPH_CACHE_VERSION = 1;
+
 /// FreeType library subsystem.
 class FreeTypeLibrary : public Object
 {
@@ -69,6 +75,236 @@ private:
     FT_Library library_;
 };
 
+/// Glyph measuring or rendering work for one work item.
+struct GlyphWork
+{
+    /// FreeType library.
+    FT_Library library_;
+    /// FreeType face.
+    FT_Face face_;
+    /// Load mode.
+    int loadMode_;
+    /// Ascender.
+    int ascender_;
+    /// Character codes by glyph index.
+    const unsigned* charCodes_;
+    /// Glyphs by glyph index.
+    FontGlyph* glyphs_;
+    /// Pixel data of the texture pages to render to.
+    unsigned char* const* pageData_;
+    /// Row pitch of the texture pages.
+    int pitch_;
+};
+
+/// Runs glyph work for a font face on the work queue threads. FreeType shares the rasterizer memory between the faces of a
+/// library, so each work item uses its own library and face.
+class GlyphWorkers
+{
+public:
+    /// Construct.
+    GlyphWorkers(WorkQueue* queue) :
+        queue_(queue),
+        glyphs_(0),
+        numGlyphs_(0)
+    {
+    }
+
+    /// Destruct. Free the FreeType libraries and faces.
+    ~GlyphWorkers()
+    {
+        for (unsigned i = 0; i < works_.Size(); ++i)
+        {
+            if (works_[i].face_)
+                FT_Done_Face(works_[i].face_);
+            if (works_[i].library_)
+                FT_Done_FreeType(works_[i].library_);
+        }
+    }
+
+    /// Create the libraries and faces. Return true if successful.
+    bool Initialize(const unsigned char* fontData, unsigned fontDataSize, int pointSize, int loadMode, int ascender,
+        const PODVector<unsigned>& charCodes, Vector<FontGlyph>& glyphs)
+    {
+        glyphs_ = &glyphs[0];
+        numGlyphs_ = glyphs.Size();
+
+        // Use at most one work item per thread, and avoid the face creation overhead for small fonts
+        unsigned numWorks = queue_->GetNumThreads() + 1;
+        unsigned maxWorks = (numGlyphs_ + GLYPHS_PER_WORK_ITEM - 1) / GLYPHS_PER_WORK_ITEM;
+        if (numWorks > maxWorks)
+            numWorks = maxWorks;
+
+        works_.Resize(numWorks);
+        for (unsigned i = 0; i < numWorks; ++i)
+        {
+            GlyphWork& work = works_[i];
+            work.library_ = 0;
+            work.face_ = 0;
+            work.loadMode_ = loadMode;
+            work.ascender_ = ascender;
+            work.charCodes_ = &charCodes[0];
+            work.glyphs_ = glyphs_;
+            work.pageData_ = 0;
+            work.pitch_ = 0;
+
+            if (FT_Init_FreeType(&work.library_))
+            {
+                work.library_ = 0;
+                LOGERROR("Could not initialize FreeType library");
+                return false;
+            }
+            if (FT_New_Memory_Face(work.library_, fontData, fontDataSize, 0, &work.face_))
+            {
+                work.face_ = 0;
+                LOGERROR("Could not create font face");
+                return false;
+            }
+            if (FT_Set_Char_Size(work.face_, 0, pointSize * 64, FONT_DPI, FONT_DPI))
+            {
+                LOGERROR("Could not set font point size " + String(pointSize));
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// Run a work function over all glyphs and wait for completion.
+    void Run(void (*workFunction)(const WorkItem*, unsigned), unsigned char* const* pageData = 0, int pitch = 0)
+    {
+        unsigned numWorks = works_.Size();
+        unsigned glyphsPerWork = (numGlyphs_ + numWorks - 1) / numWorks;
+
+        for (unsigned i = 0; i < numWorks; ++i)
+        {
+            GlyphWork& work = works_[i];
+            work.pageData_ = pageData;
+            work.pitch_ = pitch;
+
+            unsigned start = i * glyphsPerWork;
+            unsigned end = start + glyphsPerWork;
+            if (end > numGlyphs_)
+                end = numGlyphs_;
+            if (start >= end)
+                continue;
+
+            SharedPtr<WorkItem> item = queue_->GetFreeItem();
+            item->priority_ = M_MAX_UNSIGNED;
+            item->workFunction_ = workFunction;
+            item->aux_ = &work;
+            item->start_ = glyphs_ + start;
+            item->end_ = glyphs_ + end;
+            queue_->AddWorkItem(item);
+        }
+
+        queue_->Complete(M_MAX_UNSIGNED);
+    }
+
+private:
+    /// Minimum number of glyphs per work item.
+    static const unsigned GLYPHS_PER_WORK_ITEM = 64;
+
+    /// Work queue.
+    WorkQueue* queue_;
+    /// Glyph work per work item.
+    PODVector<GlyphWork> works_;
+    /// Glyphs by glyph index.
+    FontGlyph* glyphs_;
+    /// Number of glyphs.
+    unsigned numGlyphs_;
+};
+
+static void SetGlyphMetrics(FontGlyph& glyph, FT_GlyphSlot slot, int ascender)
+{
+    // Note: position within texture will be filled later
+    glyph.width_ = (short)Max(slot->metrics.width >> 6, slot->bitmap.width);
+    glyph.height_ = (short)Max(slot->metrics.height >> 6, slot->bitmap.rows);
+    glyph.offsetX_ = (short)(slot->metrics.horiBearingX >> 6);
+    glyph.offsetY_ = (short)(ascender - (slot->metrics.horiBearingY >> 6));
+    glyph.advanceX_ = (short)(slot->metrics.horiAdvance >> 6);
+}
+
+static void ClearGlyphMetrics(FontGlyph& glyph)
+{
+    glyph.width_ = 0;
+    glyph.height_ = 0;
+    glyph.offsetX_ = 0;
+    glyph.offsetY_ = 0;
+    glyph.advanceX_ = 0;
+}
+
+static void CopyGlyphBitmap(FT_GlyphSlot slot, unsigned char* dest, unsigned pitch)
+{
+    if (slot->bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+    {
+        for (int y = 0; y < slot->bitmap.rows; ++y)
+        {
+            unsigned char* src = slot->bitmap.buffer + slot->bitmap.pitch * y;
+            unsigned char* rowDest = dest + y * pitch;
+
+            for (int x = 0; x < slot->bitmap.width; ++x)
+                rowDest[x] = (unsigned char)((src[x >> 3] & (0x80 >> (x & 7))) ? 255 : 0);
+        }
+    }
+    else
+    {
+        for (int y = 0; y < slot->bitmap.rows; ++y)
+        {
+            unsigned char* src = slot->bitmap.buffer + slot->bitmap.pitch * y;
+            unsigned char* rowDest = dest + y * pitch;
+
+            for (int x = 0; x < slot->bitmap.width; ++x)
+                rowDest[x] = src[x];
+        }
+    }
+}
+
+void MeasureGlyphsWork(const WorkItem* item, unsigned threadIndex)
+{
+    GlyphWork* work = reinterpret_cast<GlyphWork*>(item->aux_);
+    FontGlyph* start = reinterpret_cast<FontGlyph*>(item->start_);
+    FontGlyph* end = reinterpret_cast<FontGlyph*>(item->end_);
+    const unsigned* charCode = work->charCodes_ + (start - work->glyphs_);
+    FT_GlyphSlot slot = work->face_->glyph;
+
+    for (FontGlyph* glyph = start; glyph < end; ++glyph, ++charCode)
+    {
+        if (*charCode == 0)
+            continue;
+
+        FT_Error error = FT_Load_Char(work->face_, *charCode, work->loadMode_);
+        if (!error)
+            SetGlyphMetrics(*glyph, slot, work->ascender_);
+        else
+            ClearGlyphMetrics(*glyph);
+    }
+}
+
+void RenderGlyphsWork(const WorkItem* item, unsigned threadIndex)
+{
+    GlyphWork* work = reinterpret_cast<GlyphWork*>(item->aux_);
+    FontGlyph* start = reinterpret_cast<FontGlyph*>(item->start_);
+    FontGlyph* end = reinterpret_cast<FontGlyph*>(item->end_);
+    const unsigned* charCode = work->charCodes_ + (start - work->glyphs_);
+    FT_GlyphSlot slot = work->face_->glyph;
+
+    for (FontGlyph* glyph = start; glyph < end; ++glyph, ++charCode)
+    {
+        // Skip glyphs that are empty or were left out of the textures
+        if (*charCode == 0 || glyph->page_ == M_MAX_UNSIGNED || glyph->width_ <= 0 || glyph->height_ <= 0)
+            continue;
+
+        FT_Error error = FT_Load_Char(work->face_, *charCode, work->loadMode_);
+        if (!error)
+            error = FT_Render_Glyph(slot, FT_RENDER_MODE_NORMAL);
+        if (!error)
+        {
+            unsigned char* dest = work->pageData_[glyph->page_] + glyph->y_ * work->pitch_ + glyph->x_;
+            CopyGlyphBitmap(slot, dest, (unsigned)work->pitch_);
+        }
+    }
+}
+
 FontFaceFreeType::FontFaceFreeType(Font* font) :
     FontFace(font),
     face_(0),
@@ -83,6 +319,10 @@ FontFaceFreeType::~FontFaceFreeType()
         FT_Done_Face((FT_Face)face_);
         face_ = 0;
     }
+
+    // The atlas textures are owned by the font, so do not deduct their size in the base class
+    if (atlas_)
+        textures_.Clear();
 }
 
 bool FontFaceFreeType::Load(const unsigned char* fontData, unsigned fontDataSize, int pointSize)
@@ -99,6 +339,7 @@ bool FontFaceFreeType::Load(const unsigned char* fontData, unsigned fontDataSize
 
     UI* ui = font_->GetSubsystem<UI>();
     int maxTextureSize = ui->GetMaxFontTextureSize();
+    bool useAtlas = ui->GetUseSharedFontAtlas();
 
     FT_Face face;
     FT_Error error;
@@ -116,6 +357,23 @@ bool FontFaceFreeType::Load(const unsigned char* fontData, unsigned fontDataSize
         return false;
     }
 
+    HiresTimer loadTimer;
+    pointSize_ = pointSize;
+
+    // Check for the face in the glyph cache. A shared atlas is filled by several faces, so its contents are not cached
+    String cacheFileName;
+    if (!useAtlas && !ui->GetFontCacheDir().Empty())
+    {
+        cacheFileName = ui->GetFontCacheDir() + ToString("%08x_%d_%d%s.glyphs", font_->GetChecksum(), pointSize, maxTextureSize,
+            ui->GetForceAutoHint() ? "_autohint" : "");
+        if (LoadCache(cacheFileName, fontDataSize))
+        {
+            LOGDEBUGF("Font face %s (%dpt) loaded from glyph cache in %d ms", GetFileName(font_->GetName()).CString(), pointSize,
+                (int)(loadTimer.GetUSec(false) / 1000));
+            return true;
+        }
+    }
+
     error = FT_New_Memory_Face(library, fontData, fontDataSize, 0, &face);
     if (error)
     {
@@ -149,7 +407,6 @@ bool FontFaceFreeType::Load(const unsigned char* fontData, unsigned fontDataSize
         charCode = FT_Get_Next_Char(face, charCode, &glyphIndex);
     }
 
-    // Load each of the glyphs to see the sizes & store other information
     loadMode_ = (int)(ui->GetForceAutoHint() ? FT_LOAD_FORCE_AUTOHINT : FT_LOAD_DEFAULT);
     ascender_ = (int)(face->size->metrics.ascender >> 6);
     int descender = (int)(face->size->metrics.descender >> 6);
@@ -164,39 +421,142 @@ bool FontFaceFreeType::Load(const unsigned char* fontData, unsigned fontDataSize
         descender = Max(descender, os2Info->sTypoDescender * face->size->metrics.y_ppem / face->units_per_EM);
     }
 
-    // Store point size and row height. Use the maximum of ascender + descender, or the face's stored default row height
-    pointSize_ = pointSize;
+    // Store row height. Use the maximum of ascender + descender, or the face's stored default row height
     rowHeight_ = (int)Max(ascender_ + descender, face->size->metrics.height >> 6);
 
+    // Load each of the glyphs to see the sizes & store other information. Measuring and rendering are done on the work queue
+    // threads
+    Vector<FontGlyph> glyphs(numGlyphs);
+    GlyphWorkers workers(font_->GetSubsystem<WorkQueue>());
+    if (numGlyphs && !workers.Initialize(fontData, fontDataSize, pointSize, loadMode_, ascender_, charCodes, glyphs))
+        return false;
+    if (numGlyphs)
+        workers.Run(MeasureGlyphsWork);
+
+    // Check if all glyphs fit in one texture and find the smallest sufficient texture size
     int textureWidth = maxTextureSize;
     int textureHeight = maxTextureSize;
-    bool loadAllGlyphs = CanLoadAllGlyphs(charCodes, textureWidth, textureHeight);
+    bool loadAllGlyphs = true;
+    {
+        AreaAllocator allocator(FONT_TEXTURE_MIN_SIZE, FONT_TEXTURE_MIN_SIZE, textureWidth, textureHeight);
+        for (unsigned i = 0; i < numGlyphs; ++i)
+        {
+            FontGlyph& glyph = glyphs[i];
+            if (charCodes[i] == 0)
+                continue;
 
-    SharedPtr<Image> image(new Image(font_->GetContext()));
-    image->SetSize(textureWidth, textureHeight, 1);
-    unsigned char* imageData = image->GetData();
-    memset(imageData, 0, (size_t)(image->GetWidth() * image->GetHeight()));
-    allocator_.Reset(FONT_TEXTURE_MIN_SIZE, FONT_TEXTURE_MIN_SIZE, textureWidth, textureHeight);
+            // Empty glyphs need no texture space
+            glyph.page_ = 0;
+            if (glyph.width_ <= 0 || glyph.height_ <= 0)
+                continue;
 
-    for (unsigned i = 0; i < numGlyphs; ++i)
+            int x, y;
+            if (!allocator.Allocate(glyph.width_ + 1, glyph.height_ + 1, x, y))
+            {
+                loadAllGlyphs = false;
+                break;
+            }
+
+            glyph.x_ = (short)x;
+            glyph.y_ = (short)y;
+        }
+
+        if (loadAllGlyphs)
+        {
+            textureWidth = allocator.GetWidth();
+            textureHeight = allocator.GetHeight();
+        }
+    }
+
+    // If not all glyphs fit, load only the first 256 character codes now and the rest on demand. When using the shared
+    // atlas, allocate from it instead
+    if (useAtlas || !loadAllGlyphs)
     {
-        unsigned charCode = charCodes[i];
-        if (charCode == 0)
-            continue;
+        if (useAtlas)
+            atlas_ = font_->GetAtlas();
+        allocator_.Reset(FONT_TEXTURE_MIN_SIZE, FONT_TEXTURE_MIN_SIZE, textureWidth, textureHeight);
+
+        for (unsigned i = 0; i < numGlyphs; ++i)
+        {
+            FontGlyph& glyph = glyphs[i];
+            unsigned charCode = charCodes[i];
+            if (charCode == 0)
+                continue;
+
+            if (glyph.width_ <= 0 || glyph.height_ <= 0)
+            {
+                glyph.page_ = 0;
+                continue;
+            }
+
+            glyph.page_ = M_MAX_UNSIGNED;
+            if (!loadAllGlyphs && charCode > 0xff)
+                continue;
+
+            unsigned page = 0;
+            int x, y;
+            if (atlas_ ? atlas_->Allocate(glyph.width_ + 1, glyph.height_ + 1, page, x, y) :
+                allocator_.Allocate(glyph.width_ + 1, glyph.height_ + 1, x, y))
+            {
+                glyph.x_ = (short)x;
+                glyph.y_ = (short)y;
+                glyph.page_ = page;
+            }
+        }
+    }
+
+    SharedPtr<Image> image;
+    PODVector<unsigned char*> pageData;
+    int pitch;
+    if (atlas_)
+    {
+        for (unsigned i = 0; i < atlas_->GetNumPages(); ++i)
+            pageData.Push(atlas_->GetPageData(i));
+        pitch = atlas_->GetPageSize();
+    }
+    else
+    {
+        image = new Image(font_->GetContext());
+        image->SetSize(textureWidth, textureHeight, 1);
+        unsigned char* imageData = image->GetData();
+        memset(imageData, 0, (size_t)(image->GetWidth() * image->GetHeight()));
+        pageData.Push(imageData);
+        pitch = textureWidth;
+    }
+
+    if (numGlyphs && pageData.Size())
+        workers.Run(RenderGlyphsWork, &pageData[0], pitch);
 
-        if (!loadAllGlyphs && (charCode > 0xff))
-            break;
+    if (atlas_)
+    {
+        for (unsigned i = 0; i < numGlyphs; ++i)
+        {
+            const FontGlyph& glyph = glyphs[i];
+            if (charCodes[i] && glyph.page_ != M_MAX_UNSIGNED && glyph.width_ > 0 && glyph.height_ > 0)
+                atlas_->MarkDirty(glyph.page_, glyph.y_, glyph.height_);
+        }
 
-        if (!LoadCharGlyph(charCode, image))
+        if (!atlas_->Commit())
             return false;
+
+        textures_ = atlas_->GetTextures();
     }
+    else
+    {
+        SharedPtr<Texture2D> texture = LoadFaceTexture(image);
+        if (!texture)
+            return false;
 
-    SharedPtr<Texture2D> texture = LoadFaceTexture(image);
-    if (!texture)
-        return false;
+        textures_.Push(texture);
+        font_->SetMemoryUse(font_->GetMemoryUse() + textureWidth * textureHeight);
+    }
 
-    textures_.Push(texture);
-    font_->SetMemoryUse(font_->GetMemoryUse() + textureWidth * textureHeight);
+    for (unsigned i = 0; i < numGlyphs; ++i)
+    {
+        unsigned charCode = charCodes[i];
+        if (charCode && glyphs[i].page_ != M_MAX_UNSIGNED && (loadAllGlyphs || charCode <= 0xff))
+            glyphMapping_[charCode] = glyphs[i];
+    }
 
     // Store kerning if face has kerning information
     if (FT_HAS_KERNING(face))
@@ -272,10 +632,16 @@ bool FontFaceFreeType::Load(const unsigned char* fontData, unsigned fontDataSize
         FT_Done_Face(face);
         face_ = 0;
         hasMutableGlyph_ = false;
+
+        if (!cacheFileName.Empty())
+            SaveCache(cacheFileName, image, fontDataSize);
     }
     else
         hasMutableGlyph_ = true;
 
+    LOGDEBUGF("Font face %s (%dpt) loaded in %d ms", GetFileName(font_->GetName()).CString(), pointSize,
+        (int)(loadTimer.GetUSec(false) / 1000));
+
     return true;
 }
 
@@ -303,55 +669,138 @@ const FontGlyph* FontFaceFreeType::GetGlyph(unsigned c)
     return 0;
 }
 
-bool FontFaceFreeType::CanLoadAllGlyphs(const PODVector<unsigned>& charCodes, int& textureWidth, int& textureHeight) const
+bool FontFaceFreeType::SetupNextTexture(int textureWidth, int textureHeight)
 {
-    FT_Face face = (FT_Face)face_;
-    FT_GlyphSlot slot = face->glyph;
-    AreaAllocator allocator(FONT_TEXTURE_MIN_SIZE, FONT_TEXTURE_MIN_SIZE, textureWidth, textureHeight);
+    SharedPtr<Image> image(new Image(font_->GetContext()));
+    image->SetSize(textureWidth, textureHeight, 1);
+    unsigned char* imageData = image->GetData();
+    memset(imageData, 0, (size_t)(image->GetWidth() * image->GetHeight()));
 
-    unsigned numGlyphs = charCodes.Size();
-    for (unsigned i = 0; i < numGlyphs; ++i)
-    {
-        unsigned charCode = charCodes[i];
-        if (charCode == 0)
-            continue;
+    SharedPtr<Texture2D> texture = LoadFaceTexture(image);
+    if (!texture)
+        return false;
 
-        FT_Error error = FT_Load_Char(face, charCode, loadMode_);
-        if (!error)
-        {
-            int width = (int)Max(slot->metrics.width >> 6, slot->bitmap.width);
-            int height = (int)Max(slot->metrics.height >> 6, slot->bitmap.rows);
-            int x, y;
-            if (!allocator.Allocate(width + 1, height + 1, x, y))
-                return false;
-        }
-    }
+    textures_.Push(texture);
+    allocator_.Reset(FONT_TEXTURE_MIN_SIZE, FONT_TEXTURE_MIN_SIZE, textureWidth, textureHeight);
+
+    font_->SetMemoryUse(font_->GetMemoryUse() + textureWidth * textureHeight);
 
-    textureWidth = allocator.GetWidth();
-    textureHeight = allocator.GetHeight();
     return true;
 }
 
-bool FontFaceFreeType::SetupNextTexture(int textureWidth, int textureHeight)
+bool FontFaceFreeType::LoadCache(const String& fileName, unsigned fontDataSize)
 {
+    if (!font_->GetSubsystem<FileSystem>()->FileExists(fileName))
+        return false;
+
+    File file(font_->GetContext(), fileName);
+    if (!file.IsOpen() || file.ReadFileID() != "UGLC")
+        return false;
+
+    if (file.ReadUInt() != GLYPH_CACHE_VERSION || file.ReadUInt() != fontDataSize)
+    {
+        LOGWARNING("Ignoring outdated font glyph cache " + fileName);
+        return false;
+    }
+
+    int rowHeight = file.ReadInt();
+
+    HashMap<unsigned, FontGlyph> glyphMapping;
+    unsigned numGlyphs = file.ReadUInt();
+    for (unsigned i = 0; i < numGlyphs; ++i)
+    {
+        unsigned charCode = file.ReadUInt();
+        FontGlyph& glyph = glyphMapping[charCode];
+        glyph.x_ = file.ReadShort();
+        glyph.y_ = file.ReadShort();
+        glyph.width_ = file.ReadShort();
+        glyph.height_ = file.ReadShort();
+        glyph.offsetX_ = file.ReadShort();
+        glyph.offsetY_ = file.ReadShort();
+        glyph.advanceX_ = file.ReadShort();
+        glyph.page_ = 0;
+    }
+
+    HashMap<unsigned, short> kerningMapping;
+    unsigned numKerningPairs = file.ReadUInt();
+    for (unsigned i = 0; i < numKerningPairs; ++i)
+    {
+        unsigned value = file.ReadUInt();
+        kerningMapping[value] = file.ReadShort();
+    }
+
+    int textureWidth = file.ReadInt();
+    int textureHeight = file.ReadInt();
+    if (textureWidth <= 0 || textureHeight <= 0 || file.GetSize() - file.GetPosition() != (unsigned)(textureWidth * textureHeight))
+    {
+        LOGWARNING("Ignoring corrupted font glyph cache " + fileName);
+        return false;
+    }
+
     SharedPtr<Image> image(new Image(font_->GetContext()));
     image->SetSize(textureWidth, textureHeight, 1);
-    unsigned char* imageData = image->GetData();
-    memset(imageData, 0, (size_t)(image->GetWidth() * image->GetHeight()));
+    file.Read(image->GetData(), (unsigned)(textureWidth * textureHeight));
 
     SharedPtr<Texture2D> texture = LoadFaceTexture(image);
     if (!texture)
         return false;
 
     textures_.Push(texture);
-    allocator_.Reset(FONT_TEXTURE_MIN_SIZE, FONT_TEXTURE_MIN_SIZE, textureWidth, textureHeight);
-
     font_->SetMemoryUse(font_->GetMemoryUse() + textureWidth * textureHeight);
 
+    rowHeight_ = rowHeight;
+    glyphMapping_ = glyphMapping;
+    kerningMapping_ = kerningMapping;
+    hasMutableGlyph_ = false;
     return true;
 }
 
-bool FontFaceFreeType::LoadCharGlyph(unsigned charCode, Image* image)
+void FontFaceFreeType::SaveCache(const String& fileName, Image* image, unsigned fontDataSize) const
+{
+    FileSystem* fileSystem = font_->GetSubsystem<FileSystem>();
+    String pathName = GetPath(fileName);
+    if (!fileSystem->DirExists(pathName) && !fileSystem->CreateDir(pathName))
+    {
+        LOGWARNING("Could not create font glyph cache directory " + pathName);
+        return;
+    }
+
+    File file(font_->GetContext(), fileName, FILE_WRITE);
+    if (!file.IsOpen())
+        return;
+
+    file.WriteFileID("UGLC");
+    file.WriteUInt(GLYPH_CACHE_VERSION);
+    file.WriteUInt(fontDataSize);
+    file.WriteInt(rowHeight_);
+
+    file.WriteUInt(glyphMapping_.Size());
+    for (HashMap<unsigned, FontGlyph>::ConstIterator i = glyphMapping_.Begin(); i != glyphMapping_.End(); ++i)
+    {
+        const FontGlyph& glyph = i->second_;
+        file.WriteUInt(i->first_);
+        file.WriteShort(glyph.x_);
+        file.WriteShort(glyph.y_);
+        file.WriteShort(glyph.width_);
+        file.WriteShort(glyph.height_);
+        file.WriteShort(glyph.offsetX_);
+        file.WriteShort(glyph.offsetY_);
+        file.WriteShort(glyph.advanceX_);
+    }
+
+    file.WriteUInt(kerningMapping_.Size());
+    for (HashMap<unsigned, short>::ConstIterator i = kerningMapping_.Begin(); i != kerningMapping_.End(); ++i)
+    {
+        file.WriteUInt(i->first_);
+        file.WriteShort(i->second_);
+    }
+
+    file.WriteInt(image->GetWidth());
+    file.WriteInt(image->GetHeight());
+    file.Write(image->GetData(), (unsigned)(image->GetWidth() * image->GetHeight()));
+}
+
+bool FontFaceFreeType::LoadCharGlyph(unsigned charCode)
 {
     if (!face_)
         return false;
@@ -363,68 +812,55 @@ bool FontFaceFreeType::LoadCharGlyph(unsigned charCode, Image* image)
     FT_Error error = FT_Load_Char(face, charCode, loadMode_);
     if (!error)
     {
-        // Note: position within texture will be filled later
-        fontGlyph.width_ = (short)Max(slot->metrics.width >> 6, slot->bitmap.width);
-        fontGlyph.height_ = (short)Max(slot->metrics.height >> 6, slot->bitmap.rows);
-        fontGlyph.offsetX_ = (short)(slot->metrics.horiBearingX >> 6);
-        fontGlyph.offsetY_ = (short)(ascender_ - (slot->metrics.horiBearingY >> 6));
-        fontGlyph.advanceX_ = (short)(slot->metrics.horiAdvance >> 6);
+        SetGlyphMetrics(fontGlyph, slot, ascender_);
 
         if (fontGlyph.width_ > 0 && fontGlyph.height_ > 0)
         {
             int x, y;
-            if (!allocator_.Allocate(fontGlyph.width_ + 1, fontGlyph.height_ + 1, x, y))
-            {
-                if (!SetupNextTexture(allocator_.GetWidth(), allocator_.GetHeight()))
-                    return false;
-
-                if (!allocator_.Allocate(fontGlyph.width_ + 1, fontGlyph.height_ + 1, x, y))
-                    return false;
-            }
-
-            fontGlyph.x_ = (short)x;
-            fontGlyph.y_ = (short)y;
-
             unsigned char* dest = 0;
             unsigned pitch = 0;
-            if (image)
+            if (atlas_)
             {
-                fontGlyph.page_ = 0;
-                dest = image->GetData() + fontGlyph.y_ * image->GetWidth() + fontGlyph.x_;
-                pitch = (unsigned)image->GetWidth();
+                unsigned page;
+                if (!atlas_->Allocate(fontGlyph.width_ + 1, fontGlyph.height_ + 1, page, x, y))
+                    return false;
+
+                fontGlyph.page_ = page;
+                pitch = (unsigned)atlas_->GetPageSize();
+                dest = atlas_->GetPageData(page) + y * pitch + x;
             }
             else
             {
+                if (!allocator_.Allocate(fontGlyph.width_ + 1, fontGlyph.height_ + 1, x, y))
+                {
+                    if (!SetupNextTexture(allocator_.GetWidth(), allocator_.GetHeight()))
+                        return false;
+
+                    if (!allocator_.Allocate(fontGlyph.width_ + 1, fontGlyph.height_ + 1, x, y))
+                        return false;
+                }
+
                 fontGlyph.page_ = textures_.Size() - 1;
                 dest = new unsigned char[fontGlyph.width_ * fontGlyph.height_];
                 pitch = (unsigned)fontGlyph.width_;
             }
 
+            fontGlyph.x_ = (short)x;
+            fontGlyph.y_ = (short)y;
+
             FT_Render_Glyph(slot, FT_RENDER_MODE_NORMAL);
-            if (slot->bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
-            {
-                for (int y = 0; y < slot->bitmap.rows; ++y)
-                {
-                    unsigned char* src = slot->bitmap.buffer + slot->bitmap.pitch * y;
-                    unsigned char* rowDest = dest + y * pitch;
+            CopyGlyphBitmap(slot, dest, pitch);
 
-                    for (int x = 0; x < slot->bitmap.width; ++x)
-                        rowDest[x] = (unsigned char)((src[x >> 3] & (0x80 >> (x & 7))) ? 255 : 0);
-                }
-            }
-            else
+            if (atlas_)
             {
-                for (int y = 0; y < slot->bitmap.rows; ++y)
-                {
-                    unsigned char* src = slot->bitmap.buffer + slot->bitmap.pitch * y;
-                    unsigned char* rowDest = dest + y * pitch;
+                atlas_->MarkDirty(fontGlyph.page_, fontGlyph.y_, fontGlyph.height_);
+                if (!atlas_->Commit())
+                    return false;
 
-                    for (int x = 0; x < slot->bitmap.width; ++x)
-                        rowDest[x] = src[x];
-                }
+                // The atlas may have grown a new page
+                textures_ = atlas_->GetTextures();
             }
-
-            if (!image)
+            else
             {
                 textures_.Back()->SetData(0, fontGlyph.x_, fontGlyph.y_, fontGlyph.width_, fontGlyph.height_, dest);
                 delete[] dest;
@@ -439,11 +875,7 @@ bool FontFaceFreeType::LoadCharGlyph(unsigned charCode, Image* image)
     }
     else
     {
-        fontGlyph.width_ = 0;
-        fontGlyph.height_ = 0;
-        fontGlyph.offsetX_ = 0;
-        fontGlyph.offsetY_ = 0;
-        fontGlyph.advanceX_ = 0;
+        ClearGlyphMetrics(fontGlyph);
         fontGlyph.page_ = 0;
     }
 
@@ -27,6 +27,7 @@
 namespace Urho3D
 {
 
+class FontAtlas;
 class FreeTypeLibrary;
 class Texture2D;
 
@@ -48,12 +49,14 @@ public:
     virtual bool HasMutableGlyphs() const { return hasMutableGlyph_; }
 
 private:
-    /// Check can load all glyph in one texture, return true and texture size if can load.
-    bool CanLoadAllGlyphs(const PODVector<unsigned>& charCodes, int& textureWidth, int& textureHeight) const;
     /// Setup next texture.
     bool SetupNextTexture(int textureWidth, int textureHeight);
-    /// Load char glyph.
-    bool LoadCharGlyph(unsigned charCode, Image* image = 0);
+    /// Load char glyph on demand.
+    bool LoadCharGlyph(unsigned charCode);
+    /// Load glyphs, kerning and texture from the glyph cache. Return true if successful.
+    bool LoadCache(const String& fileName, unsigned fontDataSize);
+    /// Save glyphs, kerning and texture to the glyph cache.
+    void SaveCache(const String& fileName, Image* image, unsigned fontDataSize) const;
 
     /// FreeType library.
     SharedPtr<FreeTypeLibrary> freeType_;
@@ -67,6 +70,8 @@ private:
     bool hasMutableGlyph_;
     /// Glyph area allocator.
     AreaAllocator allocator_;
+    /// Shared glyph texture atlas of the font, if in use.
+    SharedPtr<FontAtlas> atlas_;
 };
 
 }
@@ -70,6 +70,24 @@ void SetItemHierarchyParent(UIElement* item, bool enable)
     item->SetVar(hierarchyParentHash, enable);
 }
 
+/// Return whether the first count indices of a sorted index list contain an index.
+static bool ContainsSorted(const PODVector<unsigned>& indices, unsigned count, unsigned index)
+{
+    unsigned low = 0;
+    unsigned high = count < indices.Size() ? count : indices.Size();
+    while (low < high)
+    {
+        unsigned middle = low + (high - low) / 2;
+        if (indices[middle] < index)
+            low = middle + 1;
+        else if (indices[middle] > index)
+            high = middle;
+        else
+            return true;
+    }
+    return false;
+}
+
 /// Hierarchy container (used by ListView internally when in hierarchy mode).
 class HierarchyContainer : public UIElement
 {
@@ -171,7 +189,11 @@ ListView::ListView(Context* context) :
     hierarchyMode_(true),    // Init to true here so that the setter below takes effect
     baseIndent_(0),
     clearSelectionOnDefocus_(false),
-    selectOnClickEnd_(false)
+    selectOnClickEnd_(false),
+    virtualMode_(false),
+    virtualItemCount_(0),
+    virtualItemHeight_(16),
+    virtualItemType_("Text")
 {
     resizeContentWidth_ = true;
 
@@ -182,6 +204,7 @@ ListView::ListView(Context* context) :
     SubscribeToEvent(E_FOCUSCHANGED, HANDLER(ListView, HandleItemFocusChanged));
     SubscribeToEvent(this, E_DEFOCUSED, HANDLER(ListView, HandleFocusChanged));
     SubscribeToEvent(this, E_FOCUSED, HANDLER(ListView, HandleFocusChanged));
+    SubscribeToEvent(this, E_VIEWCHANGED, HANDLER(ListView, HandleViewChanged));
 
     UpdateUIClickSubscription();
 }
@@ -205,6 +228,15 @@ void ListView::RegisterObject(Context* context)
     ACCESSOR_ATTRIBUTE("Select On Click End", GetSelectOnClickEnd, SetSelectOnClickEnd, bool, false, AM_FILE);
 }
 
+void ListView::Update(float timeStep)
+{
+    ScrollView::Update(timeStep);
+
+    // Follow changes in the panel size, which do not necessarily cause a view change
+    if (virtualMode_)
+        UpdateVirtualItems();
+}
+
 void ListView::OnKey(int key, int buttons, int qualifiers)
 {
     // If no selection, can not move with keys
@@ -262,6 +294,12 @@ void ListView::OnKey(int key, int buttons, int qualifiers)
                 // Convert page step to pixels and see how many items have to be skipped to reach that many pixels
                 if (selection == M_MAX_UNSIGNED)
                     selection = 0;      // Assume as if first item is selected
+                if (virtualMode_)
+                {
+                    // All items are visible and of the same height, so the page step converts directly to an item count
+                    delta = pageDirection * Max((int)(pageStep_ * scrollPanel_->GetHeight()) / virtualItemHeight_ - 1, 1);
+                    break;
+                }
                 int stepPixels = ((int)(pageStep_ * scrollPanel_->GetHeight())) - contentElement_->GetChild(selection)->GetHeight();
                 unsigned newSelection = selection;
                 unsigned okSelection = selection;
@@ -333,6 +371,12 @@ void ListView::InsertItem(unsigned index, UIElement* item, UIElement* parentItem
     if (!item || item->GetParent() == contentElement_)
         return;
 
+    if (virtualMode_)
+    {
+        LOGERROR("Can not insert items to a ListView in virtual mode");
+        return;
+    }
+
     // Enable input so that clicking the item can be detected
     item->SetEnabled(true);
     item->SetSelected(false);
@@ -390,7 +434,7 @@ void ListView::InsertItem(unsigned index, UIElement* item, UIElement* parentItem
 
 void ListView::RemoveItem(UIElement* item, unsigned index)
 {
-    if (!item)
+    if (!item || virtualMode_)
         return;
 
     unsigned numItems = GetNumItems();
@@ -471,6 +515,12 @@ void ListView::RemoveItem(unsigned index)
 
 void ListView::RemoveAllItems()
 {
+    if (virtualMode_)
+    {
+        SetVirtualItemCount(0);
+        return;
+    }
+
     contentElement_->DisableLayoutUpdate();
 
     ClearSelection();
@@ -497,11 +547,15 @@ void ListView::SetSelections(const PODVector<unsigned>& indices)
 
     unsigned numItems = GetNumItems();
 
+    // Sort a copy of the new selection for lookups, as the selections can be large in virtual mode
+    PODVector<unsigned> sortedIndices = indices;
+    Sort(sortedIndices.Begin(), sortedIndices.End());
+
     // Remove first items that should no longer be selected
     for (PODVector<unsigned>::Iterator i = selections_.Begin(); i != selections_.End();)
     {
         unsigned index = *i;
-        if (!indices.Contains(index))
+        if (!ContainsSorted(sortedIndices, sortedIndices.Size(), index))
         {
             i = selections_.Erase(i);
 
@@ -521,14 +575,21 @@ void ListView::SetSelections(const PODVector<unsigned>& indices)
 
     bool added = false;
 
-    // Then add missing items
+    // Then add missing items. The selections remain sorted up to the added ones. Added items need to be searched only if the
+    // new selection contains duplicates
+    unsigned numSorted = selections_.Size();
+    bool hasDuplicates = false;
+    for (unsigned i = 1; i < sortedIndices.Size() && !hasDuplicates; ++i)
+        hasDuplicates = sortedIndices[i] == sortedIndices[i - 1];
+
     for (PODVector<unsigned>::ConstIterator i = indices.Begin(); i != indices.End(); ++i)
     {
         unsigned index = *i;
         if (index < numItems)
         {
             // In singleselect mode, resend the event even for the same selection
-            bool duplicate = selections_.Contains(index);
+            bool duplicate = ContainsSorted(selections_, numSorted, index) || (hasDuplicates &&
+                selections_.Find(index) != selections_.End());
             if (!duplicate || !multiselect_)
             {
                 if (!duplicate)
@@ -573,7 +634,7 @@ void ListView::AddSelection(unsigned index)
         if (index >= GetNumItems())
             return;
 
-        if (!selections_.Contains(index))
+        if (!IsSelected(index))
         {
             selections_.Push(index);
 
@@ -596,6 +657,56 @@ void ListView::AddSelection(unsigned index)
     }
 }
 
+void ListView::AddSelectionRange(unsigned first, unsigned last)
+{
+    // Make a weak pointer to self to check for destruction as a response to events
+    WeakPtr<ListView> self(this);
+
+    unsigned numItems = GetNumItems();
+    if (last >= numItems)
+        last = numItems - 1;
+    if (!numItems || first > last)
+        return;
+
+    // Merge the range into the sorted selections
+    PODVector<unsigned> previous = selections_;
+    selections_.Clear();
+    selections_.Reserve(previous.Size() + last - first + 1);
+
+    unsigned j = 0;
+    while (j < previous.Size() && previous[j] < first)
+        selections_.Push(previous[j++]);
+    for (unsigned index = first; index <= last; ++index)
+        selections_.Push(index);
+    while (j < previous.Size() && previous[j] <= last)
+        ++j;
+    while (j < previous.Size())
+        selections_.Push(previous[j++]);
+
+    // Send the selected event for the items that were not selected before
+    j = 0;
+    for (unsigned index = first; index <= last; ++index)
+    {
+        while (j < previous.Size() && previous[j] < index)
+            ++j;
+        if (j < previous.Size() && previous[j] == index)
+            continue;
+
+        using namespace ItemSelected;
+
+        VariantMap& eventData = GetEventDataMap();
+        eventData[P_ELEMENT] = this;
+        eventData[P_SELECTION] = index;
+        SendEvent(E_ITEMSELECTED, eventData);
+
+        if (self.Expired())
+            return;
+    }
+
+    UpdateSelectionEffect();
+    SendEvent(E_SELECTIONCHANGED);
+}
+
 void ListView::RemoveSelection(unsigned index)
 {
     if (index >= GetNumItems())
@@ -622,7 +733,7 @@ void ListView::ToggleSelection(unsigned index)
     if (index >= numItems)
         return;
 
-    if (selections_.Contains(index))
+    if (IsSelected(index))
         RemoveSelection(index);
     else
         AddSelection(index);
@@ -642,6 +753,32 @@ void ListView::ChangeSelection(int delta, bool additive)
     if (!multiselect_)
         additive = false;
 
+    if (virtualMode_)
+    {
+        // All items are visible in virtual mode, so the new selection can be calculated directly
+        if (selections_.Empty())
+            return;
+        unsigned first = selections_.Front();
+        unsigned last = selections_.Back();
+        unsigned target;
+        if (delta > 0)
+            target = (unsigned)delta < numItems - last ? last + delta : numItems - 1;
+        else
+            target = (unsigned)-delta < first ? first + delta : 0;
+
+        if (!additive)
+            SetSelection(target);
+        else
+        {
+            if (target < first)
+                AddSelectionRange(target, first - 1);
+            else if (target > last)
+                AddSelectionRange(last + 1, target);
+            EnsureItemVisibility(target);
+        }
+        return;
+    }
+
     // If going downwards, use the last selection as a base. Otherwise use first
     unsigned selection = delta > 0 ? selections_.Back() : selections_.Front();
     int direction = delta > 0 ? 1 : -1;
@@ -690,6 +827,12 @@ void ListView::SetHierarchyMode(bool enable)
     if (enable == hierarchyMode_)
         return;
 
+    if (enable && virtualMode_)
+    {
+        LOGERROR("Hierarchy mode is not supported in virtual mode");
+        return;
+    }
+
     hierarchyMode_ = enable;
     UIElement* container;
     if (enable)
@@ -746,6 +889,91 @@ void ListView::SetSelectOnClickEnd(bool enable)
     }
 }
 
+void ListView::SetVirtualMode(bool enable)
+{
+    if (enable == virtualMode_)
+        return;
+
+    if (enable)
+        SetHierarchyMode(false);
+
+    // Items are not carried over between the modes
+    ClearSelection();
+    contentElement_->DisableLayoutUpdate();
+    contentElement_->RemoveAllChildren();
+    contentElement_->EnableLayoutUpdate();
+    virtualItems_.Clear();
+    virtualItemIndices_.Clear();
+
+    virtualMode_ = enable;
+    if (enable)
+    {
+        // The recycled item elements are positioned manually
+        contentElement_->SetLayoutMode(LM_FREE);
+        UpdateVirtualContentSize();
+    }
+    else
+        contentElement_->SetLayoutMode(LM_VERTICAL);
+}
+
+void ListView::SetVirtualItemCount(unsigned count)
+{
+    if (count == virtualItemCount_)
+        return;
+
+    virtualItemCount_ = count;
+    if (!virtualMode_)
+        return;
+
+    // Drop selections that are beyond the new item count. The selections are sorted, so check just the last
+    if (!selections_.Empty() && selections_.Back() >= count)
+    {
+        PODVector<unsigned> indices;
+        for (PODVector<unsigned>::ConstIterator i = selections_.Begin(); i != selections_.End() && *i < count; ++i)
+            indices.Push(*i);
+        SetSelections(indices);
+    }
+
+    UpdateVirtualContentSize();
+}
+
+void ListView::SetVirtualItemHeight(int height)
+{
+    height = Max(height, 1);
+    if (height == virtualItemHeight_)
+        return;
+
+    virtualItemHeight_ = height;
+    if (virtualMode_)
+        UpdateVirtualContentSize();
+}
+
+void ListView::SetVirtualItemType(const String& type, const String& style)
+{
+    virtualItemType_ = type;
+    virtualItemStyle_ = style;
+
+    // Recreate the recycled item elements on the next update
+    if (virtualMode_)
+    {
+        for (unsigned i = 0; i < virtualItems_.Size(); ++i)
+            contentElement_->RemoveChild(virtualItems_[i]);
+        virtualItems_.Clear();
+        virtualItemIndices_.Clear();
+        UpdateVirtualItems();
+    }
+}
+
+void ListView::RefreshVirtualItems()
+{
+    if (!virtualMode_)
+        return;
+
+    for (unsigned i = 0; i < virtualItemIndices_.Size(); ++i)
+        virtualItemIndices_[i] = M_MAX_UNSIGNED;
+    UpdateVirtualItems();
+}
+
 void ListView::Expand(unsigned index, bool enable, bool recursive)
 {
     if (!hierarchyMode_)
@@ -803,18 +1031,36 @@ void ListView::ToggleExpand(unsigned index, bool recursive)
 
 unsigned ListView::GetNumItems() const
 {
-    return contentElement_->GetNumChildren();
+    return virtualMode_ ? virtualItemCount_ : contentElement_->GetNumChildren();
 }
 
 UIElement* ListView::GetItem(unsigned index) const
 {
+    if (virtualMode_)
+    {
+        // Only the visible items have an element in virtual mode
+        if (virtualItems_.Empty())
+            return 0;
+        unsigned slot = index % virtualItems_.Size();
+        return virtualItemIndices_[slot] == index ? virtualItems_[slot].Get() : (UIElement*)0;
+    }
+
     return contentElement_->GetChild(index);
 }
 
 PODVector<UIElement*> ListView::GetItems() const
 {
     PODVector<UIElement*> items;
-    contentElement_->GetChildren(items);
+    if (virtualMode_)
+    {
+        for (unsigned i = 0; i < virtualItems_.Size(); ++i)
+        {
+            if (virtualItemIndices_[i] != M_MAX_UNSIGNED)
+                items.Push(virtualItems_[i]);
+        }
+    }
+    else
+        contentElement_->GetChildren(items);
     return items;
 }
 
@@ -827,6 +1073,16 @@ unsigned ListView::FindItem(UIElement* item) const
     if (item->GetParent() != contentElement_)
         return M_MAX_UNSIGNED;
 
+    if (virtualMode_)
+    {
+        for (unsigned i = 0; i < virtualItems_.Size(); ++i)
+        {
+            if (virtualItems_[i] == item)
+                return virtualItemIndices_[i];
+        }
+        return M_MAX_UNSIGNED;
+    }
+
     const Vector<SharedPtr<UIElement> >& children = contentElement_->GetChildren();
 
     // Binary search for list item based on screen coordinate Y
@@ -867,7 +1123,7 @@ unsigned ListView::GetSelection() const
 
 UIElement* ListView::GetSelectedItem() const
 {
-    return contentElement_->GetChild(GetSelection());
+    return GetItem(GetSelection());
 }
 
 PODVector<UIElement*> ListView::GetSelectedItems() const
@@ -901,12 +1157,12 @@ void ListView::CopySelectedItemsToClipboard() const
 
 bool ListView::IsSelected(unsigned index) const
 {
-    return selections_.Contains(index);
+    return ContainsSorted(selections_, selections_.Size(), index);
 }
 
 bool ListView::IsExpanded(unsigned index) const
 {
-    return GetItemExpanded(contentElement_->GetChild(index));
+    return GetItemExpanded(GetItem(index));
 }
 
 bool ListView::FilterImplicitAttributes(XMLElement& dest) const
@@ -954,13 +1210,25 @@ bool ListView::FilterImplicitAttributes(XMLElement& dest) const
 
 void ListView::UpdateSelectionEffect()
 {
-    unsigned numItems = GetNumItems();
     bool highlighted = highlightMode_ == HM_ALWAYS || HasFocus();
 
+    if (virtualMode_)
+    {
+        for (unsigned i = 0; i < virtualItems_.Size(); ++i)
+        {
+            unsigned index = virtualItemIndices_[i];
+            virtualItems_[i]->SetSelected(highlighted && highlightMode_ != HM_NEVER && index != M_MAX_UNSIGNED &&
+                IsSelected(index));
+        }
+        return;
+    }
+
+    unsigned numItems = GetNumItems();
+
     for (unsigned i = 0; i < numItems; ++i)
     {
         UIElement* item = GetItem(i);
-        if (highlightMode_ != HM_NEVER && selections_.Contains(i))
+        if (highlightMode_ != HM_NEVER && IsSelected(i))
             item->SetSelected(highlighted);
         else
             item->SetSelected(false);
@@ -969,7 +1237,14 @@ void ListView::UpdateSelectionEffect()
 
 void ListView::EnsureItemVisibility(unsigned index)
 {
-    EnsureItemVisibility(GetItem(index));
+    // In virtual mode the item may not have an element yet, but its position is known
+    if (virtualMode_)
+    {
+        if (index < virtualItemCount_)
+            EnsureVisibility((int)index * virtualItemHeight_, virtualItemHeight_);
+    }
+    else
+        EnsureItemVisibility(GetItem(index));
 }
 
 void ListView::EnsureItemVisibility(UIElement* item)
@@ -977,18 +1252,7 @@ void ListView::EnsureItemVisibility(UIElement* item)
     if (!item || !item->IsVisible())
         return;
 
-    IntVector2 newView = GetViewPosition();
-    IntVector2 currentOffset = item->GetPosition() - newView;
-    const IntRect& clipBorder = scrollPanel_->GetClipBorder();
-    IntVector2 windowSize(scrollPanel_->GetWidth() - clipBorder.left_ - clipBorder.right_,
-        scrollPanel_->GetHeight() - clipBorder.top_ - clipBorder.bottom_);
-
-    if (currentOffset.y_ < 0)
-        newView.y_ += currentOffset.y_;
-    if (currentOffset.y_ + item->GetHeight() > windowSize.y_)
-        newView.y_ += currentOffset.y_ + item->GetHeight() - windowSize.y_;
-
-    SetViewPosition(newView);
+    EnsureVisibility(item->GetPosition().y_, item->GetHeight());
 }
 
 void ListView::HandleUIMouseClick(StringHash eventType, VariantMap& eventData)
@@ -1030,38 +1294,22 @@ void ListView::HandleUIMouseClick(StringHash eventType, VariantMap& eventData)
                     SetSelection(i);
                 else
                 {
+                    // Extend the selection with a range of items, without listing them for SetSelections()
                     unsigned first = selections_.Front();
                     unsigned last = selections_.Back();
-                    PODVector<unsigned> newSelections = selections_;
                     if (i == first || i == last)
-                    {
-                        for (unsigned j = first; j <= last; ++j)
-                            newSelections.Push(j);
-                    }
+                        AddSelectionRange(first, last);
                     else if (i < first)
-                    {
-                        for (unsigned j = i; j <= first; ++j)
-                            newSelections.Push(j);
-                    }
+                        AddSelectionRange(i, first);
                     else if (i < last)
                     {
                         if ((abs((int)i - (int)first)) <= (abs((int)i - (int)last)))
-                        {
-                            for (unsigned j = first; j <= i; ++j)
-                                newSelections.Push(j);
-                        }
+                            AddSelectionRange(first, i);
                         else
-                        {
-                            for (unsigned j = i; j <= last; ++j)
-                                newSelections.Push(j);
-                        }
+                            AddSelectionRange(i, last);
                     }
-                    else if (i > last)
-                    {
-                        for (unsigned j = last; j <= i; ++j)
-                            newSelections.Push(j);
-                    }
-                    SetSelections(newSelections);
+                    else
+                        AddSelectionRange(last, i);
                 }
             }
             else if (qualifiers & QUAL_CTRL)
@@ -1137,4 +1385,130 @@ void ListView::UpdateUIClickSubscription()
     SubscribeToEvent(selectOnClickEnd_ ? E_UIMOUSECLICKEND : E_UIMOUSECLICK, HANDLER(ListView, HandleUIMouseClick));
 }
 
+void ListView::HandleViewChanged(StringHash eventType, VariantMap& eventData)
+{
+    if (virtualMode_)
+        UpdateVirtualItems();
+}
+
+UIElement* ListView::CreateVirtualItem()
+{
+    SharedPtr<UIElement> item(DynamicCast<UIElement>(context_->CreateObject(StringHash(virtualItemType_))));
+    if (!item)
+    {
+        LOGERROR("Could not create virtual item element of type " + virtualItemType_);
+        item = new UIElement(context_);
+    }
+
+    // The recycled elements are not part of the list's serialized content
+    item->SetTemporary(true);
+    contentElement_->AddChild(item);
+    if (virtualItemStyle_.Empty())
+        item->SetStyleAuto();
+    else
+        item->SetStyle(virtualItemStyle_);
+    item->SetEnabled(true);
+    item->SetSelected(false);
+
+    using namespace VirtualItemCreated;
+
+    VariantMap& eventData = GetEventDataMap();
+    eventData[P_ELEMENT] = this;
+    eventData[P_ITEM] = item;
+    SendEvent(E_VIRTUALITEMCREATED, eventData);
+
+    return item;
+}
+
+void ListView::UpdateVirtualContentSize()
+{
+    // Limit the content height to the range of an int
+    unsigned maxCount = (unsigned)(M_MAX_INT / virtualItemHeight_);
+    contentElement_->SetHeight((int)(virtualItemCount_ < maxCount ? virtualItemCount_ : maxCount) * virtualItemHeight_);
+
+    RefreshVirtualItems();
+}
+
+void ListView::UpdateVirtualItems()
+{
+    // Make sure that a style has not set a layout on the item container, as the elements are positioned manually
+    if (contentElement_->GetLayoutMode() != LM_FREE)
+        contentElement_->SetLayoutMode(LM_FREE);
+
+    // Count the rows that may be at least partially visible, and grow the recycled elements to cover them
+    const IntRect& clipBorder = scrollPanel_->GetClipBorder();
+    int viewHeight = Max(scrollPanel_->GetHeight() - clipBorder.top_ - clipBorder.bottom_, 0);
+    unsigned numRows = (unsigned)((viewHeight + virtualItemHeight_ - 1) / virtualItemHeight_ + 1);
+    if (numRows > virtualItems_.Size())
+    {
+        unsigned oldSize = virtualItems_.Size();
+        virtualItems_.Resize(numRows);
+        for (unsigned i = oldSize; i < numRows; ++i)
+            virtualItems_[i] = CreateVirtualItem();
+
+        // The elements are assigned by the index modulo the number of elements, so all need to be rebound
+        virtualItemIndices_.Resize(numRows);
+        for (unsigned i = 0; i < numRows; ++i)
+            virtualItemIndices_[i] = M_MAX_UNSIGNED;
+    }
+
+    // Make a weak pointer to self to check for destruction as a response to events
+    WeakPtr<ListView> self(this);
+
+    unsigned numElements = virtualItems_.Size();
+    unsigned first = (unsigned)(viewPosition_.y_ / virtualItemHeight_);
+    int width = contentElement_->GetWidth();
+    bool highlighted = highlightMode_ != HM_NEVER && (highlightMode_ == HM_ALWAYS || HasFocus());
+
+    for (unsigned index = first; index < first + numElements; ++index)
+    {
+        unsigned slot = index % numElements;
+        UIElement* item = virtualItems_[slot];
+
+        if (index >= virtualItemCount_)
+        {
+            item->SetVisible(false);
+            virtualItemIndices_[slot] = M_MAX_UNSIGNED;
+            continue;
+        }
+
+        item->SetSize(width, virtualItemHeight_);
+
+        // Already bound elements are not updated again, so scrolling by a row only updates one element
+        if (virtualItemIndices_[slot] == index)
+            continue;
+
+        virtualItemIndices_[slot] = index;
+        item->SetPosition(0, (int)index * virtualItemHeight_);
+        item->SetVisible(true);
+        item->SetSelected(highlighted && IsSelected(index));
+
+        using namespace VirtualItemUpdate;
+
+        VariantMap& eventData = GetEventDataMap();
+        eventData[P_ELEMENT] = this;
+        eventData[P_ITEM] = item;
+        eventData[P_INDEX] = index;
+        SendEvent(E_VIRTUALITEMUPDATE, eventData);
+
+        if (self.Expired() || !virtualMode_ || virtualItems_.Size() != numElements)
+            return;
+    }
+}
+
+void ListView::EnsureVisibility(int y, int height)
+{
+    IntVector2 newView = GetViewPosition();
+    int currentOffset = y - newView.y_;
+    const IntRect& clipBorder = scrollPanel_->GetClipBorder();
+    int windowHeight = scrollPanel_->GetHeight() - clipBorder.top_ - clipBorder.bottom_;
+
+    if (currentOffset < 0)
+        newView.y_ += currentOffset;
+    if (currentOffset + height > windowHeight)
+        newView.y_ += currentOffset + height - windowHeight;
+
+    SetViewPosition(newView);
+}
+
 }
@@ -51,6 +51,8 @@ public:
     /// Register object factory.
     static void RegisterObject(Context* context);
 
+    /// Perform UI element update.
+    virtual void Update(float timeStep);
     /// React to a key press.
     virtual void OnKey(int key, int buttons, int qualifiers);
     /// React to resize.
@@ -96,6 +98,17 @@ public:
     void SetClearSelectionOnDefocus(bool enable);
     /// Enable reacting to click end instead of click start for item selection. Default false.
     void SetSelectOnClickEnd(bool enable);
+    /// \brief Enable virtual mode. Instead of holding every item as a child element, only the visible rows are instantiated as recycled elements, whose contents are requested with the VirtualItemUpdate event.
+    /// Items must have uniform height. Disables hierarchy mode. All non-virtual items in the list will be lost during mode change.
+    void SetVirtualMode(bool enable);
+    /// Set number of items in virtual mode.
+    void SetVirtualItemCount(unsigned count);
+    /// Set item height in pixels in virtual mode.
+    void SetVirtualItemHeight(int height);
+    /// Set type and optional style of the recycled item elements in virtual mode. If no style given, uses the default style of the type. Default is Text.
+    void SetVirtualItemType(const String& type, const String& style = String::EMPTY);
+    /// Request the contents of the visible items again in virtual mode, for example after the data has changed.
+    void RefreshVirtualItems();
 
     /// Expand item at index. Only has effect in hierarchy mode.
     void Expand(unsigned index, bool enable, bool recursive = false);
@@ -145,6 +158,21 @@ public:
     /// Return base indent.
     int GetBaseIndent() const { return baseIndent_; }
 
+    /// Return whether virtual mode enabled.
+    bool GetVirtualMode() const { return virtualMode_; }
+
+    /// Return number of items in virtual mode.
+    unsigned GetVirtualItemCount() const { return virtualItemCount_; }
+
+    /// Return item height in pixels in virtual mode.
+    int GetVirtualItemHeight() const { return virtualItemHeight_; }
+
+    /// Return type of the recycled item elements in virtual mode.
+    const String& GetVirtualItemType() const { return virtualItemType_; }
+
+    /// Return style of the recycled item elements in virtual mode.
+    const String& GetVirtualItemStyle() const { return virtualItemStyle_; }
+
     /// Ensure full visibility of the item.
     void EnsureItemVisibility(unsigned index);
     /// Ensure full visibility of the item.
@@ -172,6 +200,20 @@ protected:
     bool clearSelectionOnDefocus_;
     /// React to click end instead of click start flag.
     bool selectOnClickEnd_;
+    /// Virtual mode flag.
+    bool virtualMode_;
+    /// Number of items in virtual mode.
+    unsigned virtualItemCount_;
+    /// Item height in virtual mode.
+    int virtualItemHeight_;
+    /// Type of the recycled item elements in virtual mode.
+    String virtualItemType_;
+    /// Style of the recycled item elements in virtual mode.
+    String virtualItemStyle_;
+    /// Recycled item elements in virtual mode. An item index is always shown by the element at the index modulo the number of elements.
+    Vector<SharedPtr<UIElement> > virtualItems_;
+    /// Item index currently shown by each recycled item element, or M_MAX_UNSIGNED if none.
+    PODVector<unsigned> virtualItemIndices_;
 
 private:
     /// Handle global UI mouseclick to check for selection change.
@@ -184,6 +226,18 @@ private:
     void HandleFocusChanged(StringHash eventType, VariantMap& eventData);
     /// Update subscription to UI click events
     void UpdateUIClickSubscription();
+    /// Add a range of items to the selection in multiselect mode.
+    void AddSelectionRange(unsigned first, unsigned last);
+    /// Handle view changed to update the recycled item elements in virtual mode.
+    void HandleViewChanged(StringHash eventType, VariantMap& eventData);
+    /// Create a recycled item element for virtual mode.
+    UIElement* CreateVirtualItem();
+    /// Resize the content element to cover all items in virtual mode.
+    void UpdateVirtualContentSize();
+    /// Bind the recycled item elements to the visible items in virtual mode.
+    void UpdateVirtualItems();
+    /// Scroll the view so that a vertical range of the content is fully visible.
+    void EnsureVisibility(int y, int height);
 };
 
 }
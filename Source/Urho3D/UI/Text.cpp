@@ -343,32 +343,38 @@ void Text::SetSelection(unsigned start, unsigned length)
     selectionStart_ = start;
     selectionLength_ = length;
     ValidateSelection();
+    MarkBatchesDirty();
 }
 
 void Text::ClearSelection()
 {
     selectionStart_ = 0;
     selectionLength_ = 0;
+    MarkBatchesDirty();
 }
 
 void Text::SetSelectionColor(const Color& color)
 {
     selectionColor_ = color;
+    MarkBatchesDirty();
 }
 
 void Text::SetHoverColor(const Color& color)
 {
     hoverColor_ = color;
+    MarkBatchesDirty();
 }
 
 void Text::SetTextEffect(TextEffect textEffect)
 {
     textEffect_ = textEffect;
+    MarkBatchesDirty();
 }
 
 void Text::SetEffectColor(const Color& effectColor)
 {
     effectColor_ = effectColor;
+    MarkBatchesDirty();
 }
 
 void Text::SetUsedInText3D(bool usedInText3D)
@@ -379,6 +385,7 @@ void Text::SetUsedInText3D(bool usedInText3D)
 void Text::SetEffectDepthBias(float bias)
 {
     effectDepthBias_ = bias;
+    MarkBatchesDirty();
 }
 
 int Text::GetRowWidth(unsigned index) const
@@ -439,6 +446,16 @@ bool Text::FilterImplicitAttributes(XMLElement& dest) const
     return true;
 }
 
+bool Text::IsBatchesDirty() const
+{
+    if (UIElement::IsBatchesDirty() || charLocationsDirty_)
+        return true;
+
+    // If the face has changed, or uses the mutable glyphs mechanism where glyphs may move in the texture, can not reuse
+    FontFace* face = font_ ? font_->GetFace(fontSize_) : (FontFace*)0;
+    return !face || face != fontFace_ || face->HasMutableGlyphs();
+}
+
 void Text::UpdateText(bool onResize)
 {
     rowWidths_.Clear();
@@ -687,6 +704,7 @@ void Text::UpdateCharLocations()
     charLocations_[numChars].size_ = IntVector2::ZERO;
 
     charLocationsDirty_ = false;
+    MarkBatchesDirty();
 }
 
 void Text::ValidateSelection()
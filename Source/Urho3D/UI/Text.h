@@ -191,6 +191,8 @@ public:
 protected:
     /// Filter implicit attributes in serialization process.
     virtual bool FilterImplicitAttributes(XMLElement& dest) const;
+    /// Return whether the retained rendering batches need to be regenerated.
+    virtual bool IsBatchesDirty() const;
     /// Update text when text, font or spacing changed.
     void UpdateText(bool onResize = false);
     /// Update cached character locations after text update, or when text alignment or indent has changed.
@@ -34,6 +34,7 @@
 #include "../Graphics/VertexBuffer.h"
 #include "../Input/Input.h"
 #include "../Input/InputEvents.h"
+#include "../IO/FileSystem.h"
 #include "../IO/Log.h"
 #include "../Math/Matrix3x4.h"
 #include "../Resource/ResourceCache.h"
@@ -105,6 +106,8 @@ UI::UI(Context* context) :
 #endif
     useMutableGlyphs_(false),
     forceAutoHint_(false),
+    useSharedFontAtlas_(false),
+    retainBatches_(false),
     uiRendered_(false),
     nonModalBatchSize_(0),
     dragElementsCount_(0),
@@ -592,6 +595,25 @@ void UI::SetForceAutoHint(bool enable)
     }
 }
 
+void UI::SetUseSharedFontAtlas(bool enable)
+{
+    if (enable != useSharedFontAtlas_)
+    {
+        useSharedFontAtlas_ = enable;
+        ReleaseFontFaces();
+    }
+}
+
+void UI::SetFontCacheDir(const String& path)
+{
+    fontCacheDir_ = path.Empty() ? String::EMPTY : AddTrailingSlash(path);
+}
+
+void UI::SetRetainBatches(bool enable)
+{
+    retainBatches_ = enable;
+}
+
 IntVector2 UI::GetCursorPosition() const
 {
     return cursor_ ? cursor_->GetPosition() : GetSubsystem<Input>()->GetMousePosition();
@@ -850,7 +872,12 @@ void UI::GetBatches(UIElement* element, IntRect currentScissor)
             while (j != children.End() && (*j)->GetPriority() == currentPriority)
             {
                 if ((*j)->IsWithinScissor(currentScissor) && (*j) != cursor_)
-                    (*j)->GetBatches(batches_, vertexData_, currentScissor);
+                {
+                    if (retainBatches_)
+                        (*j)->GetRetainedBatches(batches_, vertexData_, currentScissor);
+                    else
+                        (*j)->GetBatches(batches_, vertexData_, currentScissor);
+                }
                 ++j;
             }
             // Now recurse into the children
@@ -870,7 +897,12 @@ void UI::GetBatches(UIElement* element, IntRect currentScissor)
             if ((*i) != cursor_)
             {
                 if ((*i)->IsWithinScissor(currentScissor))
-                    (*i)->GetBatches(batches_, vertexData_, currentScissor);
+                {
+                    if (retainBatches_)
+                        (*i)->GetRetainedBatches(batches_, vertexData_, currentScissor);
+                    else
+                        (*i)->GetBatches(batches_, vertexData_, currentScissor);
+                }
                 if ((*i)->IsVisible())
                     GetBatches(*i, currentScissor);
             }
@@ -95,6 +95,12 @@ public:
     void SetUseMutableGlyphs(bool enable);
     /// Set whether to force font autohinting instead of using FreeType's TTF bytecode interpreter.
     void SetForceAutoHint(bool enable);
+    /// Set whether the faces (point sizes) of a FreeType font share one glyph texture atlas instead of each using its own textures. Default false.
+    void SetUseSharedFontAtlas(bool enable);
+    /// Set directory for caching the rasterized glyphs of FreeType font faces to speed up later loads. Empty (default) disables the cache.
+    void SetFontCacheDir(const String& path);
+    /// Set whether to retain the rendering batches of unchanged UI elements between frames instead of regenerating them. Uses more memory, but reduces CPU time when most of the UI is static. Default false.
+    void SetRetainBatches(bool enable);
 
     /// Return root UI element.
     UIElement* GetRoot() const { return rootElement_; }
@@ -158,6 +164,15 @@ public:
     /// Return whether is using forced autohinting.
     bool GetForceAutoHint() const { return forceAutoHint_; }
 
+    /// Return whether FreeType font faces share a glyph texture atlas.
+    bool GetUseSharedFontAtlas() const { return useSharedFontAtlas_; }
+
+    /// Return font glyph cache directory.
+    const String& GetFontCacheDir() const { return fontCacheDir_; }
+
+    /// Return whether is retaining rendering batches of unchanged UI elements between frames.
+    bool GetRetainBatches() const { return retainBatches_; }
+
     /// Return true when UI has modal element(s).
     bool HasModalElement() const;
 
@@ -311,6 +326,12 @@ private:
     bool useMutableGlyphs_;
     /// Flag for forcing FreeType auto hinting.
     bool forceAutoHint_;
+    /// Flag for sharing a glyph texture atlas between the faces of a FreeType font.
+    bool useSharedFontAtlas_;
+    /// Font glyph cache directory.
+    String fontCacheDir_;
+    /// Flag for retaining rendering batches of unchanged UI elements.
+    bool retainBatches_;
     /// Flag for UI already being rendered this frame.
     bool uiRendered_;
     /// Non-modal batch size (used internally for rendering).
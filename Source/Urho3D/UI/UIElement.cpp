@@ -133,7 +133,10 @@ UIElement::UIElement(Context* context) :
     sortOrderDirty_(false),
     colorGradient_(false),
     traversalMode_(TM_BREADTH_FIRST),
-    elementEventSender_(false)
+    elementEventSender_(false),
+    retainedScissor_(IntRect::ZERO),
+    retainedState_(0),
+    batchesDirty_(true)
 {
     SetEnabled(false);
 }
@@ -192,6 +195,7 @@ void UIElement::ApplyAttributes()
 {
     colorGradient_ = false;
     derivedColorDirty_ = true;
+    batchesDirty_ = true;
 
     for (unsigned i = 1; i < MAX_UIELEMENT_CORNERS; ++i)
     {
@@ -782,6 +786,7 @@ void UIElement::SetColor(const Color& color)
         color_[i] = color;
     colorGradient_ = false;
     derivedColorDirty_ = true;
+    batchesDirty_ = true;
 }
 
 void UIElement::SetColor(Corner corner, const Color& color)
@@ -789,6 +794,7 @@ void UIElement::SetColor(Corner corner, const Color& color)
     color_[corner] = color;
     colorGradient_ = false;
     derivedColorDirty_ = true;
+    batchesDirty_ = true;
 
     for (unsigned i = 0; i < MAX_UIELEMENT_CORNERS; ++i)
     {
@@ -1007,6 +1013,7 @@ void UIElement::SetLayoutFlexScale(const Vector2& scale)
 void UIElement::SetIndent(int indent)
 {
     indent_ = indent;
+    batchesDirty_ = true;
     if (parent_)
         parent_->UpdateLayout();
     UpdateLayout();
@@ -1016,6 +1023,7 @@ void UIElement::SetIndent(int indent)
 void UIElement::SetIndentSpacing(int indentSpacing)
 {
     indentSpacing_ = Max(indentSpacing, 0);
+    batchesDirty_ = true;
     if (parent_)
         parent_->UpdateLayout();
     UpdateLayout();
@@ -1657,6 +1665,45 @@ void UIElement::GetBatchesWithOffset(IntVector2& offset, PODVector<UIBatch>& bat
     }
 }
 
+void UIElement::GetRetainedBatches(PODVector<UIBatch>& batches, PODVector<float>& vertexData, const IntRect& currentScissor)
+{
+    // Hover, selection and focus are evaluated each frame and affect the appearance of many elements, so they are compared
+    // along with the scissor instead of requiring the elements to mark themselves dirty
+    unsigned state = (hovering_ ? 1 : 0) | (selected_ ? 2 : 0) | (HasFocus() ? 4 : 0);
+
+    if (IsBatchesDirty() || state != retainedState_ || currentScissor != retainedScissor_)
+    {
+        retainedBatches_.Clear();
+        retainedVertexData_.Clear();
+        GetBatches(retainedBatches_, retainedVertexData_, currentScissor);
+        retainedScissor_ = currentScissor;
+        retainedState_ = state;
+        batchesDirty_ = false;
+    }
+    else
+    {
+        // Reset hovering for next frame, as GetBatches() would do
+        hovering_ = false;
+    }
+
+    if (retainedVertexData_.Empty())
+        return;
+
+    // Splice the retained vertex data to the end of the frame's vertex data and rebase the batches' vertex ranges
+    unsigned vertexOffset = vertexData.Size();
+    vertexData.Resize(vertexOffset + retainedVertexData_.Size());
+    memcpy(&vertexData[vertexOffset], &retainedVertexData_[0], retainedVertexData_.Size() * sizeof(float));
+
+    for (PODVector<UIBatch>::ConstIterator i = retainedBatches_.Begin(); i != retainedBatches_.End(); ++i)
+    {
+        UIBatch batch = *i;
+        batch.vertexData_ = &vertexData;
+        batch.vertexStart_ += vertexOffset;
+        batch.vertexEnd_ += vertexOffset;
+        UIBatch::AddOrMerge(batch, batches);
+    }
+}
+
 UIElement* UIElement::GetElementEventSender() const
 {
     UIElement* element = const_cast<UIElement*>(this);
@@ -1722,6 +1769,7 @@ void UIElement::MarkDirty()
     positionDirty_ = true;
     opacityDirty_ = true;
     derivedColorDirty_ = true;
+    batchesDirty_ = true;
 
     for (Vector<SharedPtr<UIElement> >::ConstIterator i = children_.Begin(); i != children_.End(); ++i)
         (*i)->MarkDirty();
@@ -544,6 +544,10 @@ public:
     /// Get UI rendering batches with a specified offset. Also recurse to child elements.
     void
         GetBatchesWithOffset(IntVector2& offset, PODVector<UIBatch>& batches, PODVector<float>& vertexData, IntRect currentScissor);
+    /// Get UI rendering batches, reusing the batches retained from a previous frame if the element has not changed.
+    void GetRetainedBatches(PODVector<UIBatch>& batches, PODVector<float>& vertexData, const IntRect& currentScissor);
+    /// Mark the retained rendering batches as needing regeneration.
+    void MarkBatchesDirty() { batchesDirty_ = true; }
 
     /// Return color attribute. Uses just the top-left color.
     const Color& GetColorAttr() const { return color_[0]; }
@@ -565,6 +569,8 @@ protected:
     /// Set object attribute animation internal.
     virtual void
         SetObjectAttributeAnimation(const String& name, ValueAnimation* attributeAnimation, WrapMode wrapMode, float speed);
+    /// Return whether the retained rendering batches need to be regenerated.
+    virtual bool IsBatchesDirty() const { return batchesDirty_; }
     /// Mark screen position as needing an update.
     void MarkDirty();
     /// Remove child XML element by matching attribute name.
@@ -701,6 +707,16 @@ private:
     TraversalMode traversalMode_;
     /// Flag whether node should send child added / removed events by itself.
     bool elementEventSender_;
+    /// Retained rendering batches.
+    PODVector<UIBatch> retainedBatches_;
+    /// Retained vertex data.
+    PODVector<float> retainedVertexData_;
+    /// Scissor rectangle used when the retained batches were generated.
+    IntRect retainedScissor_;
+    /// Hover, selection and focus state when the retained batches were generated.
+    unsigned retainedState_;
+    /// Retained batches dirty flag.
+    bool batchesDirty_;
     /// XPath query for selecting UI-style.
     static XPathQuery styleXPathQuery_;
 };
@@ -260,6 +260,21 @@ EVENT(E_ITEMDOUBLECLICKED, ItemDoubleClicked)
     PARAM(P_QUALIFIERS, Qualifiers);        // int
 }
 
+/// Virtual mode listview item element created. Can be used to customize the recycled element, for example by adding child elements.
+EVENT(E_VIRTUALITEMCREATED, VirtualItemCreated)
+{
+    PARAM(P_ELEMENT, Element);              // UIElement pointer
+    PARAM(P_ITEM, Item);                    // UIElement pointer
+}
+
+/// Virtual mode listview item element bound to an item index. The element should be updated to show the item's contents.
+EVENT(E_VIRTUALITEMUPDATE, VirtualItemUpdate)
+{
+    PARAM(P_ELEMENT, Element);              // UIElement pointer
+    PARAM(P_ITEM, Item);                    // UIElement pointer
+    PARAM(P_INDEX, Index);                  // unsigned
+}
+
 /// LineEdit or ListView unhandled key pressed.
 EVENT(E_UNHANDLEDKEY, UnhandledKey)
 {
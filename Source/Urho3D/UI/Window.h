@@ -126,6 +126,8 @@ public:
     bool GetModalAutoDismiss() const { return modalAutoDismiss_; }
 
 protected:
+    /// Return whether the retained rendering batches need to be regenerated. Always true when modal due to the modal shade.
+    virtual bool IsBatchesDirty() const { return BorderImage::IsBatchesDirty() || modal_; }
     /// Identify drag mode (move/resize.)
     WindowDragMode GetDragMode(const IntVector2& position) const;
     /// Set cursor shape based on drag mode.
@@ -46,7 +46,14 @@ Drawable2D::Drawable2D(Context* context) :
     Drawable(context, DRAWABLE_GEOMETRY2D),
     layer_(0),
     orderInLayer_(0),
-    sourceBatchesDirty_(true)
+    sourceBatchesDirty_(true),
+    rendererIndex_(M_MAX_UNSIGNED),
+    gridCell_(0),
+    gridIndex_(M_MAX_UNSIGNED),
+    gridLarge_(false),
+    gridUpdateQueued_(false),
+    viewStamp_(0),
+    sortedBatchCount_(0)
 {
 }
 
@@ -125,6 +132,10 @@ void Drawable2D::OnMarkedDirty(Node* node)
     Drawable::OnMarkedDirty(node);
 
     sourceBatchesDirty_ = true;
+
+    // The world bounding box changes, so the drawable must be moved in the renderer's spatial grid
+    if (renderer_ && !gridUpdateQueued_ && rendererIndex_ != M_MAX_UNSIGNED)
+        renderer_->QueueGridUpdate(this);
 }
 
 }
\ No newline at end of file
@@ -65,6 +65,8 @@ class URHO3D_API Drawable2D : public Drawable
 {
     OBJECT(Drawable2D);
 
+    friend class Renderer2D;
+
 public:
     /// Construct.
     Drawable2D(Context* context);
@@ -113,6 +115,22 @@ protected:
     bool sourceBatchesDirty_;
     /// Renderer2D.
     WeakPtr<Renderer2D> renderer_;
+
+private:
+    /// Index in the Renderer2D drawable list, or M_MAX_UNSIGNED if not added.
+    unsigned rendererIndex_;
+    /// Renderer2D spatial grid cell key.
+    unsigned gridCell_;
+    /// Index in the spatial grid cell or the large drawable list, or M_MAX_UNSIGNED if not inserted.
+    unsigned gridIndex_;
+    /// Inserted to the large drawable list instead of a grid cell flag.
+    bool gridLarge_;
+    /// Spatial grid update queued flag.
+    bool gridUpdateQueued_;
+    /// Renderer2D view stamp for incremental batch sorting.
+    unsigned viewStamp_;
+    /// Number of source batches already in the view's sorted batch list.
+    unsigned sortedBatchCount_;
 };
 
 }
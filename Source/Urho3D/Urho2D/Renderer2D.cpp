@@ -49,6 +49,28 @@ namespace Urho3D
 extern const char* blendModeNames[];
 
 static const unsigned MASK_VERTEX2D = MASK_POSITION | MASK_COLOR | MASK_TEXCOORD1;
+/// Spatial grid cell size. Drawables larger than this go to the large drawable list.
+static const float GRID_CELL_SIZE = 16.0f;
+/// Spatial grid cell coordinate range. Coordinates outside are clamped.
+static const float GRID_MAX_CELL = 32767.0f;
+/// Maximum number of out-of-order batches to fix by insertion sort instead of a full sort.
+static const unsigned MAX_INSERTION_SORT_BATCHES = 64;
+/// Minimum vertex count to copy the vertices in parallel.
+static const unsigned MIN_PARALLEL_COPY_VERTICES = 16384;
+
+void CopyVertices2D(const WorkItem* item, unsigned threadIndex);
+
+/// Return spatial grid cell key from cell coordinates.
+static inline unsigned GetGridCellKey(int x, int y)
+{
+    return ((unsigned)y << 16) | ((unsigned)x & 0xffff);
+}
+
+/// Return spatial grid cell coordinate for a world coordinate.
+static inline int GetGridCellCoordinate(float value)
+{
+    return (int)floorf(Clamp(value / GRID_CELL_SIZE, -GRID_MAX_CELL - 1.0f, GRID_MAX_CELL));
+}
 
 ViewBatchInfo2D::ViewBatchInfo2D() :
     vertexBufferUpdateFrameNumber_(0),
@@ -61,8 +83,9 @@ ViewBatchInfo2D::ViewBatchInfo2D() :
 
 Renderer2D::Renderer2D(Context* context) :
     Drawable(context, DRAWABLE_GEOMETRY),
-    material_(new Material(context)),
     indexBuffer_(new IndexBuffer(context_)),
+    material_(new Material(context)),
+    viewStamp_(0),
     frustum_(0)
 {
     material_->SetName("Urho2D");
@@ -83,6 +106,14 @@ Renderer2D::Renderer2D(Context* context) :
 
 Renderer2D::~Renderer2D()
 {
+    // Reset the bookkeeping of the remaining drawables so that they can be added to another renderer
+    for (unsigned i = 0; i < drawables_.Size(); ++i)
+    {
+        Drawable2D* drawable = drawables_[i];
+        drawable->rendererIndex_ = M_MAX_UNSIGNED;
+        drawable->gridIndex_ = M_MAX_UNSIGNED;
+        drawable->gridUpdateQueued_ = false;
+    }
 }
 
 void Renderer2D::RegisterObject(Context* context)
@@ -200,12 +231,47 @@ void Renderer2D::UpdateGeometry(const FrameInfo& frame)
             if (dest)
             {
                 const PODVector<const SourceBatch2D*>& sourceBatches = viewBatchInfo.sourceBatches_;
-                for (unsigned b = 0; b < sourceBatches.Size(); ++b)
+                WorkQueue* queue = GetSubsystem<WorkQueue>();
+
+                if (vertexCount >= MIN_PARALLEL_COPY_VERTICES && queue->GetNumThreads())
                 {
-                    const Vector<Vertex2D>& vertices = sourceBatches[b]->vertices_;
-                    for (unsigned i = 0; i < vertices.Size(); ++i)
-                        dest[i] = vertices[i];
-                    dest += vertices.Size();
+                    PROFILE(CopyVertices2D);
+
+                    // Split the batches to work items of roughly equal vertex counts
+                    unsigned numWorkItems = queue->GetNumThreads() + 1; // Worker threads + main thread
+                    unsigned verticesPerItem = (vertexCount + numWorkItems - 1) / numWorkItems;
+                    unsigned start = 0;
+                    unsigned itemVertices = 0;
+
+                    for (unsigned b = 0; b < sourceBatches.Size(); ++b)
+                    {
+                        itemVertices += sourceBatches[b]->vertices_.Size();
+                        if (itemVertices >= verticesPerItem || b == sourceBatches.Size() - 1)
+                        {
+                            SharedPtr<WorkItem> item = queue->GetFreeItem();
+                            item->priority_ = M_MAX_UNSIGNED;
+                            item->workFunction_ = CopyVertices2D;
+                            item->aux_ = dest;
+                            item->start_ = const_cast<const SourceBatch2D**>(&sourceBatches[0]) + start;
+                            item->end_ = const_cast<const SourceBatch2D**>(&sourceBatches[0]) + b + 1;
+                            queue->AddWorkItem(item);
+
+                            dest += itemVertices;
+                            start = b + 1;
+                            itemVertices = 0;
+                        }
+                    }
+
+                    queue->Complete(M_MAX_UNSIGNED);
+                }
+                else
+                {
+                    for (unsigned b = 0; b < sourceBatches.Size(); ++b)
+                    {
+                        const Vector<Vertex2D>& vertices = sourceBatches[b]->vertices_;
+                        memcpy((void*)dest, &vertices[0], vertices.Size() * sizeof(Vertex2D));
+                        dest += vertices.Size();
+                    }
                 }
 
                 vertexBuffer->Unlock();
@@ -225,18 +291,39 @@ UpdateGeometryType Renderer2D::GetUpdateGeometryType()
 
 void Renderer2D::AddDrawable(Drawable2D* drawable)
 {
-    if (!drawable)
+    if (!drawable || drawable->rendererIndex_ != M_MAX_UNSIGNED)
         return;
 
+    drawable->rendererIndex_ = drawables_.Size();
     drawables_.Push(drawable);
+    removedDrawables_.Erase(drawable);
+
+    // Insert to the spatial grid on the next view update, when the world bounding box is up to date
+    QueueGridUpdate(drawable);
 }
 
 void Renderer2D::RemoveDrawable(Drawable2D* drawable)
 {
-    if (!drawable)
+    if (!drawable || drawable->rendererIndex_ == M_MAX_UNSIGNED)
         return;
 
-    drawables_.Remove(drawable);
+    // Swap with the last drawable to remove in constant time
+    unsigned index = drawable->rendererIndex_;
+    Drawable2D* last = drawables_.Back();
+    drawables_[index] = last;
+    last->rendererIndex_ = index;
+    drawables_.Pop();
+    drawable->rendererIndex_ = M_MAX_UNSIGNED;
+
+    RemoveFromGrid(drawable);
+    if (drawable->gridUpdateQueued_)
+    {
+        gridUpdates_.Remove(drawable);
+        drawable->gridUpdateQueued_ = false;
+    }
+
+    // The drawable may be about to be destroyed, so remove it from the views' sorted batch lists before they are used next
+    removedDrawables_.Insert(drawable);
 }
 
 Material* Renderer2D::GetMaterial(Texture2D* texture, BlendMode blendMode)
@@ -302,6 +389,161 @@ SharedPtr<Material> Renderer2D::CreateMaterial(Texture2D* texture, BlendMode ble
     return newMaterial;
 }
 
+void Renderer2D::QueueGridUpdate(Drawable2D* drawable)
+{
+    Scene* scene = GetScene();
+    if (scene && scene->IsThreadedUpdate())
+    {
+        MutexLock lock(gridUpdateMutex_);
+        if (!drawable->gridUpdateQueued_)
+        {
+            gridUpdates_.Push(drawable);
+            drawable->gridUpdateQueued_ = true;
+        }
+    }
+    else if (!drawable->gridUpdateQueued_)
+    {
+        gridUpdates_.Push(drawable);
+        drawable->gridUpdateQueued_ = true;
+    }
+}
+
+void Renderer2D::UpdateGrid()
+{
+    if (gridUpdates_.Empty())
+        return;
+
+    PROFILE(UpdateGrid2D);
+
+    for (unsigned i = 0; i < gridUpdates_.Size(); ++i)
+    {
+        Drawable2D* drawable = gridUpdates_[i];
+        drawable->gridUpdateQueued_ = false;
+        RemoveFromGrid(drawable);
+        InsertToGrid(drawable);
+    }
+
+    gridUpdates_.Clear();
+}
+
+void Renderer2D::InsertToGrid(Drawable2D* drawable)
+{
+    // Drawables are inserted to the cell containing their center, so their size must not exceed the cell size for the view
+    // query to find them
+    const BoundingBox& box = drawable->GetWorldBoundingBox();
+    Vector3 size = box.Size();
+    if (!box.defined_ || size.x_ > GRID_CELL_SIZE || size.y_ > GRID_CELL_SIZE)
+    {
+        drawable->gridLarge_ = true;
+        drawable->gridIndex_ = largeDrawables_.Size();
+        largeDrawables_.Push(drawable);
+        return;
+    }
+
+    Vector3 center = box.Center();
+    unsigned key = GetGridCellKey(GetGridCellCoordinate(center.x_), GetGridCellCoordinate(center.y_));
+    PODVector<Drawable2D*>& cell = gridCells_[key];
+    drawable->gridLarge_ = false;
+    drawable->gridCell_ = key;
+    drawable->gridIndex_ = cell.Size();
+    cell.Push(drawable);
+}
+
+void Renderer2D::RemoveFromGrid(Drawable2D* drawable)
+{
+    if (drawable->gridIndex_ == M_MAX_UNSIGNED)
+        return;
+
+    PODVector<Drawable2D*>* list = &largeDrawables_;
+    if (!drawable->gridLarge_)
+    {
+        HashMap<unsigned, PODVector<Drawable2D*> >::Iterator i = gridCells_.Find(drawable->gridCell_);
+        if (i == gridCells_.End())
+        {
+            drawable->gridIndex_ = M_MAX_UNSIGNED;
+            return;
+        }
+        list = &i->second_;
+    }
+
+    Drawable2D* last = list->Back();
+    (*list)[drawable->gridIndex_] = last;
+    last->gridIndex_ = drawable->gridIndex_;
+    list->Pop();
+    drawable->gridIndex_ = M_MAX_UNSIGNED;
+}
+
+void Renderer2D::GetVisibilityCandidates()
+{
+    candidates_.Clear();
+    candidates_.Push(largeDrawables_);
+
+    // Expand the view rectangle by half a cell, as the drawables are inserted by their center
+    BoundingBox viewBox = frustum_ ? BoundingBox(*frustum_) : frustumBoundingBox_;
+    int minX = GetGridCellCoordinate(viewBox.min_.x_ - GRID_CELL_SIZE * 0.5f);
+    int maxX = GetGridCellCoordinate(viewBox.max_.x_ + GRID_CELL_SIZE * 0.5f);
+    int minY = GetGridCellCoordinate(viewBox.min_.y_ - GRID_CELL_SIZE * 0.5f);
+    int maxY = GetGridCellCoordinate(viewBox.max_.y_ + GRID_CELL_SIZE * 0.5f);
+
+    // If the view covers more cells than there are occupied, go through the occupied cells instead
+    if ((float)(maxX - minX + 1) * (float)(maxY - minY + 1) > (float)gridCells_.Size())
+    {
+        for (HashMap<unsigned, PODVector<Drawable2D*> >::ConstIterator i = gridCells_.Begin(); i != gridCells_.End(); ++i)
+        {
+            int x = (short)(i->first_ & 0xffff);
+            int y = (short)(i->first_ >> 16);
+            if (x >= minX && x <= maxX && y >= minY && y <= maxY)
+                candidates_.Push(i->second_);
+        }
+    }
+    else
+    {
+        for (int y = minY; y <= maxY; ++y)
+        {
+            for (int x = minX; x <= maxX; ++x)
+            {
+                HashMap<unsigned, PODVector<Drawable2D*> >::ConstIterator i = gridCells_.Find(GetGridCellKey(x, y));
+                if (i != gridCells_.End())
+                    candidates_.Push(i->second_);
+            }
+        }
+    }
+}
+
+void Renderer2D::PurgeRemovedDrawables()
+{
+    if (removedDrawables_.Empty())
+        return;
+
+    for (HashMap<Camera*, ViewBatchInfo2D>::Iterator i = viewBatchInfos_.Begin(); i != viewBatchInfos_.End(); ++i)
+    {
+        PODVector<SourceBatchEntry2D>& entries = i->second_.sortedBatches_;
+        unsigned keep = 0;
+        for (unsigned j = 0; j < entries.Size(); ++j)
+        {
+            if (!removedDrawables_.Contains(entries[j].drawable_))
+                entries[keep++] = entries[j];
+        }
+        entries.Resize(keep);
+    }
+
+    removedDrawables_.Clear();
+}
+
+void CopyVertices2D(const WorkItem* item, unsigned threadIndex)
+{
+    const SourceBatch2D** start = reinterpret_cast<const SourceBatch2D**>(item->start_);
+    const SourceBatch2D** end = reinterpret_cast<const SourceBatch2D**>(item->end_);
+    Vertex2D* dest = reinterpret_cast<Vertex2D*>(item->aux_);
+
+    while (start != end)
+    {
+        const Vector<Vertex2D>& vertices = (*start++)->vertices_;
+        memcpy((void*)dest, &vertices[0], vertices.Size() * sizeof(Vertex2D));
+        dest += vertices.Size();
+    }
+}
+
 void CheckDrawableVisibility(const WorkItem* item, unsigned threadIndex)
 {
     Renderer2D* renderer = reinterpret_cast<Renderer2D*>(item->aux_);
@@ -337,15 +579,20 @@ void Renderer2D::HandleBeginViewUpdate(StringHash eventType, VariantMap& eventDa
         frustum_ = 0;
     }
 
-    // Check visibility
+    PurgeRemovedDrawables();
+    UpdateGrid();
+    GetVisibilityCandidates();
+
+    // Check visibility of the drawables in the grid cells overlapping the view
+    if (candidates_.Size())
     {
         PROFILE(CheckDrawableVisibility);
 
         WorkQueue* queue = GetSubsystem<WorkQueue>();
         int numWorkItems = queue->GetNumThreads() + 1; // Worker threads + main thread
-        int drawablesPerItem = drawables_.Size() / numWorkItems;
+        int drawablesPerItem = candidates_.Size() / numWorkItems;
 
-        PODVector<Drawable2D*>::Iterator start = drawables_.Begin();
+        PODVector<Drawable2D*>::Iterator start = candidates_.Begin();
         for (int i = 0; i < numWorkItems; ++i)
         {
             SharedPtr<WorkItem> item = queue->GetFreeItem();
@@ -353,7 +600,7 @@ void Renderer2D::HandleBeginViewUpdate(StringHash eventType, VariantMap& eventDa
             item->workFunction_ = CheckDrawableVisibility;
             item->aux_ = this;
 
-            PODVector<Drawable2D*>::Iterator end = drawables_.End();
+            PODVector<Drawable2D*>::Iterator end = candidates_.End();
             if (i < numWorkItems - 1 && end - start > drawablesPerItem)
                 end = start + drawablesPerItem;
 
@@ -405,15 +652,23 @@ void Renderer2D::GetDrawables(PODVector<Drawable2D*>& dest, Node* node)
         GetDrawables(dest, i->Get());
 }
 
-static inline bool CompareSourceBatch2Ds(const SourceBatch2D* lhs, const SourceBatch2D* rhs)
+static inline bool CompareSourceBatchEntries(const SourceBatchEntry2D& lhs, const SourceBatchEntry2D& rhs)
 {
-    if (lhs->drawOrder_ != rhs->drawOrder_)
-        return lhs->drawOrder_ < rhs->drawOrder_;
+    if (lhs.sortKey_ != rhs.sortKey_)
+        return lhs.sortKey_ < rhs.sortKey_;
 
-    if (lhs->material_ != rhs->material_)
-        return lhs->material_->GetNameHash() < rhs->material_->GetNameHash();
+    if (lhs.drawable_ != rhs.drawable_)
+        return lhs.drawable_->GetID() < rhs.drawable_->GetID();
 
-    return lhs < rhs;
+    return lhs.batchIndex_ < rhs.batchIndex_;
+}
+
+static inline unsigned long long GetSourceBatchSortKey(const SourceBatch2D& batch)
+{
+    // Flip the sign bit so that negative draw orders sort first as unsigned
+    unsigned drawOrder = (unsigned)batch.drawOrder_ ^ 0x80000000;
+    unsigned materialHash = batch.material_ ? batch.material_->GetNameHash().Value() : 0;
+    return ((unsigned long long)drawOrder << 32) | materialHash;
 }
 
 void Renderer2D::UpdateViewBatchInfo(ViewBatchInfo2D& viewBatchInfo, Camera* camera)
@@ -422,22 +677,98 @@ void Renderer2D::UpdateViewBatchInfo(ViewBatchInfo2D& viewBatchInfo, Camera* cam
     if (viewBatchInfo.batchUpdatedFrameNumber_ == frame_.frameNumber_)
         return;
 
-    PODVector<const SourceBatch2D*>& soruceBatches = viewBatchInfo.sourceBatches_;
-    soruceBatches.Clear();
-    for (unsigned d = 0; d < drawables_.Size(); ++d)
+    PROFILE(SortSourceBatches2D);
+
+    PODVector<SourceBatchEntry2D>& entries = viewBatchInfo.sortedBatches_;
+
+    // Mark the visible drawables. The next stamp value marks visible drawables that were also visible in the previous frame
+    viewStamp_ += 2;
+    unsigned visibleStamp = viewStamp_;
+    unsigned keptStamp = viewStamp_ + 1;
+    for (unsigned d = 0; d < candidates_.Size(); ++d)
+    {
+        if (candidates_[d]->IsInView(camera))
+            candidates_[d]->viewStamp_ = visibleStamp;
+    }
+
+    // Keep the batches that are still visible in their previous order
+    unsigned keep = 0;
+    for (unsigned i = 0; i < entries.Size(); ++i)
+    {
+        Drawable2D* drawable = entries[i].drawable_;
+        if (drawable->viewStamp_ != visibleStamp && drawable->viewStamp_ != keptStamp)
+            continue;
+        if (drawable->viewStamp_ == visibleStamp)
+        {
+            drawable->viewStamp_ = keptStamp;
+            drawable->sortedBatchCount_ = 0;
+        }
+
+        if (entries[i].batchIndex_ < drawable->GetSourceBatches().Size())
+        {
+            entries[keep++] = entries[i];
+            ++drawable->sortedBatchCount_;
+        }
+    }
+    entries.Resize(keep);
+
+    // Append the batches of newly visible drawables, and new batches of the already visible
+    for (unsigned d = 0; d < candidates_.Size(); ++d)
     {
-        if (!drawables_[d]->IsInView(camera))
+        Drawable2D* drawable = candidates_[d];
+        if (drawable->viewStamp_ != visibleStamp && drawable->viewStamp_ != keptStamp)
             continue;
 
-        const Vector<SourceBatch2D>& batches = drawables_[d]->GetSourceBatches();
-        for (unsigned b = 0; b < batches.Size(); ++b)
+        unsigned numBatches = drawable->GetSourceBatches().Size();
+        unsigned start = drawable->viewStamp_ == keptStamp ? drawable->sortedBatchCount_ : 0;
+        for (unsigned b = start; b < numBatches; ++b)
         {
-            if (batches[b].material_ && !batches[b].vertices_.Empty())
-                soruceBatches.Push(&batches[b]);
+            SourceBatchEntry2D entry;
+            entry.drawable_ = drawable;
+            entry.batchIndex_ = b;
+            entries.Push(entry);
         }
+
+        // Clear the stamp so that a drawable in several grid lists is only appended once
+        drawable->viewStamp_ = 0;
+    }
+
+    // Refresh the sort keys, as draw order or material may have changed, and count the batches that are out of order
+    unsigned outOfOrder = 0;
+    for (unsigned i = 0; i < entries.Size(); ++i)
+    {
+        entries[i].sortKey_ = GetSourceBatchSortKey(entries[i].drawable_->GetSourceBatches()[entries[i].batchIndex_]);
+        if (i && CompareSourceBatchEntries(entries[i], entries[i - 1]))
+            ++outOfOrder;
     }
 
-    Sort(soruceBatches.Begin(), soruceBatches.End(), CompareSourceBatch2Ds);
+    // Usually only a few batches have changed or become visible, so the previous order is fixed with an insertion sort.
+    // Fall back to a full sort if there are many changes
+    if (outOfOrder > MAX_INSERTION_SORT_BATCHES)
+        Sort(entries.Begin(), entries.End(), CompareSourceBatchEntries);
+    else if (outOfOrder)
+    {
+        for (unsigned i = 1; i < entries.Size(); ++i)
+        {
+            SourceBatchEntry2D entry = entries[i];
+            unsigned j = i;
+            while (j > 0 && CompareSourceBatchEntries(entry, entries[j - 1]))
+            {
+                entries[j] = entries[j - 1];
+                --j;
+            }
+            entries[j] = entry;
+        }
+    }
+
+    PODVector<const SourceBatch2D*>& soruceBatches = viewBatchInfo.sourceBatches_;
+    soruceBatches.Clear();
+    for (unsigned i = 0; i < entries.Size(); ++i)
+    {
+        const SourceBatch2D& batch = entries[i].drawable_->GetSourceBatches()[entries[i].batchIndex_];
+        if (batch.material_ && !batch.vertices_.Empty())
+            soruceBatches.Push(&batch);
+    }
 
     viewBatchInfo.batchCount_ = 0;
     Material* currMaterial = 0;
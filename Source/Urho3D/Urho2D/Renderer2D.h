@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include "../Container/HashSet.h"
+#include "../Core/Mutex.h"
 #include "../Graphics/Drawable.h"
 
 namespace Urho3D
@@ -35,6 +37,17 @@ class VertexBuffer;
 struct FrameInfo;
 struct SourceBatch2D;
 
+/// Sort entry of a visible source batch.
+struct SourceBatchEntry2D
+{
+    /// Sort key from draw order and material.
+    unsigned long long sortKey_;
+    /// Drawable.
+    Drawable2D* drawable_;
+    /// Source batch index in the drawable.
+    unsigned batchIndex_;
+};
+
 /// 2D view batch info.
 struct ViewBatchInfo2D
 {
@@ -53,6 +66,8 @@ struct ViewBatchInfo2D
     unsigned batchUpdatedFrameNumber_;
     /// Source batches.
     PODVector<const SourceBatch2D*> sourceBatches_;
+    /// Visible source batches in sorted order, kept between frames so that they only need to be re-sorted partially.
+    PODVector<SourceBatchEntry2D> sortedBatches_;
     /// Batch count;
     unsigned batchCount_;
     /// Materials.
@@ -67,6 +82,7 @@ class URHO3D_API Renderer2D : public Drawable
     OBJECT(Renderer2D);
 
     friend void CheckDrawableVisibility(const WorkItem* item, unsigned threadIndex);
+    friend class Drawable2D;
 
 public:
     /// Construct.
@@ -100,6 +116,18 @@ private:
     virtual void OnWorldBoundingBoxUpdate();
     /// Create material by texture and blend mode.
     SharedPtr<Material> CreateMaterial(Texture2D* texture, BlendMode blendMode);
+    /// Queue a drawable to be moved in the spatial grid. May be called from a worker thread.
+    void QueueGridUpdate(Drawable2D* drawable);
+    /// Move the queued drawables in the spatial grid.
+    void UpdateGrid();
+    /// Insert drawable to the spatial grid according to its world bounding box.
+    void InsertToGrid(Drawable2D* drawable);
+    /// Remove drawable from the spatial grid.
+    void RemoveFromGrid(Drawable2D* drawable);
+    /// Collect the drawables in the grid cells overlapping the view as visibility test candidates.
+    void GetVisibilityCandidates();
+    /// Remove the destroyed drawables from the sorted batch lists.
+    void PurgeRemovedDrawables();
     /// Handle view update begin event. Determine Drawable2D's and their batches here.
     void HandleBeginViewUpdate(StringHash eventType, VariantMap& eventData);
     /// Get all drawables in node.
@@ -117,6 +145,20 @@ private:
     SharedPtr<Material> material_;
     /// Drawables.
     PODVector<Drawable2D*> drawables_;
+    /// Spatial grid cells of drawables keyed by cell coordinates.
+    HashMap<unsigned, PODVector<Drawable2D*> > gridCells_;
+    /// Drawables too large or undefined for the spatial grid. Always visibility tested.
+    PODVector<Drawable2D*> largeDrawables_;
+    /// Drawables queued for spatial grid update.
+    PODVector<Drawable2D*> gridUpdates_;
+    /// Spatial grid update queue mutex.
+    Mutex gridUpdateMutex_;
+    /// Visibility test candidates for current view.
+    PODVector<Drawable2D*> candidates_;
+    /// Drawables removed since the sorted batch lists were last purged.
+    HashSet<Drawable2D*> removedDrawables_;
+    /// View stamp for incremental batch sorting.
+    unsigned viewStamp_;
     /// View frame info for current frame.
     FrameInfo frame_;
     /// View batch info.
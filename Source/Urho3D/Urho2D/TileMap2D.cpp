@@ -23,7 +23,10 @@
 #include "../Precompiled.h"
 
 #include "../Core/Context.h"
+#include "../Core/Profiler.h"
+#include "../Core/Timer.h"
 #include "../Graphics/DebugRenderer.h"
+#include "../IO/Log.h"
 #include "../Resource/ResourceCache.h"
 #include "../Scene/Node.h"
 #include "../Scene/Scene.h"
@@ -118,6 +121,9 @@ void TileMap2D::SetTmxFile(TmxFile2D* tmxFile)
     if (!tmxFile_)
         return;
 
+    PROFILE(CreateTileMapLayers);
+
+    HiresTimer createTimer;
     info_ = tmxFile_->GetInfo();
 
     if (!rootNode_)
@@ -142,6 +148,9 @@ void TileMap2D::SetTmxFile(TmxFile2D* tmxFile)
 
         layers_[i] = layer;
     }
+
+    LOGDEBUGF("Tile map %s (%dx%d tiles, %u layers) created in %d ms", tmxFile_->GetName().CString(), info_.width_,
+        info_.height_, numLayers, (int)(createTimer.GetUSec(false) / 1000));
 }
 
 TmxFile2D* TileMap2D::GetTmxFile() const
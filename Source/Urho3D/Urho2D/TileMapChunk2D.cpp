@@ -0,0 +1,241 @@
+//
+// Copyright (c) 2008-2015 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../Precompiled.h"
+
+#include "../Core/Context.h"
+#include "../Core/Profiler.h"
+#include "../Graphics/Material.h"
+#include "../Graphics/Texture2D.h"
+#include "../Scene/Node.h"
+#include "../Urho2D/Renderer2D.h"
+#include "../Urho2D/Sprite2D.h"
+#include "../Urho2D/TileMap2D.h"
+#include "../Urho2D/TileMapChunk2D.h"
+#include "../Urho2D/TileMapLayer2D.h"
+
+#include "../DebugNew.h"
+
+namespace Urho3D
+{
+
+/// Largest draw order offset of a source batch. The low 10 bits of the drawable draw order are free for it.
+static const int MAX_BATCH_ORDER = 1023;
+
+TileMapChunk2D::TileMapChunk2D(Context* context) :
+    Drawable2D(context),
+    tileRect_(IntRect::ZERO),
+    boundingBoxDirty_(true)
+{
+}
+
+TileMapChunk2D::~TileMapChunk2D()
+{
+}
+
+void TileMapChunk2D::RegisterObject(Context* context)
+{
+    context->RegisterFactory<TileMapChunk2D>();
+}
+
+void TileMapChunk2D::SetTiles(TileMapLayer2D* layer, const IntRect& tileRect)
+{
+    layer_ = layer;
+    tileRect_ = tileRect;
+
+    MarkTilesDirty();
+}
+
+void TileMapChunk2D::MarkTilesDirty()
+{
+    sourceBatchesDirty_ = true;
+    boundingBoxDirty_ = true;
+
+    // Also dirties the world bounding box
+    if (node_)
+        OnMarkedDirty(node_);
+}
+
+TileMapLayer2D* TileMapChunk2D::GetLayer() const
+{
+    return layer_;
+}
+
+void TileMapChunk2D::OnWorldBoundingBoxUpdate()
+{
+    if (boundingBoxDirty_)
+    {
+        boundingBox_.Clear();
+
+        TileMap2D* tileMap = layer_ ? layer_->GetTileMap() : 0;
+        if (tileMap)
+        {
+            const TileMapInfo2D& info = tileMap->GetInfo();
+            for (int y = tileRect_.top_; y < tileRect_.bottom_; ++y)
+            {
+                for (int x = tileRect_.left_; x < tileRect_.right_; ++x)
+                {
+                    Tile2D* tile = layer_->GetTile(x, y);
+                    Sprite2D* sprite = tile ? tile->GetSprite() : 0;
+                    Rect drawRect;
+                    if (!sprite || !sprite->GetDrawRectangle(drawRect))
+                        continue;
+
+                    Vector2 position = info.TileIndexToPosition(x, y);
+                    boundingBox_.Merge(Vector3(position.x_ + drawRect.min_.x_, position.y_ + drawRect.min_.y_, 0.0f));
+                    boundingBox_.Merge(Vector3(position.x_ + drawRect.max_.x_, position.y_ + drawRect.max_.y_, 0.0f));
+                }
+            }
+        }
+
+        boundingBoxDirty_ = false;
+    }
+
+    worldBoundingBox_ = boundingBox_.Transformed(node_->GetWorldTransform());
+}
+
+void TileMapChunk2D::OnDrawOrderChanged()
+{
+    for (unsigned i = 0; i < sourceBatches_.Size(); ++i)
+        sourceBatches_[i].drawOrder_ = GetBatchDrawOrder(i);
+}
+
+void TileMapChunk2D::UpdateSourceBatches()
+{
+    if (!sourceBatchesDirty_)
+        return;
+
+    PROFILE(UpdateTileMapChunk);
+
+    unsigned numBatches = 0;
+    for (unsigned i = 0; i < sourceBatches_.Size(); ++i)
+        sourceBatches_[i].vertices_.Clear();
+
+    TileMap2D* tileMap = layer_ ? layer_->GetTileMap() : 0;
+    if (!tileMap || !renderer_)
+    {
+        sourceBatches_.Clear();
+        return;
+    }
+
+    const TileMapInfo2D& info = tileMap->GetInfo();
+    const Matrix3x4& worldTransform = node_->GetWorldTransform();
+    bool keepTileOrder = IsTileOrderKept();
+    unsigned color = Color::WHITE.ToUInt();
+    Material* lastMaterial = 0;
+    Vector<Vertex2D>* vertices = 0;
+
+    /*
+    V1---------V2
+    |         / |
+    |       /   |
+    |     /     |
+    |   /       |
+    | /         |
+    V0---------V3
+    */
+    Vertex2D vertex0;
+    Vertex2D vertex1;
+    Vertex2D vertex2;
+    Vertex2D vertex3;
+    vertex0.color_ = vertex1.color_ = vertex2.color_ = vertex3.color_ = color;
+
+    // Emit the tiles in the same row-major order as separate tile sprites would be drawn in. Tiles from different tilesets go
+    // to separate batches. Renderer2D sorts batches of the same draw order by material, so when tiles may overlap, start a new
+    // batch on every material change and give the batches increasing draw orders. Otherwise share one batch per material
+    for (int y = tileRect_.top_; y < tileRect_.bottom_; ++y)
+    {
+        for (int x = tileRect_.left_; x < tileRect_.right_; ++x)
+        {
+            Tile2D* tile = layer_->GetTile(x, y);
+            Sprite2D* sprite = tile ? tile->GetSprite() : 0;
+            if (!sprite)
+                continue;
+
+            Rect drawRect;
+            Rect textureRect;
+            if (!sprite->GetDrawRectangle(drawRect) || !sprite->GetTextureRectangle(textureRect))
+                continue;
+
+            Material* material = renderer_->GetMaterial(sprite->GetTexture(), BLEND_ALPHA);
+            if (material != lastMaterial)
+            {
+                unsigned index = 0;
+                if (keepTileOrder)
+                    index = numBatches;
+                else
+                {
+                    while (index < numBatches && sourceBatches_[index].material_ != material)
+                        ++index;
+                }
+
+                if (index == numBatches)
+                {
+                    if (sourceBatches_.Size() <= numBatches)
+                        sourceBatches_.Resize(numBatches + 1);
+                    sourceBatches_[index].material_ = material;
+                    sourceBatches_[index].drawOrder_ = GetBatchDrawOrder(index);
+                    ++numBatches;
+                }
+
+                lastMaterial = material;
+                vertices = &sourceBatches_[index].vertices_;
+            }
+
+            Vector2 position = info.TileIndexToPosition(x, y);
+            drawRect.min_ += position;
+            drawRect.max_ += position;
+
+            vertex0.position_ = worldTransform * Vector3(drawRect.min_.x_, drawRect.min_.y_, 0.0f);
+            vertex1.position_ = worldTransform * Vector3(drawRect.min_.x_, drawRect.max_.y_, 0.0f);
+            vertex2.position_ = worldTransform * Vector3(drawRect.max_.x_, drawRect.max_.y_, 0.0f);
+            vertex3.position_ = worldTransform * Vector3(drawRect.max_.x_, drawRect.min_.y_, 0.0f);
+
+            vertex0.uv_ = textureRect.min_;
+            vertex1.uv_ = Vector2(textureRect.min_.x_, textureRect.max_.y_);
+            vertex2.uv_ = textureRect.max_;
+            vertex3.uv_ = Vector2(textureRect.max_.x_, textureRect.min_.y_);
+
+            vertices->Push(vertex0);
+            vertices->Push(vertex1);
+            vertices->Push(vertex2);
+            vertices->Push(vertex3);
+        }
+    }
+
+    sourceBatches_.Resize(numBatches);
+    sourceBatchesDirty_ = false;
+}
+
+bool TileMapChunk2D::IsTileOrderKept() const
+{
+    TileMap2D* tileMap = layer_ ? layer_->GetTileMap() : 0;
+    return tileMap && tileMap->GetInfo().orientation_ != O_ORTHOGONAL;
+}
+
+int TileMapChunk2D::GetBatchDrawOrder(unsigned index) const
+{
+    // A chunk has at most 32x32 tiles, so the offset only saturates on extremely wide non-orthogonal maps
+    return IsTileOrderKept() ? GetDrawOrder() + Min((int)index, MAX_BATCH_ORDER) : GetDrawOrder();
+}
+
+}
@@ -0,0 +1,79 @@
+//
+// Copyright (c) 2008-2015 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "../Urho2D/Drawable2D.h"
+
+namespace Urho3D
+{
+
+class TileMapLayer2D;
+
+/// Drawable for a rectangular block of tiles in a tile map layer. The vertices of all the tiles are built at once and only
+/// rebuilt when the tiles or the node transform change.
+class URHO3D_API TileMapChunk2D : public Drawable2D
+{
+    OBJECT(TileMapChunk2D);
+
+public:
+    /// Construct.
+    TileMapChunk2D(Context* context);
+    /// Destruct.
+    ~TileMapChunk2D();
+    /// Register object factory. Drawable2D must be registered first.
+    static void RegisterObject(Context* context);
+
+    /// Set the layer to draw tiles from and the tile index rectangle (right and bottom exclusive).
+    void SetTiles(TileMapLayer2D* layer, const IntRect& tileRect);
+    /// Mark the tiles changed, causing the vertices to be rebuilt.
+    void MarkTilesDirty();
+
+    /// Return layer.
+    TileMapLayer2D* GetLayer() const;
+
+    /// Return tile index rectangle.
+    const IntRect& GetTileRect() const { return tileRect_; }
+
+protected:
+    /// Recalculate the world-space bounding box.
+    virtual void OnWorldBoundingBoxUpdate();
+    /// Handle draw order changed.
+    virtual void OnDrawOrderChanged();
+    /// Update source batches.
+    virtual void UpdateSourceBatches();
+
+private:
+    /// Return whether tiles may overlap, so that the batches must keep the row-major tile order.
+    bool IsTileOrderKept() const;
+    /// Return draw order of a source batch.
+    int GetBatchDrawOrder(unsigned index) const;
+
+    /// Layer.
+    WeakPtr<TileMapLayer2D> layer_;
+    /// Tile index rectangle.
+    IntRect tileRect_;
+    /// Local-space bounding box dirty flag.
+    bool boundingBoxDirty_;
+};
+
+}
@@ -28,6 +28,7 @@
 #include "../Scene/Node.h"
 #include "../Urho2D/StaticSprite2D.h"
 #include "../Urho2D/TileMap2D.h"
+#include "../Urho2D/TileMapChunk2D.h"
 #include "../Urho2D/TileMapLayer2D.h"
 #include "../Urho2D/TmxFile2D.h"
 
@@ -36,11 +37,19 @@
 namespace Urho3D
 {
 
+/// Number of tiles drawn by one chunk.
+static const int TILES_PER_CHUNK = 32 * 32;
+
 TileMapLayer2D::TileMapLayer2D(Context* context) :
     Component(context),
     tmxLayer_(0),
+    tileLayer_(0),
+    objectGroup_(0),
+    imageLayer_(0),
     drawOrder_(0),
-    visible_(true)
+    visible_(true),
+    chunkSize_(IntVector2::ZERO),
+    numChunksX_(0)
 {
 }
 
@@ -128,6 +137,7 @@ void TileMapLayer2D::Initialize(TileMap2D* tileMap, const TmxLayer2D* tmxLayer)
         nodes_.Clear();
     }
 
+    tiles_.Clear();
     tileLayer_ = 0;
     objectGroup_ = 0;
     imageLayer_ = 0;
@@ -171,9 +181,9 @@ void TileMapLayer2D::SetDrawOrder(int drawOrder)
         if (!nodes_[i])
             continue;
 
-        StaticSprite2D* staticSprite = nodes_[i]->GetComponent<StaticSprite2D>();
-        if (staticSprite)
-            staticSprite->SetLayer(drawOrder_);
+        Drawable2D* drawable = nodes_[i]->GetDerivedComponent<Drawable2D>();
+        if (drawable)
+            drawable->SetLayer(drawOrder_);
     }
 }
 
@@ -226,23 +236,37 @@ int TileMapLayer2D::GetHeight() const
     return tmxLayer_ ? tmxLayer_->GetHeight() : 0;
 }
 
-Tile2D* TileMapLayer2D::GetTile(int x, int y) const
+void TileMapLayer2D::SetTile(int x, int y, Tile2D* tile)
 {
-    if (!tileLayer_)
-        return 0;
+    if (!tileLayer_ || x < 0 || x >= tileLayer_->GetWidth() || y < 0 || y >= tileLayer_->GetHeight())
+        return;
 
-    return tileLayer_->GetTile(x, y);
+    SharedPtr<Tile2D>& dest = tiles_[y * tileLayer_->GetWidth() + x];
+    if (dest == tile)
+        return;
+
+    dest = tile;
+
+    TileMapChunk2D* chunk = GetTileChunk(x, y);
+    if (chunk)
+        chunk->MarkTilesDirty();
 }
 
-Node* TileMapLayer2D::GetTileNode(int x, int y) const
+Tile2D* TileMapLayer2D::GetTile(int x, int y) const
 {
-    if (!tileLayer_)
+    if (!tileLayer_ || x < 0 || x >= tileLayer_->GetWidth() || y < 0 || y >= tileLayer_->GetHeight())
         return 0;
 
-    if (x < 0 || x >= tileLayer_->GetWidth() || y < 0 || y >= tileLayer_->GetHeight())
+    return tiles_[y * tileLayer_->GetWidth() + x];
+}
+
+TileMapChunk2D* TileMapLayer2D::GetTileChunk(int x, int y) const
+{
+    if (!tileLayer_ || x < 0 || x >= tileLayer_->GetWidth() || y < 0 || y >= tileLayer_->GetHeight())
         return 0;
 
-    return nodes_[y * tileLayer_->GetWidth() + x];
+    unsigned index = (unsigned)((y / chunkSize_.y_) * numChunksX_ + x / chunkSize_.x_);
+    return index < nodes_.Size() && nodes_[index] ? nodes_[index]->GetComponent<TileMapChunk2D>() : 0;
 }
 
 unsigned TileMapLayer2D::GetNumObjects() const
@@ -289,27 +313,47 @@ void TileMapLayer2D::SetTileLayer(const TmxTileLayer2D* tileLayer)
 
     int width = tileLayer->GetWidth();
     int height = tileLayer->GetHeight();
-    nodes_.Resize((unsigned)(width * height));
+    if (width <= 0 || height <= 0)
+        return;
 
-    const TileMapInfo2D& info = tileMap_->GetInfo();
+    tiles_.Resize((unsigned)(width * height));
     for (int y = 0; y < height; ++y)
     {
         for (int x = 0; x < width; ++x)
+            tiles_[y * width + x] = tileLayer->GetTile(x, y);
+    }
+
+    // Draw the tiles in chunks instead of a node and sprite per tile, so that visibility testing, sorting and vertex updates
+    // happen per chunk. Tiles of an orthogonal map do not overlap, so square chunks can be used. On other orientations tiles
+    // may overlap their neighbors, so use chunks of whole rows to keep the row-major draw order
+    if (tileMap_->GetInfo().orientation_ == O_ORTHOGONAL)
+    {
+        int side = (int)sqrtf((float)TILES_PER_CHUNK);
+        chunkSize_ = IntVector2(side, side);
+    }
+    else
+        chunkSize_ = IntVector2(width, Max(TILES_PER_CHUNK / width, 1));
+
+    numChunksX_ = (width + chunkSize_.x_ - 1) / chunkSize_.x_;
+    int numChunksY = (height + chunkSize_.y_ - 1) / chunkSize_.y_;
+    nodes_.Resize((unsigned)(numChunksX_ * numChunksY));
+
+    for (int y = 0; y < numChunksY; ++y)
+    {
+        for (int x = 0; x < numChunksX_; ++x)
         {
-            const Tile2D* tile = tileLayer->GetTile(x, y);
-            if (!tile)
-                continue;
+            IntRect tileRect(x * chunkSize_.x_, y * chunkSize_.y_, Min((x + 1) * chunkSize_.x_, width),
+                Min((y + 1) * chunkSize_.y_, height));
 
-            SharedPtr<Node> tileNode(GetNode()->CreateChild("Tile"));
-            tileNode->SetTemporary(true);
-            tileNode->SetPosition(info.TileIndexToPosition(x, y));
+            SharedPtr<Node> chunkNode(GetNode()->CreateChild("Chunk"));
+            chunkNode->SetTemporary(true);
 
-            StaticSprite2D* staticSprite = tileNode->CreateComponent<StaticSprite2D>();
-            staticSprite->SetSprite(tile->GetSprite());
-            staticSprite->SetLayer(drawOrder_);
-            staticSprite->SetOrderInLayer(y * width + x);
+            TileMapChunk2D* chunk = chunkNode->CreateComponent<TileMapChunk2D>();
+            chunk->SetTiles(this, tileRect);
+            chunk->SetLayer(drawOrder_);
+            chunk->SetOrderInLayer(y * numChunksX_ + x);
 
-            nodes_[y * width + x] = tileNode;
+            nodes_[y * numChunksX_ + x] = chunkNode;
         }
     }
 }
@@ -31,6 +31,7 @@ namespace Urho3D
 class DebugRenderer;
 class Node;
 class TileMap2D;
+class TileMapChunk2D;
 class TmxImageLayer2D;
 class TmxLayer2D;
 class TmxObjectGroup2D;
@@ -82,10 +83,12 @@ public:
     int GetWidth() const;
     /// Return height (for tile layer only).
     int GetHeight() const;
-    /// Return tile node (for tile layer only).
-    Node* GetTileNode(int x, int y) const;
+    /// Set tile, or null to clear it (for tile layer only). Only the chunk containing the tile is rebuilt.
+    void SetTile(int x, int y, Tile2D* tile);
     /// Return tile (for tile layer only).
     Tile2D* GetTile(int x, int y) const;
+    /// Return the chunk drawing a tile (for tile layer only).
+    TileMapChunk2D* GetTileChunk(int x, int y) const;
 
     /// Return number of tile map objects (for object group only).
     unsigned GetNumObjects() const;
@@ -119,7 +122,13 @@ private:
     int drawOrder_;
     /// Visible.
     bool visible_;
-    /// Tile node or image nodes.
+    /// Tiles (for tile layer only). Initially shared with the tmx layer.
+    Vector<SharedPtr<Tile2D> > tiles_;
+    /// Chunk size in tiles (for tile layer only).
+    IntVector2 chunkSize_;
+    /// Number of chunks horizontally (for tile layer only).
+    int numChunksX_;
+    /// Chunk nodes, object nodes or image node.
     Vector<SharedPtr<Node> > nodes_;
 };
 
@@ -0,0 +1,75 @@
+-- Lua binding benchmark.
+-- Calls math value type operations and hot scene node functions through the Lua bindings a fixed number of times, and
+-- logs the calls per second of each. Exits when done. Runs without graphics, for example:
+--     Urho3DPlayer LuaScripts/Benchmarks/MathBindings.lua -headless
+-- Run it on builds with and without a binding change to compare them.
+
+local NUM_CALLS = 1000000
+
+function Start()
+    local scene = Scene()
+    local node = scene:CreateChild("Node", LOCAL)
+    local v = Vector3(1.0, 2.0, 3.0)
+    local q = Quaternion(10.0, 20.0, 30.0)
+    local delta = Vector3(0.0, 0.0, 0.001)
+
+    RunCalls("Vector3 constructor", function()
+        for i = 1, NUM_CALLS do
+            local result = Vector3(1.0, 2.0, 3.0)
+        end
+    end)
+
+    RunCalls("Vector3 * float", function()
+        for i = 1, NUM_CALLS do
+            local result = v * 2.0
+        end
+    end)
+
+    RunCalls("Quaternion * Vector3", function()
+        for i = 1, NUM_CALLS do
+            local result = q * v
+        end
+    end)
+
+    RunCalls("Node:GetWorldPosition()", function()
+        for i = 1, NUM_CALLS do
+            local result = node:GetWorldPosition()
+        end
+    end)
+
+    RunCalls("node.worldPosition", function()
+        for i = 1, NUM_CALLS do
+            local result = node.worldPosition
+        end
+    end)
+
+    RunCalls("Node:SetPosition()", function()
+        for i = 1, NUM_CALLS do
+            node:SetPosition(v)
+        end
+    end)
+
+    RunCalls("Node:Translate()", function()
+        for i = 1, NUM_CALLS do
+            node:Translate(delta)
+        end
+    end)
+
+    engine:Exit()
+end
+
+function RunCalls(name, calls)
+    -- Collect garbage from the previous run, so that it is not included in the timing
+    collectgarbage()
+
+    local startTime = os.clock()
+    calls()
+    local elapsed = os.clock() - startTime
+
+    local callsPerSec = 0
+    if elapsed > 0 then
+        callsPerSec = math.floor(NUM_CALLS / elapsed)
+    end
+    log:Write(LOG_INFO, string.format("%s: %d calls in %d ms, %d calls per second", name, NUM_CALLS, math.floor(elapsed * 1000),
+        callsPerSec))
+end
@@ -0,0 +1,58 @@
+// Font face loading benchmark.
+// Rasterizes the FreeType fonts of the engine at a range of point sizes, first to separate textures, then to the shared
+// glyph atlas, then through the glyph cache both empty and filled. Logs the time taken by each pass and exits. Font
+// textures need graphics, so this can not be run with the -headless option, for example:
+//     Urho3DPlayer Scripts/Benchmarks/FontLoad.as -w
+
+const int MIN_POINT_SIZE = 8;
+const int MAX_POINT_SIZE = 48;
+
+Array<String> fontNames = { "Fonts/Anonymous Pro.ttf", "Fonts/BlueHighway.ttf" };
+Text@ text;
+
+void Start()
+{
+    // The text element is not shown; setting its font is enough to rasterize the face
+    text = Text();
+    text.text = "The quick brown fox jumps over the lazy dog";
+
+    String cacheDir = fileSystem.GetAppPreferencesDir("urho3d", "benchmarks") + "FontCache/";
+    fileSystem.CreateDir(cacheDir);
+    Array<String>@ cachedFiles = fileSystem.ScanDir(cacheDir, "*.glyphs", SCAN_FILES, false);
+    for (uint i = 0; i < cachedFiles.length; ++i)
+        fileSystem.Delete(cacheDir + cachedFiles[i]);
+
+    ui.useSharedFontAtlas = false;
+    ui.fontCacheDir = "";
+    LoadFaces("Separate textures");
+
+    ui.useSharedFontAtlas = true;
+    LoadFaces("Shared atlas");
+
+    ui.useSharedFontAtlas = false;
+    ui.fontCacheDir = cacheDir;
+    LoadFaces("Glyph cache empty");
+    LoadFaces("Glyph cache filled");
+
+    engine.Exit();
+}
+
+void LoadFaces(const String&in pass)
+{
+    Timer timer;
+    int numFaces = 0;
+
+    for (uint i = 0; i < fontNames.length; ++i)
+    {
+        // Reload the font so that none of its faces are still in memory from the previous pass
+        cache.ReleaseResource("Font", fontNames[i], true);
+        Font@ font = cache.GetResource("Font", fontNames[i]);
+        for (int size = MIN_POINT_SIZE; size <= MAX_POINT_SIZE; size += 2)
+        {
+            text.SetFont(font, size);
+            ++numFaces;
+        }
+    }
+
+    log.Info(pass + ": loaded " + numFaces + " font faces in " + timer.GetMSec(false) + " ms");
+}
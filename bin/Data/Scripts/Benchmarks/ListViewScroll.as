@@ -0,0 +1,58 @@
+// Virtual ListView benchmark.
+// Scrolls a virtual mode ListView through one million items, first row by row and then page by page, and extends the
+// selection over all items. Logs the time taken by each step and exits. Runs without graphics, for example:
+//     Urho3DPlayer Scripts/Benchmarks/ListViewScroll.as -headless
+
+const uint NUM_ITEMS = 1000000;
+const int ITEM_HEIGHT = 16;
+const int VIEW_HEIGHT = 480;
+
+uint numItemUpdates = 0;
+
+void Start()
+{
+    ListView@ list = ListView();
+    list.SetSize(320, VIEW_HEIGHT);
+    list.multiselect = true;
+    list.virtualMode = true;
+    list.virtualItemHeight = ITEM_HEIGHT;
+    list.virtualItemCount = NUM_ITEMS;
+    ui.root.AddChild(list);
+
+    SubscribeToEvent(list, "VirtualItemUpdate", "HandleVirtualItemUpdate");
+
+    int maxY = int(NUM_ITEMS) * ITEM_HEIGHT - VIEW_HEIGHT;
+    Timer timer;
+
+    // Scroll one row at a time, which rebinds one recycled element per step
+    numItemUpdates = 0;
+    timer.Reset();
+    for (int y = 0; y <= maxY; y += ITEM_HEIGHT)
+        list.viewPosition = IntVector2(0, y);
+    LogResult("Scrolled " + NUM_ITEMS + " rows one at a time", timer.GetMSec(false));
+
+    // Scroll one page at a time, which rebinds all visible elements per step
+    numItemUpdates = 0;
+    timer.Reset();
+    for (int y = maxY; y >= 0; y -= VIEW_HEIGHT)
+        list.viewPosition = IntVector2(0, y);
+    LogResult("Scrolled " + NUM_ITEMS + " rows one page at a time", timer.GetMSec(false));
+
+    // Extend the selection from the first item to the last, as with shift + end
+    timer.Reset();
+    list.selection = 0;
+    list.ChangeSelection(int(NUM_ITEMS), true);
+    log.Info("Selected " + list.selections.length + " items in " + timer.GetMSec(false) + " ms");
+
+    engine.Exit();
+}
+
+void LogResult(const String&in action, uint msec)
+{
+    log.Info(action + " in " + msec + " ms, " + numItemUpdates + " item updates");
+}
+
+void HandleVirtualItemUpdate(StringHash eventType, VariantMap& eventData)
+{
+    ++numItemUpdates;
+}
@@ -0,0 +1,59 @@
+// Script object update benchmark.
+// Creates ten thousand script objects that rotate their scene nodes, updates the scene a fixed number of times and logs the
+// time taken and the number of Update() calls per second, first with serial and then with parallel update. Exits when
+// done. Runs without graphics, for example:
+//     Urho3DPlayer Scripts/Benchmarks/ScriptUpdate.as -headless
+// The parallel update uses one worker thread less than there are physical CPU cores, or none with the -nothreads option.
+
+const uint NUM_OBJECTS = 10000;
+const uint NUM_UPDATES = 100;
+const float TIME_STEP = 1.0f / 60.0f;
+
+Scene@ benchmarkScene;
+Array<ScriptInstance@> instances;
+
+void Start()
+{
+    // The scene is updated directly below instead of from the engine's frame update
+    benchmarkScene = Scene();
+    benchmarkScene.updateEnabled = false;
+
+    for (uint i = 0; i < NUM_OBJECTS; ++i)
+    {
+        Node@ node = benchmarkScene.CreateChild("Rotator", LOCAL);
+        ScriptInstance@ instance = node.CreateComponent("ScriptInstance", LOCAL);
+        instance.CreateObject(scriptFile, "Rotator");
+        instances.Push(instance);
+    }
+
+    // Update once before measuring, so that the first update's method lookups are not included
+    benchmarkScene.Update(TIME_STEP);
+    RunUpdates("Serial update");
+
+    for (uint i = 0; i < instances.length; ++i)
+        instances[i].parallelUpdate = true;
+    benchmarkScene.Update(TIME_STEP);
+    RunUpdates("Parallel update");
+
+    engine.Exit();
+}
+
+void RunUpdates(const String&in pass)
+{
+    Timer timer;
+    for (uint i = 0; i < NUM_UPDATES; ++i)
+        benchmarkScene.Update(TIME_STEP);
+    uint msec = timer.GetMSec(false);
+
+    uint callsPerSec = msec > 0 ? NUM_OBJECTS * NUM_UPDATES * 1000 / msec : 0;
+    log.Info(pass + ": " + NUM_UPDATES + " updates of " + NUM_OBJECTS + " script objects in " + msec + " ms, " +
+        callsPerSec + " calls per second");
+}
+
+class Rotator : ScriptObject
+{
+    void Update(float timeStep)
+    {
+        node.Rotate(Quaternion(10.0f * timeStep, 20.0f * timeStep, 30.0f * timeStep));
+    }
+}